@@ -2,10 +2,11 @@
 #include <math.h>
 #include <glib.h>
 #include <gtk/gtk.h>
-#include <gdk-pixbuf/gdk-pixbuf.h>
 #include <epoxy/gl.h>
 #include <shader_make.h>
 #include <glmath.h>
+#include <mesh_weld.h>
+#include <texture_cache.h>
 
 typedef struct {
 	vec3 position;
@@ -56,6 +57,10 @@ static vertex vertices[] = {
 	{{-0.5f, +0.5f, -0.5f}, {1.0f, 0.0f}}
 };
 
+static vertex welded[G_N_ELEMENTS(vertices)];
+static GLuint indices[G_N_ELEMENTS(vertices)];
+static GLsizei welded_count;
+
 static const vec3 cubePositions[] = {
 	{0.0f, 0.0f, 0.0f},
 	{2.0f, 5.0f, -15.0f},
@@ -71,6 +76,7 @@ static const vec3 cubePositions[] = {
 
 static GLuint vao;
 static GLuint vbo;
+static GLuint ebo;
 static GLuint program;
 
 static GLuint texture[2];
@@ -93,32 +99,12 @@ static void realize(GtkGLArea *area, gpointer user_data)
 
 	program = shader_make();
 
-	glGenTextures(2, texture);
-
 	for (unsigned int i = 0; i < G_N_ELEMENTS(filename); ++i) {
-		glBindTexture(GL_TEXTURE_2D, texture[i]);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-		GError *error = NULL;
-		GdkPixbuf *pixbuf = gdk_pixbuf_new_from_file(filename[i], &error);
-
-		if (pixbuf == NULL) {
-			g_error("Error loading file: #%d %s\n", error->code, error->message);
-			g_error_free(error);
-		}
-		const GLint width = gdk_pixbuf_get_width(pixbuf);
-		const GLint height = gdk_pixbuf_get_height(pixbuf);
-		const GLint format = gdk_pixbuf_get_has_alpha(pixbuf) ? GL_RGBA : GL_RGB;
-		const guint8 *bytes = gdk_pixbuf_read_pixels(pixbuf);
-
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, format, GL_UNSIGNED_BYTE, bytes);
-		glGenerateMipmap(GL_TEXTURE_2D);
-		g_object_unref(G_OBJECT(pixbuf));
+		texture[i] = texture_cache_acquire_async(filename[i], &TEXTURE_SAMPLER_DEFAULT, texture_cache_ready_queue_render, area);
 	}
 
+	welded_count = mesh_weld(vertices, G_N_ELEMENTS(vertices), sizeof (vertex), MESH_WELD_EPSILON, welded, indices);
+
 	{
 		GLint index;
 
@@ -127,7 +113,11 @@ static void realize(GtkGLArea *area, gpointer user_data)
 
 		glGenBuffers(1, &vbo);
 		glBindBuffer(GL_ARRAY_BUFFER, vbo);
-		glBufferData(GL_ARRAY_BUFFER, sizeof vertices, vertices, GL_STATIC_DRAW);
+		glBufferData(GL_ARRAY_BUFFER, welded_count * sizeof (vertex), welded, GL_STATIC_DRAW);
+
+		glGenBuffers(1, &ebo);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof indices, indices, GL_STATIC_DRAW);
 
 		index = glGetAttribLocation(program, "position");
 		glVertexAttribPointer(index, 3, GL_FLOAT, GL_FALSE, sizeof (vertex), (const GLvoid *) offsetof(vertex, position));
@@ -158,9 +148,12 @@ static void unrealize(GtkGLArea *area, gpointer user_data)
 		return;
 	}
 
-	glDeleteTextures(2, texture);
+	for (guint i = 0; i < G_N_ELEMENTS(texture); i++) {
+		texture_cache_release(texture[i]);
+	}
 	glDeleteVertexArrays(1, &vao);
 	glDeleteBuffers(1, &vbo);
+	glDeleteBuffers(1, &ebo);
 	glDeleteProgram(program);
 }
 
@@ -175,6 +168,8 @@ static gboolean render(GtkGLArea *area, GdkGLContext *context, gpointer user_dat
 	const GLint height = gtk_widget_get_allocated_height(GTK_WIDGET(area));
 	const mat4 projection = mat4_perspective(radians(45.), ((GLfloat) width) / ((GLfloat) height), 1., 100.);
 
+	texture_cache_upload_queue_render(area);
+
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 	glUseProgram(program);
@@ -192,7 +187,7 @@ static gboolean render(GtkGLArea *area, GdkGLContext *context, gpointer user_dat
 		const mat4 model = mat4_mul(mat4_translation(cubePositions[i]), mat4_rotation(radians(20.f * i), (vec3) { 1.0f, 0.3f, 0.5f }));
 
 		glUniformMatrix4fv(glGetUniformLocation(program, "model"), 1, GL_FALSE, (const GLfloat *) &model);
-		glDrawArrays(GL_TRIANGLES, 0, G_N_ELEMENTS(vertices));
+		glDrawElements(GL_TRIANGLES, G_N_ELEMENTS(indices), GL_UNSIGNED_INT, NULL);
 	}
 
 	glBindVertexArray(0);
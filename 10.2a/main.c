@@ -0,0 +1,208 @@
+#include <stddef.h>
+#include <math.h>
+#include <glib.h>
+#include <gtk/gtk.h>
+#include <epoxy/gl.h>
+#include <shader_make.h>
+#include <glmath.h>
+#include <mesh.h>
+#include <mesh_lod.h>
+#include <shapes.h>
+
+#define GRID 24
+#define SPACING 3.0f
+
+static GLuint vao;
+static GLuint vbo;
+static GLuint ebo;
+static GLuint program;
+
+static mesh_lod_t lods[MESH_LOD_MAX];
+/* level each sphere was drawn with last frame, for the hysteresis */
+static GLuint lod[GRID * GRID];
+
+static gint levels = MESH_LOD_MAX;
+static gdouble threshold = MESH_LOD_THRESHOLD;
+
+static const GOptionEntry entries[] = {
+	{ "levels", 'l', 0, G_OPTION_ARG_INT, &levels, "Icosphere subdivision levels, 1 to 8", "N" },
+	{ "threshold", 't', 0, G_OPTION_ARG_DOUBLE, &threshold, "Projected error in pixels before a finer level is drawn", "PIXELS" },
+	G_OPTION_ENTRY_NULL
+};
+
+/* spheres are tinted by level so the switching distances are visible */
+static const vec3 colors[MESH_LOD_MAX] = {
+	{1.0f, 1.0f, 1.0f},
+	{1.0f, 0.3f, 0.3f},
+	{1.0f, 0.6f, 0.2f},
+	{1.0f, 1.0f, 0.3f},
+	{0.3f, 1.0f, 0.3f},
+	{0.3f, 1.0f, 1.0f},
+	{0.3f, 0.3f, 1.0f},
+	{1.0f, 0.3f, 1.0f}
+};
+
+GTimer *timer;
+static gdouble report;
+
+static void realize(GtkGLArea *area, gpointer user_data)
+{
+	gtk_gl_area_make_current(area);
+	if (gtk_gl_area_get_error(area) != NULL) {
+		return;
+	}
+
+	glClearColor(0.2, 0.3, 0.3, 1.0);
+	glEnable(GL_DEPTH_TEST);
+	glEnable(GL_CULL_FACE);
+
+	program = shader_make();
+
+	levels = CLAMP(levels, 1, MESH_LOD_MAX);
+	for (guint i = 0; i < G_N_ELEMENTS(lod); ++i) {
+		lod[i] = levels - 1;
+	}
+
+	{
+		mesh_t *mesh = shape_icosphere(levels, lods);
+		GLint index;
+
+		glGenVertexArrays(1, &vao);
+		glBindVertexArray(vao);
+
+		glGenBuffers(1, &vbo);
+		glBindBuffer(GL_ARRAY_BUFFER, vbo);
+		glBufferData(GL_ARRAY_BUFFER, mesh->vertex_count * sizeof (vertex_t), mesh->vertices, GL_STATIC_DRAW);
+
+		glGenBuffers(1, &ebo);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh->index_count * sizeof (GLuint), mesh->indices, GL_STATIC_DRAW);
+
+		index = glGetAttribLocation(program, "position");
+		glVertexAttribPointer(index, 3, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (const GLvoid *) offsetof(vertex_t, position));
+		glEnableVertexAttribArray(index);
+		index = glGetAttribLocation(program, "normal");
+		glVertexAttribPointer(index, 3, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (const GLvoid *) offsetof(vertex_t, normal));
+		glEnableVertexAttribArray(index);
+
+		glBindVertexArray(0);
+		mesh_free(mesh);
+	}
+
+	glUseProgram(program);
+
+	glUniform3fv(glGetUniformLocation(program, "lightDir"), 1, (const GLfloat *) &(vec3) { -0.36f, -0.80f, -0.48f });
+
+	glUseProgram(0);
+
+	timer = g_timer_new();
+	report = 1.0;
+}
+
+static void unrealize(GtkGLArea *area, gpointer user_data)
+{
+	g_timer_destroy(timer);
+
+	gtk_gl_area_make_current(area);
+	if (gtk_gl_area_get_error(area) != NULL) {
+		return;
+	}
+
+	glDeleteVertexArrays(1, &vao);
+	glDeleteBuffers(1, &vbo);
+	glDeleteBuffers(1, &ebo);
+	glDeleteProgram(program);
+}
+
+static gboolean render(GtkGLArea *area, GdkGLContext *context, gpointer user_data)
+{
+	const gdouble time = g_timer_elapsed(timer, NULL);
+	/* fly into the field of spheres and back out again */
+	const vec3 eye = { 0.0f, 2.0f, 10.0f - 0.5f * GRID * SPACING * (1.0f - cos(time * 0.25)) };
+	const mat4 view = mat4_look_at(eye, vec3_add(eye, (vec3) { 0.0f, -0.1f, -1.0f }), (vec3) { 0.0, 1.0, 0.0 });
+
+	const GLint width = gtk_widget_get_allocated_width(GTK_WIDGET(area));
+	const GLint height = gtk_widget_get_allocated_height(GTK_WIDGET(area));
+	const GLfloat fovy = radians(45.);
+	const mat4 projection = mat4_perspective(fovy, ((GLfloat) width) / ((GLfloat) height), 0.1, 200.);
+	const GLfloat scale = mesh_lod_scale(fovy, height);
+	guint triangles = 0;
+	guint histogram[MESH_LOD_MAX] = { 0 };
+
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	glUseProgram(program);
+
+	glUniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE, (const GLfloat *) &view);
+	glUniformMatrix4fv(glGetUniformLocation(program, "projection"), 1, GL_FALSE, (const GLfloat *) &projection);
+
+	glBindVertexArray(vao);
+
+	for (guint i = 0; i < G_N_ELEMENTS(lod); i++) {
+		const vec3 position = { SPACING * ((GLfloat) (i % GRID) - 0.5f * (GRID - 1)), 0.0f, -SPACING * (i / GRID) };
+		const mat4 model = mat4_translation(position);
+		const GLfloat distance = MAX(vec3_abs(vec3_sub(position, eye)), 0.1f);
+
+		lod[i] = mesh_lod_select(lods, levels, scale / distance, threshold, lod[i]);
+		triangles += lods[lod[i]].index_count / 3;
+		histogram[lod[i]]++;
+
+		glUniformMatrix4fv(glGetUniformLocation(program, "model"), 1, GL_FALSE, (const GLfloat *) &model);
+		glUniform3fv(glGetUniformLocation(program, "color"), 1, (const GLfloat *) &colors[lod[i]]);
+		glDrawElements(GL_TRIANGLES, lods[lod[i]].index_count, GL_UNSIGNED_INT, (const GLvoid *) (lods[lod[i]].index_offset * sizeof (GLuint)));
+	}
+
+	glBindVertexArray(0);
+	glUseProgram(0);
+
+	if (time >= report) {
+		g_print("%u triangles, spheres per level:", triangles);
+		for (gint i = 0; i < levels; i++) {
+			g_print(" %u", histogram[i]);
+		}
+		g_print("\n");
+		report = time + 1.0;
+	}
+
+	return TRUE;
+}
+
+static gboolean ontick(GtkWidget *widget, GdkFrameClock *frame_clock, gpointer user_data)
+{
+	gtk_gl_area_queue_render(GTK_GL_AREA(widget));
+
+	return G_SOURCE_CONTINUE;
+}
+
+static void activate(GtkApplication *application, gpointer user_data)
+{
+	GtkWidget *window;
+	GtkWidget *drawing;
+
+	drawing = gtk_gl_area_new();
+	gtk_gl_area_set_has_depth_buffer(GTK_GL_AREA(drawing), TRUE);
+	g_signal_connect(G_OBJECT(drawing), "realize", G_CALLBACK(realize), NULL);
+	g_signal_connect(G_OBJECT(drawing), "unrealize", G_CALLBACK(unrealize), NULL);
+	g_signal_connect(G_OBJECT(drawing), "render", G_CALLBACK(render), NULL);
+	gtk_widget_add_tick_callback(drawing, ontick, NULL, NULL);
+
+	window = gtk_application_window_new(application);
+	gtk_window_set_default_size(GTK_WINDOW(window), 800, 600);
+	gtk_window_set_child(GTK_WINDOW(window), drawing);
+
+	gtk_widget_show(window);
+}
+
+int main(int argc, char *argv[])
+{
+	int result;
+	GtkApplication *application;
+
+	application = gtk_application_new(NULL, G_APPLICATION_FLAGS_NONE);
+	g_application_add_main_option_entries(G_APPLICATION(application), entries);
+	g_signal_connect(G_OBJECT(application), "activate", G_CALLBACK(activate), NULL);
+	result = g_application_run(G_APPLICATION(application), argc, argv);
+	g_object_unref(G_OBJECT(application));
+
+	return result;
+}
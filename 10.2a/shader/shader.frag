@@ -0,0 +1,14 @@
+#version 330 core
+
+in vec3 fragNormal;
+out vec4 FragColor;
+
+uniform vec3 color;
+uniform vec3 lightDir;
+
+void main()
+{
+    float diffuse = max(dot(normalize(fragNormal), -lightDir), 0.0);
+
+    FragColor = vec4(color * (0.2 + 0.8 * diffuse), 1.0);
+}
@@ -0,0 +1,15 @@
+#version 330 core
+
+in vec3 position;
+in vec3 normal;
+out vec3 fragNormal;
+
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+
+void main()
+{
+    gl_Position = projection * view * model * vec4(position, 1.0);
+    fragNormal = mat3(model) * normal;
+}
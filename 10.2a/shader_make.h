@@ -0,0 +1,8 @@
+#ifndef __SHADER_MAKE_H__
+#define __SHADER_MAKE_H__
+
+#include <epoxy/gl.h>
+
+GLuint shader_make(void);
+
+#endif
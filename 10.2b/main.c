@@ -0,0 +1,371 @@
+#include <stddef.h>
+#include <math.h>
+#include <glib.h>
+#include <gtk/gtk.h>
+#include <epoxy/gl.h>
+#include <shader_make.h>
+#include <glmath.h>
+#include <mesh.h>
+#include <shapes.h>
+#include <instance.h>
+#include <batch.h>
+
+/* cubes beyond the first ten fill a box growing with their count, about this far apart */
+#define SPACING 2.5f
+
+static const vec3 cubePositions[] = {
+	{0.0f, 0.0f, 0.0f},
+	{2.0f, 5.0f, -15.0f},
+	{-1.5f, -2.2f, -2.5f},
+	{-3.8f, -2.0f, -12.3f},
+	{2.4f, -0.4f, -3.5f},
+	{-1.7f, 3.0f, -7.5f},
+	{1.3f, -2.0f, -2.5f},
+	{1.5f, 2.0f, -2.5f},
+	{1.5f, 0.2f, -1.5f},
+	{-1.3f, 1.0f, -1.5f}
+};
+
+static const vec3 colors[4] = {
+	{1.0f, 0.5f, 0.2f},
+	{0.3f, 0.8f, 0.3f},
+	{0.3f, 0.5f, 1.0f},
+	{0.9f, 0.9f, 0.9f}
+};
+
+static GLuint vao;
+static GLuint vbo;
+static GLuint ebo;
+static GLuint ibo;
+static GLuint program[2];
+static GLsizei index_count;
+
+static GLuint batch_vao;
+static GLuint batch_vbo;
+static GLuint batch_ebo;
+static batch_t *batches;
+static guint batch_count;
+static GLsizei *batch_first;	/* first index of each batch within batch_ebo, in indices */
+static GLint *batch_base;	/* first vertex of each batch within batch_vbo */
+
+static instance_t *instances;
+static GLfloat extent;
+
+static gint count = G_N_ELEMENTS(cubePositions);
+static gboolean loop = FALSE;
+static gboolean batch = FALSE;
+
+static const GOptionEntry entries[] = {
+	{ "count", 'n', 0, G_OPTION_ARG_INT, &count, "Cubes to draw, up to 100000", "N" },
+	{ "loop", 0, 0, G_OPTION_ARG_NONE, &loop, "One glUniformMatrix4fv() and glDrawElements() per cube instead of a single instanced draw", NULL },
+	{ "batch", 0, 0, G_OPTION_ARG_NONE, &batch, "Merge the cubes into pre-transformed static batches, one culled draw per batch", NULL },
+	G_OPTION_ENTRY_NULL
+};
+
+GTimer *timer;
+static gdouble report;
+static gdouble submit;
+static guint frames;
+
+/* the cubes never move, so they are merged once by material and drawn with identity transforms */
+static void batch_setup(const mesh_t *mesh)
+{
+	batch_object_t *objects = g_new0(batch_object_t, count);
+	const GLuint uniform = program[SHADER_SET_UNIFORM];
+	GLsizei indices = 0;
+	GLint vertices = 0;
+	GLint index;
+
+	for (gint i = 0; i < count; i++) {
+		objects[i].mesh = mesh;
+		objects[i].model = instances[i].model;
+		objects[i].state.program = uniform;
+		objects[i].state.material = instances[i].material;
+	}
+
+	const gint64 start = g_get_monotonic_time();
+
+	batches = batch_build(objects, count, &batch_count);
+	g_print("%d cubes merged into %u batches in %.1f ms\n", count, batch_count, 1e-3 * (g_get_monotonic_time() - start));
+	g_free(objects);
+
+	batch_first = g_new(GLsizei, batch_count);
+	batch_base = g_new(GLint, batch_count);
+	for (guint b = 0; b < batch_count; b++) {
+		batch_first[b] = indices;
+		batch_base[b] = vertices;
+		indices += batches[b].mesh->index_count;
+		vertices += batches[b].mesh->vertex_count;
+	}
+
+	glGenVertexArrays(1, &batch_vao);
+	glBindVertexArray(batch_vao);
+
+	glGenBuffers(1, &batch_vbo);
+	glBindBuffer(GL_ARRAY_BUFFER, batch_vbo);
+	glBufferData(GL_ARRAY_BUFFER, vertices * sizeof (vertex_t), NULL, GL_STATIC_DRAW);
+
+	glGenBuffers(1, &batch_ebo);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch_ebo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices * sizeof (GLuint), NULL, GL_STATIC_DRAW);
+
+	/* batch indices start at 0, glDrawElementsBaseVertex() offsets them into the shared buffer */
+	for (guint b = 0; b < batch_count; b++) {
+		const mesh_t *merged = batches[b].mesh;
+
+		glBufferSubData(GL_ARRAY_BUFFER, batch_base[b] * sizeof (vertex_t), merged->vertex_count * sizeof (vertex_t), merged->vertices);
+		glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, batch_first[b] * sizeof (GLuint), merged->index_count * sizeof (GLuint), merged->indices);
+	}
+
+	index = glGetAttribLocation(uniform, "position");
+	glVertexAttribPointer(index, 3, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (const GLvoid *) offsetof(vertex_t, position));
+	glEnableVertexAttribArray(index);
+	index = glGetAttribLocation(uniform, "normal");
+	glVertexAttribPointer(index, 3, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (const GLvoid *) offsetof(vertex_t, normal));
+	glEnableVertexAttribArray(index);
+
+	glBindVertexArray(0);
+}
+
+static void realize(GtkGLArea *area, gpointer user_data)
+{
+	gtk_gl_area_make_current(area);
+	if (gtk_gl_area_get_error(area) != NULL) {
+		return;
+	}
+
+	glClearColor(0.2, 0.3, 0.3, 1.0);
+	glEnable(GL_DEPTH_TEST);
+	glEnable(GL_CULL_FACE);
+
+	program[SHADER_SET_INSTANCED] = shader_make(SHADER_SET_INSTANCED);
+	program[SHADER_SET_UNIFORM] = shader_make(SHADER_SET_UNIFORM);
+
+	count = CLAMP(count, 1, INSTANCE_MAX);
+	extent = SPACING * cbrt(count);
+	instances = g_new(instance_t, count);
+
+	{
+		GRand *rand = g_rand_new_with_seed(count);
+
+		for (gint i = 0; i < count; i++) {
+			const vec3 position = i < (gint) G_N_ELEMENTS(cubePositions) ? cubePositions[i] : (vec3) {
+				g_rand_double_range(rand, -0.5, 0.5) * extent,
+				g_rand_double_range(rand, -0.5, 0.5) * extent,
+				g_rand_double_range(rand, -0.5, 0.5) * extent
+			};
+			const mat4 model = mat4_mul(mat4_translation(position), mat4_rotation(radians(20.0f * i), (vec3) { 1.0f, 0.3f, 0.5f }));
+
+			instance_set(&instances[i], model, i % G_N_ELEMENTS(colors));
+		}
+		g_rand_free(rand);
+	}
+
+	{
+		mesh_t *mesh = shape_cube();
+		const GLuint instanced = program[SHADER_SET_INSTANCED];
+		GLint index;
+
+		index_count = mesh->index_count;
+
+		glGenVertexArrays(1, &vao);
+		glBindVertexArray(vao);
+
+		glGenBuffers(1, &vbo);
+		glBindBuffer(GL_ARRAY_BUFFER, vbo);
+		glBufferData(GL_ARRAY_BUFFER, mesh->vertex_count * sizeof (vertex_t), mesh->vertices, GL_STATIC_DRAW);
+
+		glGenBuffers(1, &ebo);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh->index_count * sizeof (GLuint), mesh->indices, GL_STATIC_DRAW);
+
+		/* both programs pin position and normal to the same locations */
+		index = glGetAttribLocation(instanced, "position");
+		glVertexAttribPointer(index, 3, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (const GLvoid *) offsetof(vertex_t, position));
+		glEnableVertexAttribArray(index);
+		index = glGetAttribLocation(instanced, "normal");
+		glVertexAttribPointer(index, 3, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (const GLvoid *) offsetof(vertex_t, normal));
+		glEnableVertexAttribArray(index);
+
+		glGenBuffers(1, &ibo);
+		glBindBuffer(GL_ARRAY_BUFFER, ibo);
+		glBufferData(GL_ARRAY_BUFFER, count * sizeof (instance_t), instances, GL_STATIC_DRAW);
+		instance_attrib_pointer(glGetAttribLocation(instanced, "instance_model"), glGetAttribLocation(instanced, "instance_normal"), glGetAttribLocation(instanced, "instance_material"));
+
+		glBindVertexArray(0);
+
+		if (batch) {
+			batch_setup(mesh);
+		}
+		mesh_free(mesh);
+	}
+
+	for (guint i = 0; i < G_N_ELEMENTS(program); i++) {
+		glUseProgram(program[i]);
+		glUniform3fv(glGetUniformLocation(program[i], "colors"), G_N_ELEMENTS(colors), (const GLfloat *) colors);
+		glUniform3fv(glGetUniformLocation(program[i], "lightDir"), 1, (const GLfloat *) &(vec3) { -0.36f, -0.80f, -0.48f });
+	}
+	glUseProgram(0);
+
+	timer = g_timer_new();
+	report = 1.0;
+}
+
+static void unrealize(GtkGLArea *area, gpointer user_data)
+{
+	g_timer_destroy(timer);
+	g_free(instances);
+
+	gtk_gl_area_make_current(area);
+	if (gtk_gl_area_get_error(area) != NULL) {
+		return;
+	}
+
+	glDeleteVertexArrays(1, &vao);
+	glDeleteBuffers(1, &vbo);
+	glDeleteBuffers(1, &ebo);
+	glDeleteBuffers(1, &ibo);
+	if (batch) {
+		batch_free(batches, batch_count);
+		g_free(batch_first);
+		g_free(batch_base);
+		glDeleteVertexArrays(1, &batch_vao);
+		glDeleteBuffers(1, &batch_vbo);
+		glDeleteBuffers(1, &batch_ebo);
+	}
+	glDeleteProgram(program[SHADER_SET_INSTANCED]);
+	glDeleteProgram(program[SHADER_SET_UNIFORM]);
+}
+
+/* the uniforms the instance attributes replace, set and drawn one cube at a time */
+static void draw_loop(void)
+{
+	const GLuint uniform = program[SHADER_SET_UNIFORM];
+	const GLint model = glGetUniformLocation(uniform, "model");
+	const GLint normal = glGetUniformLocation(uniform, "normalMatrix");
+	const GLint material = glGetUniformLocation(uniform, "material");
+
+	for (gint i = 0; i < count; i++) {
+		glUniformMatrix4fv(model, 1, GL_FALSE, (const GLfloat *) &instances[i].model);
+		glUniformMatrix3fv(normal, 1, GL_FALSE, (const GLfloat *) &instances[i].normal);
+		glUniform1ui(material, instances[i].material);
+		glDrawElements(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, NULL);
+	}
+}
+
+/* vertices are in world space already, only the material changes between batches */
+static guint draw_batches(const mat4 *view_projection)
+{
+	const GLuint uniform = program[SHADER_SET_UNIFORM];
+	const GLint material = glGetUniformLocation(uniform, "material");
+	const mat4 model = mat4_identity();
+	const mat3 normal = mat3_identity();
+	guint drawn = 0;
+
+	glUniformMatrix4fv(glGetUniformLocation(uniform, "model"), 1, GL_FALSE, (const GLfloat *) &model);
+	glUniformMatrix3fv(glGetUniformLocation(uniform, "normalMatrix"), 1, GL_FALSE, (const GLfloat *) &normal);
+
+	for (guint b = 0; b < batch_count; b++) {
+		if (!batch_visible(&batches[b], view_projection)) {
+			continue;
+		}
+		glUniform1ui(material, batches[b].state.material);
+		glDrawElementsBaseVertex(batches[b].mesh->mode, batches[b].mesh->index_count, GL_UNSIGNED_INT, (const GLvoid *) (batch_first[b] * sizeof (GLuint)), batch_base[b]);
+		drawn++;
+	}
+
+	return drawn;
+}
+
+static gboolean render(GtkGLArea *area, GdkGLContext *context, gpointer user_data)
+{
+	const gdouble time = g_timer_elapsed(timer, NULL);
+	const GLfloat radius = MAX(10.0f, extent);
+	const vec3 eye = { sin(time * 0.25) * radius, 0.0f, cos(time * 0.25) * radius };
+	const mat4 view = mat4_look_at(eye, (vec3) { 0.0, 0.0, 0.0 }, (vec3) { 0.0, 1.0, 0.0 });
+
+	const GLint width = gtk_widget_get_allocated_width(GTK_WIDGET(area));
+	const GLint height = gtk_widget_get_allocated_height(GTK_WIDGET(area));
+	const mat4 projection = mat4_perspective(radians(45.), ((GLfloat) width) / ((GLfloat) height), 0.1, MAX(100.0f, 2.0f * radius));
+	const GLuint current = program[loop || batch ? SHADER_SET_UNIFORM : SHADER_SET_INSTANCED];
+	guint draws = 1;
+
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	glUseProgram(current);
+
+	glUniformMatrix4fv(glGetUniformLocation(current, "view"), 1, GL_FALSE, (const GLfloat *) &view);
+	glUniformMatrix4fv(glGetUniformLocation(current, "projection"), 1, GL_FALSE, (const GLfloat *) &projection);
+
+	glBindVertexArray(batch ? batch_vao : vao);
+
+	/* CPU time to hand the cubes to the driver, the part instancing takes away */
+	const gdouble start = g_timer_elapsed(timer, NULL);
+
+	if (batch) {
+		const mat4 view_projection = mat4_mul(projection, view);
+
+		draws = draw_batches(&view_projection);
+	}
+	else if (loop) {
+		draw_loop();
+		draws = count;
+	}
+	else {
+		glDrawElementsInstanced(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, NULL, count);
+	}
+	submit += g_timer_elapsed(timer, NULL) - start;
+	frames++;
+
+	glBindVertexArray(0);
+	glUseProgram(0);
+
+	if (time >= report) {
+		g_print("%d cubes, %d draw calls, %.3f ms submit, %.1f fps\n", count, draws, 1e3 * submit / frames, frames / (time - report + 1.0));
+		submit = 0.0;
+		frames = 0;
+		report = time + 1.0;
+	}
+
+	return TRUE;
+}
+
+static gboolean ontick(GtkWidget *widget, GdkFrameClock *frame_clock, gpointer user_data)
+{
+	gtk_gl_area_queue_render(GTK_GL_AREA(widget));
+
+	return G_SOURCE_CONTINUE;
+}
+
+static void activate(GtkApplication *application, gpointer user_data)
+{
+	GtkWidget *window;
+	GtkWidget *drawing;
+
+	drawing = gtk_gl_area_new();
+	gtk_gl_area_set_has_depth_buffer(GTK_GL_AREA(drawing), TRUE);
+	g_signal_connect(G_OBJECT(drawing), "realize", G_CALLBACK(realize), NULL);
+	g_signal_connect(G_OBJECT(drawing), "unrealize", G_CALLBACK(unrealize), NULL);
+	g_signal_connect(G_OBJECT(drawing), "render", G_CALLBACK(render), NULL);
+	gtk_widget_add_tick_callback(drawing, ontick, NULL, NULL);
+
+	window = gtk_application_window_new(application);
+	gtk_window_set_default_size(GTK_WINDOW(window), 800, 600);
+	gtk_window_set_child(GTK_WINDOW(window), drawing);
+
+	gtk_widget_show(window);
+}
+
+int main(int argc, char *argv[])
+{
+	int result;
+	GtkApplication *application;
+
+	application = gtk_application_new(NULL, G_APPLICATION_FLAGS_NONE);
+	g_application_add_main_option_entries(G_APPLICATION(application), entries);
+	g_signal_connect(G_OBJECT(application), "activate", G_CALLBACK(activate), NULL);
+	result = g_application_run(G_APPLICATION(application), argc, argv);
+	g_object_unref(G_OBJECT(application));
+
+	return result;
+}
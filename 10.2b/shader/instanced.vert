@@ -0,0 +1,19 @@
+#version 330 core
+
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in mat4 instance_model;
+layout (location = 6) in mat3 instance_normal;
+layout (location = 9) in uint instance_material;
+out vec3 fragNormal;
+flat out uint fragMaterial;
+
+uniform mat4 view;
+uniform mat4 projection;
+
+void main()
+{
+    gl_Position = projection * view * instance_model * vec4(position, 1.0);
+    fragNormal = instance_normal * normal;
+    fragMaterial = instance_material;
+}
@@ -0,0 +1,15 @@
+#version 330 core
+
+in vec3 fragNormal;
+flat in uint fragMaterial;
+out vec4 FragColor;
+
+uniform vec3 colors[4];
+uniform vec3 lightDir;
+
+void main()
+{
+    float diffuse = max(dot(normalize(fragNormal), -lightDir), 0.0);
+
+    FragColor = vec4(colors[fragMaterial] * (0.2 + 0.8 * diffuse), 1.0);
+}
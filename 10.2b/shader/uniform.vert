@@ -0,0 +1,19 @@
+#version 330 core
+
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+out vec3 fragNormal;
+flat out uint fragMaterial;
+
+uniform mat4 model;
+uniform mat3 normalMatrix;
+uniform uint material;
+uniform mat4 view;
+uniform mat4 projection;
+
+void main()
+{
+    gl_Position = projection * view * model * vec4(position, 1.0);
+    fragNormal = normalMatrix * normal;
+    fragMaterial = material;
+}
@@ -0,0 +1,13 @@
+#ifndef __SHADER_MAKE_H__
+#define __SHADER_MAKE_H__
+
+#include <epoxy/gl.h>
+
+typedef enum {
+	SHADER_SET_INSTANCED,
+	SHADER_SET_UNIFORM,
+} shader_set;
+
+GLuint shader_make(shader_set set);
+
+#endif
@@ -0,0 +1,718 @@
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <glib.h>
+#include <gtk/gtk.h>
+#include <epoxy/gl.h>
+#include <shader_make.h>
+#include <glmath.h>
+#include <mesh.h>
+#include <mesh_pool.h>
+#include <ring_buffer.h>
+#include <frustum.h>
+#include <shapes.h>
+#include <texture_array.h>
+#include <texture_bindless.h>
+#include <texture_stream.h>
+
+/* objects fill a box growing with their count, about this far apart */
+#define SPACING 2.5f
+
+/* the most objects, one draw command and one Object each */
+#define OBJECT_MAX 1000000
+
+/*
+ * The std430 layout of Object in the vertex shader: the mat3 columns are
+ * padded to vec4 and the whole struct to a multiple of 16 bytes.
+ */
+typedef struct {
+	mat4 model;
+	vec4 normal[3];
+	GLuint material;
+	GLuint mesh;		/* into meshes */
+	GLuint padding[2];
+} object_t;
+
+/* the std430 Mesh of the cull shader, what a draw command of the mesh needs and its bounding sphere */
+typedef struct {
+	vec4 sphere;		/* center and radius */
+	GLuint count;
+	GLuint first_index;
+	GLint base_vertex;
+	GLuint padding;
+} cull_mesh_t;
+
+/* the std140 Frame uniform block, written to the ring buffer every frame */
+typedef struct {
+	mat4 view;
+	mat4 projection;
+	vec4 light_dir;
+} frame_t;
+
+static const vec3 colors[4] = {
+	{1.0f, 0.5f, 0.2f},
+	{0.3f, 0.8f, 0.3f},
+	{0.3f, 0.5f, 1.0f},
+	{0.9f, 0.9f, 0.9f}
+};
+
+/* with --textured, the layers of the material array in the same order */
+static const gchar *const images[4] = {
+	"container.jpg",
+	"container2.png",
+	"awesomeface.png",
+	"container.png"
+};
+
+static GLuint vao;
+static GLuint pull_vao;		/* no attributes at all, only the element buffer */
+static GLuint vbo;
+static GLuint ebo;
+static GLuint ssbo;
+static GLuint indirect;
+static GLuint meshes;
+static GLuint culled;		/* the commands the cull shader packs */
+static GLuint counter;		/* and how many */
+static GLuint program[5];
+static ring_buffer_t *ring;
+static texture_array_t *materials;
+static texture_bindless_t *bindless_materials;	/* instead of materials with --bindless */
+static texture_stream_t *stream;			/* or with --stream */
+static texture_stream_item_t *streamed[4];
+static GtkWidget *residency;				/* the overlay showing what stream holds */
+
+static GLfloat extent;
+static vec3 *positions;		/* of each object, kept to spin them with --animate */
+static object_t *objects;	/* as on the GPU, for culling on the CPU */
+static cull_mesh_t cull_meshes[4];
+
+typedef enum {
+	CULL_NONE,
+	CULL_CPU,
+	CULL_GPU
+} cull_mode;
+
+static gint count = 10000;
+static gboolean animate = FALSE;
+static gchar *cull = NULL;
+static gboolean validate = FALSE;
+static gboolean pull = FALSE;
+static gboolean textured = FALSE;
+static gboolean bindless = FALSE;
+static gint stream_budget = 0;
+static cull_mode mode = CULL_NONE;
+
+static const GOptionEntry entries[] = {
+	{ "count", 'n', 0, G_OPTION_ARG_INT, &count, "Objects to draw, up to 1000000", "N" },
+	{ "animate", 'a', 0, G_OPTION_ARG_NONE, &animate, "Spin every object, writing all of them to the ring buffer each frame", NULL },
+	{ "cull", 'c', 0, G_OPTION_ARG_STRING, &cull, "Frustum culling of the objects: none, cpu or gpu", "MODE" },
+	{ "validate", 0, 0, G_OPTION_ARG_NONE, &validate, "Once a second, compare what the GPU culled against the CPU reference", NULL },
+	{ "pull", 'p', 0, G_OPTION_ARG_NONE, &pull, "Fetch vertices from a shader storage buffer by gl_VertexID instead of through vertex attributes", NULL },
+	{ "textured", 't', 0, G_OPTION_ARG_NONE, &textured, "Give each material an image, all of them layers of one texture array, instead of a colour", NULL },
+	{ "bindless", 'b', 0, G_OPTION_ARG_NONE, &bindless, "With --textured, a texture per material through bindless handles in a storage buffer, the array where GL_ARB_bindless_texture is missing", NULL },
+	{ "stream", 's', 0, G_OPTION_ARG_INT, &stream_budget, "Stream each material image as its own texture under a budget of this many KiB, the levels following the nearest object of the material", "KIB" },
+	G_OPTION_ENTRY_NULL
+};
+
+GTimer *timer;
+static gdouble report;
+static gdouble submit;
+static guint frames;
+
+static void object_set(object_t *object, mat4 model, GLuint material, GLuint mesh)
+{
+	const mat3 normal = mat3_normal(model);
+
+	object->model = model;
+	object->normal[0] = (vec4) { normal.a11, normal.a21, normal.a31, 0.0f };
+	object->normal[1] = (vec4) { normal.a12, normal.a22, normal.a32, 0.0f };
+	object->normal[2] = (vec4) { normal.a13, normal.a23, normal.a33, 0.0f };
+	object->material = material;
+	object->mesh = mesh;
+}
+
+/*
+ * The reference for cull.comp, with the same tests in the same order: packs
+ * the commands of the objects whose bounding sphere touches the frustum and
+ * returns how many there are. The GPU packs them in no particular order.
+ */
+static guint cull_objects(const frustum_t *frustum, draw_command_t *commands)
+{
+	guint visible = 0;
+
+	for (gint i = 0; i < count; i++) {
+		const object_t *object = &objects[i];
+		const cull_mesh_t *mesh = &cull_meshes[object->mesh];
+		const vec4 center = mat4_mulv(object->model, (vec4) { mesh->sphere.x, mesh->sphere.y, mesh->sphere.z, 1.0f });
+
+		if (frustum_sphere(frustum, (vec3) { center.x, center.y, center.z }, mesh->sphere.w * frustum_scale(&object->model))) {
+			commands[visible++] = (draw_command_t) { mesh->count, 1, mesh->first_index, mesh->base_vertex, i };
+		}
+	}
+
+	return visible;
+}
+
+static void cull_dispatch(const frustum_t *frustum)
+{
+	const GLuint compute = program[SHADER_SET_CULL];
+
+	/* binding the base binds the generic point too, the clear needs the counter there */
+	glBindBufferBase(GL_ATOMIC_COUNTER_BUFFER, 0, counter);
+	glClearBufferData(GL_ATOMIC_COUNTER_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, NULL);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, meshes);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, culled);
+
+	glUseProgram(compute);
+	glUniform4fv(glGetUniformLocation(compute, "planes"), G_N_ELEMENTS(frustum->planes), (const GLfloat *) frustum->planes);
+	glUniform1ui(glGetUniformLocation(compute, "objectCount"), count);
+	glDispatchCompute((count + 63) / 64, 1, 1);
+
+	/* the draw reads the commands and the count written above */
+	glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT | GL_ATOMIC_COUNTER_BARRIER_BIT);
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, 0);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, 0);
+	glBindBufferBase(GL_ATOMIC_COUNTER_BUFFER, 0, 0);
+}
+
+/* reads back what the GPU culled, stalling until it has, and compares it as a set against cull_objects() */
+static void cull_validate(const frustum_t *frustum)
+{
+	draw_command_t *expected = g_new(draw_command_t, count);
+	draw_command_t *actual = g_new(draw_command_t, count);
+	guint8 *seen = g_new0(guint8, count);
+	const guint visible = cull_objects(frustum, expected);
+	guint culled_count;
+	guint mismatches = 0;
+
+	glBindBuffer(GL_COPY_READ_BUFFER, counter);
+	glGetBufferSubData(GL_COPY_READ_BUFFER, 0, sizeof (GLuint), &culled_count);
+
+	/* more than count means the counter was not reset, every command past count is wrong */
+	const guint read = MIN(culled_count, (guint) count);
+
+	mismatches += culled_count - read;
+	glBindBuffer(GL_COPY_READ_BUFFER, culled);
+	glGetBufferSubData(GL_COPY_READ_BUFFER, 0, read * sizeof (draw_command_t), actual);
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+	for (guint i = 0; i < visible; i++) {
+		seen[expected[i].base_instance] |= 1;
+	}
+	for (guint i = 0; i < read; i++) {
+		const draw_command_t *command = &actual[i];
+		const guint object = MIN(command->base_instance, (guint) count - 1);
+		const cull_mesh_t *mesh = &cull_meshes[objects[object].mesh];
+
+		if (command->count != mesh->count || command->first_index != mesh->first_index || command->base_vertex != mesh->base_vertex) {
+			mismatches++;
+		}
+		seen[object] |= 2;
+	}
+	for (gint i = 0; i < count; i++) {
+		mismatches += seen[i] == 1 || seen[i] == 2;
+	}
+	g_print("validate: %u visible on the GPU, %u on the CPU, %u mismatched\n", culled_count, visible, mismatches);
+
+	g_free(seen);
+	g_free(actual);
+	g_free(expected);
+}
+
+/*
+ * Asks the stream for the texture of each material as sharp as its nearest
+ * visible object needs, the diameter in pixels its bounding sphere covers
+ * on screen. Walks every object on the CPU, as cull_objects() does.
+ */
+static void stream_request(const frustum_t *frustum, vec3 eye, GLfloat pixels_per_unit)
+{
+	GLfloat nearest[G_N_ELEMENTS(streamed)] = { 0.0f };
+
+	for (gint i = 0; i < count; i++) {
+		const object_t *object = &objects[i];
+		const cull_mesh_t *mesh = &cull_meshes[object->mesh];
+		const vec4 center = mat4_mulv(object->model, (vec4) { mesh->sphere.x, mesh->sphere.y, mesh->sphere.z, 1.0f });
+		const GLfloat radius = mesh->sphere.w * frustum_scale(&object->model);
+
+		if (!frustum_sphere(frustum, (vec3) { center.x, center.y, center.z }, radius)) {
+			continue;
+		}
+
+		const vec3 offset = { center.x - eye.x, center.y - eye.y, center.z - eye.z };
+		const GLfloat distance = MAX(sqrtf(offset.x * offset.x + offset.y * offset.y + offset.z * offset.z), radius);
+
+		nearest[object->material] = MAX(nearest[object->material], 2.0f * radius * pixels_per_unit / distance);
+	}
+	for (guint i = 0; i < G_N_ELEMENTS(streamed); i++) {
+		texture_stream_request(stream, streamed[i], nearest[i]);
+	}
+}
+
+static void realize(GtkGLArea *area, gpointer user_data)
+{
+	gtk_gl_area_make_current(area);
+	if (gtk_gl_area_get_error(area) != NULL) {
+		return;
+	}
+
+	glClearColor(0.2, 0.3, 0.3, 1.0);
+	glEnable(GL_DEPTH_TEST);
+	glEnable(GL_CULL_FACE);
+
+	program[SHADER_SET_DRAW] = shader_make(SHADER_SET_DRAW);
+	program[SHADER_SET_CULL] = shader_make(SHADER_SET_CULL);
+	program[SHADER_SET_PULL] = shader_make(SHADER_SET_PULL);
+
+	if (g_strcmp0(cull, "cpu") == 0) {
+		mode = CULL_CPU;
+	}
+	else if (g_strcmp0(cull, "gpu") == 0) {
+		mode = CULL_GPU;
+	}
+	else if (cull != NULL && g_strcmp0(cull, "none") != 0) {
+		g_printerr("Unknown culling mode %s, drawing everything\n", cull);
+	}
+
+	count = CLAMP(count, 1, OBJECT_MAX);
+	extent = SPACING * cbrt(count);
+
+	mesh_pool_t *pool = mesh_pool_new();
+
+	{
+		mesh_t *shapes[] = {
+			shape_cube(),
+			shape_icosahedron(),
+			shape_torus(32, 16, 0.6f, 0.4f, GL_TRIANGLES),
+			shape_cylinder(24, GL_TRIANGLES)
+		};
+
+		G_STATIC_ASSERT(G_N_ELEMENTS(shapes) == G_N_ELEMENTS(cull_meshes));
+
+		for (guint i = 0; i < G_N_ELEMENTS(shapes); i++) {
+			const mesh_pool_entry_t *entry = mesh_pool_entry(pool, mesh_pool_add(pool, shapes[i]));
+
+			cull_meshes[i] = (cull_mesh_t) {
+				.sphere = { entry->center.x, entry->center.y, entry->center.z, entry->radius },
+				.count = entry->index_count,
+				.first_index = entry->first_index,
+				.base_vertex = entry->base_vertex
+			};
+			mesh_free(shapes[i]);
+		}
+
+		glGenBuffers(1, &meshes);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, meshes);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof cull_meshes, cull_meshes, GL_STATIC_DRAW);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+		glGenBuffers(1, &culled);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, culled);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, count * sizeof (draw_command_t), NULL, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+		const GLuint zero = 0;
+
+		glGenBuffers(1, &counter);
+		glBindBuffer(GL_ATOMIC_COUNTER_BUFFER, counter);
+		glBufferData(GL_ATOMIC_COUNTER_BUFFER, sizeof (GLuint), &zero, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_ATOMIC_COUNTER_BUFFER, 0);
+	}
+
+	{
+		draw_command_t *commands = g_new(draw_command_t, count);
+		GRand *rand = g_rand_new_with_seed(count);
+
+		positions = g_new(vec3, count);
+		objects = g_new(object_t, count);
+
+		for (gint i = 0; i < count; i++) {
+			const vec3 position = positions[i] = (vec3) {
+				g_rand_double_range(rand, -0.5, 0.5) * extent,
+				g_rand_double_range(rand, -0.5, 0.5) * extent,
+				g_rand_double_range(rand, -0.5, 0.5) * extent
+			};
+			const mat4 model = mat4_mul(mat4_translation(position), mat4_rotation(radians(20.0f * i), (vec3) { 1.0f, 0.3f, 0.5f }));
+
+			object_set(&objects[i], model, i % G_N_ELEMENTS(colors), i % G_N_ELEMENTS(cull_meshes));
+			commands[i] = mesh_pool_command(pool, objects[i].mesh, 1, i);
+		}
+		g_rand_free(rand);
+
+		glGenBuffers(1, &ssbo);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, count * sizeof (object_t), objects, GL_STATIC_DRAW);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+		glGenBuffers(1, &indirect);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect);
+		glBufferData(GL_DRAW_INDIRECT_BUFFER, count * sizeof (draw_command_t), commands, GL_STATIC_DRAW);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+		g_free(commands);
+	}
+
+	{
+		GLint index;
+
+		glGenVertexArrays(1, &vao);
+		glBindVertexArray(vao);
+
+		glGenBuffers(1, &vbo);
+		glGenBuffers(1, &ebo);
+		mesh_pool_upload(pool, vbo, ebo);
+
+		index = glGetAttribLocation(program[SHADER_SET_DRAW], "position");
+		glVertexAttribPointer(index, 3, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (const GLvoid *) offsetof(vertex_t, position));
+		glEnableVertexAttribArray(index);
+		index = glGetAttribLocation(program[SHADER_SET_DRAW], "normal");
+		glVertexAttribPointer(index, 3, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (const GLvoid *) offsetof(vertex_t, normal));
+		glEnableVertexAttribArray(index);
+		index = glGetAttribLocation(program[SHADER_SET_DRAW], "texCoord");
+		glVertexAttribPointer(index, 2, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (const GLvoid *) offsetof(vertex_t, texture));
+		glEnableVertexAttribArray(index);
+
+		/* any mesh and any vertex layout the shader knows how to read draws with this one */
+		glGenVertexArrays(1, &pull_vao);
+		glBindVertexArray(pull_vao);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+
+		glBindVertexArray(0);
+	}
+	mesh_pool_free(pool);
+
+	if (stream_budget > 0) {
+		const texture_sampler_t sampler = { GL_REPEAT, GL_REPEAT, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR };
+		GError *error = NULL;
+
+		G_STATIC_ASSERT(G_N_ELEMENTS(images) == G_N_ELEMENTS(streamed));
+
+		/* nothing is loaded yet, the first frames ask for what they need */
+		stream = texture_stream_new((gsize) stream_budget << 10);
+		for (guint i = 0; i < G_N_ELEMENTS(images); i++) {
+			streamed[i] = texture_stream_add(stream, images[i], &sampler, &error);
+			if (streamed[i] == NULL) {
+				g_printerr("%s, drawing with colours\n", error->message);
+				g_error_free(error);
+				texture_stream_free(stream);
+				stream = NULL;
+				break;
+			}
+		}
+	}
+	else if (textured) {
+		const texture_sampler_t sampler = { GL_REPEAT, GL_REPEAT, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR };
+		GError *error = NULL;
+
+		G_STATIC_ASSERT(G_N_ELEMENTS(images) == G_N_ELEMENTS(colors));
+
+		/* no binding at all, the object's material indexes the handles */
+		if (bindless && texture_bindless_supported()) {
+			bindless_materials = texture_bindless_new(images, G_N_ELEMENTS(images), &sampler, &error);
+			if (bindless_materials == NULL) {
+				g_printerr("%s, trying a texture array\n", error->message);
+				g_clear_error(&error);
+			}
+			else {
+				program[SHADER_SET_DRAW_BINDLESS] = shader_make(SHADER_SET_DRAW_BINDLESS);
+				program[SHADER_SET_PULL_BINDLESS] = shader_make(SHADER_SET_PULL_BINDLESS);
+			}
+		}
+		else if (bindless) {
+			g_printerr("No GL_ARB_bindless_texture, using a texture array\n");
+		}
+
+		/* one binding for every material, the object's material is its layer */
+		if (bindless_materials == NULL) {
+			materials = texture_array_new(images, G_N_ELEMENTS(images), &sampler, &error);
+			if (materials == NULL) {
+				g_printerr("%s, drawing with colours\n", error->message);
+				g_error_free(error);
+			}
+		}
+	}
+
+	{
+		const GLuint drawing[] = { program[SHADER_SET_DRAW], program[SHADER_SET_PULL] };
+		/* unit 0 is the array */
+		const GLint units[G_N_ELEMENTS(streamed)] = { 1, 2, 3, 4 };
+
+		for (guint i = 0; i < G_N_ELEMENTS(drawing); i++) {
+			glUseProgram(drawing[i]);
+			glUniform3fv(glGetUniformLocation(drawing[i], "colors"), G_N_ELEMENTS(colors), (const GLfloat *) colors);
+			glUniform1i(glGetUniformLocation(drawing[i], "textured"), materials != NULL);
+			glUniform1i(glGetUniformLocation(drawing[i], "materials"), 0);
+			glUniform1i(glGetUniformLocation(drawing[i], "streamed"), stream != NULL);
+			glUniform1iv(glGetUniformLocation(drawing[i], "streams"), G_N_ELEMENTS(units), units);
+		}
+	}
+	glUseProgram(0);
+
+	ring = ring_buffer_new(sizeof (frame_t) + (animate ? count * sizeof (object_t) : 0) + (mode == CULL_CPU ? count * sizeof (draw_command_t) : 0), 3);
+
+	timer = g_timer_new();
+	report = 1.0;
+}
+
+static void unrealize(GtkGLArea *area, gpointer user_data)
+{
+	g_timer_destroy(timer);
+	g_free(positions);
+	g_free(objects);
+
+	gtk_gl_area_make_current(area);
+	if (gtk_gl_area_get_error(area) != NULL) {
+		return;
+	}
+
+	glDeleteVertexArrays(1, &vao);
+	glDeleteVertexArrays(1, &pull_vao);
+	glDeleteBuffers(1, &vbo);
+	glDeleteBuffers(1, &ebo);
+	glDeleteBuffers(1, &ssbo);
+	glDeleteBuffers(1, &indirect);
+	glDeleteBuffers(1, &meshes);
+	glDeleteBuffers(1, &culled);
+	glDeleteBuffers(1, &counter);
+	glDeleteProgram(program[SHADER_SET_DRAW]);
+	glDeleteProgram(program[SHADER_SET_CULL]);
+	glDeleteProgram(program[SHADER_SET_PULL]);
+	glDeleteProgram(program[SHADER_SET_DRAW_BINDLESS]);
+	glDeleteProgram(program[SHADER_SET_PULL_BINDLESS]);
+	texture_array_free(materials);
+	texture_bindless_free(bindless_materials);
+	texture_stream_free(stream);
+	stream = NULL;
+	ring_buffer_free(ring);
+}
+
+static gboolean render(GtkGLArea *area, GdkGLContext *context, gpointer user_data)
+{
+	const gdouble time = g_timer_elapsed(timer, NULL);
+	const GLfloat radius = MAX(10.0f, extent);
+	const vec3 eye = { sin(time * 0.25) * radius, 0.0f, cos(time * 0.25) * radius };
+	const mat4 view = mat4_look_at(eye, (vec3) { 0.0, 0.0, 0.0 }, (vec3) { 0.0, 1.0, 0.0 });
+
+	const GLint width = gtk_widget_get_allocated_width(GTK_WIDGET(area));
+	const GLint height = gtk_widget_get_allocated_height(GTK_WIDGET(area));
+	const mat4 projection = mat4_perspective(radians(45.), ((GLfloat) width) / ((GLfloat) height), 0.1, MAX(100.0f, 2.0f * radius));
+
+	const mat4 view_projection = mat4_mul(projection, view);
+	const frustum_t frustum = frustum_from_matrix(&view_projection);
+	GLintptr offset;
+	guint visible = count;
+
+	ring_buffer_begin(ring);
+
+	frame_t *frame = ring_buffer_alloc(ring, sizeof (frame_t), &offset);
+
+	frame->view = view;
+	frame->projection = projection;
+	frame->light_dir = (vec4) { -0.36f, -0.80f, -0.48f, 0.0f };
+	glBindBufferRange(GL_UNIFORM_BUFFER, 0, ring->buffer, offset, sizeof (frame_t));
+
+	if (animate) {
+		object_t *mapped = ring_buffer_alloc(ring, count * sizeof (object_t), &offset);
+
+		for (gint i = 0; i < count; i++) {
+			const mat4 model = mat4_mul(mat4_translation(positions[i]), mat4_rotation(radians(20.0f * i) + time, (vec3) { 1.0f, 0.3f, 0.5f }));
+
+			object_set(&objects[i], model, objects[i].material, objects[i].mesh);
+		}
+		/* the mapping is write only, the CPU reference culls the copy in objects */
+		memcpy(mapped, objects, count * sizeof (object_t));
+		glBindBufferRange(GL_SHADER_STORAGE_BUFFER, 0, ring->buffer, offset, count * sizeof (object_t));
+	}
+	else {
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, ssbo);
+	}
+
+	/* streaming loads and uploads levels, it stays out of the submit time */
+	if (stream != NULL) {
+		stream_request(&frustum, eye, height / (2.0f * tanf(radians(45.) / 2.0f)));
+		texture_stream_update(stream, TEXTURE_UPLOAD_BUDGET);
+	}
+
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	/* the same few calls for any count unless the CPU culls, the commands and objects stay on the GPU */
+	const gdouble start = g_timer_elapsed(timer, NULL);
+
+	switch (mode) {
+	case CULL_NONE:
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect);
+		offset = 0;
+		break;
+	case CULL_CPU:
+		visible = cull_objects(&frustum, ring_buffer_alloc(ring, count * sizeof (draw_command_t), &offset));
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, ring->buffer);
+		break;
+	case CULL_GPU:
+		cull_dispatch(&frustum);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, culled);
+		glBindBuffer(GL_PARAMETER_BUFFER, counter);
+		break;
+	}
+
+	if (materials != NULL) {
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, materials->texture);
+	}
+	/* the names change as levels come and go, they are bound again every frame */
+	if (stream != NULL) {
+		for (guint i = 0; i < G_N_ELEMENTS(streamed); i++) {
+			glActiveTexture(GL_TEXTURE1 + i);
+			glBindTexture(GL_TEXTURE_2D, texture_stream_texture(streamed[i]));
+		}
+		glActiveTexture(GL_TEXTURE0);
+	}
+	if (bindless_materials != NULL) {
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, bindless_materials->buffer);
+	}
+	if (pull) {
+		glUseProgram(program[bindless_materials != NULL ? SHADER_SET_PULL_BINDLESS : SHADER_SET_PULL]);
+		glBindVertexArray(pull_vao);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, vbo);
+	}
+	else {
+		glUseProgram(program[bindless_materials != NULL ? SHADER_SET_DRAW_BINDLESS : SHADER_SET_DRAW]);
+		glBindVertexArray(vao);
+	}
+
+	if (mode == CULL_GPU) {
+		glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_INT, NULL, 0, count, 0);
+		glBindBuffer(GL_PARAMETER_BUFFER, 0);
+	}
+	else {
+		glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (const GLvoid *) offset, visible, 0);
+	}
+	submit += g_timer_elapsed(timer, NULL) - start;
+	frames++;
+
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, 0);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, 0);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+	glBindBufferBase(GL_UNIFORM_BUFFER, 0, 0);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+	if (stream != NULL) {
+		for (guint i = 0; i < G_N_ELEMENTS(streamed); i++) {
+			glActiveTexture(GL_TEXTURE1 + i);
+			glBindTexture(GL_TEXTURE_2D, 0);
+		}
+		glActiveTexture(GL_TEXTURE0);
+	}
+	glBindVertexArray(0);
+	glUseProgram(0);
+
+	ring_buffer_end(ring);
+
+	/* any fence wait means the CPU got RING_BUFFER_FRAMES frames ahead of the GPU */
+	if (time >= report) {
+		if (mode == CULL_GPU && validate) {
+			cull_validate(&frustum);
+		}
+		else if (mode == CULL_CPU) {
+			g_print("%u of %d objects visible\n", visible, count);
+		}
+		g_print("%d objects, 1 draw call, %.3f ms submit, %.1f fps, %u fence waits, %.3f ms waited\n", count, 1e3 * submit / frames, frames / (time - report + 1.0), ring->waits, 1e-3 * ring->wait_time);
+		ring_buffer_reset_stats(ring);
+		submit = 0.0;
+		frames = 0;
+		report = time + 1.0;
+	}
+
+	return TRUE;
+}
+
+/* once a second, outside of the render so the label can be laid out again */
+static void residency_update(void)
+{
+	static gdouble shown;
+	const gdouble time = g_timer_elapsed(timer, NULL);
+
+	if (time < shown) {
+		return;
+	}
+
+	GString *text = g_string_new(NULL);
+
+	g_string_append_printf(text, "%.2f of %.2f MiB resident, %.2f MiB loading\n", stream->resident / 1048576.0, stream->budget / 1048576.0, stream->loading / 1048576.0);
+	g_string_append_printf(text, "%u of %u textures sharp enough\n", stream->complete, stream->items->len);
+	g_string_append_printf(text, "%u loads, %u evictions, %u deferred in %.1f s", stream->loads, stream->evictions, stream->deferred, time - shown + 1.0);
+	for (guint i = 0; i < G_N_ELEMENTS(streamed); i++) {
+		const texture_stream_item_t *item = streamed[i];
+
+		if (item->base < item->levels) {
+			g_string_append_printf(text, "\n%s: level %d, %d x %d", item->filename, item->base, item->width, item->height);
+		}
+		else {
+			g_string_append_printf(text, "\n%s: not loaded", item->filename);
+		}
+	}
+	gtk_label_set_text(GTK_LABEL(residency), text->str);
+	g_string_free(text, TRUE);
+
+	texture_stream_reset_stats(stream);
+	shown = time + 1.0;
+}
+
+static gboolean ontick(GtkWidget *widget, GdkFrameClock *frame_clock, gpointer user_data)
+{
+	gtk_gl_area_queue_render(GTK_GL_AREA(widget));
+	if (stream != NULL && residency != NULL) {
+		residency_update();
+	}
+
+	return G_SOURCE_CONTINUE;
+}
+
+static void activate(GtkApplication *application, gpointer user_data)
+{
+	GtkWidget *window;
+	GtkWidget *drawing;
+
+	drawing = gtk_gl_area_new();
+	gtk_gl_area_set_has_depth_buffer(GTK_GL_AREA(drawing), TRUE);
+	/* glMultiDrawElementsIndirectCount() and gl_BaseInstance in the shaders are core in 4.6 */
+	gtk_gl_area_set_required_version(GTK_GL_AREA(drawing), 4, 6);
+	g_signal_connect(G_OBJECT(drawing), "realize", G_CALLBACK(realize), NULL);
+	g_signal_connect(G_OBJECT(drawing), "unrealize", G_CALLBACK(unrealize), NULL);
+	g_signal_connect(G_OBJECT(drawing), "render", G_CALLBACK(render), NULL);
+	gtk_widget_add_tick_callback(drawing, ontick, NULL, NULL);
+
+	window = gtk_application_window_new(application);
+	gtk_window_set_default_size(GTK_WINDOW(window), 800, 600);
+	if (stream_budget > 0) {
+		GtkWidget *overlay = gtk_overlay_new();
+
+		residency = gtk_label_new(NULL);
+		gtk_widget_set_halign(residency, GTK_ALIGN_START);
+		gtk_widget_set_valign(residency, GTK_ALIGN_START);
+		gtk_widget_set_margin_start(residency, 8);
+		gtk_widget_set_margin_top(residency, 8);
+		gtk_widget_add_css_class(residency, "osd");
+		gtk_overlay_set_child(GTK_OVERLAY(overlay), drawing);
+		gtk_overlay_add_overlay(GTK_OVERLAY(overlay), residency);
+		gtk_window_set_child(GTK_WINDOW(window), overlay);
+	}
+	else {
+		gtk_window_set_child(GTK_WINDOW(window), drawing);
+	}
+
+	gtk_widget_show(window);
+}
+
+int main(int argc, char *argv[])
+{
+	int result;
+	GtkApplication *application;
+
+	application = gtk_application_new(NULL, G_APPLICATION_FLAGS_NONE);
+	g_application_add_main_option_entries(G_APPLICATION(application), entries);
+	g_signal_connect(G_OBJECT(application), "activate", G_CALLBACK(activate), NULL);
+	result = g_application_run(G_APPLICATION(application), argc, argv);
+	g_object_unref(G_OBJECT(application));
+
+	return result;
+}
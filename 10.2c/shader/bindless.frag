@@ -0,0 +1,26 @@
+#version 460 core
+#extension GL_ARB_bindless_texture : require
+
+in vec3 fragNormal;
+in vec2 fragTexCoord;
+flat in uint fragMaterial;
+out vec4 FragColor;
+
+layout (std140, binding = 0) uniform Frame {
+    mat4 view;
+    mat4 projection;
+    vec3 lightDir;
+};
+
+// a texture handle per material, the same for the whole of each draw command
+layout (std430, binding = 4) readonly buffer Materials {
+    uvec2 materials[];
+};
+
+void main()
+{
+    float diffuse = max(dot(normalize(fragNormal), -lightDir), 0.0);
+    vec3 albedo = texture(sampler2D(materials[fragMaterial]), fragTexCoord).rgb;
+
+    FragColor = vec4(albedo * (0.2 + 0.8 * diffuse), 1.0);
+}
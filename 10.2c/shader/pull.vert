@@ -0,0 +1,44 @@
+#version 460 core
+
+out vec3 fragNormal;
+out vec2 fragTexCoord;
+flat out uint fragMaterial;
+
+struct Object {
+    mat4 model;
+    mat3 normal;
+    uint material;
+    uint mesh;
+};
+
+layout (std430, binding = 0) readonly buffer Objects {
+    Object objects[];
+};
+
+// the vertex buffer of the mesh pool as it is, vertex_t is position, normal and texture
+layout (std430, binding = 3) readonly buffer Vertices {
+    float vertices[];
+};
+
+layout (std140, binding = 0) uniform Frame {
+    mat4 view;
+    mat4 projection;
+    vec3 lightDir;
+};
+
+const int VERTEX_FLOATS = 8;
+
+void main()
+{
+    // gl_VertexID already has the base vertex of the command added
+    int base = gl_VertexID * VERTEX_FLOATS;
+    vec3 position = vec3(vertices[base], vertices[base + 1], vertices[base + 2]);
+    vec3 normal = vec3(vertices[base + 3], vertices[base + 4], vertices[base + 5]);
+    vec2 texCoord = vec2(vertices[base + 6], vertices[base + 7]);
+    Object object = objects[gl_BaseInstance + gl_InstanceID];
+
+    gl_Position = projection * view * object.model * vec4(position, 1.0);
+    fragNormal = object.normal * normal;
+    fragTexCoord = texCoord;
+    fragMaterial = object.material;
+}
@@ -0,0 +1,29 @@
+#version 460 core
+
+in vec3 fragNormal;
+in vec2 fragTexCoord;
+flat in uint fragMaterial;
+out vec4 FragColor;
+
+layout (std140, binding = 0) uniform Frame {
+    mat4 view;
+    mat4 projection;
+    vec3 lightDir;
+};
+
+uniform vec3 colors[4];
+uniform bool textured;
+uniform sampler2DArray materials;
+uniform bool streamed;
+uniform sampler2D streams[4];
+
+void main()
+{
+    float diffuse = max(dot(normalize(fragNormal), -lightDir), 0.0);
+
+    // the material picks the layer, or the texture unit, nothing is bound per object
+    vec3 albedo = textured ? texture(materials, vec3(fragTexCoord, fragMaterial)).rgb :
+        streamed ? texture(streams[fragMaterial], fragTexCoord).rgb : colors[fragMaterial];
+
+    FragColor = vec4(albedo * (0.2 + 0.8 * diffuse), 1.0);
+}
@@ -0,0 +1,36 @@
+#version 460 core
+
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 normal;
+layout (location = 2) in vec2 texCoord;
+out vec3 fragNormal;
+out vec2 fragTexCoord;
+flat out uint fragMaterial;
+
+struct Object {
+    mat4 model;
+    mat3 normal;
+    uint material;
+    uint mesh;
+};
+
+layout (std430, binding = 0) readonly buffer Objects {
+    Object objects[];
+};
+
+layout (std140, binding = 0) uniform Frame {
+    mat4 view;
+    mat4 projection;
+    vec3 lightDir;
+};
+
+void main()
+{
+    // culling packs the visible commands, so each carries its object as base instance
+    Object object = objects[gl_BaseInstance];
+
+    gl_Position = projection * view * object.model * vec4(position, 1.0);
+    fragNormal = object.normal * normal;
+    fragTexCoord = texCoord;
+    fragMaterial = object.material;
+}
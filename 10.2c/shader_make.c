@@ -0,0 +1,72 @@
+#include <glib.h>
+#include <shader_compile.h>
+#include <shader_make.h>
+
+GLuint shader_make(shader_set set)
+{
+	GLuint shaders[2];
+	guint count = 0;
+	GLuint program;
+	GLint success;
+
+	// draw
+	extern const GLchar _binary____10_2c_shader_shader_vert_start;
+	extern const GLchar _binary____10_2c_shader_shader_vert_end;
+	extern const GLchar _binary____10_2c_shader_shader_frag_start;
+	extern const GLchar _binary____10_2c_shader_shader_frag_end;
+
+	// pull, with the fragment shader of draw
+	extern const GLchar _binary____10_2c_shader_pull_vert_start;
+	extern const GLchar _binary____10_2c_shader_pull_vert_end;
+
+	// bindless, with the vertex shaders of draw and pull
+	extern const GLchar _binary____10_2c_shader_bindless_frag_start;
+	extern const GLchar _binary____10_2c_shader_bindless_frag_end;
+
+	// cull
+	extern const GLchar _binary____10_2c_shader_cull_comp_start;
+	extern const GLchar _binary____10_2c_shader_cull_comp_end;
+
+	switch (set) {
+	case SHADER_SET_DRAW:
+		shaders[count++] = shader_compile(GL_VERTEX_SHADER, &_binary____10_2c_shader_shader_vert_start, &_binary____10_2c_shader_shader_vert_end - &_binary____10_2c_shader_shader_vert_start);
+		shaders[count++] = shader_compile(GL_FRAGMENT_SHADER, &_binary____10_2c_shader_shader_frag_start, &_binary____10_2c_shader_shader_frag_end - &_binary____10_2c_shader_shader_frag_start);
+		break;
+	case SHADER_SET_PULL:
+		shaders[count++] = shader_compile(GL_VERTEX_SHADER, &_binary____10_2c_shader_pull_vert_start, &_binary____10_2c_shader_pull_vert_end - &_binary____10_2c_shader_pull_vert_start);
+		shaders[count++] = shader_compile(GL_FRAGMENT_SHADER, &_binary____10_2c_shader_shader_frag_start, &_binary____10_2c_shader_shader_frag_end - &_binary____10_2c_shader_shader_frag_start);
+		break;
+	case SHADER_SET_DRAW_BINDLESS:
+		shaders[count++] = shader_compile(GL_VERTEX_SHADER, &_binary____10_2c_shader_shader_vert_start, &_binary____10_2c_shader_shader_vert_end - &_binary____10_2c_shader_shader_vert_start);
+		shaders[count++] = shader_compile(GL_FRAGMENT_SHADER, &_binary____10_2c_shader_bindless_frag_start, &_binary____10_2c_shader_bindless_frag_end - &_binary____10_2c_shader_bindless_frag_start);
+		break;
+	case SHADER_SET_PULL_BINDLESS:
+		shaders[count++] = shader_compile(GL_VERTEX_SHADER, &_binary____10_2c_shader_pull_vert_start, &_binary____10_2c_shader_pull_vert_end - &_binary____10_2c_shader_pull_vert_start);
+		shaders[count++] = shader_compile(GL_FRAGMENT_SHADER, &_binary____10_2c_shader_bindless_frag_start, &_binary____10_2c_shader_bindless_frag_end - &_binary____10_2c_shader_bindless_frag_start);
+		break;
+	case SHADER_SET_CULL:
+		shaders[count++] = shader_compile(GL_COMPUTE_SHADER, &_binary____10_2c_shader_cull_comp_start, &_binary____10_2c_shader_cull_comp_end - &_binary____10_2c_shader_cull_comp_start);
+		break;
+	default:
+		return 0;
+	}
+
+	program = glCreateProgram();
+	for (guint i = 0; i < count; i++) {
+		glAttachShader(program, shaders[i]);
+	}
+	glLinkProgram(program);
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (success == GL_FALSE) {
+		GLchar message[512];
+
+		glGetProgramInfoLog(program, sizeof message, NULL, message);
+		g_error("Link error: %s\n", message);
+		program = 0;
+	}
+	for (guint i = 0; i < count; i++) {
+		glDeleteShader(shaders[i]);
+	}
+
+	return program;
+}
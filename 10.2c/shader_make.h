@@ -0,0 +1,16 @@
+#ifndef __SHADER_MAKE_H__
+#define __SHADER_MAKE_H__
+
+#include <epoxy/gl.h>
+
+typedef enum {
+	SHADER_SET_DRAW,
+	SHADER_SET_CULL,
+	SHADER_SET_PULL,
+	SHADER_SET_DRAW_BINDLESS,
+	SHADER_SET_PULL_BINDLESS,
+} shader_set;
+
+GLuint shader_make(shader_set set);
+
+#endif
@@ -1,6372 +0,0 @@
-static vertex_t vertices[] = {
-	{{+0.200000, +0.000000, +0.000000}, {-1.000000, +0.000000, +0.000000}, {0.000000, 0.000000}},
-	{{+0.207686, +0.078036, +0.000000}, {-0.980785, +0.195090, +0.000000}, {0.000000, 0.031250}},
-	{{+0.230448, +0.153073, +0.000000}, {-0.923880, +0.382683, +0.000000}, {0.000000, 0.062500}},
-	{{+0.267412, +0.222228, +0.000000}, {-0.831470, +0.555570, +0.000000}, {0.000000, 0.093750}},
-	{{+0.317157, +0.282843, +0.000000}, {-0.707107, +0.707107, +0.000000}, {0.000000, 0.125000}},
-	{{+0.377772, +0.332588, +0.000000}, {-0.555570, +0.831470, +0.000000}, {0.000000, 0.156250}},
-	{{+0.446927, +0.369552, +0.000000}, {-0.382683, +0.923880, +0.000000}, {0.000000, 0.187500}},
-	{{+0.521964, +0.392314, +0.000000}, {-0.195090, +0.980785, +0.000000}, {0.000000, 0.218750}},
-	{{+0.600000, +0.400000, +0.000000}, {-0.000000, +1.000000, +0.000000}, {0.000000, 0.250000}},
-	{{+0.678036, +0.392314, +0.000000}, {+0.195090, +0.980785, +0.000000}, {0.000000, 0.281250}},
-	{{+0.753073, +0.369552, +0.000000}, {+0.382683, +0.923880, +0.000000}, {0.000000, 0.312500}},
-	{{+0.822228, +0.332588, +0.000000}, {+0.555570, +0.831470, +0.000000}, {0.000000, 0.343750}},
-	{{+0.882843, +0.282843, +0.000000}, {+0.707107, +0.707107, +0.000000}, {0.000000, 0.375000}},
-	{{+0.932588, +0.222228, +0.000000}, {+0.831470, +0.555570, +0.000000}, {0.000000, 0.406250}},
-	{{+0.969552, +0.153073, +0.000000}, {+0.923880, +0.382683, +0.000000}, {0.000000, 0.437500}},
-	{{+0.992314, +0.078036, +0.000000}, {+0.980785, +0.195090, +0.000000}, {0.000000, 0.468750}},
-	{{+1.000000, +0.000000, +0.000000}, {+1.000000, +0.000000, +0.000000}, {0.000000, 0.500000}},
-	{{+0.992314, -0.078036, +0.000000}, {+0.980785, -0.195090, +0.000000}, {0.000000, 0.531250}},
-	{{+0.969552, -0.153073, +0.000000}, {+0.923880, -0.382683, +0.000000}, {0.000000, 0.562500}},
-	{{+0.932588, -0.222228, +0.000000}, {+0.831470, -0.555570, +0.000000}, {0.000000, 0.593750}},
-	{{+0.882843, -0.282843, +0.000000}, {+0.707107, -0.707107, +0.000000}, {0.000000, 0.625000}},
-	{{+0.822228, -0.332588, +0.000000}, {+0.555570, -0.831470, +0.000000}, {0.000000, 0.656250}},
-	{{+0.753073, -0.369552, +0.000000}, {+0.382683, -0.923880, +0.000000}, {0.000000, 0.687500}},
-	{{+0.678036, -0.392314, +0.000000}, {+0.195090, -0.980785, +0.000000}, {0.000000, 0.718750}},
-	{{+0.600000, -0.400000, +0.000000}, {+0.000000, -1.000000, +0.000000}, {0.000000, 0.750000}},
-	{{+0.521964, -0.392314, +0.000000}, {-0.195090, -0.980785, +0.000000}, {0.000000, 0.781250}},
-	{{+0.446927, -0.369552, +0.000000}, {-0.382683, -0.923880, +0.000000}, {0.000000, 0.812500}},
-	{{+0.377772, -0.332588, +0.000000}, {-0.555570, -0.831470, +0.000000}, {0.000000, 0.843750}},
-	{{+0.317157, -0.282843, +0.000000}, {-0.707107, -0.707107, +0.000000}, {0.000000, 0.875000}},
-	{{+0.267412, -0.222228, +0.000000}, {-0.831470, -0.555570, +0.000000}, {0.000000, 0.906250}},
-	{{+0.230448, -0.153073, +0.000000}, {-0.923880, -0.382683, +0.000000}, {0.000000, 0.937500}},
-	{{+0.207686, -0.078036, +0.000000}, {-0.980785, -0.195090, +0.000000}, {0.000000, 0.968750}},
-	{{+0.200000, -0.000000, +0.000000}, {-1.000000, -0.000000, +0.000000}, {0.000000, 1.000000}},
-
-	{{+0.199037, +0.000000, -0.019603}, {-0.995185, +0.000000, +0.098017}, {0.015625, 0.000000}},
-	{{+0.206686, +0.078036, -0.020357}, {-0.976063, +0.195090, +0.096134}, {0.015625, 0.031250}},
-	{{+0.229339, +0.153073, -0.022588}, {-0.919431, +0.382683, +0.090556}, {0.015625, 0.062500}},
-	{{+0.266124, +0.222228, -0.026211}, {-0.827466, +0.555570, +0.081498}, {0.015625, 0.093750}},
-	{{+0.315630, +0.282843, -0.031087}, {-0.703702, +0.707107, +0.069309}, {0.015625, 0.125000}},
-	{{+0.375953, +0.332588, -0.037028}, {-0.552895, +0.831470, +0.054455}, {0.015625, 0.156250}},
-	{{+0.444775, +0.369552, -0.043806}, {-0.380841, +0.923880, +0.037510}, {0.015625, 0.187500}},
-	{{+0.519450, +0.392314, -0.051161}, {-0.194151, +0.980785, +0.019122}, {0.015625, 0.218750}},
-	{{+0.597111, +0.400000, -0.058810}, {-0.000000, +1.000000, +0.000000}, {0.015625, 0.250000}},
-	{{+0.674771, +0.392314, -0.066459}, {+0.194151, +0.980785, -0.019122}, {0.015625, 0.281250}},
-	{{+0.749447, +0.369552, -0.073814}, {+0.380841, +0.923880, -0.037510}, {0.015625, 0.312500}},
-	{{+0.818269, +0.332588, -0.080592}, {+0.552895, +0.831470, -0.054455}, {0.015625, 0.343750}},
-	{{+0.878592, +0.282843, -0.086534}, {+0.703702, +0.707107, -0.069309}, {0.015625, 0.375000}},
-	{{+0.928097, +0.222228, -0.091410}, {+0.827466, +0.555570, -0.081498}, {0.015625, 0.406250}},
-	{{+0.964883, +0.153073, -0.095033}, {+0.919431, +0.382683, -0.090556}, {0.015625, 0.437500}},
-	{{+0.987536, +0.078036, -0.097264}, {+0.976063, +0.195090, -0.096134}, {0.015625, 0.468750}},
-	{{+0.995185, +0.000000, -0.098017}, {+0.995185, +0.000000, -0.098017}, {0.015625, 0.500000}},
-	{{+0.987536, -0.078036, -0.097264}, {+0.976063, -0.195090, -0.096134}, {0.015625, 0.531250}},
-	{{+0.964883, -0.153073, -0.095033}, {+0.919431, -0.382683, -0.090556}, {0.015625, 0.562500}},
-	{{+0.928097, -0.222228, -0.091410}, {+0.827466, -0.555570, -0.081498}, {0.015625, 0.593750}},
-	{{+0.878592, -0.282843, -0.086534}, {+0.703702, -0.707107, -0.069309}, {0.015625, 0.625000}},
-	{{+0.818269, -0.332588, -0.080592}, {+0.552895, -0.831470, -0.054455}, {0.015625, 0.656250}},
-	{{+0.749447, -0.369552, -0.073814}, {+0.380841, -0.923880, -0.037510}, {0.015625, 0.687500}},
-	{{+0.674771, -0.392314, -0.066459}, {+0.194151, -0.980785, -0.019122}, {0.015625, 0.718750}},
-	{{+0.597111, -0.400000, -0.058810}, {+0.000000, -1.000000, -0.000000}, {0.015625, 0.750000}},
-	{{+0.519450, -0.392314, -0.051161}, {-0.194151, -0.980785, +0.019122}, {0.015625, 0.781250}},
-	{{+0.444775, -0.369552, -0.043806}, {-0.380841, -0.923880, +0.037510}, {0.015625, 0.812500}},
-	{{+0.375953, -0.332588, -0.037028}, {-0.552895, -0.831470, +0.054455}, {0.015625, 0.843750}},
-	{{+0.315630, -0.282843, -0.031087}, {-0.703702, -0.707107, +0.069309}, {0.015625, 0.875000}},
-	{{+0.266124, -0.222228, -0.026211}, {-0.827466, -0.555570, +0.081498}, {0.015625, 0.906250}},
-	{{+0.229339, -0.153073, -0.022588}, {-0.919431, -0.382683, +0.090556}, {0.015625, 0.937500}},
-	{{+0.206686, -0.078036, -0.020357}, {-0.976063, -0.195090, +0.096134}, {0.015625, 0.968750}},
-	{{+0.199037, -0.000000, -0.019603}, {-0.995185, -0.000000, +0.098017}, {0.015625, 1.000000}},
-
-	{{+0.196157, +0.000000, -0.039018}, {-0.980785, +0.000000, +0.195090}, {0.031250, 0.000000}},
-	{{+0.203695, +0.078036, -0.040518}, {-0.961940, +0.195090, +0.191342}, {0.031250, 0.031250}},
-	{{+0.226020, +0.153073, -0.044958}, {-0.906127, +0.382683, +0.180240}, {0.031250, 0.062500}},
-	{{+0.262274, +0.222228, -0.052170}, {-0.815493, +0.555570, +0.162212}, {0.031250, 0.093750}},
-	{{+0.311063, +0.282843, -0.061874}, {-0.693520, +0.707107, +0.137950}, {0.031250, 0.125000}},
-	{{+0.370513, +0.332588, -0.073700}, {-0.544895, +0.831470, +0.108386}, {0.031250, 0.156250}},
-	{{+0.438339, +0.369552, -0.087191}, {-0.375330, +0.923880, +0.074658}, {0.031250, 0.187500}},
-	{{+0.511934, +0.392314, -0.101830}, {-0.191342, +0.980785, +0.038060}, {0.031250, 0.218750}},
-	{{+0.588471, +0.400000, -0.117054}, {-0.000000, +1.000000, +0.000000}, {0.031250, 0.250000}},
-	{{+0.665008, +0.392314, -0.132278}, {+0.191342, +0.980785, -0.038060}, {0.031250, 0.281250}},
-	{{+0.738603, +0.369552, -0.146917}, {+0.375330, +0.923880, -0.074658}, {0.031250, 0.312500}},
-	{{+0.806429, +0.332588, -0.160409}, {+0.544895, +0.831470, -0.108386}, {0.031250, 0.343750}},
-	{{+0.865879, +0.282843, -0.172234}, {+0.693520, +0.707107, -0.137950}, {0.031250, 0.375000}},
-	{{+0.914668, +0.222228, -0.181939}, {+0.815493, +0.555570, -0.162212}, {0.031250, 0.406250}},
-	{{+0.950922, +0.153073, -0.189150}, {+0.906127, +0.382683, -0.180240}, {0.031250, 0.437500}},
-	{{+0.973247, +0.078036, -0.193591}, {+0.961940, +0.195090, -0.191342}, {0.031250, 0.468750}},
-	{{+0.980785, +0.000000, -0.195090}, {+0.980785, +0.000000, -0.195090}, {0.031250, 0.500000}},
-	{{+0.973247, -0.078036, -0.193591}, {+0.961940, -0.195090, -0.191342}, {0.031250, 0.531250}},
-	{{+0.950922, -0.153073, -0.189150}, {+0.906127, -0.382683, -0.180240}, {0.031250, 0.562500}},
-	{{+0.914668, -0.222228, -0.181939}, {+0.815493, -0.555570, -0.162212}, {0.031250, 0.593750}},
-	{{+0.865879, -0.282843, -0.172234}, {+0.693520, -0.707107, -0.137950}, {0.031250, 0.625000}},
-	{{+0.806429, -0.332588, -0.160409}, {+0.544895, -0.831470, -0.108386}, {0.031250, 0.656250}},
-	{{+0.738603, -0.369552, -0.146917}, {+0.375330, -0.923880, -0.074658}, {0.031250, 0.687500}},
-	{{+0.665008, -0.392314, -0.132278}, {+0.191342, -0.980785, -0.038060}, {0.031250, 0.718750}},
-	{{+0.588471, -0.400000, -0.117054}, {+0.000000, -1.000000, -0.000000}, {0.031250, 0.750000}},
-	{{+0.511934, -0.392314, -0.101830}, {-0.191342, -0.980785, +0.038060}, {0.031250, 0.781250}},
-	{{+0.438339, -0.369552, -0.087191}, {-0.375330, -0.923880, +0.074658}, {0.031250, 0.812500}},
-	{{+0.370513, -0.332588, -0.073700}, {-0.544895, -0.831470, +0.108386}, {0.031250, 0.843750}},
-	{{+0.311063, -0.282843, -0.061874}, {-0.693520, -0.707107, +0.137950}, {0.031250, 0.875000}},
-	{{+0.262274, -0.222228, -0.052170}, {-0.815493, -0.555570, +0.162212}, {0.031250, 0.906250}},
-	{{+0.226020, -0.153073, -0.044958}, {-0.906127, -0.382683, +0.180240}, {0.031250, 0.937500}},
-	{{+0.203695, -0.078036, -0.040518}, {-0.961940, -0.195090, +0.191342}, {0.031250, 0.968750}},
-	{{+0.196157, -0.000000, -0.039018}, {-0.980785, -0.000000, +0.195090}, {0.031250, 1.000000}},
-
-	{{+0.191388, +0.000000, -0.058057}, {-0.956940, +0.000000, +0.290285}, {0.046875, 0.000000}},
-	{{+0.198743, +0.078036, -0.060288}, {-0.938553, +0.195090, +0.284707}, {0.046875, 0.031250}},
-	{{+0.220525, +0.153073, -0.066896}, {-0.884098, +0.382683, +0.268188}, {0.046875, 0.062500}},
-	{{+0.255897, +0.222228, -0.077626}, {-0.795667, +0.555570, +0.241363}, {0.046875, 0.093750}},
-	{{+0.303501, +0.282843, -0.092066}, {-0.676659, +0.707107, +0.205262}, {0.046875, 0.125000}},
-	{{+0.361505, +0.332588, -0.109661}, {-0.531648, +0.831470, +0.161274}, {0.046875, 0.156250}},
-	{{+0.427682, +0.369552, -0.129736}, {-0.366205, +0.923880, +0.111087}, {0.046875, 0.187500}},
-	{{+0.499488, +0.392314, -0.151518}, {-0.186690, +0.980785, +0.056632}, {0.046875, 0.218750}},
-	{{+0.574164, +0.400000, -0.174171}, {-0.000000, +1.000000, +0.000000}, {0.046875, 0.250000}},
-	{{+0.648840, +0.392314, -0.196823}, {+0.186690, +0.980785, -0.056632}, {0.046875, 0.281250}},
-	{{+0.720646, +0.369552, -0.218606}, {+0.366205, +0.923880, -0.111087}, {0.046875, 0.312500}},
-	{{+0.786823, +0.332588, -0.238680}, {+0.531648, +0.831470, -0.161274}, {0.046875, 0.343750}},
-	{{+0.844828, +0.282843, -0.256276}, {+0.676659, +0.707107, -0.205262}, {0.046875, 0.375000}},
-	{{+0.892431, +0.222228, -0.270716}, {+0.795667, +0.555570, -0.241363}, {0.046875, 0.406250}},
-	{{+0.927803, +0.153073, -0.281446}, {+0.884098, +0.382683, -0.268188}, {0.046875, 0.437500}},
-	{{+0.949585, +0.078036, -0.288054}, {+0.938553, +0.195090, -0.284707}, {0.046875, 0.468750}},
-	{{+0.956940, +0.000000, -0.290285}, {+0.956940, +0.000000, -0.290285}, {0.046875, 0.500000}},
-	{{+0.949585, -0.078036, -0.288054}, {+0.938553, -0.195090, -0.284707}, {0.046875, 0.531250}},
-	{{+0.927803, -0.153073, -0.281446}, {+0.884098, -0.382683, -0.268188}, {0.046875, 0.562500}},
-	{{+0.892431, -0.222228, -0.270716}, {+0.795667, -0.555570, -0.241363}, {0.046875, 0.593750}},
-	{{+0.844828, -0.282843, -0.256276}, {+0.676659, -0.707107, -0.205262}, {0.046875, 0.625000}},
-	{{+0.786823, -0.332588, -0.238680}, {+0.531648, -0.831470, -0.161274}, {0.046875, 0.656250}},
-	{{+0.720646, -0.369552, -0.218606}, {+0.366205, -0.923880, -0.111087}, {0.046875, 0.687500}},
-	{{+0.648840, -0.392314, -0.196823}, {+0.186690, -0.980785, -0.056632}, {0.046875, 0.718750}},
-	{{+0.574164, -0.400000, -0.174171}, {+0.000000, -1.000000, -0.000000}, {0.046875, 0.750000}},
-	{{+0.499488, -0.392314, -0.151518}, {-0.186690, -0.980785, +0.056632}, {0.046875, 0.781250}},
-	{{+0.427682, -0.369552, -0.129736}, {-0.366205, -0.923880, +0.111087}, {0.046875, 0.812500}},
-	{{+0.361505, -0.332588, -0.109661}, {-0.531648, -0.831470, +0.161274}, {0.046875, 0.843750}},
-	{{+0.303501, -0.282843, -0.092066}, {-0.676659, -0.707107, +0.205262}, {0.046875, 0.875000}},
-	{{+0.255897, -0.222228, -0.077626}, {-0.795667, -0.555570, +0.241363}, {0.046875, 0.906250}},
-	{{+0.220525, -0.153073, -0.066896}, {-0.884098, -0.382683, +0.268188}, {0.046875, 0.937500}},
-	{{+0.198743, -0.078036, -0.060288}, {-0.938553, -0.195090, +0.284707}, {0.046875, 0.968750}},
-	{{+0.191388, -0.000000, -0.058057}, {-0.956940, -0.000000, +0.290285}, {0.046875, 1.000000}},
-
-	{{+0.184776, +0.000000, -0.076537}, {-0.923880, +0.000000, +0.382683}, {0.062500, 0.000000}},
-	{{+0.191877, +0.078036, -0.079478}, {-0.906127, +0.195090, +0.375330}, {0.062500, 0.031250}},
-	{{+0.212906, +0.153073, -0.088189}, {-0.853553, +0.382683, +0.353553}, {0.062500, 0.062500}},
-	{{+0.247057, +0.222228, -0.102334}, {-0.768178, +0.555570, +0.318190}, {0.062500, 0.093750}},
-	{{+0.293015, +0.282843, -0.121371}, {-0.653281, +0.707107, +0.270598}, {0.062500, 0.125000}},
-	{{+0.349016, +0.332588, -0.144567}, {-0.513280, +0.831470, +0.212608}, {0.062500, 0.156250}},
-	{{+0.412906, +0.369552, -0.171031}, {-0.353553, +0.923880, +0.146447}, {0.062500, 0.187500}},
-	{{+0.482232, +0.392314, -0.199747}, {-0.180240, +0.980785, +0.074658}, {0.062500, 0.218750}},
-	{{+0.554328, +0.400000, -0.229610}, {-0.000000, +1.000000, +0.000000}, {0.062500, 0.250000}},
-	{{+0.626424, +0.392314, -0.259473}, {+0.180240, +0.980785, -0.074658}, {0.062500, 0.281250}},
-	{{+0.695749, +0.369552, -0.288189}, {+0.353553, +0.923880, -0.146447}, {0.062500, 0.312500}},
-	{{+0.759640, +0.332588, -0.314653}, {+0.513280, +0.831470, -0.212608}, {0.062500, 0.343750}},
-	{{+0.815640, +0.282843, -0.337849}, {+0.653281, +0.707107, -0.270598}, {0.062500, 0.375000}},
-	{{+0.861599, +0.222228, -0.356886}, {+0.768178, +0.555570, -0.318190}, {0.062500, 0.406250}},
-	{{+0.895749, +0.153073, -0.371031}, {+0.853553, +0.382683, -0.353553}, {0.062500, 0.437500}},
-	{{+0.916779, +0.078036, -0.379742}, {+0.906127, +0.195090, -0.375330}, {0.062500, 0.468750}},
-	{{+0.923880, +0.000000, -0.382683}, {+0.923880, +0.000000, -0.382683}, {0.062500, 0.500000}},
-	{{+0.916779, -0.078036, -0.379742}, {+0.906127, -0.195090, -0.375330}, {0.062500, 0.531250}},
-	{{+0.895749, -0.153073, -0.371031}, {+0.853553, -0.382683, -0.353553}, {0.062500, 0.562500}},
-	{{+0.861599, -0.222228, -0.356886}, {+0.768178, -0.555570, -0.318190}, {0.062500, 0.593750}},
-	{{+0.815640, -0.282843, -0.337849}, {+0.653281, -0.707107, -0.270598}, {0.062500, 0.625000}},
-	{{+0.759640, -0.332588, -0.314653}, {+0.513280, -0.831470, -0.212608}, {0.062500, 0.656250}},
-	{{+0.695749, -0.369552, -0.288189}, {+0.353553, -0.923880, -0.146447}, {0.062500, 0.687500}},
-	{{+0.626424, -0.392314, -0.259473}, {+0.180240, -0.980785, -0.074658}, {0.062500, 0.718750}},
-	{{+0.554328, -0.400000, -0.229610}, {+0.000000, -1.000000, -0.000000}, {0.062500, 0.750000}},
-	{{+0.482232, -0.392314, -0.199747}, {-0.180240, -0.980785, +0.074658}, {0.062500, 0.781250}},
-	{{+0.412906, -0.369552, -0.171031}, {-0.353553, -0.923880, +0.146447}, {0.062500, 0.812500}},
-	{{+0.349016, -0.332588, -0.144567}, {-0.513280, -0.831470, +0.212608}, {0.062500, 0.843750}},
-	{{+0.293015, -0.282843, -0.121371}, {-0.653281, -0.707107, +0.270598}, {0.062500, 0.875000}},
-	{{+0.247057, -0.222228, -0.102334}, {-0.768178, -0.555570, +0.318190}, {0.062500, 0.906250}},
-	{{+0.212906, -0.153073, -0.088189}, {-0.853553, -0.382683, +0.353553}, {0.062500, 0.937500}},
-	{{+0.191877, -0.078036, -0.079478}, {-0.906127, -0.195090, +0.375330}, {0.062500, 0.968750}},
-	{{+0.184776, -0.000000, -0.076537}, {-0.923880, -0.000000, +0.382683}, {0.062500, 1.000000}},
-
-	{{+0.176384, +0.000000, -0.094279}, {-0.881921, +0.000000, +0.471397}, {0.078125, 0.000000}},
-	{{+0.183163, +0.078036, -0.097902}, {-0.864975, +0.195090, +0.462339}, {0.078125, 0.031250}},
-	{{+0.203237, +0.153073, -0.108633}, {-0.814789, +0.382683, +0.435514}, {0.078125, 0.062500}},
-	{{+0.235836, +0.222228, -0.126057}, {-0.733291, +0.555570, +0.391952}, {0.078125, 0.093750}},
-	{{+0.279708, +0.282843, -0.149507}, {-0.623613, +0.707107, +0.333328}, {0.078125, 0.125000}},
-	{{+0.333165, +0.332588, -0.178080}, {-0.489969, +0.831470, +0.261894}, {0.078125, 0.156250}},
-	{{+0.394154, +0.369552, -0.210680}, {-0.337497, +0.923880, +0.180396}, {0.078125, 0.187500}},
-	{{+0.460331, +0.392314, -0.246052}, {-0.172054, +0.980785, +0.091965}, {0.078125, 0.218750}},
-	{{+0.529153, +0.400000, -0.282838}, {-0.000000, +1.000000, +0.000000}, {0.078125, 0.250000}},
-	{{+0.597974, +0.392314, -0.319624}, {+0.172054, +0.980785, -0.091965}, {0.078125, 0.281250}},
-	{{+0.664151, +0.369552, -0.354996}, {+0.337497, +0.923880, -0.180396}, {0.078125, 0.312500}},
-	{{+0.725140, +0.332588, -0.387596}, {+0.489969, +0.831470, -0.261894}, {0.078125, 0.343750}},
-	{{+0.778598, +0.282843, -0.416169}, {+0.623613, +0.707107, -0.333328}, {0.078125, 0.375000}},
-	{{+0.822469, +0.222228, -0.439619}, {+0.733291, +0.555570, -0.391952}, {0.078125, 0.406250}},
-	{{+0.855068, +0.153073, -0.457044}, {+0.814789, +0.382683, -0.435514}, {0.078125, 0.437500}},
-	{{+0.875143, +0.078036, -0.467774}, {+0.864975, +0.195090, -0.462339}, {0.078125, 0.468750}},
-	{{+0.881921, +0.000000, -0.471397}, {+0.881921, +0.000000, -0.471397}, {0.078125, 0.500000}},
-	{{+0.875143, -0.078036, -0.467774}, {+0.864975, -0.195090, -0.462339}, {0.078125, 0.531250}},
-	{{+0.855068, -0.153073, -0.457044}, {+0.814789, -0.382683, -0.435514}, {0.078125, 0.562500}},
-	{{+0.822469, -0.222228, -0.439619}, {+0.733291, -0.555570, -0.391952}, {0.078125, 0.593750}},
-	{{+0.778598, -0.282843, -0.416169}, {+0.623613, -0.707107, -0.333328}, {0.078125, 0.625000}},
-	{{+0.725140, -0.332588, -0.387596}, {+0.489969, -0.831470, -0.261894}, {0.078125, 0.656250}},
-	{{+0.664151, -0.369552, -0.354996}, {+0.337497, -0.923880, -0.180396}, {0.078125, 0.687500}},
-	{{+0.597974, -0.392314, -0.319624}, {+0.172054, -0.980785, -0.091965}, {0.078125, 0.718750}},
-	{{+0.529153, -0.400000, -0.282838}, {+0.000000, -1.000000, -0.000000}, {0.078125, 0.750000}},
-	{{+0.460331, -0.392314, -0.246052}, {-0.172054, -0.980785, +0.091965}, {0.078125, 0.781250}},
-	{{+0.394154, -0.369552, -0.210680}, {-0.337497, -0.923880, +0.180396}, {0.078125, 0.812500}},
-	{{+0.333165, -0.332588, -0.178080}, {-0.489969, -0.831470, +0.261894}, {0.078125, 0.843750}},
-	{{+0.279708, -0.282843, -0.149507}, {-0.623613, -0.707107, +0.333328}, {0.078125, 0.875000}},
-	{{+0.235836, -0.222228, -0.126057}, {-0.733291, -0.555570, +0.391952}, {0.078125, 0.906250}},
-	{{+0.203237, -0.153073, -0.108633}, {-0.814789, -0.382683, +0.435514}, {0.078125, 0.937500}},
-	{{+0.183163, -0.078036, -0.097902}, {-0.864975, -0.195090, +0.462339}, {0.078125, 0.968750}},
-	{{+0.176384, -0.000000, -0.094279}, {-0.881921, -0.000000, +0.471397}, {0.078125, 1.000000}},
-
-	{{+0.166294, +0.000000, -0.111114}, {-0.831470, +0.000000, +0.555570}, {0.093750, 0.000000}},
-	{{+0.172685, +0.078036, -0.115384}, {-0.815493, +0.195090, +0.544895}, {0.093750, 0.031250}},
-	{{+0.191611, +0.153073, -0.128030}, {-0.768178, +0.382683, +0.513280}, {0.093750, 0.062500}},
-	{{+0.222345, +0.222228, -0.148566}, {-0.691342, +0.555570, +0.461940}, {0.093750, 0.093750}},
-	{{+0.263707, +0.282843, -0.176203}, {-0.587938, +0.707107, +0.392847}, {0.093750, 0.125000}},
-	{{+0.314106, +0.332588, -0.209879}, {-0.461940, +0.831470, +0.308658}, {0.093750, 0.156250}},
-	{{+0.371606, +0.369552, -0.248299}, {-0.318190, +0.923880, +0.212608}, {0.093750, 0.187500}},
-	{{+0.433997, +0.392314, -0.289988}, {-0.162212, +0.980785, +0.108386}, {0.093750, 0.218750}},
-	{{+0.498882, +0.400000, -0.333342}, {-0.000000, +1.000000, +0.000000}, {0.093750, 0.250000}},
-	{{+0.563766, +0.392314, -0.376697}, {+0.162212, +0.980785, -0.108386}, {0.093750, 0.281250}},
-	{{+0.626158, +0.369552, -0.418385}, {+0.318190, +0.923880, -0.212608}, {0.093750, 0.312500}},
-	{{+0.683658, +0.332588, -0.456805}, {+0.461940, +0.831470, -0.308658}, {0.093750, 0.343750}},
-	{{+0.734057, +0.282843, -0.490481}, {+0.587938, +0.707107, -0.392847}, {0.093750, 0.375000}},
-	{{+0.775418, +0.222228, -0.518118}, {+0.691342, +0.555570, -0.461940}, {0.093750, 0.406250}},
-	{{+0.806153, +0.153073, -0.538654}, {+0.768178, +0.382683, -0.513280}, {0.093750, 0.437500}},
-	{{+0.825079, +0.078036, -0.551300}, {+0.815493, +0.195090, -0.544895}, {0.093750, 0.468750}},
-	{{+0.831470, +0.000000, -0.555570}, {+0.831470, +0.000000, -0.555570}, {0.093750, 0.500000}},
-	{{+0.825079, -0.078036, -0.551300}, {+0.815493, -0.195090, -0.544895}, {0.093750, 0.531250}},
-	{{+0.806153, -0.153073, -0.538654}, {+0.768178, -0.382683, -0.513280}, {0.093750, 0.562500}},
-	{{+0.775418, -0.222228, -0.518118}, {+0.691342, -0.555570, -0.461940}, {0.093750, 0.593750}},
-	{{+0.734057, -0.282843, -0.490481}, {+0.587938, -0.707107, -0.392847}, {0.093750, 0.625000}},
-	{{+0.683658, -0.332588, -0.456805}, {+0.461940, -0.831470, -0.308658}, {0.093750, 0.656250}},
-	{{+0.626158, -0.369552, -0.418385}, {+0.318190, -0.923880, -0.212608}, {0.093750, 0.687500}},
-	{{+0.563766, -0.392314, -0.376697}, {+0.162212, -0.980785, -0.108386}, {0.093750, 0.718750}},
-	{{+0.498882, -0.400000, -0.333342}, {+0.000000, -1.000000, -0.000000}, {0.093750, 0.750000}},
-	{{+0.433997, -0.392314, -0.289988}, {-0.162212, -0.980785, +0.108386}, {0.093750, 0.781250}},
-	{{+0.371606, -0.369552, -0.248299}, {-0.318190, -0.923880, +0.212608}, {0.093750, 0.812500}},
-	{{+0.314106, -0.332588, -0.209879}, {-0.461940, -0.831470, +0.308658}, {0.093750, 0.843750}},
-	{{+0.263707, -0.282843, -0.176203}, {-0.587938, -0.707107, +0.392847}, {0.093750, 0.875000}},
-	{{+0.222345, -0.222228, -0.148566}, {-0.691342, -0.555570, +0.461940}, {0.093750, 0.906250}},
-	{{+0.191611, -0.153073, -0.128030}, {-0.768178, -0.382683, +0.513280}, {0.093750, 0.937500}},
-	{{+0.172685, -0.078036, -0.115384}, {-0.815493, -0.195090, +0.544895}, {0.093750, 0.968750}},
-	{{+0.166294, -0.000000, -0.111114}, {-0.831470, -0.000000, +0.555570}, {0.093750, 1.000000}},
-
-	{{+0.154602, +0.000000, -0.126879}, {-0.773010, +0.000000, +0.634393}, {0.109375, 0.000000}},
-	{{+0.160543, +0.078036, -0.131755}, {-0.758157, +0.195090, +0.622204}, {0.109375, 0.031250}},
-	{{+0.178139, +0.153073, -0.146195}, {-0.714169, +0.382683, +0.586103}, {0.109375, 0.062500}},
-	{{+0.206712, +0.222228, -0.169644}, {-0.642735, +0.555570, +0.527479}, {0.109375, 0.093750}},
-	{{+0.245166, +0.282843, -0.201202}, {-0.546601, +0.707107, +0.448584}, {0.109375, 0.125000}},
-	{{+0.292022, +0.332588, -0.239656}, {-0.429462, +0.831470, +0.352450}, {0.109375, 0.156250}},
-	{{+0.345479, +0.369552, -0.283527}, {-0.295818, +0.923880, +0.242772}, {0.109375, 0.187500}},
-	{{+0.403484, +0.392314, -0.331130}, {-0.150807, +0.980785, +0.123764}, {0.109375, 0.218750}},
-	{{+0.463806, +0.400000, -0.380636}, {-0.000000, +1.000000, +0.000000}, {0.109375, 0.250000}},
-	{{+0.524129, +0.392314, -0.430142}, {+0.150807, +0.980785, -0.123764}, {0.109375, 0.281250}},
-	{{+0.582134, +0.369552, -0.477745}, {+0.295818, +0.923880, -0.242772}, {0.109375, 0.312500}},
-	{{+0.635591, +0.332588, -0.521616}, {+0.429462, +0.831470, -0.352450}, {0.109375, 0.343750}},
-	{{+0.682447, +0.282843, -0.560069}, {+0.546601, +0.707107, -0.448584}, {0.109375, 0.375000}},
-	{{+0.720900, +0.222228, -0.591627}, {+0.642735, +0.555570, -0.527479}, {0.109375, 0.406250}},
-	{{+0.749474, +0.153073, -0.615077}, {+0.714169, +0.382683, -0.586103}, {0.109375, 0.437500}},
-	{{+0.767069, +0.078036, -0.629517}, {+0.758157, +0.195090, -0.622204}, {0.109375, 0.468750}},
-	{{+0.773010, +0.000000, -0.634393}, {+0.773010, +0.000000, -0.634393}, {0.109375, 0.500000}},
-	{{+0.767069, -0.078036, -0.629517}, {+0.758157, -0.195090, -0.622204}, {0.109375, 0.531250}},
-	{{+0.749474, -0.153073, -0.615077}, {+0.714169, -0.382683, -0.586103}, {0.109375, 0.562500}},
-	{{+0.720900, -0.222228, -0.591627}, {+0.642735, -0.555570, -0.527479}, {0.109375, 0.593750}},
-	{{+0.682447, -0.282843, -0.560069}, {+0.546601, -0.707107, -0.448584}, {0.109375, 0.625000}},
-	{{+0.635591, -0.332588, -0.521616}, {+0.429462, -0.831470, -0.352450}, {0.109375, 0.656250}},
-	{{+0.582134, -0.369552, -0.477745}, {+0.295818, -0.923880, -0.242772}, {0.109375, 0.687500}},
-	{{+0.524129, -0.392314, -0.430142}, {+0.150807, -0.980785, -0.123764}, {0.109375, 0.718750}},
-	{{+0.463806, -0.400000, -0.380636}, {+0.000000, -1.000000, -0.000000}, {0.109375, 0.750000}},
-	{{+0.403484, -0.392314, -0.331130}, {-0.150807, -0.980785, +0.123764}, {0.109375, 0.781250}},
-	{{+0.345479, -0.369552, -0.283527}, {-0.295818, -0.923880, +0.242772}, {0.109375, 0.812500}},
-	{{+0.292022, -0.332588, -0.239656}, {-0.429462, -0.831470, +0.352450}, {0.109375, 0.843750}},
-	{{+0.245166, -0.282843, -0.201202}, {-0.546601, -0.707107, +0.448584}, {0.109375, 0.875000}},
-	{{+0.206712, -0.222228, -0.169644}, {-0.642735, -0.555570, +0.527479}, {0.109375, 0.906250}},
-	{{+0.178139, -0.153073, -0.146195}, {-0.714169, -0.382683, +0.586103}, {0.109375, 0.937500}},
-	{{+0.160543, -0.078036, -0.131755}, {-0.758157, -0.195090, +0.622204}, {0.109375, 0.968750}},
-	{{+0.154602, -0.000000, -0.126879}, {-0.773010, -0.000000, +0.634393}, {0.109375, 1.000000}},
-
-	{{+0.141421, +0.000000, -0.141421}, {-0.707107, +0.000000, +0.707107}, {0.125000, 0.000000}},
-	{{+0.146856, +0.078036, -0.146856}, {-0.693520, +0.195090, +0.693520}, {0.125000, 0.031250}},
-	{{+0.162951, +0.153073, -0.162951}, {-0.653281, +0.382683, +0.653281}, {0.125000, 0.062500}},
-	{{+0.189089, +0.222228, -0.189089}, {-0.587938, +0.555570, +0.587938}, {0.125000, 0.093750}},
-	{{+0.224264, +0.282843, -0.224264}, {-0.500000, +0.707107, +0.500000}, {0.125000, 0.125000}},
-	{{+0.267125, +0.332588, -0.267125}, {-0.392847, +0.831470, +0.392847}, {0.125000, 0.156250}},
-	{{+0.316025, +0.369552, -0.316025}, {-0.270598, +0.923880, +0.270598}, {0.125000, 0.187500}},
-	{{+0.369084, +0.392314, -0.369084}, {-0.137950, +0.980785, +0.137950}, {0.125000, 0.218750}},
-	{{+0.424264, +0.400000, -0.424264}, {-0.000000, +1.000000, +0.000000}, {0.125000, 0.250000}},
-	{{+0.479444, +0.392314, -0.479444}, {+0.137950, +0.980785, -0.137950}, {0.125000, 0.281250}},
-	{{+0.532503, +0.369552, -0.532503}, {+0.270598, +0.923880, -0.270598}, {0.125000, 0.312500}},
-	{{+0.581403, +0.332588, -0.581403}, {+0.392847, +0.831470, -0.392847}, {0.125000, 0.343750}},
-	{{+0.624264, +0.282843, -0.624264}, {+0.500000, +0.707107, -0.500000}, {0.125000, 0.375000}},
-	{{+0.659439, +0.222228, -0.659439}, {+0.587938, +0.555570, -0.587938}, {0.125000, 0.406250}},
-	{{+0.685577, +0.153073, -0.685577}, {+0.653281, +0.382683, -0.653281}, {0.125000, 0.437500}},
-	{{+0.701672, +0.078036, -0.701672}, {+0.693520, +0.195090, -0.693520}, {0.125000, 0.468750}},
-	{{+0.707107, +0.000000, -0.707107}, {+0.707107, +0.000000, -0.707107}, {0.125000, 0.500000}},
-	{{+0.701672, -0.078036, -0.701672}, {+0.693520, -0.195090, -0.693520}, {0.125000, 0.531250}},
-	{{+0.685577, -0.153073, -0.685577}, {+0.653281, -0.382683, -0.653281}, {0.125000, 0.562500}},
-	{{+0.659439, -0.222228, -0.659439}, {+0.587938, -0.555570, -0.587938}, {0.125000, 0.593750}},
-	{{+0.624264, -0.282843, -0.624264}, {+0.500000, -0.707107, -0.500000}, {0.125000, 0.625000}},
-	{{+0.581403, -0.332588, -0.581403}, {+0.392847, -0.831470, -0.392847}, {0.125000, 0.656250}},
-	{{+0.532503, -0.369552, -0.532503}, {+0.270598, -0.923880, -0.270598}, {0.125000, 0.687500}},
-	{{+0.479444, -0.392314, -0.479444}, {+0.137950, -0.980785, -0.137950}, {0.125000, 0.718750}},
-	{{+0.424264, -0.400000, -0.424264}, {+0.000000, -1.000000, -0.000000}, {0.125000, 0.750000}},
-	{{+0.369084, -0.392314, -0.369084}, {-0.137950, -0.980785, +0.137950}, {0.125000, 0.781250}},
-	{{+0.316025, -0.369552, -0.316025}, {-0.270598, -0.923880, +0.270598}, {0.125000, 0.812500}},
-	{{+0.267125, -0.332588, -0.267125}, {-0.392847, -0.831470, +0.392847}, {0.125000, 0.843750}},
-	{{+0.224264, -0.282843, -0.224264}, {-0.500000, -0.707107, +0.500000}, {0.125000, 0.875000}},
-	{{+0.189089, -0.222228, -0.189089}, {-0.587938, -0.555570, +0.587938}, {0.125000, 0.906250}},
-	{{+0.162951, -0.153073, -0.162951}, {-0.653281, -0.382683, +0.653281}, {0.125000, 0.937500}},
-	{{+0.146856, -0.078036, -0.146856}, {-0.693520, -0.195090, +0.693520}, {0.125000, 0.968750}},
-	{{+0.141421, -0.000000, -0.141421}, {-0.707107, -0.000000, +0.707107}, {0.125000, 1.000000}},
-
-	{{+0.126879, +0.000000, -0.154602}, {-0.634393, +0.000000, +0.773010}, {0.140625, 0.000000}},
-	{{+0.131755, +0.078036, -0.160543}, {-0.622204, +0.195090, +0.758157}, {0.140625, 0.031250}},
-	{{+0.146195, +0.153073, -0.178139}, {-0.586103, +0.382683, +0.714169}, {0.140625, 0.062500}},
-	{{+0.169644, +0.222228, -0.206712}, {-0.527479, +0.555570, +0.642735}, {0.140625, 0.093750}},
-	{{+0.201202, +0.282843, -0.245166}, {-0.448584, +0.707107, +0.546601}, {0.140625, 0.125000}},
-	{{+0.239656, +0.332588, -0.292022}, {-0.352450, +0.831470, +0.429462}, {0.140625, 0.156250}},
-	{{+0.283527, +0.369552, -0.345479}, {-0.242772, +0.923880, +0.295818}, {0.140625, 0.187500}},
-	{{+0.331130, +0.392314, -0.403484}, {-0.123764, +0.980785, +0.150807}, {0.140625, 0.218750}},
-	{{+0.380636, +0.400000, -0.463806}, {-0.000000, +1.000000, +0.000000}, {0.140625, 0.250000}},
-	{{+0.430142, +0.392314, -0.524129}, {+0.123764, +0.980785, -0.150807}, {0.140625, 0.281250}},
-	{{+0.477745, +0.369552, -0.582134}, {+0.242772, +0.923880, -0.295818}, {0.140625, 0.312500}},
-	{{+0.521616, +0.332588, -0.635591}, {+0.352450, +0.831470, -0.429462}, {0.140625, 0.343750}},
-	{{+0.560069, +0.282843, -0.682447}, {+0.448584, +0.707107, -0.546601}, {0.140625, 0.375000}},
-	{{+0.591627, +0.222228, -0.720900}, {+0.527479, +0.555570, -0.642735}, {0.140625, 0.406250}},
-	{{+0.615077, +0.153073, -0.749474}, {+0.586103, +0.382683, -0.714169}, {0.140625, 0.437500}},
-	{{+0.629517, +0.078036, -0.767069}, {+0.622204, +0.195090, -0.758157}, {0.140625, 0.468750}},
-	{{+0.634393, +0.000000, -0.773010}, {+0.634393, +0.000000, -0.773010}, {0.140625, 0.500000}},
-	{{+0.629517, -0.078036, -0.767069}, {+0.622204, -0.195090, -0.758157}, {0.140625, 0.531250}},
-	{{+0.615077, -0.153073, -0.749474}, {+0.586103, -0.382683, -0.714169}, {0.140625, 0.562500}},
-	{{+0.591627, -0.222228, -0.720900}, {+0.527479, -0.555570, -0.642735}, {0.140625, 0.593750}},
-	{{+0.560069, -0.282843, -0.682447}, {+0.448584, -0.707107, -0.546601}, {0.140625, 0.625000}},
-	{{+0.521616, -0.332588, -0.635591}, {+0.352450, -0.831470, -0.429462}, {0.140625, 0.656250}},
-	{{+0.477745, -0.369552, -0.582134}, {+0.242772, -0.923880, -0.295818}, {0.140625, 0.687500}},
-	{{+0.430142, -0.392314, -0.524129}, {+0.123764, -0.980785, -0.150807}, {0.140625, 0.718750}},
-	{{+0.380636, -0.400000, -0.463806}, {+0.000000, -1.000000, -0.000000}, {0.140625, 0.750000}},
-	{{+0.331130, -0.392314, -0.403484}, {-0.123764, -0.980785, +0.150807}, {0.140625, 0.781250}},
-	{{+0.283527, -0.369552, -0.345479}, {-0.242772, -0.923880, +0.295818}, {0.140625, 0.812500}},
-	{{+0.239656, -0.332588, -0.292022}, {-0.352450, -0.831470, +0.429462}, {0.140625, 0.843750}},
-	{{+0.201202, -0.282843, -0.245166}, {-0.448584, -0.707107, +0.546601}, {0.140625, 0.875000}},
-	{{+0.169644, -0.222228, -0.206712}, {-0.527479, -0.555570, +0.642735}, {0.140625, 0.906250}},
-	{{+0.146195, -0.153073, -0.178139}, {-0.586103, -0.382683, +0.714169}, {0.140625, 0.937500}},
-	{{+0.131755, -0.078036, -0.160543}, {-0.622204, -0.195090, +0.758157}, {0.140625, 0.968750}},
-	{{+0.126879, -0.000000, -0.154602}, {-0.634393, -0.000000, +0.773010}, {0.140625, 1.000000}},
-
-	{{+0.111114, +0.000000, -0.166294}, {-0.555570, +0.000000, +0.831470}, {0.156250, 0.000000}},
-	{{+0.115384, +0.078036, -0.172685}, {-0.544895, +0.195090, +0.815493}, {0.156250, 0.031250}},
-	{{+0.128030, +0.153073, -0.191611}, {-0.513280, +0.382683, +0.768178}, {0.156250, 0.062500}},
-	{{+0.148566, +0.222228, -0.222345}, {-0.461940, +0.555570, +0.691342}, {0.156250, 0.093750}},
-	{{+0.176203, +0.282843, -0.263707}, {-0.392847, +0.707107, +0.587938}, {0.156250, 0.125000}},
-	{{+0.209879, +0.332588, -0.314106}, {-0.308658, +0.831470, +0.461940}, {0.156250, 0.156250}},
-	{{+0.248299, +0.369552, -0.371606}, {-0.212608, +0.923880, +0.318190}, {0.156250, 0.187500}},
-	{{+0.289988, +0.392314, -0.433997}, {-0.108386, +0.980785, +0.162212}, {0.156250, 0.218750}},
-	{{+0.333342, +0.400000, -0.498882}, {-0.000000, +1.000000, +0.000000}, {0.156250, 0.250000}},
-	{{+0.376697, +0.392314, -0.563766}, {+0.108386, +0.980785, -0.162212}, {0.156250, 0.281250}},
-	{{+0.418385, +0.369552, -0.626158}, {+0.212608, +0.923880, -0.318190}, {0.156250, 0.312500}},
-	{{+0.456805, +0.332588, -0.683658}, {+0.308658, +0.831470, -0.461940}, {0.156250, 0.343750}},
-	{{+0.490481, +0.282843, -0.734057}, {+0.392847, +0.707107, -0.587938}, {0.156250, 0.375000}},
-	{{+0.518118, +0.222228, -0.775418}, {+0.461940, +0.555570, -0.691342}, {0.156250, 0.406250}},
-	{{+0.538654, +0.153073, -0.806153}, {+0.513280, +0.382683, -0.768178}, {0.156250, 0.437500}},
-	{{+0.551300, +0.078036, -0.825079}, {+0.544895, +0.195090, -0.815493}, {0.156250, 0.468750}},
-	{{+0.555570, +0.000000, -0.831470}, {+0.555570, +0.000000, -0.831470}, {0.156250, 0.500000}},
-	{{+0.551300, -0.078036, -0.825079}, {+0.544895, -0.195090, -0.815493}, {0.156250, 0.531250}},
-	{{+0.538654, -0.153073, -0.806153}, {+0.513280, -0.382683, -0.768178}, {0.156250, 0.562500}},
-	{{+0.518118, -0.222228, -0.775418}, {+0.461940, -0.555570, -0.691342}, {0.156250, 0.593750}},
-	{{+0.490481, -0.282843, -0.734057}, {+0.392847, -0.707107, -0.587938}, {0.156250, 0.625000}},
-	{{+0.456805, -0.332588, -0.683658}, {+0.308658, -0.831470, -0.461940}, {0.156250, 0.656250}},
-	{{+0.418385, -0.369552, -0.626158}, {+0.212608, -0.923880, -0.318190}, {0.156250, 0.687500}},
-	{{+0.376697, -0.392314, -0.563766}, {+0.108386, -0.980785, -0.162212}, {0.156250, 0.718750}},
-	{{+0.333342, -0.400000, -0.498882}, {+0.000000, -1.000000, -0.000000}, {0.156250, 0.750000}},
-	{{+0.289988, -0.392314, -0.433997}, {-0.108386, -0.980785, +0.162212}, {0.156250, 0.781250}},
-	{{+0.248299, -0.369552, -0.371606}, {-0.212608, -0.923880, +0.318190}, {0.156250, 0.812500}},
-	{{+0.209879, -0.332588, -0.314106}, {-0.308658, -0.831470, +0.461940}, {0.156250, 0.843750}},
-	{{+0.176203, -0.282843, -0.263707}, {-0.392847, -0.707107, +0.587938}, {0.156250, 0.875000}},
-	{{+0.148566, -0.222228, -0.222345}, {-0.461940, -0.555570, +0.691342}, {0.156250, 0.906250}},
-	{{+0.128030, -0.153073, -0.191611}, {-0.513280, -0.382683, +0.768178}, {0.156250, 0.937500}},
-	{{+0.115384, -0.078036, -0.172685}, {-0.544895, -0.195090, +0.815493}, {0.156250, 0.968750}},
-	{{+0.111114, -0.000000, -0.166294}, {-0.555570, -0.000000, +0.831470}, {0.156250, 1.000000}},
-
-	{{+0.094279, +0.000000, -0.176384}, {-0.471397, +0.000000, +0.881921}, {0.171875, 0.000000}},
-	{{+0.097902, +0.078036, -0.183163}, {-0.462339, +0.195090, +0.864975}, {0.171875, 0.031250}},
-	{{+0.108633, +0.153073, -0.203237}, {-0.435514, +0.382683, +0.814789}, {0.171875, 0.062500}},
-	{{+0.126057, +0.222228, -0.235836}, {-0.391952, +0.555570, +0.733291}, {0.171875, 0.093750}},
-	{{+0.149507, +0.282843, -0.279708}, {-0.333328, +0.707107, +0.623613}, {0.171875, 0.125000}},
-	{{+0.178080, +0.332588, -0.333165}, {-0.261894, +0.831470, +0.489969}, {0.171875, 0.156250}},
-	{{+0.210680, +0.369552, -0.394154}, {-0.180396, +0.923880, +0.337497}, {0.171875, 0.187500}},
-	{{+0.246052, +0.392314, -0.460331}, {-0.091965, +0.980785, +0.172054}, {0.171875, 0.218750}},
-	{{+0.282838, +0.400000, -0.529153}, {-0.000000, +1.000000, +0.000000}, {0.171875, 0.250000}},
-	{{+0.319624, +0.392314, -0.597974}, {+0.091965, +0.980785, -0.172054}, {0.171875, 0.281250}},
-	{{+0.354996, +0.369552, -0.664151}, {+0.180396, +0.923880, -0.337497}, {0.171875, 0.312500}},
-	{{+0.387596, +0.332588, -0.725140}, {+0.261894, +0.831470, -0.489969}, {0.171875, 0.343750}},
-	{{+0.416169, +0.282843, -0.778598}, {+0.333328, +0.707107, -0.623613}, {0.171875, 0.375000}},
-	{{+0.439619, +0.222228, -0.822469}, {+0.391952, +0.555570, -0.733291}, {0.171875, 0.406250}},
-	{{+0.457044, +0.153073, -0.855068}, {+0.435514, +0.382683, -0.814789}, {0.171875, 0.437500}},
-	{{+0.467774, +0.078036, -0.875143}, {+0.462339, +0.195090, -0.864975}, {0.171875, 0.468750}},
-	{{+0.471397, +0.000000, -0.881921}, {+0.471397, +0.000000, -0.881921}, {0.171875, 0.500000}},
-	{{+0.467774, -0.078036, -0.875143}, {+0.462339, -0.195090, -0.864975}, {0.171875, 0.531250}},
-	{{+0.457044, -0.153073, -0.855068}, {+0.435514, -0.382683, -0.814789}, {0.171875, 0.562500}},
-	{{+0.439619, -0.222228, -0.822469}, {+0.391952, -0.555570, -0.733291}, {0.171875, 0.593750}},
-	{{+0.416169, -0.282843, -0.778598}, {+0.333328, -0.707107, -0.623613}, {0.171875, 0.625000}},
-	{{+0.387596, -0.332588, -0.725140}, {+0.261894, -0.831470, -0.489969}, {0.171875, 0.656250}},
-	{{+0.354996, -0.369552, -0.664151}, {+0.180396, -0.923880, -0.337497}, {0.171875, 0.687500}},
-	{{+0.319624, -0.392314, -0.597974}, {+0.091965, -0.980785, -0.172054}, {0.171875, 0.718750}},
-	{{+0.282838, -0.400000, -0.529153}, {+0.000000, -1.000000, -0.000000}, {0.171875, 0.750000}},
-	{{+0.246052, -0.392314, -0.460331}, {-0.091965, -0.980785, +0.172054}, {0.171875, 0.781250}},
-	{{+0.210680, -0.369552, -0.394154}, {-0.180396, -0.923880, +0.337497}, {0.171875, 0.812500}},
-	{{+0.178080, -0.332588, -0.333165}, {-0.261894, -0.831470, +0.489969}, {0.171875, 0.843750}},
-	{{+0.149507, -0.282843, -0.279708}, {-0.333328, -0.707107, +0.623613}, {0.171875, 0.875000}},
-	{{+0.126057, -0.222228, -0.235836}, {-0.391952, -0.555570, +0.733291}, {0.171875, 0.906250}},
-	{{+0.108633, -0.153073, -0.203237}, {-0.435514, -0.382683, +0.814789}, {0.171875, 0.937500}},
-	{{+0.097902, -0.078036, -0.183163}, {-0.462339, -0.195090, +0.864975}, {0.171875, 0.968750}},
-	{{+0.094279, -0.000000, -0.176384}, {-0.471397, -0.000000, +0.881921}, {0.171875, 1.000000}},
-
-	{{+0.076537, +0.000000, -0.184776}, {-0.382683, +0.000000, +0.923880}, {0.187500, 0.000000}},
-	{{+0.079478, +0.078036, -0.191877}, {-0.375330, +0.195090, +0.906127}, {0.187500, 0.031250}},
-	{{+0.088189, +0.153073, -0.212906}, {-0.353553, +0.382683, +0.853553}, {0.187500, 0.062500}},
-	{{+0.102334, +0.222228, -0.247057}, {-0.318190, +0.555570, +0.768178}, {0.187500, 0.093750}},
-	{{+0.121371, +0.282843, -0.293015}, {-0.270598, +0.707107, +0.653281}, {0.187500, 0.125000}},
-	{{+0.144567, +0.332588, -0.349016}, {-0.212608, +0.831470, +0.513280}, {0.187500, 0.156250}},
-	{{+0.171031, +0.369552, -0.412906}, {-0.146447, +0.923880, +0.353553}, {0.187500, 0.187500}},
-	{{+0.199747, +0.392314, -0.482232}, {-0.074658, +0.980785, +0.180240}, {0.187500, 0.218750}},
-	{{+0.229610, +0.400000, -0.554328}, {-0.000000, +1.000000, +0.000000}, {0.187500, 0.250000}},
-	{{+0.259473, +0.392314, -0.626424}, {+0.074658, +0.980785, -0.180240}, {0.187500, 0.281250}},
-	{{+0.288189, +0.369552, -0.695749}, {+0.146447, +0.923880, -0.353553}, {0.187500, 0.312500}},
-	{{+0.314653, +0.332588, -0.759640}, {+0.212608, +0.831470, -0.513280}, {0.187500, 0.343750}},
-	{{+0.337849, +0.282843, -0.815640}, {+0.270598, +0.707107, -0.653281}, {0.187500, 0.375000}},
-	{{+0.356886, +0.222228, -0.861599}, {+0.318190, +0.555570, -0.768178}, {0.187500, 0.406250}},
-	{{+0.371031, +0.153073, -0.895749}, {+0.353553, +0.382683, -0.853553}, {0.187500, 0.437500}},
-	{{+0.379742, +0.078036, -0.916779}, {+0.375330, +0.195090, -0.906127}, {0.187500, 0.468750}},
-	{{+0.382683, +0.000000, -0.923880}, {+0.382683, +0.000000, -0.923880}, {0.187500, 0.500000}},
-	{{+0.379742, -0.078036, -0.916779}, {+0.375330, -0.195090, -0.906127}, {0.187500, 0.531250}},
-	{{+0.371031, -0.153073, -0.895749}, {+0.353553, -0.382683, -0.853553}, {0.187500, 0.562500}},
-	{{+0.356886, -0.222228, -0.861599}, {+0.318190, -0.555570, -0.768178}, {0.187500, 0.593750}},
-	{{+0.337849, -0.282843, -0.815640}, {+0.270598, -0.707107, -0.653281}, {0.187500, 0.625000}},
-	{{+0.314653, -0.332588, -0.759640}, {+0.212608, -0.831470, -0.513280}, {0.187500, 0.656250}},
-	{{+0.288189, -0.369552, -0.695749}, {+0.146447, -0.923880, -0.353553}, {0.187500, 0.687500}},
-	{{+0.259473, -0.392314, -0.626424}, {+0.074658, -0.980785, -0.180240}, {0.187500, 0.718750}},
-	{{+0.229610, -0.400000, -0.554328}, {+0.000000, -1.000000, -0.000000}, {0.187500, 0.750000}},
-	{{+0.199747, -0.392314, -0.482232}, {-0.074658, -0.980785, +0.180240}, {0.187500, 0.781250}},
-	{{+0.171031, -0.369552, -0.412906}, {-0.146447, -0.923880, +0.353553}, {0.187500, 0.812500}},
-	{{+0.144567, -0.332588, -0.349016}, {-0.212608, -0.831470, +0.513280}, {0.187500, 0.843750}},
-	{{+0.121371, -0.282843, -0.293015}, {-0.270598, -0.707107, +0.653281}, {0.187500, 0.875000}},
-	{{+0.102334, -0.222228, -0.247057}, {-0.318190, -0.555570, +0.768178}, {0.187500, 0.906250}},
-	{{+0.088189, -0.153073, -0.212906}, {-0.353553, -0.382683, +0.853553}, {0.187500, 0.937500}},
-	{{+0.079478, -0.078036, -0.191877}, {-0.375330, -0.195090, +0.906127}, {0.187500, 0.968750}},
-	{{+0.076537, -0.000000, -0.184776}, {-0.382683, -0.000000, +0.923880}, {0.187500, 1.000000}},
-
-	{{+0.058057, +0.000000, -0.191388}, {-0.290285, +0.000000, +0.956940}, {0.203125, 0.000000}},
-	{{+0.060288, +0.078036, -0.198743}, {-0.284707, +0.195090, +0.938553}, {0.203125, 0.031250}},
-	{{+0.066896, +0.153073, -0.220525}, {-0.268188, +0.382683, +0.884098}, {0.203125, 0.062500}},
-	{{+0.077626, +0.222228, -0.255897}, {-0.241363, +0.555570, +0.795667}, {0.203125, 0.093750}},
-	{{+0.092066, +0.282843, -0.303501}, {-0.205262, +0.707107, +0.676659}, {0.203125, 0.125000}},
-	{{+0.109661, +0.332588, -0.361505}, {-0.161274, +0.831470, +0.531648}, {0.203125, 0.156250}},
-	{{+0.129736, +0.369552, -0.427682}, {-0.111087, +0.923880, +0.366205}, {0.203125, 0.187500}},
-	{{+0.151518, +0.392314, -0.499488}, {-0.056632, +0.980785, +0.186690}, {0.203125, 0.218750}},
-	{{+0.174171, +0.400000, -0.574164}, {-0.000000, +1.000000, +0.000000}, {0.203125, 0.250000}},
-	{{+0.196823, +0.392314, -0.648840}, {+0.056632, +0.980785, -0.186690}, {0.203125, 0.281250}},
-	{{+0.218606, +0.369552, -0.720646}, {+0.111087, +0.923880, -0.366205}, {0.203125, 0.312500}},
-	{{+0.238680, +0.332588, -0.786823}, {+0.161274, +0.831470, -0.531648}, {0.203125, 0.343750}},
-	{{+0.256276, +0.282843, -0.844828}, {+0.205262, +0.707107, -0.676659}, {0.203125, 0.375000}},
-	{{+0.270716, +0.222228, -0.892431}, {+0.241363, +0.555570, -0.795667}, {0.203125, 0.406250}},
-	{{+0.281446, +0.153073, -0.927803}, {+0.268188, +0.382683, -0.884098}, {0.203125, 0.437500}},
-	{{+0.288054, +0.078036, -0.949585}, {+0.284707, +0.195090, -0.938553}, {0.203125, 0.468750}},
-	{{+0.290285, +0.000000, -0.956940}, {+0.290285, +0.000000, -0.956940}, {0.203125, 0.500000}},
-	{{+0.288054, -0.078036, -0.949585}, {+0.284707, -0.195090, -0.938553}, {0.203125, 0.531250}},
-	{{+0.281446, -0.153073, -0.927803}, {+0.268188, -0.382683, -0.884098}, {0.203125, 0.562500}},
-	{{+0.270716, -0.222228, -0.892431}, {+0.241363, -0.555570, -0.795667}, {0.203125, 0.593750}},
-	{{+0.256276, -0.282843, -0.844828}, {+0.205262, -0.707107, -0.676659}, {0.203125, 0.625000}},
-	{{+0.238680, -0.332588, -0.786823}, {+0.161274, -0.831470, -0.531648}, {0.203125, 0.656250}},
-	{{+0.218606, -0.369552, -0.720646}, {+0.111087, -0.923880, -0.366205}, {0.203125, 0.687500}},
-	{{+0.196823, -0.392314, -0.648840}, {+0.056632, -0.980785, -0.186690}, {0.203125, 0.718750}},
-	{{+0.174171, -0.400000, -0.574164}, {+0.000000, -1.000000, -0.000000}, {0.203125, 0.750000}},
-	{{+0.151518, -0.392314, -0.499488}, {-0.056632, -0.980785, +0.186690}, {0.203125, 0.781250}},
-	{{+0.129736, -0.369552, -0.427682}, {-0.111087, -0.923880, +0.366205}, {0.203125, 0.812500}},
-	{{+0.109661, -0.332588, -0.361505}, {-0.161274, -0.831470, +0.531648}, {0.203125, 0.843750}},
-	{{+0.092066, -0.282843, -0.303501}, {-0.205262, -0.707107, +0.676659}, {0.203125, 0.875000}},
-	{{+0.077626, -0.222228, -0.255897}, {-0.241363, -0.555570, +0.795667}, {0.203125, 0.906250}},
-	{{+0.066896, -0.153073, -0.220525}, {-0.268188, -0.382683, +0.884098}, {0.203125, 0.937500}},
-	{{+0.060288, -0.078036, -0.198743}, {-0.284707, -0.195090, +0.938553}, {0.203125, 0.968750}},
-	{{+0.058057, -0.000000, -0.191388}, {-0.290285, -0.000000, +0.956940}, {0.203125, 1.000000}},
-
-	{{+0.039018, +0.000000, -0.196157}, {-0.195090, +0.000000, +0.980785}, {0.218750, 0.000000}},
-	{{+0.040518, +0.078036, -0.203695}, {-0.191342, +0.195090, +0.961940}, {0.218750, 0.031250}},
-	{{+0.044958, +0.153073, -0.226020}, {-0.180240, +0.382683, +0.906127}, {0.218750, 0.062500}},
-	{{+0.052170, +0.222228, -0.262274}, {-0.162212, +0.555570, +0.815493}, {0.218750, 0.093750}},
-	{{+0.061874, +0.282843, -0.311063}, {-0.137950, +0.707107, +0.693520}, {0.218750, 0.125000}},
-	{{+0.073700, +0.332588, -0.370513}, {-0.108386, +0.831470, +0.544895}, {0.218750, 0.156250}},
-	{{+0.087191, +0.369552, -0.438339}, {-0.074658, +0.923880, +0.375330}, {0.218750, 0.187500}},
-	{{+0.101830, +0.392314, -0.511934}, {-0.038060, +0.980785, +0.191342}, {0.218750, 0.218750}},
-	{{+0.117054, +0.400000, -0.588471}, {-0.000000, +1.000000, +0.000000}, {0.218750, 0.250000}},
-	{{+0.132278, +0.392314, -0.665008}, {+0.038060, +0.980785, -0.191342}, {0.218750, 0.281250}},
-	{{+0.146917, +0.369552, -0.738603}, {+0.074658, +0.923880, -0.375330}, {0.218750, 0.312500}},
-	{{+0.160409, +0.332588, -0.806429}, {+0.108386, +0.831470, -0.544895}, {0.218750, 0.343750}},
-	{{+0.172234, +0.282843, -0.865879}, {+0.137950, +0.707107, -0.693520}, {0.218750, 0.375000}},
-	{{+0.181939, +0.222228, -0.914668}, {+0.162212, +0.555570, -0.815493}, {0.218750, 0.406250}},
-	{{+0.189150, +0.153073, -0.950922}, {+0.180240, +0.382683, -0.906127}, {0.218750, 0.437500}},
-	{{+0.193591, +0.078036, -0.973247}, {+0.191342, +0.195090, -0.961940}, {0.218750, 0.468750}},
-	{{+0.195090, +0.000000, -0.980785}, {+0.195090, +0.000000, -0.980785}, {0.218750, 0.500000}},
-	{{+0.193591, -0.078036, -0.973247}, {+0.191342, -0.195090, -0.961940}, {0.218750, 0.531250}},
-	{{+0.189150, -0.153073, -0.950922}, {+0.180240, -0.382683, -0.906127}, {0.218750, 0.562500}},
-	{{+0.181939, -0.222228, -0.914668}, {+0.162212, -0.555570, -0.815493}, {0.218750, 0.593750}},
-	{{+0.172234, -0.282843, -0.865879}, {+0.137950, -0.707107, -0.693520}, {0.218750, 0.625000}},
-	{{+0.160409, -0.332588, -0.806429}, {+0.108386, -0.831470, -0.544895}, {0.218750, 0.656250}},
-	{{+0.146917, -0.369552, -0.738603}, {+0.074658, -0.923880, -0.375330}, {0.218750, 0.687500}},
-	{{+0.132278, -0.392314, -0.665008}, {+0.038060, -0.980785, -0.191342}, {0.218750, 0.718750}},
-	{{+0.117054, -0.400000, -0.588471}, {+0.000000, -1.000000, -0.000000}, {0.218750, 0.750000}},
-	{{+0.101830, -0.392314, -0.511934}, {-0.038060, -0.980785, +0.191342}, {0.218750, 0.781250}},
-	{{+0.087191, -0.369552, -0.438339}, {-0.074658, -0.923880, +0.375330}, {0.218750, 0.812500}},
-	{{+0.073700, -0.332588, -0.370513}, {-0.108386, -0.831470, +0.544895}, {0.218750, 0.843750}},
-	{{+0.061874, -0.282843, -0.311063}, {-0.137950, -0.707107, +0.693520}, {0.218750, 0.875000}},
-	{{+0.052170, -0.222228, -0.262274}, {-0.162212, -0.555570, +0.815493}, {0.218750, 0.906250}},
-	{{+0.044958, -0.153073, -0.226020}, {-0.180240, -0.382683, +0.906127}, {0.218750, 0.937500}},
-	{{+0.040518, -0.078036, -0.203695}, {-0.191342, -0.195090, +0.961940}, {0.218750, 0.968750}},
-	{{+0.039018, -0.000000, -0.196157}, {-0.195090, -0.000000, +0.980785}, {0.218750, 1.000000}},
-
-	{{+0.019603, +0.000000, -0.199037}, {-0.098017, +0.000000, +0.995185}, {0.234375, 0.000000}},
-	{{+0.020357, +0.078036, -0.206686}, {-0.096134, +0.195090, +0.976063}, {0.234375, 0.031250}},
-	{{+0.022588, +0.153073, -0.229339}, {-0.090556, +0.382683, +0.919431}, {0.234375, 0.062500}},
-	{{+0.026211, +0.222228, -0.266124}, {-0.081498, +0.555570, +0.827466}, {0.234375, 0.093750}},
-	{{+0.031087, +0.282843, -0.315630}, {-0.069309, +0.707107, +0.703702}, {0.234375, 0.125000}},
-	{{+0.037028, +0.332588, -0.375953}, {-0.054455, +0.831470, +0.552895}, {0.234375, 0.156250}},
-	{{+0.043806, +0.369552, -0.444775}, {-0.037510, +0.923880, +0.380841}, {0.234375, 0.187500}},
-	{{+0.051161, +0.392314, -0.519450}, {-0.019122, +0.980785, +0.194151}, {0.234375, 0.218750}},
-	{{+0.058810, +0.400000, -0.597111}, {-0.000000, +1.000000, +0.000000}, {0.234375, 0.250000}},
-	{{+0.066459, +0.392314, -0.674771}, {+0.019122, +0.980785, -0.194151}, {0.234375, 0.281250}},
-	{{+0.073814, +0.369552, -0.749447}, {+0.037510, +0.923880, -0.380841}, {0.234375, 0.312500}},
-	{{+0.080592, +0.332588, -0.818269}, {+0.054455, +0.831470, -0.552895}, {0.234375, 0.343750}},
-	{{+0.086534, +0.282843, -0.878592}, {+0.069309, +0.707107, -0.703702}, {0.234375, 0.375000}},
-	{{+0.091410, +0.222228, -0.928097}, {+0.081498, +0.555570, -0.827466}, {0.234375, 0.406250}},
-	{{+0.095033, +0.153073, -0.964883}, {+0.090556, +0.382683, -0.919431}, {0.234375, 0.437500}},
-	{{+0.097264, +0.078036, -0.987536}, {+0.096134, +0.195090, -0.976063}, {0.234375, 0.468750}},
-	{{+0.098017, +0.000000, -0.995185}, {+0.098017, +0.000000, -0.995185}, {0.234375, 0.500000}},
-	{{+0.097264, -0.078036, -0.987536}, {+0.096134, -0.195090, -0.976063}, {0.234375, 0.531250}},
-	{{+0.095033, -0.153073, -0.964883}, {+0.090556, -0.382683, -0.919431}, {0.234375, 0.562500}},
-	{{+0.091410, -0.222228, -0.928097}, {+0.081498, -0.555570, -0.827466}, {0.234375, 0.593750}},
-	{{+0.086534, -0.282843, -0.878592}, {+0.069309, -0.707107, -0.703702}, {0.234375, 0.625000}},
-	{{+0.080592, -0.332588, -0.818269}, {+0.054455, -0.831470, -0.552895}, {0.234375, 0.656250}},
-	{{+0.073814, -0.369552, -0.749447}, {+0.037510, -0.923880, -0.380841}, {0.234375, 0.687500}},
-	{{+0.066459, -0.392314, -0.674771}, {+0.019122, -0.980785, -0.194151}, {0.234375, 0.718750}},
-	{{+0.058810, -0.400000, -0.597111}, {+0.000000, -1.000000, -0.000000}, {0.234375, 0.750000}},
-	{{+0.051161, -0.392314, -0.519450}, {-0.019122, -0.980785, +0.194151}, {0.234375, 0.781250}},
-	{{+0.043806, -0.369552, -0.444775}, {-0.037510, -0.923880, +0.380841}, {0.234375, 0.812500}},
-	{{+0.037028, -0.332588, -0.375953}, {-0.054455, -0.831470, +0.552895}, {0.234375, 0.843750}},
-	{{+0.031087, -0.282843, -0.315630}, {-0.069309, -0.707107, +0.703702}, {0.234375, 0.875000}},
-	{{+0.026211, -0.222228, -0.266124}, {-0.081498, -0.555570, +0.827466}, {0.234375, 0.906250}},
-	{{+0.022588, -0.153073, -0.229339}, {-0.090556, -0.382683, +0.919431}, {0.234375, 0.937500}},
-	{{+0.020357, -0.078036, -0.206686}, {-0.096134, -0.195090, +0.976063}, {0.234375, 0.968750}},
-	{{+0.019603, -0.000000, -0.199037}, {-0.098017, -0.000000, +0.995185}, {0.234375, 1.000000}},
-
-	{{-0.000000, +0.000000, -0.200000}, {-0.000000, +0.000000, +1.000000}, {0.250000, 0.000000}},
-	{{+0.000000, +0.078036, -0.207686}, {-0.000000, +0.195090, +0.980785}, {0.250000, 0.031250}},
-	{{-0.000000, +0.153073, -0.230448}, {+0.000000, +0.382683, +0.923880}, {0.250000, 0.062500}},
-	{{+0.000000, +0.222228, -0.267412}, {-0.000000, +0.555570, +0.831470}, {0.250000, 0.093750}},
-	{{+0.000000, +0.282843, -0.317157}, {-0.000000, +0.707107, +0.707107}, {0.250000, 0.125000}},
-	{{+0.000000, +0.332588, -0.377772}, {+0.000000, +0.831470, +0.555570}, {0.250000, 0.156250}},
-	{{-0.000000, +0.369552, -0.446927}, {-0.000000, +0.923880, +0.382683}, {0.250000, 0.187500}},
-	{{+0.000000, +0.392314, -0.521964}, {+0.000000, +0.980785, +0.195090}, {0.250000, 0.218750}},
-	{{-0.000000, +0.400000, -0.600000}, {-0.000000, +1.000000, +0.000000}, {0.250000, 0.250000}},
-	{{+0.000000, +0.392314, -0.678036}, {-0.000000, +0.980785, -0.195090}, {0.250000, 0.281250}},
-	{{+0.000000, +0.369552, -0.753073}, {+0.000000, +0.923880, -0.382683}, {0.250000, 0.312500}},
-	{{+0.000000, +0.332588, -0.822228}, {+0.000000, +0.831470, -0.555570}, {0.250000, 0.343750}},
-	{{-0.000000, +0.282843, -0.882843}, {-0.000000, +0.707107, -0.707107}, {0.250000, 0.375000}},
-	{{+0.000000, +0.222228, -0.932588}, {+0.000000, +0.555570, -0.831470}, {0.250000, 0.406250}},
-	{{-0.000000, +0.153073, -0.969552}, {-0.000000, +0.382683, -0.923880}, {0.250000, 0.437500}},
-	{{+0.000000, +0.078036, -0.992314}, {+0.000000, +0.195090, -0.980785}, {0.250000, 0.468750}},
-	{{+0.000000, +0.000000, -1.000000}, {+0.000000, +0.000000, -1.000000}, {0.250000, 0.500000}},
-	{{+0.000000, -0.078036, -0.992314}, {+0.000000, -0.195090, -0.980785}, {0.250000, 0.531250}},
-	{{-0.000000, -0.153073, -0.969552}, {-0.000000, -0.382683, -0.923880}, {0.250000, 0.562500}},
-	{{-0.000000, -0.222228, -0.932588}, {+0.000000, -0.555570, -0.831470}, {0.250000, 0.593750}},
-	{{-0.000000, -0.282843, -0.882843}, {+0.000000, -0.707107, -0.707107}, {0.250000, 0.625000}},
-	{{+0.000000, -0.332588, -0.822228}, {+0.000000, -0.831470, -0.555570}, {0.250000, 0.656250}},
-	{{+0.000000, -0.369552, -0.753073}, {-0.000000, -0.923880, -0.382683}, {0.250000, 0.687500}},
-	{{+0.000000, -0.392314, -0.678036}, {+0.000000, -0.980785, -0.195090}, {0.250000, 0.718750}},
-	{{+0.000000, -0.400000, -0.600000}, {+0.000000, -1.000000, -0.000000}, {0.250000, 0.750000}},
-	{{+0.000000, -0.392314, -0.521964}, {-0.000000, -0.980785, +0.195090}, {0.250000, 0.781250}},
-	{{-0.000000, -0.369552, -0.446927}, {-0.000000, -0.923880, +0.382683}, {0.250000, 0.812500}},
-	{{-0.000000, -0.332588, -0.377772}, {-0.000000, -0.831470, +0.555570}, {0.250000, 0.843750}},
-	{{+0.000000, -0.282843, -0.317157}, {+0.000000, -0.707107, +0.707107}, {0.250000, 0.875000}},
-	{{+0.000000, -0.222228, -0.267412}, {-0.000000, -0.555570, +0.831470}, {0.250000, 0.906250}},
-	{{+0.000000, -0.153073, -0.230448}, {-0.000000, -0.382683, +0.923880}, {0.250000, 0.937500}},
-	{{+0.000000, -0.078036, -0.207686}, {-0.000000, -0.195090, +0.980785}, {0.250000, 0.968750}},
-	{{-0.000000, -0.000000, -0.200000}, {-0.000000, -0.000000, +1.000000}, {0.250000, 1.000000}},
-
-	{{-0.019603, +0.000000, -0.199037}, {+0.098017, +0.000000, +0.995185}, {0.265625, 0.000000}},
-	{{-0.020357, +0.078036, -0.206686}, {+0.096134, +0.195090, +0.976063}, {0.265625, 0.031250}},
-	{{-0.022588, +0.153073, -0.229339}, {+0.090556, +0.382683, +0.919431}, {0.265625, 0.062500}},
-	{{-0.026211, +0.222228, -0.266124}, {+0.081498, +0.555570, +0.827466}, {0.265625, 0.093750}},
-	{{-0.031087, +0.282843, -0.315630}, {+0.069309, +0.707107, +0.703702}, {0.265625, 0.125000}},
-	{{-0.037028, +0.332588, -0.375953}, {+0.054455, +0.831470, +0.552895}, {0.265625, 0.156250}},
-	{{-0.043806, +0.369552, -0.444775}, {+0.037510, +0.923880, +0.380841}, {0.265625, 0.187500}},
-	{{-0.051161, +0.392314, -0.519450}, {+0.019122, +0.980785, +0.194151}, {0.265625, 0.218750}},
-	{{-0.058810, +0.400000, -0.597111}, {+0.000000, +1.000000, +0.000000}, {0.265625, 0.250000}},
-	{{-0.066459, +0.392314, -0.674771}, {-0.019122, +0.980785, -0.194151}, {0.265625, 0.281250}},
-	{{-0.073814, +0.369552, -0.749447}, {-0.037510, +0.923880, -0.380841}, {0.265625, 0.312500}},
-	{{-0.080592, +0.332588, -0.818269}, {-0.054455, +0.831470, -0.552895}, {0.265625, 0.343750}},
-	{{-0.086534, +0.282843, -0.878592}, {-0.069309, +0.707107, -0.703702}, {0.265625, 0.375000}},
-	{{-0.091410, +0.222228, -0.928097}, {-0.081498, +0.555570, -0.827466}, {0.265625, 0.406250}},
-	{{-0.095033, +0.153073, -0.964883}, {-0.090556, +0.382683, -0.919431}, {0.265625, 0.437500}},
-	{{-0.097264, +0.078036, -0.987536}, {-0.096134, +0.195090, -0.976063}, {0.265625, 0.468750}},
-	{{-0.098017, +0.000000, -0.995185}, {-0.098017, +0.000000, -0.995185}, {0.265625, 0.500000}},
-	{{-0.097264, -0.078036, -0.987536}, {-0.096134, -0.195090, -0.976063}, {0.265625, 0.531250}},
-	{{-0.095033, -0.153073, -0.964883}, {-0.090556, -0.382683, -0.919431}, {0.265625, 0.562500}},
-	{{-0.091410, -0.222228, -0.928097}, {-0.081498, -0.555570, -0.827466}, {0.265625, 0.593750}},
-	{{-0.086534, -0.282843, -0.878592}, {-0.069309, -0.707107, -0.703702}, {0.265625, 0.625000}},
-	{{-0.080592, -0.332588, -0.818269}, {-0.054455, -0.831470, -0.552895}, {0.265625, 0.656250}},
-	{{-0.073814, -0.369552, -0.749447}, {-0.037510, -0.923880, -0.380841}, {0.265625, 0.687500}},
-	{{-0.066459, -0.392314, -0.674771}, {-0.019122, -0.980785, -0.194151}, {0.265625, 0.718750}},
-	{{-0.058810, -0.400000, -0.597111}, {-0.000000, -1.000000, -0.000000}, {0.265625, 0.750000}},
-	{{-0.051161, -0.392314, -0.519450}, {+0.019122, -0.980785, +0.194151}, {0.265625, 0.781250}},
-	{{-0.043806, -0.369552, -0.444775}, {+0.037510, -0.923880, +0.380841}, {0.265625, 0.812500}},
-	{{-0.037028, -0.332588, -0.375953}, {+0.054455, -0.831470, +0.552895}, {0.265625, 0.843750}},
-	{{-0.031087, -0.282843, -0.315630}, {+0.069309, -0.707107, +0.703702}, {0.265625, 0.875000}},
-	{{-0.026211, -0.222228, -0.266124}, {+0.081498, -0.555570, +0.827466}, {0.265625, 0.906250}},
-	{{-0.022588, -0.153073, -0.229339}, {+0.090556, -0.382683, +0.919431}, {0.265625, 0.937500}},
-	{{-0.020357, -0.078036, -0.206686}, {+0.096134, -0.195090, +0.976063}, {0.265625, 0.968750}},
-	{{-0.019603, -0.000000, -0.199037}, {+0.098017, -0.000000, +0.995185}, {0.265625, 1.000000}},
-
-	{{-0.039018, +0.000000, -0.196157}, {+0.195090, +0.000000, +0.980785}, {0.281250, 0.000000}},
-	{{-0.040518, +0.078036, -0.203695}, {+0.191342, +0.195090, +0.961940}, {0.281250, 0.031250}},
-	{{-0.044958, +0.153073, -0.226020}, {+0.180240, +0.382683, +0.906127}, {0.281250, 0.062500}},
-	{{-0.052170, +0.222228, -0.262274}, {+0.162212, +0.555570, +0.815493}, {0.281250, 0.093750}},
-	{{-0.061874, +0.282843, -0.311063}, {+0.137950, +0.707107, +0.693520}, {0.281250, 0.125000}},
-	{{-0.073700, +0.332588, -0.370513}, {+0.108386, +0.831470, +0.544895}, {0.281250, 0.156250}},
-	{{-0.087191, +0.369552, -0.438339}, {+0.074658, +0.923880, +0.375330}, {0.281250, 0.187500}},
-	{{-0.101830, +0.392314, -0.511934}, {+0.038060, +0.980785, +0.191342}, {0.281250, 0.218750}},
-	{{-0.117054, +0.400000, -0.588471}, {+0.000000, +1.000000, +0.000000}, {0.281250, 0.250000}},
-	{{-0.132278, +0.392314, -0.665008}, {-0.038060, +0.980785, -0.191342}, {0.281250, 0.281250}},
-	{{-0.146917, +0.369552, -0.738603}, {-0.074658, +0.923880, -0.375330}, {0.281250, 0.312500}},
-	{{-0.160409, +0.332588, -0.806429}, {-0.108386, +0.831470, -0.544895}, {0.281250, 0.343750}},
-	{{-0.172234, +0.282843, -0.865879}, {-0.137950, +0.707107, -0.693520}, {0.281250, 0.375000}},
-	{{-0.181939, +0.222228, -0.914668}, {-0.162212, +0.555570, -0.815493}, {0.281250, 0.406250}},
-	{{-0.189150, +0.153073, -0.950922}, {-0.180240, +0.382683, -0.906127}, {0.281250, 0.437500}},
-	{{-0.193591, +0.078036, -0.973247}, {-0.191342, +0.195090, -0.961940}, {0.281250, 0.468750}},
-	{{-0.195090, +0.000000, -0.980785}, {-0.195090, +0.000000, -0.980785}, {0.281250, 0.500000}},
-	{{-0.193591, -0.078036, -0.973247}, {-0.191342, -0.195090, -0.961940}, {0.281250, 0.531250}},
-	{{-0.189150, -0.153073, -0.950922}, {-0.180240, -0.382683, -0.906127}, {0.281250, 0.562500}},
-	{{-0.181939, -0.222228, -0.914668}, {-0.162212, -0.555570, -0.815493}, {0.281250, 0.593750}},
-	{{-0.172234, -0.282843, -0.865879}, {-0.137950, -0.707107, -0.693520}, {0.281250, 0.625000}},
-	{{-0.160409, -0.332588, -0.806429}, {-0.108386, -0.831470, -0.544895}, {0.281250, 0.656250}},
-	{{-0.146917, -0.369552, -0.738603}, {-0.074658, -0.923880, -0.375330}, {0.281250, 0.687500}},
-	{{-0.132278, -0.392314, -0.665008}, {-0.038060, -0.980785, -0.191342}, {0.281250, 0.718750}},
-	{{-0.117054, -0.400000, -0.588471}, {-0.000000, -1.000000, -0.000000}, {0.281250, 0.750000}},
-	{{-0.101830, -0.392314, -0.511934}, {+0.038060, -0.980785, +0.191342}, {0.281250, 0.781250}},
-	{{-0.087191, -0.369552, -0.438339}, {+0.074658, -0.923880, +0.375330}, {0.281250, 0.812500}},
-	{{-0.073700, -0.332588, -0.370513}, {+0.108386, -0.831470, +0.544895}, {0.281250, 0.843750}},
-	{{-0.061874, -0.282843, -0.311063}, {+0.137950, -0.707107, +0.693520}, {0.281250, 0.875000}},
-	{{-0.052170, -0.222228, -0.262274}, {+0.162212, -0.555570, +0.815493}, {0.281250, 0.906250}},
-	{{-0.044958, -0.153073, -0.226020}, {+0.180240, -0.382683, +0.906127}, {0.281250, 0.937500}},
-	{{-0.040518, -0.078036, -0.203695}, {+0.191342, -0.195090, +0.961940}, {0.281250, 0.968750}},
-	{{-0.039018, -0.000000, -0.196157}, {+0.195090, -0.000000, +0.980785}, {0.281250, 1.000000}},
-
-	{{-0.058057, +0.000000, -0.191388}, {+0.290285, +0.000000, +0.956940}, {0.296875, 0.000000}},
-	{{-0.060288, +0.078036, -0.198743}, {+0.284707, +0.195090, +0.938553}, {0.296875, 0.031250}},
-	{{-0.066896, +0.153073, -0.220525}, {+0.268188, +0.382683, +0.884098}, {0.296875, 0.062500}},
-	{{-0.077626, +0.222228, -0.255897}, {+0.241363, +0.555570, +0.795667}, {0.296875, 0.093750}},
-	{{-0.092066, +0.282843, -0.303501}, {+0.205262, +0.707107, +0.676659}, {0.296875, 0.125000}},
-	{{-0.109661, +0.332588, -0.361505}, {+0.161274, +0.831470, +0.531648}, {0.296875, 0.156250}},
-	{{-0.129736, +0.369552, -0.427682}, {+0.111087, +0.923880, +0.366205}, {0.296875, 0.187500}},
-	{{-0.151518, +0.392314, -0.499488}, {+0.056632, +0.980785, +0.186690}, {0.296875, 0.218750}},
-	{{-0.174171, +0.400000, -0.574164}, {+0.000000, +1.000000, +0.000000}, {0.296875, 0.250000}},
-	{{-0.196823, +0.392314, -0.648840}, {-0.056632, +0.980785, -0.186690}, {0.296875, 0.281250}},
-	{{-0.218606, +0.369552, -0.720646}, {-0.111087, +0.923880, -0.366205}, {0.296875, 0.312500}},
-	{{-0.238680, +0.332588, -0.786823}, {-0.161274, +0.831470, -0.531648}, {0.296875, 0.343750}},
-	{{-0.256276, +0.282843, -0.844828}, {-0.205262, +0.707107, -0.676659}, {0.296875, 0.375000}},
-	{{-0.270716, +0.222228, -0.892431}, {-0.241363, +0.555570, -0.795667}, {0.296875, 0.406250}},
-	{{-0.281446, +0.153073, -0.927803}, {-0.268188, +0.382683, -0.884098}, {0.296875, 0.437500}},
-	{{-0.288054, +0.078036, -0.949585}, {-0.284707, +0.195090, -0.938553}, {0.296875, 0.468750}},
-	{{-0.290285, +0.000000, -0.956940}, {-0.290285, +0.000000, -0.956940}, {0.296875, 0.500000}},
-	{{-0.288054, -0.078036, -0.949585}, {-0.284707, -0.195090, -0.938553}, {0.296875, 0.531250}},
-	{{-0.281446, -0.153073, -0.927803}, {-0.268188, -0.382683, -0.884098}, {0.296875, 0.562500}},
-	{{-0.270716, -0.222228, -0.892431}, {-0.241363, -0.555570, -0.795667}, {0.296875, 0.593750}},
-	{{-0.256276, -0.282843, -0.844828}, {-0.205262, -0.707107, -0.676659}, {0.296875, 0.625000}},
-	{{-0.238680, -0.332588, -0.786823}, {-0.161274, -0.831470, -0.531648}, {0.296875, 0.656250}},
-	{{-0.218606, -0.369552, -0.720646}, {-0.111087, -0.923880, -0.366205}, {0.296875, 0.687500}},
-	{{-0.196823, -0.392314, -0.648840}, {-0.056632, -0.980785, -0.186690}, {0.296875, 0.718750}},
-	{{-0.174171, -0.400000, -0.574164}, {-0.000000, -1.000000, -0.000000}, {0.296875, 0.750000}},
-	{{-0.151518, -0.392314, -0.499488}, {+0.056632, -0.980785, +0.186690}, {0.296875, 0.781250}},
-	{{-0.129736, -0.369552, -0.427682}, {+0.111087, -0.923880, +0.366205}, {0.296875, 0.812500}},
-	{{-0.109661, -0.332588, -0.361505}, {+0.161274, -0.831470, +0.531648}, {0.296875, 0.843750}},
-	{{-0.092066, -0.282843, -0.303501}, {+0.205262, -0.707107, +0.676659}, {0.296875, 0.875000}},
-	{{-0.077626, -0.222228, -0.255897}, {+0.241363, -0.555570, +0.795667}, {0.296875, 0.906250}},
-	{{-0.066896, -0.153073, -0.220525}, {+0.268188, -0.382683, +0.884098}, {0.296875, 0.937500}},
-	{{-0.060288, -0.078036, -0.198743}, {+0.284707, -0.195090, +0.938553}, {0.296875, 0.968750}},
-	{{-0.058057, -0.000000, -0.191388}, {+0.290285, -0.000000, +0.956940}, {0.296875, 1.000000}},
-
-	{{-0.076537, +0.000000, -0.184776}, {+0.382683, +0.000000, +0.923880}, {0.312500, 0.000000}},
-	{{-0.079478, +0.078036, -0.191877}, {+0.375330, +0.195090, +0.906127}, {0.312500, 0.031250}},
-	{{-0.088189, +0.153073, -0.212906}, {+0.353553, +0.382683, +0.853553}, {0.312500, 0.062500}},
-	{{-0.102334, +0.222228, -0.247057}, {+0.318190, +0.555570, +0.768178}, {0.312500, 0.093750}},
-	{{-0.121371, +0.282843, -0.293015}, {+0.270598, +0.707107, +0.653281}, {0.312500, 0.125000}},
-	{{-0.144567, +0.332588, -0.349016}, {+0.212608, +0.831470, +0.513280}, {0.312500, 0.156250}},
-	{{-0.171031, +0.369552, -0.412906}, {+0.146447, +0.923880, +0.353553}, {0.312500, 0.187500}},
-	{{-0.199747, +0.392314, -0.482232}, {+0.074658, +0.980785, +0.180240}, {0.312500, 0.218750}},
-	{{-0.229610, +0.400000, -0.554328}, {+0.000000, +1.000000, +0.000000}, {0.312500, 0.250000}},
-	{{-0.259473, +0.392314, -0.626424}, {-0.074658, +0.980785, -0.180240}, {0.312500, 0.281250}},
-	{{-0.288189, +0.369552, -0.695749}, {-0.146447, +0.923880, -0.353553}, {0.312500, 0.312500}},
-	{{-0.314653, +0.332588, -0.759640}, {-0.212608, +0.831470, -0.513280}, {0.312500, 0.343750}},
-	{{-0.337849, +0.282843, -0.815640}, {-0.270598, +0.707107, -0.653281}, {0.312500, 0.375000}},
-	{{-0.356886, +0.222228, -0.861599}, {-0.318190, +0.555570, -0.768178}, {0.312500, 0.406250}},
-	{{-0.371031, +0.153073, -0.895749}, {-0.353553, +0.382683, -0.853553}, {0.312500, 0.437500}},
-	{{-0.379742, +0.078036, -0.916779}, {-0.375330, +0.195090, -0.906127}, {0.312500, 0.468750}},
-	{{-0.382683, +0.000000, -0.923880}, {-0.382683, +0.000000, -0.923880}, {0.312500, 0.500000}},
-	{{-0.379742, -0.078036, -0.916779}, {-0.375330, -0.195090, -0.906127}, {0.312500, 0.531250}},
-	{{-0.371031, -0.153073, -0.895749}, {-0.353553, -0.382683, -0.853553}, {0.312500, 0.562500}},
-	{{-0.356886, -0.222228, -0.861599}, {-0.318190, -0.555570, -0.768178}, {0.312500, 0.593750}},
-	{{-0.337849, -0.282843, -0.815640}, {-0.270598, -0.707107, -0.653281}, {0.312500, 0.625000}},
-	{{-0.314653, -0.332588, -0.759640}, {-0.212608, -0.831470, -0.513280}, {0.312500, 0.656250}},
-	{{-0.288189, -0.369552, -0.695749}, {-0.146447, -0.923880, -0.353553}, {0.312500, 0.687500}},
-	{{-0.259473, -0.392314, -0.626424}, {-0.074658, -0.980785, -0.180240}, {0.312500, 0.718750}},
-	{{-0.229610, -0.400000, -0.554328}, {-0.000000, -1.000000, -0.000000}, {0.312500, 0.750000}},
-	{{-0.199747, -0.392314, -0.482232}, {+0.074658, -0.980785, +0.180240}, {0.312500, 0.781250}},
-	{{-0.171031, -0.369552, -0.412906}, {+0.146447, -0.923880, +0.353553}, {0.312500, 0.812500}},
-	{{-0.144567, -0.332588, -0.349016}, {+0.212608, -0.831470, +0.513280}, {0.312500, 0.843750}},
-	{{-0.121371, -0.282843, -0.293015}, {+0.270598, -0.707107, +0.653281}, {0.312500, 0.875000}},
-	{{-0.102334, -0.222228, -0.247057}, {+0.318190, -0.555570, +0.768178}, {0.312500, 0.906250}},
-	{{-0.088189, -0.153073, -0.212906}, {+0.353553, -0.382683, +0.853553}, {0.312500, 0.937500}},
-	{{-0.079478, -0.078036, -0.191877}, {+0.375330, -0.195090, +0.906127}, {0.312500, 0.968750}},
-	{{-0.076537, -0.000000, -0.184776}, {+0.382683, -0.000000, +0.923880}, {0.312500, 1.000000}},
-
-	{{-0.094279, +0.000000, -0.176384}, {+0.471397, +0.000000, +0.881921}, {0.328125, 0.000000}},
-	{{-0.097902, +0.078036, -0.183163}, {+0.462339, +0.195090, +0.864975}, {0.328125, 0.031250}},
-	{{-0.108633, +0.153073, -0.203237}, {+0.435514, +0.382683, +0.814789}, {0.328125, 0.062500}},
-	{{-0.126057, +0.222228, -0.235836}, {+0.391952, +0.555570, +0.733291}, {0.328125, 0.093750}},
-	{{-0.149507, +0.282843, -0.279708}, {+0.333328, +0.707107, +0.623613}, {0.328125, 0.125000}},
-	{{-0.178080, +0.332588, -0.333165}, {+0.261894, +0.831470, +0.489969}, {0.328125, 0.156250}},
-	{{-0.210680, +0.369552, -0.394154}, {+0.180396, +0.923880, +0.337497}, {0.328125, 0.187500}},
-	{{-0.246052, +0.392314, -0.460331}, {+0.091965, +0.980785, +0.172054}, {0.328125, 0.218750}},
-	{{-0.282838, +0.400000, -0.529153}, {+0.000000, +1.000000, +0.000000}, {0.328125, 0.250000}},
-	{{-0.319624, +0.392314, -0.597974}, {-0.091965, +0.980785, -0.172054}, {0.328125, 0.281250}},
-	{{-0.354996, +0.369552, -0.664151}, {-0.180396, +0.923880, -0.337497}, {0.328125, 0.312500}},
-	{{-0.387596, +0.332588, -0.725140}, {-0.261894, +0.831470, -0.489969}, {0.328125, 0.343750}},
-	{{-0.416169, +0.282843, -0.778598}, {-0.333328, +0.707107, -0.623613}, {0.328125, 0.375000}},
-	{{-0.439619, +0.222228, -0.822469}, {-0.391952, +0.555570, -0.733291}, {0.328125, 0.406250}},
-	{{-0.457044, +0.153073, -0.855068}, {-0.435514, +0.382683, -0.814789}, {0.328125, 0.437500}},
-	{{-0.467774, +0.078036, -0.875143}, {-0.462339, +0.195090, -0.864975}, {0.328125, 0.468750}},
-	{{-0.471397, +0.000000, -0.881921}, {-0.471397, +0.000000, -0.881921}, {0.328125, 0.500000}},
-	{{-0.467774, -0.078036, -0.875143}, {-0.462339, -0.195090, -0.864975}, {0.328125, 0.531250}},
-	{{-0.457044, -0.153073, -0.855068}, {-0.435514, -0.382683, -0.814789}, {0.328125, 0.562500}},
-	{{-0.439619, -0.222228, -0.822469}, {-0.391952, -0.555570, -0.733291}, {0.328125, 0.593750}},
-	{{-0.416169, -0.282843, -0.778598}, {-0.333328, -0.707107, -0.623613}, {0.328125, 0.625000}},
-	{{-0.387596, -0.332588, -0.725140}, {-0.261894, -0.831470, -0.489969}, {0.328125, 0.656250}},
-	{{-0.354996, -0.369552, -0.664151}, {-0.180396, -0.923880, -0.337497}, {0.328125, 0.687500}},
-	{{-0.319624, -0.392314, -0.597974}, {-0.091965, -0.980785, -0.172054}, {0.328125, 0.718750}},
-	{{-0.282838, -0.400000, -0.529153}, {-0.000000, -1.000000, -0.000000}, {0.328125, 0.750000}},
-	{{-0.246052, -0.392314, -0.460331}, {+0.091965, -0.980785, +0.172054}, {0.328125, 0.781250}},
-	{{-0.210680, -0.369552, -0.394154}, {+0.180396, -0.923880, +0.337497}, {0.328125, 0.812500}},
-	{{-0.178080, -0.332588, -0.333165}, {+0.261894, -0.831470, +0.489969}, {0.328125, 0.843750}},
-	{{-0.149507, -0.282843, -0.279708}, {+0.333328, -0.707107, +0.623613}, {0.328125, 0.875000}},
-	{{-0.126057, -0.222228, -0.235836}, {+0.391952, -0.555570, +0.733291}, {0.328125, 0.906250}},
-	{{-0.108633, -0.153073, -0.203237}, {+0.435514, -0.382683, +0.814789}, {0.328125, 0.937500}},
-	{{-0.097902, -0.078036, -0.183163}, {+0.462339, -0.195090, +0.864975}, {0.328125, 0.968750}},
-	{{-0.094279, -0.000000, -0.176384}, {+0.471397, -0.000000, +0.881921}, {0.328125, 1.000000}},
-
-	{{-0.111114, +0.000000, -0.166294}, {+0.555570, +0.000000, +0.831470}, {0.343750, 0.000000}},
-	{{-0.115384, +0.078036, -0.172685}, {+0.544895, +0.195090, +0.815493}, {0.343750, 0.031250}},
-	{{-0.128030, +0.153073, -0.191611}, {+0.513280, +0.382683, +0.768178}, {0.343750, 0.062500}},
-	{{-0.148566, +0.222228, -0.222345}, {+0.461940, +0.555570, +0.691342}, {0.343750, 0.093750}},
-	{{-0.176203, +0.282843, -0.263707}, {+0.392847, +0.707107, +0.587938}, {0.343750, 0.125000}},
-	{{-0.209879, +0.332588, -0.314106}, {+0.308658, +0.831470, +0.461940}, {0.343750, 0.156250}},
-	{{-0.248299, +0.369552, -0.371606}, {+0.212608, +0.923880, +0.318190}, {0.343750, 0.187500}},
-	{{-0.289988, +0.392314, -0.433997}, {+0.108386, +0.980785, +0.162212}, {0.343750, 0.218750}},
-	{{-0.333342, +0.400000, -0.498882}, {+0.000000, +1.000000, +0.000000}, {0.343750, 0.250000}},
-	{{-0.376697, +0.392314, -0.563766}, {-0.108386, +0.980785, -0.162212}, {0.343750, 0.281250}},
-	{{-0.418385, +0.369552, -0.626158}, {-0.212608, +0.923880, -0.318190}, {0.343750, 0.312500}},
-	{{-0.456805, +0.332588, -0.683658}, {-0.308658, +0.831470, -0.461940}, {0.343750, 0.343750}},
-	{{-0.490481, +0.282843, -0.734057}, {-0.392847, +0.707107, -0.587938}, {0.343750, 0.375000}},
-	{{-0.518118, +0.222228, -0.775418}, {-0.461940, +0.555570, -0.691342}, {0.343750, 0.406250}},
-	{{-0.538654, +0.153073, -0.806153}, {-0.513280, +0.382683, -0.768178}, {0.343750, 0.437500}},
-	{{-0.551300, +0.078036, -0.825079}, {-0.544895, +0.195090, -0.815493}, {0.343750, 0.468750}},
-	{{-0.555570, +0.000000, -0.831470}, {-0.555570, +0.000000, -0.831470}, {0.343750, 0.500000}},
-	{{-0.551300, -0.078036, -0.825079}, {-0.544895, -0.195090, -0.815493}, {0.343750, 0.531250}},
-	{{-0.538654, -0.153073, -0.806153}, {-0.513280, -0.382683, -0.768178}, {0.343750, 0.562500}},
-	{{-0.518118, -0.222228, -0.775418}, {-0.461940, -0.555570, -0.691342}, {0.343750, 0.593750}},
-	{{-0.490481, -0.282843, -0.734057}, {-0.392847, -0.707107, -0.587938}, {0.343750, 0.625000}},
-	{{-0.456805, -0.332588, -0.683658}, {-0.308658, -0.831470, -0.461940}, {0.343750, 0.656250}},
-	{{-0.418385, -0.369552, -0.626158}, {-0.212608, -0.923880, -0.318190}, {0.343750, 0.687500}},
-	{{-0.376697, -0.392314, -0.563766}, {-0.108386, -0.980785, -0.162212}, {0.343750, 0.718750}},
-	{{-0.333342, -0.400000, -0.498882}, {-0.000000, -1.000000, -0.000000}, {0.343750, 0.750000}},
-	{{-0.289988, -0.392314, -0.433997}, {+0.108386, -0.980785, +0.162212}, {0.343750, 0.781250}},
-	{{-0.248299, -0.369552, -0.371606}, {+0.212608, -0.923880, +0.318190}, {0.343750, 0.812500}},
-	{{-0.209879, -0.332588, -0.314106}, {+0.308658, -0.831470, +0.461940}, {0.343750, 0.843750}},
-	{{-0.176203, -0.282843, -0.263707}, {+0.392847, -0.707107, +0.587938}, {0.343750, 0.875000}},
-	{{-0.148566, -0.222228, -0.222345}, {+0.461940, -0.555570, +0.691342}, {0.343750, 0.906250}},
-	{{-0.128030, -0.153073, -0.191611}, {+0.513280, -0.382683, +0.768178}, {0.343750, 0.937500}},
-	{{-0.115384, -0.078036, -0.172685}, {+0.544895, -0.195090, +0.815493}, {0.343750, 0.968750}},
-	{{-0.111114, -0.000000, -0.166294}, {+0.555570, -0.000000, +0.831470}, {0.343750, 1.000000}},
-
-	{{-0.126879, +0.000000, -0.154602}, {+0.634393, +0.000000, +0.773010}, {0.359375, 0.000000}},
-	{{-0.131755, +0.078036, -0.160543}, {+0.622204, +0.195090, +0.758157}, {0.359375, 0.031250}},
-	{{-0.146195, +0.153073, -0.178139}, {+0.586103, +0.382683, +0.714169}, {0.359375, 0.062500}},
-	{{-0.169644, +0.222228, -0.206712}, {+0.527479, +0.555570, +0.642735}, {0.359375, 0.093750}},
-	{{-0.201202, +0.282843, -0.245166}, {+0.448584, +0.707107, +0.546601}, {0.359375, 0.125000}},
-	{{-0.239656, +0.332588, -0.292022}, {+0.352450, +0.831470, +0.429462}, {0.359375, 0.156250}},
-	{{-0.283527, +0.369552, -0.345479}, {+0.242772, +0.923880, +0.295818}, {0.359375, 0.187500}},
-	{{-0.331130, +0.392314, -0.403484}, {+0.123764, +0.980785, +0.150807}, {0.359375, 0.218750}},
-	{{-0.380636, +0.400000, -0.463806}, {+0.000000, +1.000000, +0.000000}, {0.359375, 0.250000}},
-	{{-0.430142, +0.392314, -0.524129}, {-0.123764, +0.980785, -0.150807}, {0.359375, 0.281250}},
-	{{-0.477745, +0.369552, -0.582134}, {-0.242772, +0.923880, -0.295818}, {0.359375, 0.312500}},
-	{{-0.521616, +0.332588, -0.635591}, {-0.352450, +0.831470, -0.429462}, {0.359375, 0.343750}},
-	{{-0.560069, +0.282843, -0.682447}, {-0.448584, +0.707107, -0.546601}, {0.359375, 0.375000}},
-	{{-0.591627, +0.222228, -0.720900}, {-0.527479, +0.555570, -0.642735}, {0.359375, 0.406250}},
-	{{-0.615077, +0.153073, -0.749474}, {-0.586103, +0.382683, -0.714169}, {0.359375, 0.437500}},
-	{{-0.629517, +0.078036, -0.767069}, {-0.622204, +0.195090, -0.758157}, {0.359375, 0.468750}},
-	{{-0.634393, +0.000000, -0.773010}, {-0.634393, +0.000000, -0.773010}, {0.359375, 0.500000}},
-	{{-0.629517, -0.078036, -0.767069}, {-0.622204, -0.195090, -0.758157}, {0.359375, 0.531250}},
-	{{-0.615077, -0.153073, -0.749474}, {-0.586103, -0.382683, -0.714169}, {0.359375, 0.562500}},
-	{{-0.591627, -0.222228, -0.720900}, {-0.527479, -0.555570, -0.642735}, {0.359375, 0.593750}},
-	{{-0.560069, -0.282843, -0.682447}, {-0.448584, -0.707107, -0.546601}, {0.359375, 0.625000}},
-	{{-0.521616, -0.332588, -0.635591}, {-0.352450, -0.831470, -0.429462}, {0.359375, 0.656250}},
-	{{-0.477745, -0.369552, -0.582134}, {-0.242772, -0.923880, -0.295818}, {0.359375, 0.687500}},
-	{{-0.430142, -0.392314, -0.524129}, {-0.123764, -0.980785, -0.150807}, {0.359375, 0.718750}},
-	{{-0.380636, -0.400000, -0.463806}, {-0.000000, -1.000000, -0.000000}, {0.359375, 0.750000}},
-	{{-0.331130, -0.392314, -0.403484}, {+0.123764, -0.980785, +0.150807}, {0.359375, 0.781250}},
-	{{-0.283527, -0.369552, -0.345479}, {+0.242772, -0.923880, +0.295818}, {0.359375, 0.812500}},
-	{{-0.239656, -0.332588, -0.292022}, {+0.352450, -0.831470, +0.429462}, {0.359375, 0.843750}},
-	{{-0.201202, -0.282843, -0.245166}, {+0.448584, -0.707107, +0.546601}, {0.359375, 0.875000}},
-	{{-0.169644, -0.222228, -0.206712}, {+0.527479, -0.555570, +0.642735}, {0.359375, 0.906250}},
-	{{-0.146195, -0.153073, -0.178139}, {+0.586103, -0.382683, +0.714169}, {0.359375, 0.937500}},
-	{{-0.131755, -0.078036, -0.160543}, {+0.622204, -0.195090, +0.758157}, {0.359375, 0.968750}},
-	{{-0.126879, -0.000000, -0.154602}, {+0.634393, -0.000000, +0.773010}, {0.359375, 1.000000}},
-
-	{{-0.141421, +0.000000, -0.141421}, {+0.707107, +0.000000, +0.707107}, {0.375000, 0.000000}},
-	{{-0.146856, +0.078036, -0.146856}, {+0.693520, +0.195090, +0.693520}, {0.375000, 0.031250}},
-	{{-0.162951, +0.153073, -0.162951}, {+0.653281, +0.382683, +0.653281}, {0.375000, 0.062500}},
-	{{-0.189089, +0.222228, -0.189089}, {+0.587938, +0.555570, +0.587938}, {0.375000, 0.093750}},
-	{{-0.224264, +0.282843, -0.224264}, {+0.500000, +0.707107, +0.500000}, {0.375000, 0.125000}},
-	{{-0.267125, +0.332588, -0.267125}, {+0.392847, +0.831470, +0.392847}, {0.375000, 0.156250}},
-	{{-0.316025, +0.369552, -0.316025}, {+0.270598, +0.923880, +0.270598}, {0.375000, 0.187500}},
-	{{-0.369084, +0.392314, -0.369084}, {+0.137950, +0.980785, +0.137950}, {0.375000, 0.218750}},
-	{{-0.424264, +0.400000, -0.424264}, {+0.000000, +1.000000, +0.000000}, {0.375000, 0.250000}},
-	{{-0.479444, +0.392314, -0.479444}, {-0.137950, +0.980785, -0.137950}, {0.375000, 0.281250}},
-	{{-0.532503, +0.369552, -0.532503}, {-0.270598, +0.923880, -0.270598}, {0.375000, 0.312500}},
-	{{-0.581403, +0.332588, -0.581403}, {-0.392847, +0.831470, -0.392847}, {0.375000, 0.343750}},
-	{{-0.624264, +0.282843, -0.624264}, {-0.500000, +0.707107, -0.500000}, {0.375000, 0.375000}},
-	{{-0.659439, +0.222228, -0.659439}, {-0.587938, +0.555570, -0.587938}, {0.375000, 0.406250}},
-	{{-0.685577, +0.153073, -0.685577}, {-0.653281, +0.382683, -0.653281}, {0.375000, 0.437500}},
-	{{-0.701672, +0.078036, -0.701672}, {-0.693520, +0.195090, -0.693520}, {0.375000, 0.468750}},
-	{{-0.707107, +0.000000, -0.707107}, {-0.707107, +0.000000, -0.707107}, {0.375000, 0.500000}},
-	{{-0.701672, -0.078036, -0.701672}, {-0.693520, -0.195090, -0.693520}, {0.375000, 0.531250}},
-	{{-0.685577, -0.153073, -0.685577}, {-0.653281, -0.382683, -0.653281}, {0.375000, 0.562500}},
-	{{-0.659439, -0.222228, -0.659439}, {-0.587938, -0.555570, -0.587938}, {0.375000, 0.593750}},
-	{{-0.624264, -0.282843, -0.624264}, {-0.500000, -0.707107, -0.500000}, {0.375000, 0.625000}},
-	{{-0.581403, -0.332588, -0.581403}, {-0.392847, -0.831470, -0.392847}, {0.375000, 0.656250}},
-	{{-0.532503, -0.369552, -0.532503}, {-0.270598, -0.923880, -0.270598}, {0.375000, 0.687500}},
-	{{-0.479444, -0.392314, -0.479444}, {-0.137950, -0.980785, -0.137950}, {0.375000, 0.718750}},
-	{{-0.424264, -0.400000, -0.424264}, {-0.000000, -1.000000, -0.000000}, {0.375000, 0.750000}},
-	{{-0.369084, -0.392314, -0.369084}, {+0.137950, -0.980785, +0.137950}, {0.375000, 0.781250}},
-	{{-0.316025, -0.369552, -0.316025}, {+0.270598, -0.923880, +0.270598}, {0.375000, 0.812500}},
-	{{-0.267125, -0.332588, -0.267125}, {+0.392847, -0.831470, +0.392847}, {0.375000, 0.843750}},
-	{{-0.224264, -0.282843, -0.224264}, {+0.500000, -0.707107, +0.500000}, {0.375000, 0.875000}},
-	{{-0.189089, -0.222228, -0.189089}, {+0.587938, -0.555570, +0.587938}, {0.375000, 0.906250}},
-	{{-0.162951, -0.153073, -0.162951}, {+0.653281, -0.382683, +0.653281}, {0.375000, 0.937500}},
-	{{-0.146856, -0.078036, -0.146856}, {+0.693520, -0.195090, +0.693520}, {0.375000, 0.968750}},
-	{{-0.141421, -0.000000, -0.141421}, {+0.707107, -0.000000, +0.707107}, {0.375000, 1.000000}},
-
-	{{-0.154602, +0.000000, -0.126879}, {+0.773010, +0.000000, +0.634393}, {0.390625, 0.000000}},
-	{{-0.160543, +0.078036, -0.131755}, {+0.758157, +0.195090, +0.622204}, {0.390625, 0.031250}},
-	{{-0.178139, +0.153073, -0.146195}, {+0.714169, +0.382683, +0.586103}, {0.390625, 0.062500}},
-	{{-0.206712, +0.222228, -0.169644}, {+0.642735, +0.555570, +0.527479}, {0.390625, 0.093750}},
-	{{-0.245166, +0.282843, -0.201202}, {+0.546601, +0.707107, +0.448584}, {0.390625, 0.125000}},
-	{{-0.292022, +0.332588, -0.239656}, {+0.429462, +0.831470, +0.352450}, {0.390625, 0.156250}},
-	{{-0.345479, +0.369552, -0.283527}, {+0.295818, +0.923880, +0.242772}, {0.390625, 0.187500}},
-	{{-0.403484, +0.392314, -0.331130}, {+0.150807, +0.980785, +0.123764}, {0.390625, 0.218750}},
-	{{-0.463806, +0.400000, -0.380636}, {+0.000000, +1.000000, +0.000000}, {0.390625, 0.250000}},
-	{{-0.524129, +0.392314, -0.430142}, {-0.150807, +0.980785, -0.123764}, {0.390625, 0.281250}},
-	{{-0.582134, +0.369552, -0.477745}, {-0.295818, +0.923880, -0.242772}, {0.390625, 0.312500}},
-	{{-0.635591, +0.332588, -0.521616}, {-0.429462, +0.831470, -0.352450}, {0.390625, 0.343750}},
-	{{-0.682447, +0.282843, -0.560069}, {-0.546601, +0.707107, -0.448584}, {0.390625, 0.375000}},
-	{{-0.720900, +0.222228, -0.591627}, {-0.642735, +0.555570, -0.527479}, {0.390625, 0.406250}},
-	{{-0.749474, +0.153073, -0.615077}, {-0.714169, +0.382683, -0.586103}, {0.390625, 0.437500}},
-	{{-0.767069, +0.078036, -0.629517}, {-0.758157, +0.195090, -0.622204}, {0.390625, 0.468750}},
-	{{-0.773010, +0.000000, -0.634393}, {-0.773010, +0.000000, -0.634393}, {0.390625, 0.500000}},
-	{{-0.767069, -0.078036, -0.629517}, {-0.758157, -0.195090, -0.622204}, {0.390625, 0.531250}},
-	{{-0.749474, -0.153073, -0.615077}, {-0.714169, -0.382683, -0.586103}, {0.390625, 0.562500}},
-	{{-0.720900, -0.222228, -0.591627}, {-0.642735, -0.555570, -0.527479}, {0.390625, 0.593750}},
-	{{-0.682447, -0.282843, -0.560069}, {-0.546601, -0.707107, -0.448584}, {0.390625, 0.625000}},
-	{{-0.635591, -0.332588, -0.521616}, {-0.429462, -0.831470, -0.352450}, {0.390625, 0.656250}},
-	{{-0.582134, -0.369552, -0.477745}, {-0.295818, -0.923880, -0.242772}, {0.390625, 0.687500}},
-	{{-0.524129, -0.392314, -0.430142}, {-0.150807, -0.980785, -0.123764}, {0.390625, 0.718750}},
-	{{-0.463806, -0.400000, -0.380636}, {-0.000000, -1.000000, -0.000000}, {0.390625, 0.750000}},
-	{{-0.403484, -0.392314, -0.331130}, {+0.150807, -0.980785, +0.123764}, {0.390625, 0.781250}},
-	{{-0.345479, -0.369552, -0.283527}, {+0.295818, -0.923880, +0.242772}, {0.390625, 0.812500}},
-	{{-0.292022, -0.332588, -0.239656}, {+0.429462, -0.831470, +0.352450}, {0.390625, 0.843750}},
-	{{-0.245166, -0.282843, -0.201202}, {+0.546601, -0.707107, +0.448584}, {0.390625, 0.875000}},
-	{{-0.206712, -0.222228, -0.169644}, {+0.642735, -0.555570, +0.527479}, {0.390625, 0.906250}},
-	{{-0.178139, -0.153073, -0.146195}, {+0.714169, -0.382683, +0.586103}, {0.390625, 0.937500}},
-	{{-0.160543, -0.078036, -0.131755}, {+0.758157, -0.195090, +0.622204}, {0.390625, 0.968750}},
-	{{-0.154602, -0.000000, -0.126879}, {+0.773010, -0.000000, +0.634393}, {0.390625, 1.000000}},
-
-	{{-0.166294, +0.000000, -0.111114}, {+0.831470, +0.000000, +0.555570}, {0.406250, 0.000000}},
-	{{-0.172685, +0.078036, -0.115384}, {+0.815493, +0.195090, +0.544895}, {0.406250, 0.031250}},
-	{{-0.191611, +0.153073, -0.128030}, {+0.768178, +0.382683, +0.513280}, {0.406250, 0.062500}},
-	{{-0.222345, +0.222228, -0.148566}, {+0.691342, +0.555570, +0.461940}, {0.406250, 0.093750}},
-	{{-0.263707, +0.282843, -0.176203}, {+0.587938, +0.707107, +0.392847}, {0.406250, 0.125000}},
-	{{-0.314106, +0.332588, -0.209879}, {+0.461940, +0.831470, +0.308658}, {0.406250, 0.156250}},
-	{{-0.371606, +0.369552, -0.248299}, {+0.318190, +0.923880, +0.212608}, {0.406250, 0.187500}},
-	{{-0.433997, +0.392314, -0.289988}, {+0.162212, +0.980785, +0.108386}, {0.406250, 0.218750}},
-	{{-0.498882, +0.400000, -0.333342}, {+0.000000, +1.000000, +0.000000}, {0.406250, 0.250000}},
-	{{-0.563766, +0.392314, -0.376697}, {-0.162212, +0.980785, -0.108386}, {0.406250, 0.281250}},
-	{{-0.626158, +0.369552, -0.418385}, {-0.318190, +0.923880, -0.212608}, {0.406250, 0.312500}},
-	{{-0.683658, +0.332588, -0.456805}, {-0.461940, +0.831470, -0.308658}, {0.406250, 0.343750}},
-	{{-0.734057, +0.282843, -0.490481}, {-0.587938, +0.707107, -0.392847}, {0.406250, 0.375000}},
-	{{-0.775418, +0.222228, -0.518118}, {-0.691342, +0.555570, -0.461940}, {0.406250, 0.406250}},
-	{{-0.806153, +0.153073, -0.538654}, {-0.768178, +0.382683, -0.513280}, {0.406250, 0.437500}},
-	{{-0.825079, +0.078036, -0.551300}, {-0.815493, +0.195090, -0.544895}, {0.406250, 0.468750}},
-	{{-0.831470, +0.000000, -0.555570}, {-0.831470, +0.000000, -0.555570}, {0.406250, 0.500000}},
-	{{-0.825079, -0.078036, -0.551300}, {-0.815493, -0.195090, -0.544895}, {0.406250, 0.531250}},
-	{{-0.806153, -0.153073, -0.538654}, {-0.768178, -0.382683, -0.513280}, {0.406250, 0.562500}},
-	{{-0.775418, -0.222228, -0.518118}, {-0.691342, -0.555570, -0.461940}, {0.406250, 0.593750}},
-	{{-0.734057, -0.282843, -0.490481}, {-0.587938, -0.707107, -0.392847}, {0.406250, 0.625000}},
-	{{-0.683658, -0.332588, -0.456805}, {-0.461940, -0.831470, -0.308658}, {0.406250, 0.656250}},
-	{{-0.626158, -0.369552, -0.418385}, {-0.318190, -0.923880, -0.212608}, {0.406250, 0.687500}},
-	{{-0.563766, -0.392314, -0.376697}, {-0.162212, -0.980785, -0.108386}, {0.406250, 0.718750}},
-	{{-0.498882, -0.400000, -0.333342}, {-0.000000, -1.000000, -0.000000}, {0.406250, 0.750000}},
-	{{-0.433997, -0.392314, -0.289988}, {+0.162212, -0.980785, +0.108386}, {0.406250, 0.781250}},
-	{{-0.371606, -0.369552, -0.248299}, {+0.318190, -0.923880, +0.212608}, {0.406250, 0.812500}},
-	{{-0.314106, -0.332588, -0.209879}, {+0.461940, -0.831470, +0.308658}, {0.406250, 0.843750}},
-	{{-0.263707, -0.282843, -0.176203}, {+0.587938, -0.707107, +0.392847}, {0.406250, 0.875000}},
-	{{-0.222345, -0.222228, -0.148566}, {+0.691342, -0.555570, +0.461940}, {0.406250, 0.906250}},
-	{{-0.191611, -0.153073, -0.128030}, {+0.768178, -0.382683, +0.513280}, {0.406250, 0.937500}},
-	{{-0.172685, -0.078036, -0.115384}, {+0.815493, -0.195090, +0.544895}, {0.406250, 0.968750}},
-	{{-0.166294, -0.000000, -0.111114}, {+0.831470, -0.000000, +0.555570}, {0.406250, 1.000000}},
-
-	{{-0.176384, +0.000000, -0.094279}, {+0.881921, +0.000000, +0.471397}, {0.421875, 0.000000}},
-	{{-0.183163, +0.078036, -0.097902}, {+0.864975, +0.195090, +0.462339}, {0.421875, 0.031250}},
-	{{-0.203237, +0.153073, -0.108633}, {+0.814789, +0.382683, +0.435514}, {0.421875, 0.062500}},
-	{{-0.235836, +0.222228, -0.126057}, {+0.733291, +0.555570, +0.391952}, {0.421875, 0.093750}},
-	{{-0.279708, +0.282843, -0.149507}, {+0.623613, +0.707107, +0.333328}, {0.421875, 0.125000}},
-	{{-0.333165, +0.332588, -0.178080}, {+0.489969, +0.831470, +0.261894}, {0.421875, 0.156250}},
-	{{-0.394154, +0.369552, -0.210680}, {+0.337497, +0.923880, +0.180396}, {0.421875, 0.187500}},
-	{{-0.460331, +0.392314, -0.246052}, {+0.172054, +0.980785, +0.091965}, {0.421875, 0.218750}},
-	{{-0.529153, +0.400000, -0.282838}, {+0.000000, +1.000000, +0.000000}, {0.421875, 0.250000}},
-	{{-0.597974, +0.392314, -0.319624}, {-0.172054, +0.980785, -0.091965}, {0.421875, 0.281250}},
-	{{-0.664151, +0.369552, -0.354996}, {-0.337497, +0.923880, -0.180396}, {0.421875, 0.312500}},
-	{{-0.725140, +0.332588, -0.387596}, {-0.489969, +0.831470, -0.261894}, {0.421875, 0.343750}},
-	{{-0.778598, +0.282843, -0.416169}, {-0.623613, +0.707107, -0.333328}, {0.421875, 0.375000}},
-	{{-0.822469, +0.222228, -0.439619}, {-0.733291, +0.555570, -0.391952}, {0.421875, 0.406250}},
-	{{-0.855068, +0.153073, -0.457044}, {-0.814789, +0.382683, -0.435514}, {0.421875, 0.437500}},
-	{{-0.875143, +0.078036, -0.467774}, {-0.864975, +0.195090, -0.462339}, {0.421875, 0.468750}},
-	{{-0.881921, +0.000000, -0.471397}, {-0.881921, +0.000000, -0.471397}, {0.421875, 0.500000}},
-	{{-0.875143, -0.078036, -0.467774}, {-0.864975, -0.195090, -0.462339}, {0.421875, 0.531250}},
-	{{-0.855068, -0.153073, -0.457044}, {-0.814789, -0.382683, -0.435514}, {0.421875, 0.562500}},
-	{{-0.822469, -0.222228, -0.439619}, {-0.733291, -0.555570, -0.391952}, {0.421875, 0.593750}},
-	{{-0.778598, -0.282843, -0.416169}, {-0.623613, -0.707107, -0.333328}, {0.421875, 0.625000}},
-	{{-0.725140, -0.332588, -0.387596}, {-0.489969, -0.831470, -0.261894}, {0.421875, 0.656250}},
-	{{-0.664151, -0.369552, -0.354996}, {-0.337497, -0.923880, -0.180396}, {0.421875, 0.687500}},
-	{{-0.597974, -0.392314, -0.319624}, {-0.172054, -0.980785, -0.091965}, {0.421875, 0.718750}},
-	{{-0.529153, -0.400000, -0.282838}, {-0.000000, -1.000000, -0.000000}, {0.421875, 0.750000}},
-	{{-0.460331, -0.392314, -0.246052}, {+0.172054, -0.980785, +0.091965}, {0.421875, 0.781250}},
-	{{-0.394154, -0.369552, -0.210680}, {+0.337497, -0.923880, +0.180396}, {0.421875, 0.812500}},
-	{{-0.333165, -0.332588, -0.178080}, {+0.489969, -0.831470, +0.261894}, {0.421875, 0.843750}},
-	{{-0.279708, -0.282843, -0.149507}, {+0.623613, -0.707107, +0.333328}, {0.421875, 0.875000}},
-	{{-0.235836, -0.222228, -0.126057}, {+0.733291, -0.555570, +0.391952}, {0.421875, 0.906250}},
-	{{-0.203237, -0.153073, -0.108633}, {+0.814789, -0.382683, +0.435514}, {0.421875, 0.937500}},
-	{{-0.183163, -0.078036, -0.097902}, {+0.864975, -0.195090, +0.462339}, {0.421875, 0.968750}},
-	{{-0.176384, -0.000000, -0.094279}, {+0.881921, -0.000000, +0.471397}, {0.421875, 1.000000}},
-
-	{{-0.184776, +0.000000, -0.076537}, {+0.923880, +0.000000, +0.382683}, {0.437500, 0.000000}},
-	{{-0.191877, +0.078036, -0.079478}, {+0.906127, +0.195090, +0.375330}, {0.437500, 0.031250}},
-	{{-0.212906, +0.153073, -0.088189}, {+0.853553, +0.382683, +0.353553}, {0.437500, 0.062500}},
-	{{-0.247057, +0.222228, -0.102334}, {+0.768178, +0.555570, +0.318190}, {0.437500, 0.093750}},
-	{{-0.293015, +0.282843, -0.121371}, {+0.653281, +0.707107, +0.270598}, {0.437500, 0.125000}},
-	{{-0.349016, +0.332588, -0.144567}, {+0.513280, +0.831470, +0.212608}, {0.437500, 0.156250}},
-	{{-0.412906, +0.369552, -0.171031}, {+0.353553, +0.923880, +0.146447}, {0.437500, 0.187500}},
-	{{-0.482232, +0.392314, -0.199747}, {+0.180240, +0.980785, +0.074658}, {0.437500, 0.218750}},
-	{{-0.554328, +0.400000, -0.229610}, {+0.000000, +1.000000, +0.000000}, {0.437500, 0.250000}},
-	{{-0.626424, +0.392314, -0.259473}, {-0.180240, +0.980785, -0.074658}, {0.437500, 0.281250}},
-	{{-0.695749, +0.369552, -0.288189}, {-0.353553, +0.923880, -0.146447}, {0.437500, 0.312500}},
-	{{-0.759640, +0.332588, -0.314653}, {-0.513280, +0.831470, -0.212608}, {0.437500, 0.343750}},
-	{{-0.815640, +0.282843, -0.337849}, {-0.653281, +0.707107, -0.270598}, {0.437500, 0.375000}},
-	{{-0.861599, +0.222228, -0.356886}, {-0.768178, +0.555570, -0.318190}, {0.437500, 0.406250}},
-	{{-0.895749, +0.153073, -0.371031}, {-0.853553, +0.382683, -0.353553}, {0.437500, 0.437500}},
-	{{-0.916779, +0.078036, -0.379742}, {-0.906127, +0.195090, -0.375330}, {0.437500, 0.468750}},
-	{{-0.923880, +0.000000, -0.382683}, {-0.923880, +0.000000, -0.382683}, {0.437500, 0.500000}},
-	{{-0.916779, -0.078036, -0.379742}, {-0.906127, -0.195090, -0.375330}, {0.437500, 0.531250}},
-	{{-0.895749, -0.153073, -0.371031}, {-0.853553, -0.382683, -0.353553}, {0.437500, 0.562500}},
-	{{-0.861599, -0.222228, -0.356886}, {-0.768178, -0.555570, -0.318190}, {0.437500, 0.593750}},
-	{{-0.815640, -0.282843, -0.337849}, {-0.653281, -0.707107, -0.270598}, {0.437500, 0.625000}},
-	{{-0.759640, -0.332588, -0.314653}, {-0.513280, -0.831470, -0.212608}, {0.437500, 0.656250}},
-	{{-0.695749, -0.369552, -0.288189}, {-0.353553, -0.923880, -0.146447}, {0.437500, 0.687500}},
-	{{-0.626424, -0.392314, -0.259473}, {-0.180240, -0.980785, -0.074658}, {0.437500, 0.718750}},
-	{{-0.554328, -0.400000, -0.229610}, {-0.000000, -1.000000, -0.000000}, {0.437500, 0.750000}},
-	{{-0.482232, -0.392314, -0.199747}, {+0.180240, -0.980785, +0.074658}, {0.437500, 0.781250}},
-	{{-0.412906, -0.369552, -0.171031}, {+0.353553, -0.923880, +0.146447}, {0.437500, 0.812500}},
-	{{-0.349016, -0.332588, -0.144567}, {+0.513280, -0.831470, +0.212608}, {0.437500, 0.843750}},
-	{{-0.293015, -0.282843, -0.121371}, {+0.653281, -0.707107, +0.270598}, {0.437500, 0.875000}},
-	{{-0.247057, -0.222228, -0.102334}, {+0.768178, -0.555570, +0.318190}, {0.437500, 0.906250}},
-	{{-0.212906, -0.153073, -0.088189}, {+0.853553, -0.382683, +0.353553}, {0.437500, 0.937500}},
-	{{-0.191877, -0.078036, -0.079478}, {+0.906127, -0.195090, +0.375330}, {0.437500, 0.968750}},
-	{{-0.184776, -0.000000, -0.076537}, {+0.923880, -0.000000, +0.382683}, {0.437500, 1.000000}},
-
-	{{-0.191388, +0.000000, -0.058057}, {+0.956940, +0.000000, +0.290285}, {0.453125, 0.000000}},
-	{{-0.198743, +0.078036, -0.060288}, {+0.938553, +0.195090, +0.284707}, {0.453125, 0.031250}},
-	{{-0.220525, +0.153073, -0.066896}, {+0.884098, +0.382683, +0.268188}, {0.453125, 0.062500}},
-	{{-0.255897, +0.222228, -0.077626}, {+0.795667, +0.555570, +0.241363}, {0.453125, 0.093750}},
-	{{-0.303501, +0.282843, -0.092066}, {+0.676659, +0.707107, +0.205262}, {0.453125, 0.125000}},
-	{{-0.361505, +0.332588, -0.109661}, {+0.531648, +0.831470, +0.161274}, {0.453125, 0.156250}},
-	{{-0.427682, +0.369552, -0.129736}, {+0.366205, +0.923880, +0.111087}, {0.453125, 0.187500}},
-	{{-0.499488, +0.392314, -0.151518}, {+0.186690, +0.980785, +0.056632}, {0.453125, 0.218750}},
-	{{-0.574164, +0.400000, -0.174171}, {+0.000000, +1.000000, +0.000000}, {0.453125, 0.250000}},
-	{{-0.648840, +0.392314, -0.196823}, {-0.186690, +0.980785, -0.056632}, {0.453125, 0.281250}},
-	{{-0.720646, +0.369552, -0.218606}, {-0.366205, +0.923880, -0.111087}, {0.453125, 0.312500}},
-	{{-0.786823, +0.332588, -0.238680}, {-0.531648, +0.831470, -0.161274}, {0.453125, 0.343750}},
-	{{-0.844828, +0.282843, -0.256276}, {-0.676659, +0.707107, -0.205262}, {0.453125, 0.375000}},
-	{{-0.892431, +0.222228, -0.270716}, {-0.795667, +0.555570, -0.241363}, {0.453125, 0.406250}},
-	{{-0.927803, +0.153073, -0.281446}, {-0.884098, +0.382683, -0.268188}, {0.453125, 0.437500}},
-	{{-0.949585, +0.078036, -0.288054}, {-0.938553, +0.195090, -0.284707}, {0.453125, 0.468750}},
-	{{-0.956940, +0.000000, -0.290285}, {-0.956940, +0.000000, -0.290285}, {0.453125, 0.500000}},
-	{{-0.949585, -0.078036, -0.288054}, {-0.938553, -0.195090, -0.284707}, {0.453125, 0.531250}},
-	{{-0.927803, -0.153073, -0.281446}, {-0.884098, -0.382683, -0.268188}, {0.453125, 0.562500}},
-	{{-0.892431, -0.222228, -0.270716}, {-0.795667, -0.555570, -0.241363}, {0.453125, 0.593750}},
-	{{-0.844828, -0.282843, -0.256276}, {-0.676659, -0.707107, -0.205262}, {0.453125, 0.625000}},
-	{{-0.786823, -0.332588, -0.238680}, {-0.531648, -0.831470, -0.161274}, {0.453125, 0.656250}},
-	{{-0.720646, -0.369552, -0.218606}, {-0.366205, -0.923880, -0.111087}, {0.453125, 0.687500}},
-	{{-0.648840, -0.392314, -0.196823}, {-0.186690, -0.980785, -0.056632}, {0.453125, 0.718750}},
-	{{-0.574164, -0.400000, -0.174171}, {-0.000000, -1.000000, -0.000000}, {0.453125, 0.750000}},
-	{{-0.499488, -0.392314, -0.151518}, {+0.186690, -0.980785, +0.056632}, {0.453125, 0.781250}},
-	{{-0.427682, -0.369552, -0.129736}, {+0.366205, -0.923880, +0.111087}, {0.453125, 0.812500}},
-	{{-0.361505, -0.332588, -0.109661}, {+0.531648, -0.831470, +0.161274}, {0.453125, 0.843750}},
-	{{-0.303501, -0.282843, -0.092066}, {+0.676659, -0.707107, +0.205262}, {0.453125, 0.875000}},
-	{{-0.255897, -0.222228, -0.077626}, {+0.795667, -0.555570, +0.241363}, {0.453125, 0.906250}},
-	{{-0.220525, -0.153073, -0.066896}, {+0.884098, -0.382683, +0.268188}, {0.453125, 0.937500}},
-	{{-0.198743, -0.078036, -0.060288}, {+0.938553, -0.195090, +0.284707}, {0.453125, 0.968750}},
-	{{-0.191388, -0.000000, -0.058057}, {+0.956940, -0.000000, +0.290285}, {0.453125, 1.000000}},
-
-	{{-0.196157, +0.000000, -0.039018}, {+0.980785, +0.000000, +0.195090}, {0.468750, 0.000000}},
-	{{-0.203695, +0.078036, -0.040518}, {+0.961940, +0.195090, +0.191342}, {0.468750, 0.031250}},
-	{{-0.226020, +0.153073, -0.044958}, {+0.906127, +0.382683, +0.180240}, {0.468750, 0.062500}},
-	{{-0.262274, +0.222228, -0.052170}, {+0.815493, +0.555570, +0.162212}, {0.468750, 0.093750}},
-	{{-0.311063, +0.282843, -0.061874}, {+0.693520, +0.707107, +0.137950}, {0.468750, 0.125000}},
-	{{-0.370513, +0.332588, -0.073700}, {+0.544895, +0.831470, +0.108386}, {0.468750, 0.156250}},
-	{{-0.438339, +0.369552, -0.087191}, {+0.375330, +0.923880, +0.074658}, {0.468750, 0.187500}},
-	{{-0.511934, +0.392314, -0.101830}, {+0.191342, +0.980785, +0.038060}, {0.468750, 0.218750}},
-	{{-0.588471, +0.400000, -0.117054}, {+0.000000, +1.000000, +0.000000}, {0.468750, 0.250000}},
-	{{-0.665008, +0.392314, -0.132278}, {-0.191342, +0.980785, -0.038060}, {0.468750, 0.281250}},
-	{{-0.738603, +0.369552, -0.146917}, {-0.375330, +0.923880, -0.074658}, {0.468750, 0.312500}},
-	{{-0.806429, +0.332588, -0.160409}, {-0.544895, +0.831470, -0.108386}, {0.468750, 0.343750}},
-	{{-0.865879, +0.282843, -0.172234}, {-0.693520, +0.707107, -0.137950}, {0.468750, 0.375000}},
-	{{-0.914668, +0.222228, -0.181939}, {-0.815493, +0.555570, -0.162212}, {0.468750, 0.406250}},
-	{{-0.950922, +0.153073, -0.189150}, {-0.906127, +0.382683, -0.180240}, {0.468750, 0.437500}},
-	{{-0.973247, +0.078036, -0.193591}, {-0.961940, +0.195090, -0.191342}, {0.468750, 0.468750}},
-	{{-0.980785, +0.000000, -0.195090}, {-0.980785, +0.000000, -0.195090}, {0.468750, 0.500000}},
-	{{-0.973247, -0.078036, -0.193591}, {-0.961940, -0.195090, -0.191342}, {0.468750, 0.531250}},
-	{{-0.950922, -0.153073, -0.189150}, {-0.906127, -0.382683, -0.180240}, {0.468750, 0.562500}},
-	{{-0.914668, -0.222228, -0.181939}, {-0.815493, -0.555570, -0.162212}, {0.468750, 0.593750}},
-	{{-0.865879, -0.282843, -0.172234}, {-0.693520, -0.707107, -0.137950}, {0.468750, 0.625000}},
-	{{-0.806429, -0.332588, -0.160409}, {-0.544895, -0.831470, -0.108386}, {0.468750, 0.656250}},
-	{{-0.738603, -0.369552, -0.146917}, {-0.375330, -0.923880, -0.074658}, {0.468750, 0.687500}},
-	{{-0.665008, -0.392314, -0.132278}, {-0.191342, -0.980785, -0.038060}, {0.468750, 0.718750}},
-	{{-0.588471, -0.400000, -0.117054}, {-0.000000, -1.000000, -0.000000}, {0.468750, 0.750000}},
-	{{-0.511934, -0.392314, -0.101830}, {+0.191342, -0.980785, +0.038060}, {0.468750, 0.781250}},
-	{{-0.438339, -0.369552, -0.087191}, {+0.375330, -0.923880, +0.074658}, {0.468750, 0.812500}},
-	{{-0.370513, -0.332588, -0.073700}, {+0.544895, -0.831470, +0.108386}, {0.468750, 0.843750}},
-	{{-0.311063, -0.282843, -0.061874}, {+0.693520, -0.707107, +0.137950}, {0.468750, 0.875000}},
-	{{-0.262274, -0.222228, -0.052170}, {+0.815493, -0.555570, +0.162212}, {0.468750, 0.906250}},
-	{{-0.226020, -0.153073, -0.044958}, {+0.906127, -0.382683, +0.180240}, {0.468750, 0.937500}},
-	{{-0.203695, -0.078036, -0.040518}, {+0.961940, -0.195090, +0.191342}, {0.468750, 0.968750}},
-	{{-0.196157, -0.000000, -0.039018}, {+0.980785, -0.000000, +0.195090}, {0.468750, 1.000000}},
-
-	{{-0.199037, +0.000000, -0.019603}, {+0.995185, +0.000000, +0.098017}, {0.484375, 0.000000}},
-	{{-0.206686, +0.078036, -0.020357}, {+0.976063, +0.195090, +0.096134}, {0.484375, 0.031250}},
-	{{-0.229339, +0.153073, -0.022588}, {+0.919431, +0.382683, +0.090556}, {0.484375, 0.062500}},
-	{{-0.266124, +0.222228, -0.026211}, {+0.827466, +0.555570, +0.081498}, {0.484375, 0.093750}},
-	{{-0.315630, +0.282843, -0.031087}, {+0.703702, +0.707107, +0.069309}, {0.484375, 0.125000}},
-	{{-0.375953, +0.332588, -0.037028}, {+0.552895, +0.831470, +0.054455}, {0.484375, 0.156250}},
-	{{-0.444775, +0.369552, -0.043806}, {+0.380841, +0.923880, +0.037510}, {0.484375, 0.187500}},
-	{{-0.519450, +0.392314, -0.051161}, {+0.194151, +0.980785, +0.019122}, {0.484375, 0.218750}},
-	{{-0.597111, +0.400000, -0.058810}, {+0.000000, +1.000000, +0.000000}, {0.484375, 0.250000}},
-	{{-0.674771, +0.392314, -0.066459}, {-0.194151, +0.980785, -0.019122}, {0.484375, 0.281250}},
-	{{-0.749447, +0.369552, -0.073814}, {-0.380841, +0.923880, -0.037510}, {0.484375, 0.312500}},
-	{{-0.818269, +0.332588, -0.080592}, {-0.552895, +0.831470, -0.054455}, {0.484375, 0.343750}},
-	{{-0.878592, +0.282843, -0.086534}, {-0.703702, +0.707107, -0.069309}, {0.484375, 0.375000}},
-	{{-0.928097, +0.222228, -0.091410}, {-0.827466, +0.555570, -0.081498}, {0.484375, 0.406250}},
-	{{-0.964883, +0.153073, -0.095033}, {-0.919431, +0.382683, -0.090556}, {0.484375, 0.437500}},
-	{{-0.987536, +0.078036, -0.097264}, {-0.976063, +0.195090, -0.096134}, {0.484375, 0.468750}},
-	{{-0.995185, +0.000000, -0.098017}, {-0.995185, +0.000000, -0.098017}, {0.484375, 0.500000}},
-	{{-0.987536, -0.078036, -0.097264}, {-0.976063, -0.195090, -0.096134}, {0.484375, 0.531250}},
-	{{-0.964883, -0.153073, -0.095033}, {-0.919431, -0.382683, -0.090556}, {0.484375, 0.562500}},
-	{{-0.928097, -0.222228, -0.091410}, {-0.827466, -0.555570, -0.081498}, {0.484375, 0.593750}},
-	{{-0.878592, -0.282843, -0.086534}, {-0.703702, -0.707107, -0.069309}, {0.484375, 0.625000}},
-	{{-0.818269, -0.332588, -0.080592}, {-0.552895, -0.831470, -0.054455}, {0.484375, 0.656250}},
-	{{-0.749447, -0.369552, -0.073814}, {-0.380841, -0.923880, -0.037510}, {0.484375, 0.687500}},
-	{{-0.674771, -0.392314, -0.066459}, {-0.194151, -0.980785, -0.019122}, {0.484375, 0.718750}},
-	{{-0.597111, -0.400000, -0.058810}, {-0.000000, -1.000000, -0.000000}, {0.484375, 0.750000}},
-	{{-0.519450, -0.392314, -0.051161}, {+0.194151, -0.980785, +0.019122}, {0.484375, 0.781250}},
-	{{-0.444775, -0.369552, -0.043806}, {+0.380841, -0.923880, +0.037510}, {0.484375, 0.812500}},
-	{{-0.375953, -0.332588, -0.037028}, {+0.552895, -0.831470, +0.054455}, {0.484375, 0.843750}},
-	{{-0.315630, -0.282843, -0.031087}, {+0.703702, -0.707107, +0.069309}, {0.484375, 0.875000}},
-	{{-0.266124, -0.222228, -0.026211}, {+0.827466, -0.555570, +0.081498}, {0.484375, 0.906250}},
-	{{-0.229339, -0.153073, -0.022588}, {+0.919431, -0.382683, +0.090556}, {0.484375, 0.937500}},
-	{{-0.206686, -0.078036, -0.020357}, {+0.976063, -0.195090, +0.096134}, {0.484375, 0.968750}},
-	{{-0.199037, -0.000000, -0.019603}, {+0.995185, -0.000000, +0.098017}, {0.484375, 1.000000}},
-
-	{{-0.200000, +0.000000, -0.000000}, {+1.000000, +0.000000, +0.000000}, {0.500000, 0.000000}},
-	{{-0.207686, +0.078036, -0.000000}, {+0.980785, +0.195090, +0.000000}, {0.500000, 0.031250}},
-	{{-0.230448, +0.153073, -0.000000}, {+0.923880, +0.382683, +0.000000}, {0.500000, 0.062500}},
-	{{-0.267412, +0.222228, -0.000000}, {+0.831470, +0.555570, -0.000000}, {0.500000, 0.093750}},
-	{{-0.317157, +0.282843, -0.000000}, {+0.707107, +0.707107, +0.000000}, {0.500000, 0.125000}},
-	{{-0.377772, +0.332588, +0.000000}, {+0.555570, +0.831470, -0.000000}, {0.500000, 0.156250}},
-	{{-0.446927, +0.369552, +0.000000}, {+0.382683, +0.923880, +0.000000}, {0.500000, 0.187500}},
-	{{-0.521964, +0.392314, -0.000000}, {+0.195090, +0.980785, -0.000000}, {0.500000, 0.218750}},
-	{{-0.600000, +0.400000, -0.000000}, {+0.000000, +1.000000, +0.000000}, {0.500000, 0.250000}},
-	{{-0.678036, +0.392314, -0.000000}, {-0.195090, +0.980785, +0.000000}, {0.500000, 0.281250}},
-	{{-0.753073, +0.369552, -0.000000}, {-0.382683, +0.923880, -0.000000}, {0.500000, 0.312500}},
-	{{-0.822228, +0.332588, -0.000000}, {-0.555570, +0.831470, +0.000000}, {0.500000, 0.343750}},
-	{{-0.882843, +0.282843, -0.000000}, {-0.707107, +0.707107, -0.000000}, {0.500000, 0.375000}},
-	{{-0.932588, +0.222228, -0.000000}, {-0.831470, +0.555570, +0.000000}, {0.500000, 0.406250}},
-	{{-0.969552, +0.153073, +0.000000}, {-0.923880, +0.382683, -0.000000}, {0.500000, 0.437500}},
-	{{-0.992314, +0.078036, -0.000000}, {-0.980785, +0.195090, -0.000000}, {0.500000, 0.468750}},
-	{{-1.000000, +0.000000, -0.000000}, {-1.000000, +0.000000, -0.000000}, {0.500000, 0.500000}},
-	{{-0.992314, -0.078036, -0.000000}, {-0.980785, -0.195090, -0.000000}, {0.500000, 0.531250}},
-	{{-0.969552, -0.153073, -0.000000}, {-0.923880, -0.382683, -0.000000}, {0.500000, 0.562500}},
-	{{-0.932588, -0.222228, +0.000000}, {-0.831470, -0.555570, -0.000000}, {0.500000, 0.593750}},
-	{{-0.882843, -0.282843, -0.000000}, {-0.707107, -0.707107, -0.000000}, {0.500000, 0.625000}},
-	{{-0.822228, -0.332588, -0.000000}, {-0.555570, -0.831470, -0.000000}, {0.500000, 0.656250}},
-	{{-0.753073, -0.369552, -0.000000}, {-0.382683, -0.923880, +0.000000}, {0.500000, 0.687500}},
-	{{-0.678036, -0.392314, -0.000000}, {-0.195090, -0.980785, -0.000000}, {0.500000, 0.718750}},
-	{{-0.600000, -0.400000, -0.000000}, {-0.000000, -1.000000, -0.000000}, {0.500000, 0.750000}},
-	{{-0.521964, -0.392314, -0.000000}, {+0.195090, -0.980785, +0.000000}, {0.500000, 0.781250}},
-	{{-0.446927, -0.369552, +0.000000}, {+0.382683, -0.923880, +0.000000}, {0.500000, 0.812500}},
-	{{-0.377772, -0.332588, +0.000000}, {+0.555570, -0.831470, +0.000000}, {0.500000, 0.843750}},
-	{{-0.317157, -0.282843, -0.000000}, {+0.707107, -0.707107, +0.000000}, {0.500000, 0.875000}},
-	{{-0.267412, -0.222228, -0.000000}, {+0.831470, -0.555570, -0.000000}, {0.500000, 0.906250}},
-	{{-0.230448, -0.153073, -0.000000}, {+0.923880, -0.382683, +0.000000}, {0.500000, 0.937500}},
-	{{-0.207686, -0.078036, -0.000000}, {+0.980785, -0.195090, +0.000000}, {0.500000, 0.968750}},
-	{{-0.200000, -0.000000, -0.000000}, {+1.000000, -0.000000, +0.000000}, {0.500000, 1.000000}},
-
-	{{-0.199037, +0.000000, +0.019603}, {+0.995185, +0.000000, -0.098017}, {0.515625, 0.000000}},
-	{{-0.206686, +0.078036, +0.020357}, {+0.976063, +0.195090, -0.096134}, {0.515625, 0.031250}},
-	{{-0.229339, +0.153073, +0.022588}, {+0.919431, +0.382683, -0.090556}, {0.515625, 0.062500}},
-	{{-0.266124, +0.222228, +0.026211}, {+0.827466, +0.555570, -0.081498}, {0.515625, 0.093750}},
-	{{-0.315630, +0.282843, +0.031087}, {+0.703702, +0.707107, -0.069309}, {0.515625, 0.125000}},
-	{{-0.375953, +0.332588, +0.037028}, {+0.552895, +0.831470, -0.054455}, {0.515625, 0.156250}},
-	{{-0.444775, +0.369552, +0.043806}, {+0.380841, +0.923880, -0.037510}, {0.515625, 0.187500}},
-	{{-0.519450, +0.392314, +0.051161}, {+0.194151, +0.980785, -0.019122}, {0.515625, 0.218750}},
-	{{-0.597111, +0.400000, +0.058810}, {+0.000000, +1.000000, -0.000000}, {0.515625, 0.250000}},
-	{{-0.674771, +0.392314, +0.066459}, {-0.194151, +0.980785, +0.019122}, {0.515625, 0.281250}},
-	{{-0.749447, +0.369552, +0.073814}, {-0.380841, +0.923880, +0.037510}, {0.515625, 0.312500}},
-	{{-0.818269, +0.332588, +0.080592}, {-0.552895, +0.831470, +0.054455}, {0.515625, 0.343750}},
-	{{-0.878592, +0.282843, +0.086534}, {-0.703702, +0.707107, +0.069309}, {0.515625, 0.375000}},
-	{{-0.928097, +0.222228, +0.091410}, {-0.827466, +0.555570, +0.081498}, {0.515625, 0.406250}},
-	{{-0.964883, +0.153073, +0.095033}, {-0.919431, +0.382683, +0.090556}, {0.515625, 0.437500}},
-	{{-0.987536, +0.078036, +0.097264}, {-0.976063, +0.195090, +0.096134}, {0.515625, 0.468750}},
-	{{-0.995185, +0.000000, +0.098017}, {-0.995185, +0.000000, +0.098017}, {0.515625, 0.500000}},
-	{{-0.987536, -0.078036, +0.097264}, {-0.976063, -0.195090, +0.096134}, {0.515625, 0.531250}},
-	{{-0.964883, -0.153073, +0.095033}, {-0.919431, -0.382683, +0.090556}, {0.515625, 0.562500}},
-	{{-0.928097, -0.222228, +0.091410}, {-0.827466, -0.555570, +0.081498}, {0.515625, 0.593750}},
-	{{-0.878592, -0.282843, +0.086534}, {-0.703702, -0.707107, +0.069309}, {0.515625, 0.625000}},
-	{{-0.818269, -0.332588, +0.080592}, {-0.552895, -0.831470, +0.054455}, {0.515625, 0.656250}},
-	{{-0.749447, -0.369552, +0.073814}, {-0.380841, -0.923880, +0.037510}, {0.515625, 0.687500}},
-	{{-0.674771, -0.392314, +0.066459}, {-0.194151, -0.980785, +0.019122}, {0.515625, 0.718750}},
-	{{-0.597111, -0.400000, +0.058810}, {-0.000000, -1.000000, +0.000000}, {0.515625, 0.750000}},
-	{{-0.519450, -0.392314, +0.051161}, {+0.194151, -0.980785, -0.019122}, {0.515625, 0.781250}},
-	{{-0.444775, -0.369552, +0.043806}, {+0.380841, -0.923880, -0.037510}, {0.515625, 0.812500}},
-	{{-0.375953, -0.332588, +0.037028}, {+0.552895, -0.831470, -0.054455}, {0.515625, 0.843750}},
-	{{-0.315630, -0.282843, +0.031087}, {+0.703702, -0.707107, -0.069309}, {0.515625, 0.875000}},
-	{{-0.266124, -0.222228, +0.026211}, {+0.827466, -0.555570, -0.081498}, {0.515625, 0.906250}},
-	{{-0.229339, -0.153073, +0.022588}, {+0.919431, -0.382683, -0.090556}, {0.515625, 0.937500}},
-	{{-0.206686, -0.078036, +0.020357}, {+0.976063, -0.195090, -0.096134}, {0.515625, 0.968750}},
-	{{-0.199037, -0.000000, +0.019603}, {+0.995185, -0.000000, -0.098017}, {0.515625, 1.000000}},
-
-	{{-0.196157, +0.000000, +0.039018}, {+0.980785, +0.000000, -0.195090}, {0.531250, 0.000000}},
-	{{-0.203695, +0.078036, +0.040518}, {+0.961940, +0.195090, -0.191342}, {0.531250, 0.031250}},
-	{{-0.226020, +0.153073, +0.044958}, {+0.906127, +0.382683, -0.180240}, {0.531250, 0.062500}},
-	{{-0.262274, +0.222228, +0.052170}, {+0.815493, +0.555570, -0.162212}, {0.531250, 0.093750}},
-	{{-0.311063, +0.282843, +0.061874}, {+0.693520, +0.707107, -0.137950}, {0.531250, 0.125000}},
-	{{-0.370513, +0.332588, +0.073700}, {+0.544895, +0.831470, -0.108386}, {0.531250, 0.156250}},
-	{{-0.438339, +0.369552, +0.087191}, {+0.375330, +0.923880, -0.074658}, {0.531250, 0.187500}},
-	{{-0.511934, +0.392314, +0.101830}, {+0.191342, +0.980785, -0.038060}, {0.531250, 0.218750}},
-	{{-0.588471, +0.400000, +0.117054}, {+0.000000, +1.000000, -0.000000}, {0.531250, 0.250000}},
-	{{-0.665008, +0.392314, +0.132278}, {-0.191342, +0.980785, +0.038060}, {0.531250, 0.281250}},
-	{{-0.738603, +0.369552, +0.146917}, {-0.375330, +0.923880, +0.074658}, {0.531250, 0.312500}},
-	{{-0.806429, +0.332588, +0.160409}, {-0.544895, +0.831470, +0.108386}, {0.531250, 0.343750}},
-	{{-0.865879, +0.282843, +0.172234}, {-0.693520, +0.707107, +0.137950}, {0.531250, 0.375000}},
-	{{-0.914668, +0.222228, +0.181939}, {-0.815493, +0.555570, +0.162212}, {0.531250, 0.406250}},
-	{{-0.950922, +0.153073, +0.189150}, {-0.906127, +0.382683, +0.180240}, {0.531250, 0.437500}},
-	{{-0.973247, +0.078036, +0.193591}, {-0.961940, +0.195090, +0.191342}, {0.531250, 0.468750}},
-	{{-0.980785, +0.000000, +0.195090}, {-0.980785, +0.000000, +0.195090}, {0.531250, 0.500000}},
-	{{-0.973247, -0.078036, +0.193591}, {-0.961940, -0.195090, +0.191342}, {0.531250, 0.531250}},
-	{{-0.950922, -0.153073, +0.189150}, {-0.906127, -0.382683, +0.180240}, {0.531250, 0.562500}},
-	{{-0.914668, -0.222228, +0.181939}, {-0.815493, -0.555570, +0.162212}, {0.531250, 0.593750}},
-	{{-0.865879, -0.282843, +0.172234}, {-0.693520, -0.707107, +0.137950}, {0.531250, 0.625000}},
-	{{-0.806429, -0.332588, +0.160409}, {-0.544895, -0.831470, +0.108386}, {0.531250, 0.656250}},
-	{{-0.738603, -0.369552, +0.146917}, {-0.375330, -0.923880, +0.074658}, {0.531250, 0.687500}},
-	{{-0.665008, -0.392314, +0.132278}, {-0.191342, -0.980785, +0.038060}, {0.531250, 0.718750}},
-	{{-0.588471, -0.400000, +0.117054}, {-0.000000, -1.000000, +0.000000}, {0.531250, 0.750000}},
-	{{-0.511934, -0.392314, +0.101830}, {+0.191342, -0.980785, -0.038060}, {0.531250, 0.781250}},
-	{{-0.438339, -0.369552, +0.087191}, {+0.375330, -0.923880, -0.074658}, {0.531250, 0.812500}},
-	{{-0.370513, -0.332588, +0.073700}, {+0.544895, -0.831470, -0.108386}, {0.531250, 0.843750}},
-	{{-0.311063, -0.282843, +0.061874}, {+0.693520, -0.707107, -0.137950}, {0.531250, 0.875000}},
-	{{-0.262274, -0.222228, +0.052170}, {+0.815493, -0.555570, -0.162212}, {0.531250, 0.906250}},
-	{{-0.226020, -0.153073, +0.044958}, {+0.906127, -0.382683, -0.180240}, {0.531250, 0.937500}},
-	{{-0.203695, -0.078036, +0.040518}, {+0.961940, -0.195090, -0.191342}, {0.531250, 0.968750}},
-	{{-0.196157, -0.000000, +0.039018}, {+0.980785, -0.000000, -0.195090}, {0.531250, 1.000000}},
-
-	{{-0.191388, +0.000000, +0.058057}, {+0.956940, +0.000000, -0.290285}, {0.546875, 0.000000}},
-	{{-0.198743, +0.078036, +0.060288}, {+0.938553, +0.195090, -0.284707}, {0.546875, 0.031250}},
-	{{-0.220525, +0.153073, +0.066896}, {+0.884098, +0.382683, -0.268188}, {0.546875, 0.062500}},
-	{{-0.255897, +0.222228, +0.077626}, {+0.795667, +0.555570, -0.241363}, {0.546875, 0.093750}},
-	{{-0.303501, +0.282843, +0.092066}, {+0.676659, +0.707107, -0.205262}, {0.546875, 0.125000}},
-	{{-0.361505, +0.332588, +0.109661}, {+0.531648, +0.831470, -0.161274}, {0.546875, 0.156250}},
-	{{-0.427682, +0.369552, +0.129736}, {+0.366205, +0.923880, -0.111087}, {0.546875, 0.187500}},
-	{{-0.499488, +0.392314, +0.151518}, {+0.186690, +0.980785, -0.056632}, {0.546875, 0.218750}},
-	{{-0.574164, +0.400000, +0.174171}, {+0.000000, +1.000000, -0.000000}, {0.546875, 0.250000}},
-	{{-0.648840, +0.392314, +0.196823}, {-0.186690, +0.980785, +0.056632}, {0.546875, 0.281250}},
-	{{-0.720646, +0.369552, +0.218606}, {-0.366205, +0.923880, +0.111087}, {0.546875, 0.312500}},
-	{{-0.786823, +0.332588, +0.238680}, {-0.531648, +0.831470, +0.161274}, {0.546875, 0.343750}},
-	{{-0.844828, +0.282843, +0.256276}, {-0.676659, +0.707107, +0.205262}, {0.546875, 0.375000}},
-	{{-0.892431, +0.222228, +0.270716}, {-0.795667, +0.555570, +0.241363}, {0.546875, 0.406250}},
-	{{-0.927803, +0.153073, +0.281446}, {-0.884098, +0.382683, +0.268188}, {0.546875, 0.437500}},
-	{{-0.949585, +0.078036, +0.288054}, {-0.938553, +0.195090, +0.284707}, {0.546875, 0.468750}},
-	{{-0.956940, +0.000000, +0.290285}, {-0.956940, +0.000000, +0.290285}, {0.546875, 0.500000}},
-	{{-0.949585, -0.078036, +0.288054}, {-0.938553, -0.195090, +0.284707}, {0.546875, 0.531250}},
-	{{-0.927803, -0.153073, +0.281446}, {-0.884098, -0.382683, +0.268188}, {0.546875, 0.562500}},
-	{{-0.892431, -0.222228, +0.270716}, {-0.795667, -0.555570, +0.241363}, {0.546875, 0.593750}},
-	{{-0.844828, -0.282843, +0.256276}, {-0.676659, -0.707107, +0.205262}, {0.546875, 0.625000}},
-	{{-0.786823, -0.332588, +0.238680}, {-0.531648, -0.831470, +0.161274}, {0.546875, 0.656250}},
-	{{-0.720646, -0.369552, +0.218606}, {-0.366205, -0.923880, +0.111087}, {0.546875, 0.687500}},
-	{{-0.648840, -0.392314, +0.196823}, {-0.186690, -0.980785, +0.056632}, {0.546875, 0.718750}},
-	{{-0.574164, -0.400000, +0.174171}, {-0.000000, -1.000000, +0.000000}, {0.546875, 0.750000}},
-	{{-0.499488, -0.392314, +0.151518}, {+0.186690, -0.980785, -0.056632}, {0.546875, 0.781250}},
-	{{-0.427682, -0.369552, +0.129736}, {+0.366205, -0.923880, -0.111087}, {0.546875, 0.812500}},
-	{{-0.361505, -0.332588, +0.109661}, {+0.531648, -0.831470, -0.161274}, {0.546875, 0.843750}},
-	{{-0.303501, -0.282843, +0.092066}, {+0.676659, -0.707107, -0.205262}, {0.546875, 0.875000}},
-	{{-0.255897, -0.222228, +0.077626}, {+0.795667, -0.555570, -0.241363}, {0.546875, 0.906250}},
-	{{-0.220525, -0.153073, +0.066896}, {+0.884098, -0.382683, -0.268188}, {0.546875, 0.937500}},
-	{{-0.198743, -0.078036, +0.060288}, {+0.938553, -0.195090, -0.284707}, {0.546875, 0.968750}},
-	{{-0.191388, -0.000000, +0.058057}, {+0.956940, -0.000000, -0.290285}, {0.546875, 1.000000}},
-
-	{{-0.184776, +0.000000, +0.076537}, {+0.923880, +0.000000, -0.382683}, {0.562500, 0.000000}},
-	{{-0.191877, +0.078036, +0.079478}, {+0.906127, +0.195090, -0.375330}, {0.562500, 0.031250}},
-	{{-0.212906, +0.153073, +0.088189}, {+0.853553, +0.382683, -0.353553}, {0.562500, 0.062500}},
-	{{-0.247057, +0.222228, +0.102334}, {+0.768178, +0.555570, -0.318190}, {0.562500, 0.093750}},
-	{{-0.293015, +0.282843, +0.121371}, {+0.653281, +0.707107, -0.270598}, {0.562500, 0.125000}},
-	{{-0.349016, +0.332588, +0.144567}, {+0.513280, +0.831470, -0.212608}, {0.562500, 0.156250}},
-	{{-0.412906, +0.369552, +0.171031}, {+0.353553, +0.923880, -0.146447}, {0.562500, 0.187500}},
-	{{-0.482232, +0.392314, +0.199747}, {+0.180240, +0.980785, -0.074658}, {0.562500, 0.218750}},
-	{{-0.554328, +0.400000, +0.229610}, {+0.000000, +1.000000, -0.000000}, {0.562500, 0.250000}},
-	{{-0.626424, +0.392314, +0.259473}, {-0.180240, +0.980785, +0.074658}, {0.562500, 0.281250}},
-	{{-0.695749, +0.369552, +0.288189}, {-0.353553, +0.923880, +0.146447}, {0.562500, 0.312500}},
-	{{-0.759640, +0.332588, +0.314653}, {-0.513280, +0.831470, +0.212608}, {0.562500, 0.343750}},
-	{{-0.815640, +0.282843, +0.337849}, {-0.653281, +0.707107, +0.270598}, {0.562500, 0.375000}},
-	{{-0.861599, +0.222228, +0.356886}, {-0.768178, +0.555570, +0.318190}, {0.562500, 0.406250}},
-	{{-0.895749, +0.153073, +0.371031}, {-0.853553, +0.382683, +0.353553}, {0.562500, 0.437500}},
-	{{-0.916779, +0.078036, +0.379742}, {-0.906127, +0.195090, +0.375330}, {0.562500, 0.468750}},
-	{{-0.923880, +0.000000, +0.382683}, {-0.923880, +0.000000, +0.382683}, {0.562500, 0.500000}},
-	{{-0.916779, -0.078036, +0.379742}, {-0.906127, -0.195090, +0.375330}, {0.562500, 0.531250}},
-	{{-0.895749, -0.153073, +0.371031}, {-0.853553, -0.382683, +0.353553}, {0.562500, 0.562500}},
-	{{-0.861599, -0.222228, +0.356886}, {-0.768178, -0.555570, +0.318190}, {0.562500, 0.593750}},
-	{{-0.815640, -0.282843, +0.337849}, {-0.653281, -0.707107, +0.270598}, {0.562500, 0.625000}},
-	{{-0.759640, -0.332588, +0.314653}, {-0.513280, -0.831470, +0.212608}, {0.562500, 0.656250}},
-	{{-0.695749, -0.369552, +0.288189}, {-0.353553, -0.923880, +0.146447}, {0.562500, 0.687500}},
-	{{-0.626424, -0.392314, +0.259473}, {-0.180240, -0.980785, +0.074658}, {0.562500, 0.718750}},
-	{{-0.554328, -0.400000, +0.229610}, {-0.000000, -1.000000, +0.000000}, {0.562500, 0.750000}},
-	{{-0.482232, -0.392314, +0.199747}, {+0.180240, -0.980785, -0.074658}, {0.562500, 0.781250}},
-	{{-0.412906, -0.369552, +0.171031}, {+0.353553, -0.923880, -0.146447}, {0.562500, 0.812500}},
-	{{-0.349016, -0.332588, +0.144567}, {+0.513280, -0.831470, -0.212608}, {0.562500, 0.843750}},
-	{{-0.293015, -0.282843, +0.121371}, {+0.653281, -0.707107, -0.270598}, {0.562500, 0.875000}},
-	{{-0.247057, -0.222228, +0.102334}, {+0.768178, -0.555570, -0.318190}, {0.562500, 0.906250}},
-	{{-0.212906, -0.153073, +0.088189}, {+0.853553, -0.382683, -0.353553}, {0.562500, 0.937500}},
-	{{-0.191877, -0.078036, +0.079478}, {+0.906127, -0.195090, -0.375330}, {0.562500, 0.968750}},
-	{{-0.184776, -0.000000, +0.076537}, {+0.923880, -0.000000, -0.382683}, {0.562500, 1.000000}},
-
-	{{-0.176384, +0.000000, +0.094279}, {+0.881921, +0.000000, -0.471397}, {0.578125, 0.000000}},
-	{{-0.183163, +0.078036, +0.097902}, {+0.864975, +0.195090, -0.462339}, {0.578125, 0.031250}},
-	{{-0.203237, +0.153073, +0.108633}, {+0.814789, +0.382683, -0.435514}, {0.578125, 0.062500}},
-	{{-0.235836, +0.222228, +0.126057}, {+0.733291, +0.555570, -0.391952}, {0.578125, 0.093750}},
-	{{-0.279708, +0.282843, +0.149507}, {+0.623613, +0.707107, -0.333328}, {0.578125, 0.125000}},
-	{{-0.333165, +0.332588, +0.178080}, {+0.489969, +0.831470, -0.261894}, {0.578125, 0.156250}},
-	{{-0.394154, +0.369552, +0.210680}, {+0.337497, +0.923880, -0.180396}, {0.578125, 0.187500}},
-	{{-0.460331, +0.392314, +0.246052}, {+0.172054, +0.980785, -0.091965}, {0.578125, 0.218750}},
-	{{-0.529153, +0.400000, +0.282838}, {+0.000000, +1.000000, -0.000000}, {0.578125, 0.250000}},
-	{{-0.597974, +0.392314, +0.319624}, {-0.172054, +0.980785, +0.091965}, {0.578125, 0.281250}},
-	{{-0.664151, +0.369552, +0.354996}, {-0.337497, +0.923880, +0.180396}, {0.578125, 0.312500}},
-	{{-0.725140, +0.332588, +0.387596}, {-0.489969, +0.831470, +0.261894}, {0.578125, 0.343750}},
-	{{-0.778598, +0.282843, +0.416169}, {-0.623613, +0.707107, +0.333328}, {0.578125, 0.375000}},
-	{{-0.822469, +0.222228, +0.439619}, {-0.733291, +0.555570, +0.391952}, {0.578125, 0.406250}},
-	{{-0.855068, +0.153073, +0.457044}, {-0.814789, +0.382683, +0.435514}, {0.578125, 0.437500}},
-	{{-0.875143, +0.078036, +0.467774}, {-0.864975, +0.195090, +0.462339}, {0.578125, 0.468750}},
-	{{-0.881921, +0.000000, +0.471397}, {-0.881921, +0.000000, +0.471397}, {0.578125, 0.500000}},
-	{{-0.875143, -0.078036, +0.467774}, {-0.864975, -0.195090, +0.462339}, {0.578125, 0.531250}},
-	{{-0.855068, -0.153073, +0.457044}, {-0.814789, -0.382683, +0.435514}, {0.578125, 0.562500}},
-	{{-0.822469, -0.222228, +0.439619}, {-0.733291, -0.555570, +0.391952}, {0.578125, 0.593750}},
-	{{-0.778598, -0.282843, +0.416169}, {-0.623613, -0.707107, +0.333328}, {0.578125, 0.625000}},
-	{{-0.725140, -0.332588, +0.387596}, {-0.489969, -0.831470, +0.261894}, {0.578125, 0.656250}},
-	{{-0.664151, -0.369552, +0.354996}, {-0.337497, -0.923880, +0.180396}, {0.578125, 0.687500}},
-	{{-0.597974, -0.392314, +0.319624}, {-0.172054, -0.980785, +0.091965}, {0.578125, 0.718750}},
-	{{-0.529153, -0.400000, +0.282838}, {-0.000000, -1.000000, +0.000000}, {0.578125, 0.750000}},
-	{{-0.460331, -0.392314, +0.246052}, {+0.172054, -0.980785, -0.091965}, {0.578125, 0.781250}},
-	{{-0.394154, -0.369552, +0.210680}, {+0.337497, -0.923880, -0.180396}, {0.578125, 0.812500}},
-	{{-0.333165, -0.332588, +0.178080}, {+0.489969, -0.831470, -0.261894}, {0.578125, 0.843750}},
-	{{-0.279708, -0.282843, +0.149507}, {+0.623613, -0.707107, -0.333328}, {0.578125, 0.875000}},
-	{{-0.235836, -0.222228, +0.126057}, {+0.733291, -0.555570, -0.391952}, {0.578125, 0.906250}},
-	{{-0.203237, -0.153073, +0.108633}, {+0.814789, -0.382683, -0.435514}, {0.578125, 0.937500}},
-	{{-0.183163, -0.078036, +0.097902}, {+0.864975, -0.195090, -0.462339}, {0.578125, 0.968750}},
-	{{-0.176384, -0.000000, +0.094279}, {+0.881921, -0.000000, -0.471397}, {0.578125, 1.000000}},
-
-	{{-0.166294, +0.000000, +0.111114}, {+0.831470, +0.000000, -0.555570}, {0.593750, 0.000000}},
-	{{-0.172685, +0.078036, +0.115384}, {+0.815493, +0.195090, -0.544895}, {0.593750, 0.031250}},
-	{{-0.191611, +0.153073, +0.128030}, {+0.768178, +0.382683, -0.513280}, {0.593750, 0.062500}},
-	{{-0.222345, +0.222228, +0.148566}, {+0.691342, +0.555570, -0.461940}, {0.593750, 0.093750}},
-	{{-0.263707, +0.282843, +0.176203}, {+0.587938, +0.707107, -0.392847}, {0.593750, 0.125000}},
-	{{-0.314106, +0.332588, +0.209879}, {+0.461940, +0.831470, -0.308658}, {0.593750, 0.156250}},
-	{{-0.371606, +0.369552, +0.248299}, {+0.318190, +0.923880, -0.212608}, {0.593750, 0.187500}},
-	{{-0.433997, +0.392314, +0.289988}, {+0.162212, +0.980785, -0.108386}, {0.593750, 0.218750}},
-	{{-0.498882, +0.400000, +0.333342}, {+0.000000, +1.000000, -0.000000}, {0.593750, 0.250000}},
-	{{-0.563766, +0.392314, +0.376697}, {-0.162212, +0.980785, +0.108386}, {0.593750, 0.281250}},
-	{{-0.626158, +0.369552, +0.418385}, {-0.318190, +0.923880, +0.212608}, {0.593750, 0.312500}},
-	{{-0.683658, +0.332588, +0.456805}, {-0.461940, +0.831470, +0.308658}, {0.593750, 0.343750}},
-	{{-0.734057, +0.282843, +0.490481}, {-0.587938, +0.707107, +0.392847}, {0.593750, 0.375000}},
-	{{-0.775418, +0.222228, +0.518118}, {-0.691342, +0.555570, +0.461940}, {0.593750, 0.406250}},
-	{{-0.806153, +0.153073, +0.538654}, {-0.768178, +0.382683, +0.513280}, {0.593750, 0.437500}},
-	{{-0.825079, +0.078036, +0.551300}, {-0.815493, +0.195090, +0.544895}, {0.593750, 0.468750}},
-	{{-0.831470, +0.000000, +0.555570}, {-0.831470, +0.000000, +0.555570}, {0.593750, 0.500000}},
-	{{-0.825079, -0.078036, +0.551300}, {-0.815493, -0.195090, +0.544895}, {0.593750, 0.531250}},
-	{{-0.806153, -0.153073, +0.538654}, {-0.768178, -0.382683, +0.513280}, {0.593750, 0.562500}},
-	{{-0.775418, -0.222228, +0.518118}, {-0.691342, -0.555570, +0.461940}, {0.593750, 0.593750}},
-	{{-0.734057, -0.282843, +0.490481}, {-0.587938, -0.707107, +0.392847}, {0.593750, 0.625000}},
-	{{-0.683658, -0.332588, +0.456805}, {-0.461940, -0.831470, +0.308658}, {0.593750, 0.656250}},
-	{{-0.626158, -0.369552, +0.418385}, {-0.318190, -0.923880, +0.212608}, {0.593750, 0.687500}},
-	{{-0.563766, -0.392314, +0.376697}, {-0.162212, -0.980785, +0.108386}, {0.593750, 0.718750}},
-	{{-0.498882, -0.400000, +0.333342}, {-0.000000, -1.000000, +0.000000}, {0.593750, 0.750000}},
-	{{-0.433997, -0.392314, +0.289988}, {+0.162212, -0.980785, -0.108386}, {0.593750, 0.781250}},
-	{{-0.371606, -0.369552, +0.248299}, {+0.318190, -0.923880, -0.212608}, {0.593750, 0.812500}},
-	{{-0.314106, -0.332588, +0.209879}, {+0.461940, -0.831470, -0.308658}, {0.593750, 0.843750}},
-	{{-0.263707, -0.282843, +0.176203}, {+0.587938, -0.707107, -0.392847}, {0.593750, 0.875000}},
-	{{-0.222345, -0.222228, +0.148566}, {+0.691342, -0.555570, -0.461940}, {0.593750, 0.906250}},
-	{{-0.191611, -0.153073, +0.128030}, {+0.768178, -0.382683, -0.513280}, {0.593750, 0.937500}},
-	{{-0.172685, -0.078036, +0.115384}, {+0.815493, -0.195090, -0.544895}, {0.593750, 0.968750}},
-	{{-0.166294, -0.000000, +0.111114}, {+0.831470, -0.000000, -0.555570}, {0.593750, 1.000000}},
-
-	{{-0.154602, +0.000000, +0.126879}, {+0.773010, +0.000000, -0.634393}, {0.609375, 0.000000}},
-	{{-0.160543, +0.078036, +0.131755}, {+0.758157, +0.195090, -0.622204}, {0.609375, 0.031250}},
-	{{-0.178139, +0.153073, +0.146195}, {+0.714169, +0.382683, -0.586103}, {0.609375, 0.062500}},
-	{{-0.206712, +0.222228, +0.169644}, {+0.642735, +0.555570, -0.527479}, {0.609375, 0.093750}},
-	{{-0.245166, +0.282843, +0.201202}, {+0.546601, +0.707107, -0.448584}, {0.609375, 0.125000}},
-	{{-0.292022, +0.332588, +0.239656}, {+0.429462, +0.831470, -0.352450}, {0.609375, 0.156250}},
-	{{-0.345479, +0.369552, +0.283527}, {+0.295818, +0.923880, -0.242772}, {0.609375, 0.187500}},
-	{{-0.403484, +0.392314, +0.331130}, {+0.150807, +0.980785, -0.123764}, {0.609375, 0.218750}},
-	{{-0.463806, +0.400000, +0.380636}, {+0.000000, +1.000000, -0.000000}, {0.609375, 0.250000}},
-	{{-0.524129, +0.392314, +0.430142}, {-0.150807, +0.980785, +0.123764}, {0.609375, 0.281250}},
-	{{-0.582134, +0.369552, +0.477745}, {-0.295818, +0.923880, +0.242772}, {0.609375, 0.312500}},
-	{{-0.635591, +0.332588, +0.521616}, {-0.429462, +0.831470, +0.352450}, {0.609375, 0.343750}},
-	{{-0.682447, +0.282843, +0.560069}, {-0.546601, +0.707107, +0.448584}, {0.609375, 0.375000}},
-	{{-0.720900, +0.222228, +0.591627}, {-0.642735, +0.555570, +0.527479}, {0.609375, 0.406250}},
-	{{-0.749474, +0.153073, +0.615077}, {-0.714169, +0.382683, +0.586103}, {0.609375, 0.437500}},
-	{{-0.767069, +0.078036, +0.629517}, {-0.758157, +0.195090, +0.622204}, {0.609375, 0.468750}},
-	{{-0.773010, +0.000000, +0.634393}, {-0.773010, +0.000000, +0.634393}, {0.609375, 0.500000}},
-	{{-0.767069, -0.078036, +0.629517}, {-0.758157, -0.195090, +0.622204}, {0.609375, 0.531250}},
-	{{-0.749474, -0.153073, +0.615077}, {-0.714169, -0.382683, +0.586103}, {0.609375, 0.562500}},
-	{{-0.720900, -0.222228, +0.591627}, {-0.642735, -0.555570, +0.527479}, {0.609375, 0.593750}},
-	{{-0.682447, -0.282843, +0.560069}, {-0.546601, -0.707107, +0.448584}, {0.609375, 0.625000}},
-	{{-0.635591, -0.332588, +0.521616}, {-0.429462, -0.831470, +0.352450}, {0.609375, 0.656250}},
-	{{-0.582134, -0.369552, +0.477745}, {-0.295818, -0.923880, +0.242772}, {0.609375, 0.687500}},
-	{{-0.524129, -0.392314, +0.430142}, {-0.150807, -0.980785, +0.123764}, {0.609375, 0.718750}},
-	{{-0.463806, -0.400000, +0.380636}, {-0.000000, -1.000000, +0.000000}, {0.609375, 0.750000}},
-	{{-0.403484, -0.392314, +0.331130}, {+0.150807, -0.980785, -0.123764}, {0.609375, 0.781250}},
-	{{-0.345479, -0.369552, +0.283527}, {+0.295818, -0.923880, -0.242772}, {0.609375, 0.812500}},
-	{{-0.292022, -0.332588, +0.239656}, {+0.429462, -0.831470, -0.352450}, {0.609375, 0.843750}},
-	{{-0.245166, -0.282843, +0.201202}, {+0.546601, -0.707107, -0.448584}, {0.609375, 0.875000}},
-	{{-0.206712, -0.222228, +0.169644}, {+0.642735, -0.555570, -0.527479}, {0.609375, 0.906250}},
-	{{-0.178139, -0.153073, +0.146195}, {+0.714169, -0.382683, -0.586103}, {0.609375, 0.937500}},
-	{{-0.160543, -0.078036, +0.131755}, {+0.758157, -0.195090, -0.622204}, {0.609375, 0.968750}},
-	{{-0.154602, -0.000000, +0.126879}, {+0.773010, -0.000000, -0.634393}, {0.609375, 1.000000}},
-
-	{{-0.141421, +0.000000, +0.141421}, {+0.707107, +0.000000, -0.707107}, {0.625000, 0.000000}},
-	{{-0.146856, +0.078036, +0.146856}, {+0.693520, +0.195090, -0.693520}, {0.625000, 0.031250}},
-	{{-0.162951, +0.153073, +0.162951}, {+0.653281, +0.382683, -0.653281}, {0.625000, 0.062500}},
-	{{-0.189089, +0.222228, +0.189089}, {+0.587938, +0.555570, -0.587938}, {0.625000, 0.093750}},
-	{{-0.224264, +0.282843, +0.224264}, {+0.500000, +0.707107, -0.500000}, {0.625000, 0.125000}},
-	{{-0.267125, +0.332588, +0.267125}, {+0.392847, +0.831470, -0.392847}, {0.625000, 0.156250}},
-	{{-0.316025, +0.369552, +0.316025}, {+0.270598, +0.923880, -0.270598}, {0.625000, 0.187500}},
-	{{-0.369084, +0.392314, +0.369084}, {+0.137950, +0.980785, -0.137950}, {0.625000, 0.218750}},
-	{{-0.424264, +0.400000, +0.424264}, {+0.000000, +1.000000, -0.000000}, {0.625000, 0.250000}},
-	{{-0.479444, +0.392314, +0.479444}, {-0.137950, +0.980785, +0.137950}, {0.625000, 0.281250}},
-	{{-0.532503, +0.369552, +0.532503}, {-0.270598, +0.923880, +0.270598}, {0.625000, 0.312500}},
-	{{-0.581403, +0.332588, +0.581403}, {-0.392847, +0.831470, +0.392847}, {0.625000, 0.343750}},
-	{{-0.624264, +0.282843, +0.624264}, {-0.500000, +0.707107, +0.500000}, {0.625000, 0.375000}},
-	{{-0.659439, +0.222228, +0.659439}, {-0.587938, +0.555570, +0.587938}, {0.625000, 0.406250}},
-	{{-0.685577, +0.153073, +0.685577}, {-0.653281, +0.382683, +0.653281}, {0.625000, 0.437500}},
-	{{-0.701672, +0.078036, +0.701672}, {-0.693520, +0.195090, +0.693520}, {0.625000, 0.468750}},
-	{{-0.707107, +0.000000, +0.707107}, {-0.707107, +0.000000, +0.707107}, {0.625000, 0.500000}},
-	{{-0.701672, -0.078036, +0.701672}, {-0.693520, -0.195090, +0.693520}, {0.625000, 0.531250}},
-	{{-0.685577, -0.153073, +0.685577}, {-0.653281, -0.382683, +0.653281}, {0.625000, 0.562500}},
-	{{-0.659439, -0.222228, +0.659439}, {-0.587938, -0.555570, +0.587938}, {0.625000, 0.593750}},
-	{{-0.624264, -0.282843, +0.624264}, {-0.500000, -0.707107, +0.500000}, {0.625000, 0.625000}},
-	{{-0.581403, -0.332588, +0.581403}, {-0.392847, -0.831470, +0.392847}, {0.625000, 0.656250}},
-	{{-0.532503, -0.369552, +0.532503}, {-0.270598, -0.923880, +0.270598}, {0.625000, 0.687500}},
-	{{-0.479444, -0.392314, +0.479444}, {-0.137950, -0.980785, +0.137950}, {0.625000, 0.718750}},
-	{{-0.424264, -0.400000, +0.424264}, {-0.000000, -1.000000, +0.000000}, {0.625000, 0.750000}},
-	{{-0.369084, -0.392314, +0.369084}, {+0.137950, -0.980785, -0.137950}, {0.625000, 0.781250}},
-	{{-0.316025, -0.369552, +0.316025}, {+0.270598, -0.923880, -0.270598}, {0.625000, 0.812500}},
-	{{-0.267125, -0.332588, +0.267125}, {+0.392847, -0.831470, -0.392847}, {0.625000, 0.843750}},
-	{{-0.224264, -0.282843, +0.224264}, {+0.500000, -0.707107, -0.500000}, {0.625000, 0.875000}},
-	{{-0.189089, -0.222228, +0.189089}, {+0.587938, -0.555570, -0.587938}, {0.625000, 0.906250}},
-	{{-0.162951, -0.153073, +0.162951}, {+0.653281, -0.382683, -0.653281}, {0.625000, 0.937500}},
-	{{-0.146856, -0.078036, +0.146856}, {+0.693520, -0.195090, -0.693520}, {0.625000, 0.968750}},
-	{{-0.141421, -0.000000, +0.141421}, {+0.707107, -0.000000, -0.707107}, {0.625000, 1.000000}},
-
-	{{-0.126879, +0.000000, +0.154602}, {+0.634393, +0.000000, -0.773010}, {0.640625, 0.000000}},
-	{{-0.131755, +0.078036, +0.160543}, {+0.622204, +0.195090, -0.758157}, {0.640625, 0.031250}},
-	{{-0.146195, +0.153073, +0.178139}, {+0.586103, +0.382683, -0.714169}, {0.640625, 0.062500}},
-	{{-0.169644, +0.222228, +0.206712}, {+0.527479, +0.555570, -0.642735}, {0.640625, 0.093750}},
-	{{-0.201202, +0.282843, +0.245166}, {+0.448584, +0.707107, -0.546601}, {0.640625, 0.125000}},
-	{{-0.239656, +0.332588, +0.292022}, {+0.352450, +0.831470, -0.429462}, {0.640625, 0.156250}},
-	{{-0.283527, +0.369552, +0.345479}, {+0.242772, +0.923880, -0.295818}, {0.640625, 0.187500}},
-	{{-0.331130, +0.392314, +0.403484}, {+0.123764, +0.980785, -0.150807}, {0.640625, 0.218750}},
-	{{-0.380636, +0.400000, +0.463806}, {+0.000000, +1.000000, -0.000000}, {0.640625, 0.250000}},
-	{{-0.430142, +0.392314, +0.524129}, {-0.123764, +0.980785, +0.150807}, {0.640625, 0.281250}},
-	{{-0.477745, +0.369552, +0.582134}, {-0.242772, +0.923880, +0.295818}, {0.640625, 0.312500}},
-	{{-0.521616, +0.332588, +0.635591}, {-0.352450, +0.831470, +0.429462}, {0.640625, 0.343750}},
-	{{-0.560069, +0.282843, +0.682447}, {-0.448584, +0.707107, +0.546601}, {0.640625, 0.375000}},
-	{{-0.591627, +0.222228, +0.720900}, {-0.527479, +0.555570, +0.642735}, {0.640625, 0.406250}},
-	{{-0.615077, +0.153073, +0.749474}, {-0.586103, +0.382683, +0.714169}, {0.640625, 0.437500}},
-	{{-0.629517, +0.078036, +0.767069}, {-0.622204, +0.195090, +0.758157}, {0.640625, 0.468750}},
-	{{-0.634393, +0.000000, +0.773010}, {-0.634393, +0.000000, +0.773010}, {0.640625, 0.500000}},
-	{{-0.629517, -0.078036, +0.767069}, {-0.622204, -0.195090, +0.758157}, {0.640625, 0.531250}},
-	{{-0.615077, -0.153073, +0.749474}, {-0.586103, -0.382683, +0.714169}, {0.640625, 0.562500}},
-	{{-0.591627, -0.222228, +0.720900}, {-0.527479, -0.555570, +0.642735}, {0.640625, 0.593750}},
-	{{-0.560069, -0.282843, +0.682447}, {-0.448584, -0.707107, +0.546601}, {0.640625, 0.625000}},
-	{{-0.521616, -0.332588, +0.635591}, {-0.352450, -0.831470, +0.429462}, {0.640625, 0.656250}},
-	{{-0.477745, -0.369552, +0.582134}, {-0.242772, -0.923880, +0.295818}, {0.640625, 0.687500}},
-	{{-0.430142, -0.392314, +0.524129}, {-0.123764, -0.980785, +0.150807}, {0.640625, 0.718750}},
-	{{-0.380636, -0.400000, +0.463806}, {-0.000000, -1.000000, +0.000000}, {0.640625, 0.750000}},
-	{{-0.331130, -0.392314, +0.403484}, {+0.123764, -0.980785, -0.150807}, {0.640625, 0.781250}},
-	{{-0.283527, -0.369552, +0.345479}, {+0.242772, -0.923880, -0.295818}, {0.640625, 0.812500}},
-	{{-0.239656, -0.332588, +0.292022}, {+0.352450, -0.831470, -0.429462}, {0.640625, 0.843750}},
-	{{-0.201202, -0.282843, +0.245166}, {+0.448584, -0.707107, -0.546601}, {0.640625, 0.875000}},
-	{{-0.169644, -0.222228, +0.206712}, {+0.527479, -0.555570, -0.642735}, {0.640625, 0.906250}},
-	{{-0.146195, -0.153073, +0.178139}, {+0.586103, -0.382683, -0.714169}, {0.640625, 0.937500}},
-	{{-0.131755, -0.078036, +0.160543}, {+0.622204, -0.195090, -0.758157}, {0.640625, 0.968750}},
-	{{-0.126879, -0.000000, +0.154602}, {+0.634393, -0.000000, -0.773010}, {0.640625, 1.000000}},
-
-	{{-0.111114, +0.000000, +0.166294}, {+0.555570, +0.000000, -0.831470}, {0.656250, 0.000000}},
-	{{-0.115384, +0.078036, +0.172685}, {+0.544895, +0.195090, -0.815493}, {0.656250, 0.031250}},
-	{{-0.128030, +0.153073, +0.191611}, {+0.513280, +0.382683, -0.768178}, {0.656250, 0.062500}},
-	{{-0.148566, +0.222228, +0.222345}, {+0.461940, +0.555570, -0.691342}, {0.656250, 0.093750}},
-	{{-0.176203, +0.282843, +0.263707}, {+0.392847, +0.707107, -0.587938}, {0.656250, 0.125000}},
-	{{-0.209879, +0.332588, +0.314106}, {+0.308658, +0.831470, -0.461940}, {0.656250, 0.156250}},
-	{{-0.248299, +0.369552, +0.371606}, {+0.212608, +0.923880, -0.318190}, {0.656250, 0.187500}},
-	{{-0.289988, +0.392314, +0.433997}, {+0.108386, +0.980785, -0.162212}, {0.656250, 0.218750}},
-	{{-0.333342, +0.400000, +0.498882}, {+0.000000, +1.000000, -0.000000}, {0.656250, 0.250000}},
-	{{-0.376697, +0.392314, +0.563766}, {-0.108386, +0.980785, +0.162212}, {0.656250, 0.281250}},
-	{{-0.418385, +0.369552, +0.626158}, {-0.212608, +0.923880, +0.318190}, {0.656250, 0.312500}},
-	{{-0.456805, +0.332588, +0.683658}, {-0.308658, +0.831470, +0.461940}, {0.656250, 0.343750}},
-	{{-0.490481, +0.282843, +0.734057}, {-0.392847, +0.707107, +0.587938}, {0.656250, 0.375000}},
-	{{-0.518118, +0.222228, +0.775418}, {-0.461940, +0.555570, +0.691342}, {0.656250, 0.406250}},
-	{{-0.538654, +0.153073, +0.806153}, {-0.513280, +0.382683, +0.768178}, {0.656250, 0.437500}},
-	{{-0.551300, +0.078036, +0.825079}, {-0.544895, +0.195090, +0.815493}, {0.656250, 0.468750}},
-	{{-0.555570, +0.000000, +0.831470}, {-0.555570, +0.000000, +0.831470}, {0.656250, 0.500000}},
-	{{-0.551300, -0.078036, +0.825079}, {-0.544895, -0.195090, +0.815493}, {0.656250, 0.531250}},
-	{{-0.538654, -0.153073, +0.806153}, {-0.513280, -0.382683, +0.768178}, {0.656250, 0.562500}},
-	{{-0.518118, -0.222228, +0.775418}, {-0.461940, -0.555570, +0.691342}, {0.656250, 0.593750}},
-	{{-0.490481, -0.282843, +0.734057}, {-0.392847, -0.707107, +0.587938}, {0.656250, 0.625000}},
-	{{-0.456805, -0.332588, +0.683658}, {-0.308658, -0.831470, +0.461940}, {0.656250, 0.656250}},
-	{{-0.418385, -0.369552, +0.626158}, {-0.212608, -0.923880, +0.318190}, {0.656250, 0.687500}},
-	{{-0.376697, -0.392314, +0.563766}, {-0.108386, -0.980785, +0.162212}, {0.656250, 0.718750}},
-	{{-0.333342, -0.400000, +0.498882}, {-0.000000, -1.000000, +0.000000}, {0.656250, 0.750000}},
-	{{-0.289988, -0.392314, +0.433997}, {+0.108386, -0.980785, -0.162212}, {0.656250, 0.781250}},
-	{{-0.248299, -0.369552, +0.371606}, {+0.212608, -0.923880, -0.318190}, {0.656250, 0.812500}},
-	{{-0.209879, -0.332588, +0.314106}, {+0.308658, -0.831470, -0.461940}, {0.656250, 0.843750}},
-	{{-0.176203, -0.282843, +0.263707}, {+0.392847, -0.707107, -0.587938}, {0.656250, 0.875000}},
-	{{-0.148566, -0.222228, +0.222345}, {+0.461940, -0.555570, -0.691342}, {0.656250, 0.906250}},
-	{{-0.128030, -0.153073, +0.191611}, {+0.513280, -0.382683, -0.768178}, {0.656250, 0.937500}},
-	{{-0.115384, -0.078036, +0.172685}, {+0.544895, -0.195090, -0.815493}, {0.656250, 0.968750}},
-	{{-0.111114, -0.000000, +0.166294}, {+0.555570, -0.000000, -0.831470}, {0.656250, 1.000000}},
-
-	{{-0.094279, +0.000000, +0.176384}, {+0.471397, +0.000000, -0.881921}, {0.671875, 0.000000}},
-	{{-0.097902, +0.078036, +0.183163}, {+0.462339, +0.195090, -0.864975}, {0.671875, 0.031250}},
-	{{-0.108633, +0.153073, +0.203237}, {+0.435514, +0.382683, -0.814789}, {0.671875, 0.062500}},
-	{{-0.126057, +0.222228, +0.235836}, {+0.391952, +0.555570, -0.733291}, {0.671875, 0.093750}},
-	{{-0.149507, +0.282843, +0.279708}, {+0.333328, +0.707107, -0.623613}, {0.671875, 0.125000}},
-	{{-0.178080, +0.332588, +0.333165}, {+0.261894, +0.831470, -0.489969}, {0.671875, 0.156250}},
-	{{-0.210680, +0.369552, +0.394154}, {+0.180396, +0.923880, -0.337497}, {0.671875, 0.187500}},
-	{{-0.246052, +0.392314, +0.460331}, {+0.091965, +0.980785, -0.172054}, {0.671875, 0.218750}},
-	{{-0.282838, +0.400000, +0.529153}, {+0.000000, +1.000000, -0.000000}, {0.671875, 0.250000}},
-	{{-0.319624, +0.392314, +0.597974}, {-0.091965, +0.980785, +0.172054}, {0.671875, 0.281250}},
-	{{-0.354996, +0.369552, +0.664151}, {-0.180396, +0.923880, +0.337497}, {0.671875, 0.312500}},
-	{{-0.387596, +0.332588, +0.725140}, {-0.261894, +0.831470, +0.489969}, {0.671875, 0.343750}},
-	{{-0.416169, +0.282843, +0.778598}, {-0.333328, +0.707107, +0.623613}, {0.671875, 0.375000}},
-	{{-0.439619, +0.222228, +0.822469}, {-0.391952, +0.555570, +0.733291}, {0.671875, 0.406250}},
-	{{-0.457044, +0.153073, +0.855068}, {-0.435514, +0.382683, +0.814789}, {0.671875, 0.437500}},
-	{{-0.467774, +0.078036, +0.875143}, {-0.462339, +0.195090, +0.864975}, {0.671875, 0.468750}},
-	{{-0.471397, +0.000000, +0.881921}, {-0.471397, +0.000000, +0.881921}, {0.671875, 0.500000}},
-	{{-0.467774, -0.078036, +0.875143}, {-0.462339, -0.195090, +0.864975}, {0.671875, 0.531250}},
-	{{-0.457044, -0.153073, +0.855068}, {-0.435514, -0.382683, +0.814789}, {0.671875, 0.562500}},
-	{{-0.439619, -0.222228, +0.822469}, {-0.391952, -0.555570, +0.733291}, {0.671875, 0.593750}},
-	{{-0.416169, -0.282843, +0.778598}, {-0.333328, -0.707107, +0.623613}, {0.671875, 0.625000}},
-	{{-0.387596, -0.332588, +0.725140}, {-0.261894, -0.831470, +0.489969}, {0.671875, 0.656250}},
-	{{-0.354996, -0.369552, +0.664151}, {-0.180396, -0.923880, +0.337497}, {0.671875, 0.687500}},
-	{{-0.319624, -0.392314, +0.597974}, {-0.091965, -0.980785, +0.172054}, {0.671875, 0.718750}},
-	{{-0.282838, -0.400000, +0.529153}, {-0.000000, -1.000000, +0.000000}, {0.671875, 0.750000}},
-	{{-0.246052, -0.392314, +0.460331}, {+0.091965, -0.980785, -0.172054}, {0.671875, 0.781250}},
-	{{-0.210680, -0.369552, +0.394154}, {+0.180396, -0.923880, -0.337497}, {0.671875, 0.812500}},
-	{{-0.178080, -0.332588, +0.333165}, {+0.261894, -0.831470, -0.489969}, {0.671875, 0.843750}},
-	{{-0.149507, -0.282843, +0.279708}, {+0.333328, -0.707107, -0.623613}, {0.671875, 0.875000}},
-	{{-0.126057, -0.222228, +0.235836}, {+0.391952, -0.555570, -0.733291}, {0.671875, 0.906250}},
-	{{-0.108633, -0.153073, +0.203237}, {+0.435514, -0.382683, -0.814789}, {0.671875, 0.937500}},
-	{{-0.097902, -0.078036, +0.183163}, {+0.462339, -0.195090, -0.864975}, {0.671875, 0.968750}},
-	{{-0.094279, -0.000000, +0.176384}, {+0.471397, -0.000000, -0.881921}, {0.671875, 1.000000}},
-
-	{{-0.076537, +0.000000, +0.184776}, {+0.382683, +0.000000, -0.923880}, {0.687500, 0.000000}},
-	{{-0.079478, +0.078036, +0.191877}, {+0.375330, +0.195090, -0.906127}, {0.687500, 0.031250}},
-	{{-0.088189, +0.153073, +0.212906}, {+0.353553, +0.382683, -0.853553}, {0.687500, 0.062500}},
-	{{-0.102334, +0.222228, +0.247057}, {+0.318190, +0.555570, -0.768178}, {0.687500, 0.093750}},
-	{{-0.121371, +0.282843, +0.293015}, {+0.270598, +0.707107, -0.653281}, {0.687500, 0.125000}},
-	{{-0.144567, +0.332588, +0.349016}, {+0.212608, +0.831470, -0.513280}, {0.687500, 0.156250}},
-	{{-0.171031, +0.369552, +0.412906}, {+0.146447, +0.923880, -0.353553}, {0.687500, 0.187500}},
-	{{-0.199747, +0.392314, +0.482232}, {+0.074658, +0.980785, -0.180240}, {0.687500, 0.218750}},
-	{{-0.229610, +0.400000, +0.554328}, {+0.000000, +1.000000, -0.000000}, {0.687500, 0.250000}},
-	{{-0.259473, +0.392314, +0.626424}, {-0.074658, +0.980785, +0.180240}, {0.687500, 0.281250}},
-	{{-0.288189, +0.369552, +0.695749}, {-0.146447, +0.923880, +0.353553}, {0.687500, 0.312500}},
-	{{-0.314653, +0.332588, +0.759640}, {-0.212608, +0.831470, +0.513280}, {0.687500, 0.343750}},
-	{{-0.337849, +0.282843, +0.815640}, {-0.270598, +0.707107, +0.653281}, {0.687500, 0.375000}},
-	{{-0.356886, +0.222228, +0.861599}, {-0.318190, +0.555570, +0.768178}, {0.687500, 0.406250}},
-	{{-0.371031, +0.153073, +0.895749}, {-0.353553, +0.382683, +0.853553}, {0.687500, 0.437500}},
-	{{-0.379742, +0.078036, +0.916779}, {-0.375330, +0.195090, +0.906127}, {0.687500, 0.468750}},
-	{{-0.382683, +0.000000, +0.923880}, {-0.382683, +0.000000, +0.923880}, {0.687500, 0.500000}},
-	{{-0.379742, -0.078036, +0.916779}, {-0.375330, -0.195090, +0.906127}, {0.687500, 0.531250}},
-	{{-0.371031, -0.153073, +0.895749}, {-0.353553, -0.382683, +0.853553}, {0.687500, 0.562500}},
-	{{-0.356886, -0.222228, +0.861599}, {-0.318190, -0.555570, +0.768178}, {0.687500, 0.593750}},
-	{{-0.337849, -0.282843, +0.815640}, {-0.270598, -0.707107, +0.653281}, {0.687500, 0.625000}},
-	{{-0.314653, -0.332588, +0.759640}, {-0.212608, -0.831470, +0.513280}, {0.687500, 0.656250}},
-	{{-0.288189, -0.369552, +0.695749}, {-0.146447, -0.923880, +0.353553}, {0.687500, 0.687500}},
-	{{-0.259473, -0.392314, +0.626424}, {-0.074658, -0.980785, +0.180240}, {0.687500, 0.718750}},
-	{{-0.229610, -0.400000, +0.554328}, {-0.000000, -1.000000, +0.000000}, {0.687500, 0.750000}},
-	{{-0.199747, -0.392314, +0.482232}, {+0.074658, -0.980785, -0.180240}, {0.687500, 0.781250}},
-	{{-0.171031, -0.369552, +0.412906}, {+0.146447, -0.923880, -0.353553}, {0.687500, 0.812500}},
-	{{-0.144567, -0.332588, +0.349016}, {+0.212608, -0.831470, -0.513280}, {0.687500, 0.843750}},
-	{{-0.121371, -0.282843, +0.293015}, {+0.270598, -0.707107, -0.653281}, {0.687500, 0.875000}},
-	{{-0.102334, -0.222228, +0.247057}, {+0.318190, -0.555570, -0.768178}, {0.687500, 0.906250}},
-	{{-0.088189, -0.153073, +0.212906}, {+0.353553, -0.382683, -0.853553}, {0.687500, 0.937500}},
-	{{-0.079478, -0.078036, +0.191877}, {+0.375330, -0.195090, -0.906127}, {0.687500, 0.968750}},
-	{{-0.076537, -0.000000, +0.184776}, {+0.382683, -0.000000, -0.923880}, {0.687500, 1.000000}},
-
-	{{-0.058057, +0.000000, +0.191388}, {+0.290285, +0.000000, -0.956940}, {0.703125, 0.000000}},
-	{{-0.060288, +0.078036, +0.198743}, {+0.284707, +0.195090, -0.938553}, {0.703125, 0.031250}},
-	{{-0.066896, +0.153073, +0.220525}, {+0.268188, +0.382683, -0.884098}, {0.703125, 0.062500}},
-	{{-0.077626, +0.222228, +0.255897}, {+0.241363, +0.555570, -0.795667}, {0.703125, 0.093750}},
-	{{-0.092066, +0.282843, +0.303501}, {+0.205262, +0.707107, -0.676659}, {0.703125, 0.125000}},
-	{{-0.109661, +0.332588, +0.361505}, {+0.161274, +0.831470, -0.531648}, {0.703125, 0.156250}},
-	{{-0.129736, +0.369552, +0.427682}, {+0.111087, +0.923880, -0.366205}, {0.703125, 0.187500}},
-	{{-0.151518, +0.392314, +0.499488}, {+0.056632, +0.980785, -0.186690}, {0.703125, 0.218750}},
-	{{-0.174171, +0.400000, +0.574164}, {+0.000000, +1.000000, -0.000000}, {0.703125, 0.250000}},
-	{{-0.196823, +0.392314, +0.648840}, {-0.056632, +0.980785, +0.186690}, {0.703125, 0.281250}},
-	{{-0.218606, +0.369552, +0.720646}, {-0.111087, +0.923880, +0.366205}, {0.703125, 0.312500}},
-	{{-0.238680, +0.332588, +0.786823}, {-0.161274, +0.831470, +0.531648}, {0.703125, 0.343750}},
-	{{-0.256276, +0.282843, +0.844828}, {-0.205262, +0.707107, +0.676659}, {0.703125, 0.375000}},
-	{{-0.270716, +0.222228, +0.892431}, {-0.241363, +0.555570, +0.795667}, {0.703125, 0.406250}},
-	{{-0.281446, +0.153073, +0.927803}, {-0.268188, +0.382683, +0.884098}, {0.703125, 0.437500}},
-	{{-0.288054, +0.078036, +0.949585}, {-0.284707, +0.195090, +0.938553}, {0.703125, 0.468750}},
-	{{-0.290285, +0.000000, +0.956940}, {-0.290285, +0.000000, +0.956940}, {0.703125, 0.500000}},
-	{{-0.288054, -0.078036, +0.949585}, {-0.284707, -0.195090, +0.938553}, {0.703125, 0.531250}},
-	{{-0.281446, -0.153073, +0.927803}, {-0.268188, -0.382683, +0.884098}, {0.703125, 0.562500}},
-	{{-0.270716, -0.222228, +0.892431}, {-0.241363, -0.555570, +0.795667}, {0.703125, 0.593750}},
-	{{-0.256276, -0.282843, +0.844828}, {-0.205262, -0.707107, +0.676659}, {0.703125, 0.625000}},
-	{{-0.238680, -0.332588, +0.786823}, {-0.161274, -0.831470, +0.531648}, {0.703125, 0.656250}},
-	{{-0.218606, -0.369552, +0.720646}, {-0.111087, -0.923880, +0.366205}, {0.703125, 0.687500}},
-	{{-0.196823, -0.392314, +0.648840}, {-0.056632, -0.980785, +0.186690}, {0.703125, 0.718750}},
-	{{-0.174171, -0.400000, +0.574164}, {-0.000000, -1.000000, +0.000000}, {0.703125, 0.750000}},
-	{{-0.151518, -0.392314, +0.499488}, {+0.056632, -0.980785, -0.186690}, {0.703125, 0.781250}},
-	{{-0.129736, -0.369552, +0.427682}, {+0.111087, -0.923880, -0.366205}, {0.703125, 0.812500}},
-	{{-0.109661, -0.332588, +0.361505}, {+0.161274, -0.831470, -0.531648}, {0.703125, 0.843750}},
-	{{-0.092066, -0.282843, +0.303501}, {+0.205262, -0.707107, -0.676659}, {0.703125, 0.875000}},
-	{{-0.077626, -0.222228, +0.255897}, {+0.241363, -0.555570, -0.795667}, {0.703125, 0.906250}},
-	{{-0.066896, -0.153073, +0.220525}, {+0.268188, -0.382683, -0.884098}, {0.703125, 0.937500}},
-	{{-0.060288, -0.078036, +0.198743}, {+0.284707, -0.195090, -0.938553}, {0.703125, 0.968750}},
-	{{-0.058057, -0.000000, +0.191388}, {+0.290285, -0.000000, -0.956940}, {0.703125, 1.000000}},
-
-	{{-0.039018, +0.000000, +0.196157}, {+0.195090, +0.000000, -0.980785}, {0.718750, 0.000000}},
-	{{-0.040518, +0.078036, +0.203695}, {+0.191342, +0.195090, -0.961940}, {0.718750, 0.031250}},
-	{{-0.044958, +0.153073, +0.226020}, {+0.180240, +0.382683, -0.906127}, {0.718750, 0.062500}},
-	{{-0.052170, +0.222228, +0.262274}, {+0.162212, +0.555570, -0.815493}, {0.718750, 0.093750}},
-	{{-0.061874, +0.282843, +0.311063}, {+0.137950, +0.707107, -0.693520}, {0.718750, 0.125000}},
-	{{-0.073700, +0.332588, +0.370513}, {+0.108386, +0.831470, -0.544895}, {0.718750, 0.156250}},
-	{{-0.087191, +0.369552, +0.438339}, {+0.074658, +0.923880, -0.375330}, {0.718750, 0.187500}},
-	{{-0.101830, +0.392314, +0.511934}, {+0.038060, +0.980785, -0.191342}, {0.718750, 0.218750}},
-	{{-0.117054, +0.400000, +0.588471}, {+0.000000, +1.000000, -0.000000}, {0.718750, 0.250000}},
-	{{-0.132278, +0.392314, +0.665008}, {-0.038060, +0.980785, +0.191342}, {0.718750, 0.281250}},
-	{{-0.146917, +0.369552, +0.738603}, {-0.074658, +0.923880, +0.375330}, {0.718750, 0.312500}},
-	{{-0.160409, +0.332588, +0.806429}, {-0.108386, +0.831470, +0.544895}, {0.718750, 0.343750}},
-	{{-0.172234, +0.282843, +0.865879}, {-0.137950, +0.707107, +0.693520}, {0.718750, 0.375000}},
-	{{-0.181939, +0.222228, +0.914668}, {-0.162212, +0.555570, +0.815493}, {0.718750, 0.406250}},
-	{{-0.189150, +0.153073, +0.950922}, {-0.180240, +0.382683, +0.906127}, {0.718750, 0.437500}},
-	{{-0.193591, +0.078036, +0.973247}, {-0.191342, +0.195090, +0.961940}, {0.718750, 0.468750}},
-	{{-0.195090, +0.000000, +0.980785}, {-0.195090, +0.000000, +0.980785}, {0.718750, 0.500000}},
-	{{-0.193591, -0.078036, +0.973247}, {-0.191342, -0.195090, +0.961940}, {0.718750, 0.531250}},
-	{{-0.189150, -0.153073, +0.950922}, {-0.180240, -0.382683, +0.906127}, {0.718750, 0.562500}},
-	{{-0.181939, -0.222228, +0.914668}, {-0.162212, -0.555570, +0.815493}, {0.718750, 0.593750}},
-	{{-0.172234, -0.282843, +0.865879}, {-0.137950, -0.707107, +0.693520}, {0.718750, 0.625000}},
-	{{-0.160409, -0.332588, +0.806429}, {-0.108386, -0.831470, +0.544895}, {0.718750, 0.656250}},
-	{{-0.146917, -0.369552, +0.738603}, {-0.074658, -0.923880, +0.375330}, {0.718750, 0.687500}},
-	{{-0.132278, -0.392314, +0.665008}, {-0.038060, -0.980785, +0.191342}, {0.718750, 0.718750}},
-	{{-0.117054, -0.400000, +0.588471}, {-0.000000, -1.000000, +0.000000}, {0.718750, 0.750000}},
-	{{-0.101830, -0.392314, +0.511934}, {+0.038060, -0.980785, -0.191342}, {0.718750, 0.781250}},
-	{{-0.087191, -0.369552, +0.438339}, {+0.074658, -0.923880, -0.375330}, {0.718750, 0.812500}},
-	{{-0.073700, -0.332588, +0.370513}, {+0.108386, -0.831470, -0.544895}, {0.718750, 0.843750}},
-	{{-0.061874, -0.282843, +0.311063}, {+0.137950, -0.707107, -0.693520}, {0.718750, 0.875000}},
-	{{-0.052170, -0.222228, +0.262274}, {+0.162212, -0.555570, -0.815493}, {0.718750, 0.906250}},
-	{{-0.044958, -0.153073, +0.226020}, {+0.180240, -0.382683, -0.906127}, {0.718750, 0.937500}},
-	{{-0.040518, -0.078036, +0.203695}, {+0.191342, -0.195090, -0.961940}, {0.718750, 0.968750}},
-	{{-0.039018, -0.000000, +0.196157}, {+0.195090, -0.000000, -0.980785}, {0.718750, 1.000000}},
-
-	{{-0.019603, +0.000000, +0.199037}, {+0.098017, +0.000000, -0.995185}, {0.734375, 0.000000}},
-	{{-0.020357, +0.078036, +0.206686}, {+0.096134, +0.195090, -0.976063}, {0.734375, 0.031250}},
-	{{-0.022588, +0.153073, +0.229339}, {+0.090556, +0.382683, -0.919431}, {0.734375, 0.062500}},
-	{{-0.026211, +0.222228, +0.266124}, {+0.081498, +0.555570, -0.827466}, {0.734375, 0.093750}},
-	{{-0.031087, +0.282843, +0.315630}, {+0.069309, +0.707107, -0.703702}, {0.734375, 0.125000}},
-	{{-0.037028, +0.332588, +0.375953}, {+0.054455, +0.831470, -0.552895}, {0.734375, 0.156250}},
-	{{-0.043806, +0.369552, +0.444775}, {+0.037510, +0.923880, -0.380841}, {0.734375, 0.187500}},
-	{{-0.051161, +0.392314, +0.519450}, {+0.019122, +0.980785, -0.194151}, {0.734375, 0.218750}},
-	{{-0.058810, +0.400000, +0.597111}, {+0.000000, +1.000000, -0.000000}, {0.734375, 0.250000}},
-	{{-0.066459, +0.392314, +0.674771}, {-0.019122, +0.980785, +0.194151}, {0.734375, 0.281250}},
-	{{-0.073814, +0.369552, +0.749447}, {-0.037510, +0.923880, +0.380841}, {0.734375, 0.312500}},
-	{{-0.080592, +0.332588, +0.818269}, {-0.054455, +0.831470, +0.552895}, {0.734375, 0.343750}},
-	{{-0.086534, +0.282843, +0.878592}, {-0.069309, +0.707107, +0.703702}, {0.734375, 0.375000}},
-	{{-0.091410, +0.222228, +0.928097}, {-0.081498, +0.555570, +0.827466}, {0.734375, 0.406250}},
-	{{-0.095033, +0.153073, +0.964883}, {-0.090556, +0.382683, +0.919431}, {0.734375, 0.437500}},
-	{{-0.097264, +0.078036, +0.987536}, {-0.096134, +0.195090, +0.976063}, {0.734375, 0.468750}},
-	{{-0.098017, +0.000000, +0.995185}, {-0.098017, +0.000000, +0.995185}, {0.734375, 0.500000}},
-	{{-0.097264, -0.078036, +0.987536}, {-0.096134, -0.195090, +0.976063}, {0.734375, 0.531250}},
-	{{-0.095033, -0.153073, +0.964883}, {-0.090556, -0.382683, +0.919431}, {0.734375, 0.562500}},
-	{{-0.091410, -0.222228, +0.928097}, {-0.081498, -0.555570, +0.827466}, {0.734375, 0.593750}},
-	{{-0.086534, -0.282843, +0.878592}, {-0.069309, -0.707107, +0.703702}, {0.734375, 0.625000}},
-	{{-0.080592, -0.332588, +0.818269}, {-0.054455, -0.831470, +0.552895}, {0.734375, 0.656250}},
-	{{-0.073814, -0.369552, +0.749447}, {-0.037510, -0.923880, +0.380841}, {0.734375, 0.687500}},
-	{{-0.066459, -0.392314, +0.674771}, {-0.019122, -0.980785, +0.194151}, {0.734375, 0.718750}},
-	{{-0.058810, -0.400000, +0.597111}, {-0.000000, -1.000000, +0.000000}, {0.734375, 0.750000}},
-	{{-0.051161, -0.392314, +0.519450}, {+0.019122, -0.980785, -0.194151}, {0.734375, 0.781250}},
-	{{-0.043806, -0.369552, +0.444775}, {+0.037510, -0.923880, -0.380841}, {0.734375, 0.812500}},
-	{{-0.037028, -0.332588, +0.375953}, {+0.054455, -0.831470, -0.552895}, {0.734375, 0.843750}},
-	{{-0.031087, -0.282843, +0.315630}, {+0.069309, -0.707107, -0.703702}, {0.734375, 0.875000}},
-	{{-0.026211, -0.222228, +0.266124}, {+0.081498, -0.555570, -0.827466}, {0.734375, 0.906250}},
-	{{-0.022588, -0.153073, +0.229339}, {+0.090556, -0.382683, -0.919431}, {0.734375, 0.937500}},
-	{{-0.020357, -0.078036, +0.206686}, {+0.096134, -0.195090, -0.976063}, {0.734375, 0.968750}},
-	{{-0.019603, -0.000000, +0.199037}, {+0.098017, -0.000000, -0.995185}, {0.734375, 1.000000}},
-
-	{{-0.000000, +0.000000, +0.200000}, {+0.000000, +0.000000, -1.000000}, {0.750000, 0.000000}},
-	{{-0.000000, +0.078036, +0.207686}, {+0.000000, +0.195090, -0.980785}, {0.750000, 0.031250}},
-	{{-0.000000, +0.153073, +0.230448}, {+0.000000, +0.382683, -0.923880}, {0.750000, 0.062500}},
-	{{-0.000000, +0.222228, +0.267412}, {-0.000000, +0.555570, -0.831470}, {0.750000, 0.093750}},
-	{{-0.000000, +0.282843, +0.317157}, {+0.000000, +0.707107, -0.707107}, {0.750000, 0.125000}},
-	{{-0.000000, +0.332588, +0.377772}, {+0.000000, +0.831470, -0.555570}, {0.750000, 0.156250}},
-	{{+0.000000, +0.369552, +0.446927}, {+0.000000, +0.923880, -0.382683}, {0.750000, 0.187500}},
-	{{-0.000000, +0.392314, +0.521964}, {-0.000000, +0.980785, -0.195090}, {0.750000, 0.218750}},
-	{{-0.000000, +0.400000, +0.600000}, {+0.000000, +1.000000, -0.000000}, {0.750000, 0.250000}},
-	{{+0.000000, +0.392314, +0.678036}, {+0.000000, +0.980785, +0.195090}, {0.750000, 0.281250}},
-	{{-0.000000, +0.369552, +0.753073}, {-0.000000, +0.923880, +0.382683}, {0.750000, 0.312500}},
-	{{-0.000000, +0.332588, +0.822228}, {+0.000000, +0.831470, +0.555570}, {0.750000, 0.343750}},
-	{{-0.000000, +0.282843, +0.882843}, {-0.000000, +0.707107, +0.707107}, {0.750000, 0.375000}},
-	{{+0.000000, +0.222228, +0.932588}, {-0.000000, +0.555570, +0.831470}, {0.750000, 0.406250}},
-	{{+0.000000, +0.153073, +0.969552}, {-0.000000, +0.382683, +0.923880}, {0.750000, 0.437500}},
-	{{-0.000000, +0.078036, +0.992314}, {-0.000000, +0.195090, +0.980785}, {0.750000, 0.468750}},
-	{{-0.000000, +0.000000, +1.000000}, {-0.000000, +0.000000, +1.000000}, {0.750000, 0.500000}},
-	{{-0.000000, -0.078036, +0.992314}, {-0.000000, -0.195090, +0.980785}, {0.750000, 0.531250}},
-	{{-0.000000, -0.153073, +0.969552}, {-0.000000, -0.382683, +0.923880}, {0.750000, 0.562500}},
-	{{-0.000000, -0.222228, +0.932588}, {-0.000000, -0.555570, +0.831470}, {0.750000, 0.593750}},
-	{{-0.000000, -0.282843, +0.882843}, {-0.000000, -0.707107, +0.707107}, {0.750000, 0.625000}},
-	{{-0.000000, -0.332588, +0.822228}, {-0.000000, -0.831470, +0.555570}, {0.750000, 0.656250}},
-	{{-0.000000, -0.369552, +0.753073}, {+0.000000, -0.923880, +0.382683}, {0.750000, 0.687500}},
-	{{-0.000000, -0.392314, +0.678036}, {-0.000000, -0.980785, +0.195090}, {0.750000, 0.718750}},
-	{{-0.000000, -0.400000, +0.600000}, {-0.000000, -1.000000, +0.000000}, {0.750000, 0.750000}},
-	{{-0.000000, -0.392314, +0.521964}, {+0.000000, -0.980785, -0.195090}, {0.750000, 0.781250}},
-	{{+0.000000, -0.369552, +0.446927}, {+0.000000, -0.923880, -0.382683}, {0.750000, 0.812500}},
-	{{-0.000000, -0.332588, +0.377772}, {+0.000000, -0.831470, -0.555570}, {0.750000, 0.843750}},
-	{{-0.000000, -0.282843, +0.317157}, {+0.000000, -0.707107, -0.707107}, {0.750000, 0.875000}},
-	{{-0.000000, -0.222228, +0.267412}, {-0.000000, -0.555570, -0.831470}, {0.750000, 0.906250}},
-	{{+0.000000, -0.153073, +0.230448}, {+0.000000, -0.382683, -0.923880}, {0.750000, 0.937500}},
-	{{-0.000000, -0.078036, +0.207686}, {+0.000000, -0.195090, -0.980785}, {0.750000, 0.968750}},
-	{{-0.000000, -0.000000, +0.200000}, {+0.000000, -0.000000, -1.000000}, {0.750000, 1.000000}},
-
-	{{+0.019603, +0.000000, +0.199037}, {-0.098017, +0.000000, -0.995185}, {0.765625, 0.000000}},
-	{{+0.020357, +0.078036, +0.206686}, {-0.096134, +0.195090, -0.976063}, {0.765625, 0.031250}},
-	{{+0.022588, +0.153073, +0.229339}, {-0.090556, +0.382683, -0.919431}, {0.765625, 0.062500}},
-	{{+0.026211, +0.222228, +0.266124}, {-0.081498, +0.555570, -0.827466}, {0.765625, 0.093750}},
-	{{+0.031087, +0.282843, +0.315630}, {-0.069309, +0.707107, -0.703702}, {0.765625, 0.125000}},
-	{{+0.037028, +0.332588, +0.375953}, {-0.054455, +0.831470, -0.552895}, {0.765625, 0.156250}},
-	{{+0.043806, +0.369552, +0.444775}, {-0.037510, +0.923880, -0.380841}, {0.765625, 0.187500}},
-	{{+0.051161, +0.392314, +0.519450}, {-0.019122, +0.980785, -0.194151}, {0.765625, 0.218750}},
-	{{+0.058810, +0.400000, +0.597111}, {-0.000000, +1.000000, -0.000000}, {0.765625, 0.250000}},
-	{{+0.066459, +0.392314, +0.674771}, {+0.019122, +0.980785, +0.194151}, {0.765625, 0.281250}},
-	{{+0.073814, +0.369552, +0.749447}, {+0.037510, +0.923880, +0.380841}, {0.765625, 0.312500}},
-	{{+0.080592, +0.332588, +0.818269}, {+0.054455, +0.831470, +0.552895}, {0.765625, 0.343750}},
-	{{+0.086534, +0.282843, +0.878592}, {+0.069309, +0.707107, +0.703702}, {0.765625, 0.375000}},
-	{{+0.091410, +0.222228, +0.928097}, {+0.081498, +0.555570, +0.827466}, {0.765625, 0.406250}},
-	{{+0.095033, +0.153073, +0.964883}, {+0.090556, +0.382683, +0.919431}, {0.765625, 0.437500}},
-	{{+0.097264, +0.078036, +0.987536}, {+0.096134, +0.195090, +0.976063}, {0.765625, 0.468750}},
-	{{+0.098017, +0.000000, +0.995185}, {+0.098017, +0.000000, +0.995185}, {0.765625, 0.500000}},
-	{{+0.097264, -0.078036, +0.987536}, {+0.096134, -0.195090, +0.976063}, {0.765625, 0.531250}},
-	{{+0.095033, -0.153073, +0.964883}, {+0.090556, -0.382683, +0.919431}, {0.765625, 0.562500}},
-	{{+0.091410, -0.222228, +0.928097}, {+0.081498, -0.555570, +0.827466}, {0.765625, 0.593750}},
-	{{+0.086534, -0.282843, +0.878592}, {+0.069309, -0.707107, +0.703702}, {0.765625, 0.625000}},
-	{{+0.080592, -0.332588, +0.818269}, {+0.054455, -0.831470, +0.552895}, {0.765625, 0.656250}},
-	{{+0.073814, -0.369552, +0.749447}, {+0.037510, -0.923880, +0.380841}, {0.765625, 0.687500}},
-	{{+0.066459, -0.392314, +0.674771}, {+0.019122, -0.980785, +0.194151}, {0.765625, 0.718750}},
-	{{+0.058810, -0.400000, +0.597111}, {+0.000000, -1.000000, +0.000000}, {0.765625, 0.750000}},
-	{{+0.051161, -0.392314, +0.519450}, {-0.019122, -0.980785, -0.194151}, {0.765625, 0.781250}},
-	{{+0.043806, -0.369552, +0.444775}, {-0.037510, -0.923880, -0.380841}, {0.765625, 0.812500}},
-	{{+0.037028, -0.332588, +0.375953}, {-0.054455, -0.831470, -0.552895}, {0.765625, 0.843750}},
-	{{+0.031087, -0.282843, +0.315630}, {-0.069309, -0.707107, -0.703702}, {0.765625, 0.875000}},
-	{{+0.026211, -0.222228, +0.266124}, {-0.081498, -0.555570, -0.827466}, {0.765625, 0.906250}},
-	{{+0.022588, -0.153073, +0.229339}, {-0.090556, -0.382683, -0.919431}, {0.765625, 0.937500}},
-	{{+0.020357, -0.078036, +0.206686}, {-0.096134, -0.195090, -0.976063}, {0.765625, 0.968750}},
-	{{+0.019603, -0.000000, +0.199037}, {-0.098017, -0.000000, -0.995185}, {0.765625, 1.000000}},
-
-	{{+0.039018, +0.000000, +0.196157}, {-0.195090, +0.000000, -0.980785}, {0.781250, 0.000000}},
-	{{+0.040518, +0.078036, +0.203695}, {-0.191342, +0.195090, -0.961940}, {0.781250, 0.031250}},
-	{{+0.044958, +0.153073, +0.226020}, {-0.180240, +0.382683, -0.906127}, {0.781250, 0.062500}},
-	{{+0.052170, +0.222228, +0.262274}, {-0.162212, +0.555570, -0.815493}, {0.781250, 0.093750}},
-	{{+0.061874, +0.282843, +0.311063}, {-0.137950, +0.707107, -0.693520}, {0.781250, 0.125000}},
-	{{+0.073700, +0.332588, +0.370513}, {-0.108386, +0.831470, -0.544895}, {0.781250, 0.156250}},
-	{{+0.087191, +0.369552, +0.438339}, {-0.074658, +0.923880, -0.375330}, {0.781250, 0.187500}},
-	{{+0.101830, +0.392314, +0.511934}, {-0.038060, +0.980785, -0.191342}, {0.781250, 0.218750}},
-	{{+0.117054, +0.400000, +0.588471}, {-0.000000, +1.000000, -0.000000}, {0.781250, 0.250000}},
-	{{+0.132278, +0.392314, +0.665008}, {+0.038060, +0.980785, +0.191342}, {0.781250, 0.281250}},
-	{{+0.146917, +0.369552, +0.738603}, {+0.074658, +0.923880, +0.375330}, {0.781250, 0.312500}},
-	{{+0.160409, +0.332588, +0.806429}, {+0.108386, +0.831470, +0.544895}, {0.781250, 0.343750}},
-	{{+0.172234, +0.282843, +0.865879}, {+0.137950, +0.707107, +0.693520}, {0.781250, 0.375000}},
-	{{+0.181939, +0.222228, +0.914668}, {+0.162212, +0.555570, +0.815493}, {0.781250, 0.406250}},
-	{{+0.189150, +0.153073, +0.950922}, {+0.180240, +0.382683, +0.906127}, {0.781250, 0.437500}},
-	{{+0.193591, +0.078036, +0.973247}, {+0.191342, +0.195090, +0.961940}, {0.781250, 0.468750}},
-	{{+0.195090, +0.000000, +0.980785}, {+0.195090, +0.000000, +0.980785}, {0.781250, 0.500000}},
-	{{+0.193591, -0.078036, +0.973247}, {+0.191342, -0.195090, +0.961940}, {0.781250, 0.531250}},
-	{{+0.189150, -0.153073, +0.950922}, {+0.180240, -0.382683, +0.906127}, {0.781250, 0.562500}},
-	{{+0.181939, -0.222228, +0.914668}, {+0.162212, -0.555570, +0.815493}, {0.781250, 0.593750}},
-	{{+0.172234, -0.282843, +0.865879}, {+0.137950, -0.707107, +0.693520}, {0.781250, 0.625000}},
-	{{+0.160409, -0.332588, +0.806429}, {+0.108386, -0.831470, +0.544895}, {0.781250, 0.656250}},
-	{{+0.146917, -0.369552, +0.738603}, {+0.074658, -0.923880, +0.375330}, {0.781250, 0.687500}},
-	{{+0.132278, -0.392314, +0.665008}, {+0.038060, -0.980785, +0.191342}, {0.781250, 0.718750}},
-	{{+0.117054, -0.400000, +0.588471}, {+0.000000, -1.000000, +0.000000}, {0.781250, 0.750000}},
-	{{+0.101830, -0.392314, +0.511934}, {-0.038060, -0.980785, -0.191342}, {0.781250, 0.781250}},
-	{{+0.087191, -0.369552, +0.438339}, {-0.074658, -0.923880, -0.375330}, {0.781250, 0.812500}},
-	{{+0.073700, -0.332588, +0.370513}, {-0.108386, -0.831470, -0.544895}, {0.781250, 0.843750}},
-	{{+0.061874, -0.282843, +0.311063}, {-0.137950, -0.707107, -0.693520}, {0.781250, 0.875000}},
-	{{+0.052170, -0.222228, +0.262274}, {-0.162212, -0.555570, -0.815493}, {0.781250, 0.906250}},
-	{{+0.044958, -0.153073, +0.226020}, {-0.180240, -0.382683, -0.906127}, {0.781250, 0.937500}},
-	{{+0.040518, -0.078036, +0.203695}, {-0.191342, -0.195090, -0.961940}, {0.781250, 0.968750}},
-	{{+0.039018, -0.000000, +0.196157}, {-0.195090, -0.000000, -0.980785}, {0.781250, 1.000000}},
-
-	{{+0.058057, +0.000000, +0.191388}, {-0.290285, +0.000000, -0.956940}, {0.796875, 0.000000}},
-	{{+0.060288, +0.078036, +0.198743}, {-0.284707, +0.195090, -0.938553}, {0.796875, 0.031250}},
-	{{+0.066896, +0.153073, +0.220525}, {-0.268188, +0.382683, -0.884098}, {0.796875, 0.062500}},
-	{{+0.077626, +0.222228, +0.255897}, {-0.241363, +0.555570, -0.795667}, {0.796875, 0.093750}},
-	{{+0.092066, +0.282843, +0.303501}, {-0.205262, +0.707107, -0.676659}, {0.796875, 0.125000}},
-	{{+0.109661, +0.332588, +0.361505}, {-0.161274, +0.831470, -0.531648}, {0.796875, 0.156250}},
-	{{+0.129736, +0.369552, +0.427682}, {-0.111087, +0.923880, -0.366205}, {0.796875, 0.187500}},
-	{{+0.151518, +0.392314, +0.499488}, {-0.056632, +0.980785, -0.186690}, {0.796875, 0.218750}},
-	{{+0.174171, +0.400000, +0.574164}, {-0.000000, +1.000000, -0.000000}, {0.796875, 0.250000}},
-	{{+0.196823, +0.392314, +0.648840}, {+0.056632, +0.980785, +0.186690}, {0.796875, 0.281250}},
-	{{+0.218606, +0.369552, +0.720646}, {+0.111087, +0.923880, +0.366205}, {0.796875, 0.312500}},
-	{{+0.238680, +0.332588, +0.786823}, {+0.161274, +0.831470, +0.531648}, {0.796875, 0.343750}},
-	{{+0.256276, +0.282843, +0.844828}, {+0.205262, +0.707107, +0.676659}, {0.796875, 0.375000}},
-	{{+0.270716, +0.222228, +0.892431}, {+0.241363, +0.555570, +0.795667}, {0.796875, 0.406250}},
-	{{+0.281446, +0.153073, +0.927803}, {+0.268188, +0.382683, +0.884098}, {0.796875, 0.437500}},
-	{{+0.288054, +0.078036, +0.949585}, {+0.284707, +0.195090, +0.938553}, {0.796875, 0.468750}},
-	{{+0.290285, +0.000000, +0.956940}, {+0.290285, +0.000000, +0.956940}, {0.796875, 0.500000}},
-	{{+0.288054, -0.078036, +0.949585}, {+0.284707, -0.195090, +0.938553}, {0.796875, 0.531250}},
-	{{+0.281446, -0.153073, +0.927803}, {+0.268188, -0.382683, +0.884098}, {0.796875, 0.562500}},
-	{{+0.270716, -0.222228, +0.892431}, {+0.241363, -0.555570, +0.795667}, {0.796875, 0.593750}},
-	{{+0.256276, -0.282843, +0.844828}, {+0.205262, -0.707107, +0.676659}, {0.796875, 0.625000}},
-	{{+0.238680, -0.332588, +0.786823}, {+0.161274, -0.831470, +0.531648}, {0.796875, 0.656250}},
-	{{+0.218606, -0.369552, +0.720646}, {+0.111087, -0.923880, +0.366205}, {0.796875, 0.687500}},
-	{{+0.196823, -0.392314, +0.648840}, {+0.056632, -0.980785, +0.186690}, {0.796875, 0.718750}},
-	{{+0.174171, -0.400000, +0.574164}, {+0.000000, -1.000000, +0.000000}, {0.796875, 0.750000}},
-	{{+0.151518, -0.392314, +0.499488}, {-0.056632, -0.980785, -0.186690}, {0.796875, 0.781250}},
-	{{+0.129736, -0.369552, +0.427682}, {-0.111087, -0.923880, -0.366205}, {0.796875, 0.812500}},
-	{{+0.109661, -0.332588, +0.361505}, {-0.161274, -0.831470, -0.531648}, {0.796875, 0.843750}},
-	{{+0.092066, -0.282843, +0.303501}, {-0.205262, -0.707107, -0.676659}, {0.796875, 0.875000}},
-	{{+0.077626, -0.222228, +0.255897}, {-0.241363, -0.555570, -0.795667}, {0.796875, 0.906250}},
-	{{+0.066896, -0.153073, +0.220525}, {-0.268188, -0.382683, -0.884098}, {0.796875, 0.937500}},
-	{{+0.060288, -0.078036, +0.198743}, {-0.284707, -0.195090, -0.938553}, {0.796875, 0.968750}},
-	{{+0.058057, -0.000000, +0.191388}, {-0.290285, -0.000000, -0.956940}, {0.796875, 1.000000}},
-
-	{{+0.076537, +0.000000, +0.184776}, {-0.382683, +0.000000, -0.923880}, {0.812500, 0.000000}},
-	{{+0.079478, +0.078036, +0.191877}, {-0.375330, +0.195090, -0.906127}, {0.812500, 0.031250}},
-	{{+0.088189, +0.153073, +0.212906}, {-0.353553, +0.382683, -0.853553}, {0.812500, 0.062500}},
-	{{+0.102334, +0.222228, +0.247057}, {-0.318190, +0.555570, -0.768178}, {0.812500, 0.093750}},
-	{{+0.121371, +0.282843, +0.293015}, {-0.270598, +0.707107, -0.653281}, {0.812500, 0.125000}},
-	{{+0.144567, +0.332588, +0.349016}, {-0.212608, +0.831470, -0.513280}, {0.812500, 0.156250}},
-	{{+0.171031, +0.369552, +0.412906}, {-0.146447, +0.923880, -0.353553}, {0.812500, 0.187500}},
-	{{+0.199747, +0.392314, +0.482232}, {-0.074658, +0.980785, -0.180240}, {0.812500, 0.218750}},
-	{{+0.229610, +0.400000, +0.554328}, {-0.000000, +1.000000, -0.000000}, {0.812500, 0.250000}},
-	{{+0.259473, +0.392314, +0.626424}, {+0.074658, +0.980785, +0.180240}, {0.812500, 0.281250}},
-	{{+0.288189, +0.369552, +0.695749}, {+0.146447, +0.923880, +0.353553}, {0.812500, 0.312500}},
-	{{+0.314653, +0.332588, +0.759640}, {+0.212608, +0.831470, +0.513280}, {0.812500, 0.343750}},
-	{{+0.337849, +0.282843, +0.815640}, {+0.270598, +0.707107, +0.653281}, {0.812500, 0.375000}},
-	{{+0.356886, +0.222228, +0.861599}, {+0.318190, +0.555570, +0.768178}, {0.812500, 0.406250}},
-	{{+0.371031, +0.153073, +0.895749}, {+0.353553, +0.382683, +0.853553}, {0.812500, 0.437500}},
-	{{+0.379742, +0.078036, +0.916779}, {+0.375330, +0.195090, +0.906127}, {0.812500, 0.468750}},
-	{{+0.382683, +0.000000, +0.923880}, {+0.382683, +0.000000, +0.923880}, {0.812500, 0.500000}},
-	{{+0.379742, -0.078036, +0.916779}, {+0.375330, -0.195090, +0.906127}, {0.812500, 0.531250}},
-	{{+0.371031, -0.153073, +0.895749}, {+0.353553, -0.382683, +0.853553}, {0.812500, 0.562500}},
-	{{+0.356886, -0.222228, +0.861599}, {+0.318190, -0.555570, +0.768178}, {0.812500, 0.593750}},
-	{{+0.337849, -0.282843, +0.815640}, {+0.270598, -0.707107, +0.653281}, {0.812500, 0.625000}},
-	{{+0.314653, -0.332588, +0.759640}, {+0.212608, -0.831470, +0.513280}, {0.812500, 0.656250}},
-	{{+0.288189, -0.369552, +0.695749}, {+0.146447, -0.923880, +0.353553}, {0.812500, 0.687500}},
-	{{+0.259473, -0.392314, +0.626424}, {+0.074658, -0.980785, +0.180240}, {0.812500, 0.718750}},
-	{{+0.229610, -0.400000, +0.554328}, {+0.000000, -1.000000, +0.000000}, {0.812500, 0.750000}},
-	{{+0.199747, -0.392314, +0.482232}, {-0.074658, -0.980785, -0.180240}, {0.812500, 0.781250}},
-	{{+0.171031, -0.369552, +0.412906}, {-0.146447, -0.923880, -0.353553}, {0.812500, 0.812500}},
-	{{+0.144567, -0.332588, +0.349016}, {-0.212608, -0.831470, -0.513280}, {0.812500, 0.843750}},
-	{{+0.121371, -0.282843, +0.293015}, {-0.270598, -0.707107, -0.653281}, {0.812500, 0.875000}},
-	{{+0.102334, -0.222228, +0.247057}, {-0.318190, -0.555570, -0.768178}, {0.812500, 0.906250}},
-	{{+0.088189, -0.153073, +0.212906}, {-0.353553, -0.382683, -0.853553}, {0.812500, 0.937500}},
-	{{+0.079478, -0.078036, +0.191877}, {-0.375330, -0.195090, -0.906127}, {0.812500, 0.968750}},
-	{{+0.076537, -0.000000, +0.184776}, {-0.382683, -0.000000, -0.923880}, {0.812500, 1.000000}},
-
-	{{+0.094279, +0.000000, +0.176384}, {-0.471397, +0.000000, -0.881921}, {0.828125, 0.000000}},
-	{{+0.097902, +0.078036, +0.183163}, {-0.462339, +0.195090, -0.864975}, {0.828125, 0.031250}},
-	{{+0.108633, +0.153073, +0.203237}, {-0.435514, +0.382683, -0.814789}, {0.828125, 0.062500}},
-	{{+0.126057, +0.222228, +0.235836}, {-0.391952, +0.555570, -0.733291}, {0.828125, 0.093750}},
-	{{+0.149507, +0.282843, +0.279708}, {-0.333328, +0.707107, -0.623613}, {0.828125, 0.125000}},
-	{{+0.178080, +0.332588, +0.333165}, {-0.261894, +0.831470, -0.489969}, {0.828125, 0.156250}},
-	{{+0.210680, +0.369552, +0.394154}, {-0.180396, +0.923880, -0.337497}, {0.828125, 0.187500}},
-	{{+0.246052, +0.392314, +0.460331}, {-0.091965, +0.980785, -0.172054}, {0.828125, 0.218750}},
-	{{+0.282838, +0.400000, +0.529153}, {-0.000000, +1.000000, -0.000000}, {0.828125, 0.250000}},
-	{{+0.319624, +0.392314, +0.597974}, {+0.091965, +0.980785, +0.172054}, {0.828125, 0.281250}},
-	{{+0.354996, +0.369552, +0.664151}, {+0.180396, +0.923880, +0.337497}, {0.828125, 0.312500}},
-	{{+0.387596, +0.332588, +0.725140}, {+0.261894, +0.831470, +0.489969}, {0.828125, 0.343750}},
-	{{+0.416169, +0.282843, +0.778598}, {+0.333328, +0.707107, +0.623613}, {0.828125, 0.375000}},
-	{{+0.439619, +0.222228, +0.822469}, {+0.391952, +0.555570, +0.733291}, {0.828125, 0.406250}},
-	{{+0.457044, +0.153073, +0.855068}, {+0.435514, +0.382683, +0.814789}, {0.828125, 0.437500}},
-	{{+0.467774, +0.078036, +0.875143}, {+0.462339, +0.195090, +0.864975}, {0.828125, 0.468750}},
-	{{+0.471397, +0.000000, +0.881921}, {+0.471397, +0.000000, +0.881921}, {0.828125, 0.500000}},
-	{{+0.467774, -0.078036, +0.875143}, {+0.462339, -0.195090, +0.864975}, {0.828125, 0.531250}},
-	{{+0.457044, -0.153073, +0.855068}, {+0.435514, -0.382683, +0.814789}, {0.828125, 0.562500}},
-	{{+0.439619, -0.222228, +0.822469}, {+0.391952, -0.555570, +0.733291}, {0.828125, 0.593750}},
-	{{+0.416169, -0.282843, +0.778598}, {+0.333328, -0.707107, +0.623613}, {0.828125, 0.625000}},
-	{{+0.387596, -0.332588, +0.725140}, {+0.261894, -0.831470, +0.489969}, {0.828125, 0.656250}},
-	{{+0.354996, -0.369552, +0.664151}, {+0.180396, -0.923880, +0.337497}, {0.828125, 0.687500}},
-	{{+0.319624, -0.392314, +0.597974}, {+0.091965, -0.980785, +0.172054}, {0.828125, 0.718750}},
-	{{+0.282838, -0.400000, +0.529153}, {+0.000000, -1.000000, +0.000000}, {0.828125, 0.750000}},
-	{{+0.246052, -0.392314, +0.460331}, {-0.091965, -0.980785, -0.172054}, {0.828125, 0.781250}},
-	{{+0.210680, -0.369552, +0.394154}, {-0.180396, -0.923880, -0.337497}, {0.828125, 0.812500}},
-	{{+0.178080, -0.332588, +0.333165}, {-0.261894, -0.831470, -0.489969}, {0.828125, 0.843750}},
-	{{+0.149507, -0.282843, +0.279708}, {-0.333328, -0.707107, -0.623613}, {0.828125, 0.875000}},
-	{{+0.126057, -0.222228, +0.235836}, {-0.391952, -0.555570, -0.733291}, {0.828125, 0.906250}},
-	{{+0.108633, -0.153073, +0.203237}, {-0.435514, -0.382683, -0.814789}, {0.828125, 0.937500}},
-	{{+0.097902, -0.078036, +0.183163}, {-0.462339, -0.195090, -0.864975}, {0.828125, 0.968750}},
-	{{+0.094279, -0.000000, +0.176384}, {-0.471397, -0.000000, -0.881921}, {0.828125, 1.000000}},
-
-	{{+0.111114, +0.000000, +0.166294}, {-0.555570, +0.000000, -0.831470}, {0.843750, 0.000000}},
-	{{+0.115384, +0.078036, +0.172685}, {-0.544895, +0.195090, -0.815493}, {0.843750, 0.031250}},
-	{{+0.128030, +0.153073, +0.191611}, {-0.513280, +0.382683, -0.768178}, {0.843750, 0.062500}},
-	{{+0.148566, +0.222228, +0.222345}, {-0.461940, +0.555570, -0.691342}, {0.843750, 0.093750}},
-	{{+0.176203, +0.282843, +0.263707}, {-0.392847, +0.707107, -0.587938}, {0.843750, 0.125000}},
-	{{+0.209879, +0.332588, +0.314106}, {-0.308658, +0.831470, -0.461940}, {0.843750, 0.156250}},
-	{{+0.248299, +0.369552, +0.371606}, {-0.212608, +0.923880, -0.318190}, {0.843750, 0.187500}},
-	{{+0.289988, +0.392314, +0.433997}, {-0.108386, +0.980785, -0.162212}, {0.843750, 0.218750}},
-	{{+0.333342, +0.400000, +0.498882}, {-0.000000, +1.000000, -0.000000}, {0.843750, 0.250000}},
-	{{+0.376697, +0.392314, +0.563766}, {+0.108386, +0.980785, +0.162212}, {0.843750, 0.281250}},
-	{{+0.418385, +0.369552, +0.626158}, {+0.212608, +0.923880, +0.318190}, {0.843750, 0.312500}},
-	{{+0.456805, +0.332588, +0.683658}, {+0.308658, +0.831470, +0.461940}, {0.843750, 0.343750}},
-	{{+0.490481, +0.282843, +0.734057}, {+0.392847, +0.707107, +0.587938}, {0.843750, 0.375000}},
-	{{+0.518118, +0.222228, +0.775418}, {+0.461940, +0.555570, +0.691342}, {0.843750, 0.406250}},
-	{{+0.538654, +0.153073, +0.806153}, {+0.513280, +0.382683, +0.768178}, {0.843750, 0.437500}},
-	{{+0.551300, +0.078036, +0.825079}, {+0.544895, +0.195090, +0.815493}, {0.843750, 0.468750}},
-	{{+0.555570, +0.000000, +0.831470}, {+0.555570, +0.000000, +0.831470}, {0.843750, 0.500000}},
-	{{+0.551300, -0.078036, +0.825079}, {+0.544895, -0.195090, +0.815493}, {0.843750, 0.531250}},
-	{{+0.538654, -0.153073, +0.806153}, {+0.513280, -0.382683, +0.768178}, {0.843750, 0.562500}},
-	{{+0.518118, -0.222228, +0.775418}, {+0.461940, -0.555570, +0.691342}, {0.843750, 0.593750}},
-	{{+0.490481, -0.282843, +0.734057}, {+0.392847, -0.707107, +0.587938}, {0.843750, 0.625000}},
-	{{+0.456805, -0.332588, +0.683658}, {+0.308658, -0.831470, +0.461940}, {0.843750, 0.656250}},
-	{{+0.418385, -0.369552, +0.626158}, {+0.212608, -0.923880, +0.318190}, {0.843750, 0.687500}},
-	{{+0.376697, -0.392314, +0.563766}, {+0.108386, -0.980785, +0.162212}, {0.843750, 0.718750}},
-	{{+0.333342, -0.400000, +0.498882}, {+0.000000, -1.000000, +0.000000}, {0.843750, 0.750000}},
-	{{+0.289988, -0.392314, +0.433997}, {-0.108386, -0.980785, -0.162212}, {0.843750, 0.781250}},
-	{{+0.248299, -0.369552, +0.371606}, {-0.212608, -0.923880, -0.318190}, {0.843750, 0.812500}},
-	{{+0.209879, -0.332588, +0.314106}, {-0.308658, -0.831470, -0.461940}, {0.843750, 0.843750}},
-	{{+0.176203, -0.282843, +0.263707}, {-0.392847, -0.707107, -0.587938}, {0.843750, 0.875000}},
-	{{+0.148566, -0.222228, +0.222345}, {-0.461940, -0.555570, -0.691342}, {0.843750, 0.906250}},
-	{{+0.128030, -0.153073, +0.191611}, {-0.513280, -0.382683, -0.768178}, {0.843750, 0.937500}},
-	{{+0.115384, -0.078036, +0.172685}, {-0.544895, -0.195090, -0.815493}, {0.843750, 0.968750}},
-	{{+0.111114, -0.000000, +0.166294}, {-0.555570, -0.000000, -0.831470}, {0.843750, 1.000000}},
-
-	{{+0.126879, +0.000000, +0.154602}, {-0.634393, +0.000000, -0.773010}, {0.859375, 0.000000}},
-	{{+0.131755, +0.078036, +0.160543}, {-0.622204, +0.195090, -0.758157}, {0.859375, 0.031250}},
-	{{+0.146195, +0.153073, +0.178139}, {-0.586103, +0.382683, -0.714169}, {0.859375, 0.062500}},
-	{{+0.169644, +0.222228, +0.206712}, {-0.527479, +0.555570, -0.642735}, {0.859375, 0.093750}},
-	{{+0.201202, +0.282843, +0.245166}, {-0.448584, +0.707107, -0.546601}, {0.859375, 0.125000}},
-	{{+0.239656, +0.332588, +0.292022}, {-0.352450, +0.831470, -0.429462}, {0.859375, 0.156250}},
-	{{+0.283527, +0.369552, +0.345479}, {-0.242772, +0.923880, -0.295818}, {0.859375, 0.187500}},
-	{{+0.331130, +0.392314, +0.403484}, {-0.123764, +0.980785, -0.150807}, {0.859375, 0.218750}},
-	{{+0.380636, +0.400000, +0.463806}, {-0.000000, +1.000000, -0.000000}, {0.859375, 0.250000}},
-	{{+0.430142, +0.392314, +0.524129}, {+0.123764, +0.980785, +0.150807}, {0.859375, 0.281250}},
-	{{+0.477745, +0.369552, +0.582134}, {+0.242772, +0.923880, +0.295818}, {0.859375, 0.312500}},
-	{{+0.521616, +0.332588, +0.635591}, {+0.352450, +0.831470, +0.429462}, {0.859375, 0.343750}},
-	{{+0.560069, +0.282843, +0.682447}, {+0.448584, +0.707107, +0.546601}, {0.859375, 0.375000}},
-	{{+0.591627, +0.222228, +0.720900}, {+0.527479, +0.555570, +0.642735}, {0.859375, 0.406250}},
-	{{+0.615077, +0.153073, +0.749474}, {+0.586103, +0.382683, +0.714169}, {0.859375, 0.437500}},
-	{{+0.629517, +0.078036, +0.767069}, {+0.622204, +0.195090, +0.758157}, {0.859375, 0.468750}},
-	{{+0.634393, +0.000000, +0.773010}, {+0.634393, +0.000000, +0.773010}, {0.859375, 0.500000}},
-	{{+0.629517, -0.078036, +0.767069}, {+0.622204, -0.195090, +0.758157}, {0.859375, 0.531250}},
-	{{+0.615077, -0.153073, +0.749474}, {+0.586103, -0.382683, +0.714169}, {0.859375, 0.562500}},
-	{{+0.591627, -0.222228, +0.720900}, {+0.527479, -0.555570, +0.642735}, {0.859375, 0.593750}},
-	{{+0.560069, -0.282843, +0.682447}, {+0.448584, -0.707107, +0.546601}, {0.859375, 0.625000}},
-	{{+0.521616, -0.332588, +0.635591}, {+0.352450, -0.831470, +0.429462}, {0.859375, 0.656250}},
-	{{+0.477745, -0.369552, +0.582134}, {+0.242772, -0.923880, +0.295818}, {0.859375, 0.687500}},
-	{{+0.430142, -0.392314, +0.524129}, {+0.123764, -0.980785, +0.150807}, {0.859375, 0.718750}},
-	{{+0.380636, -0.400000, +0.463806}, {+0.000000, -1.000000, +0.000000}, {0.859375, 0.750000}},
-	{{+0.331130, -0.392314, +0.403484}, {-0.123764, -0.980785, -0.150807}, {0.859375, 0.781250}},
-	{{+0.283527, -0.369552, +0.345479}, {-0.242772, -0.923880, -0.295818}, {0.859375, 0.812500}},
-	{{+0.239656, -0.332588, +0.292022}, {-0.352450, -0.831470, -0.429462}, {0.859375, 0.843750}},
-	{{+0.201202, -0.282843, +0.245166}, {-0.448584, -0.707107, -0.546601}, {0.859375, 0.875000}},
-	{{+0.169644, -0.222228, +0.206712}, {-0.527479, -0.555570, -0.642735}, {0.859375, 0.906250}},
-	{{+0.146195, -0.153073, +0.178139}, {-0.586103, -0.382683, -0.714169}, {0.859375, 0.937500}},
-	{{+0.131755, -0.078036, +0.160543}, {-0.622204, -0.195090, -0.758157}, {0.859375, 0.968750}},
-	{{+0.126879, -0.000000, +0.154602}, {-0.634393, -0.000000, -0.773010}, {0.859375, 1.000000}},
-
-	{{+0.141421, +0.000000, +0.141421}, {-0.707107, +0.000000, -0.707107}, {0.875000, 0.000000}},
-	{{+0.146856, +0.078036, +0.146856}, {-0.693520, +0.195090, -0.693520}, {0.875000, 0.031250}},
-	{{+0.162951, +0.153073, +0.162951}, {-0.653281, +0.382683, -0.653281}, {0.875000, 0.062500}},
-	{{+0.189089, +0.222228, +0.189089}, {-0.587938, +0.555570, -0.587938}, {0.875000, 0.093750}},
-	{{+0.224264, +0.282843, +0.224264}, {-0.500000, +0.707107, -0.500000}, {0.875000, 0.125000}},
-	{{+0.267125, +0.332588, +0.267125}, {-0.392847, +0.831470, -0.392847}, {0.875000, 0.156250}},
-	{{+0.316025, +0.369552, +0.316025}, {-0.270598, +0.923880, -0.270598}, {0.875000, 0.187500}},
-	{{+0.369084, +0.392314, +0.369084}, {-0.137950, +0.980785, -0.137950}, {0.875000, 0.218750}},
-	{{+0.424264, +0.400000, +0.424264}, {-0.000000, +1.000000, -0.000000}, {0.875000, 0.250000}},
-	{{+0.479444, +0.392314, +0.479444}, {+0.137950, +0.980785, +0.137950}, {0.875000, 0.281250}},
-	{{+0.532503, +0.369552, +0.532503}, {+0.270598, +0.923880, +0.270598}, {0.875000, 0.312500}},
-	{{+0.581403, +0.332588, +0.581403}, {+0.392847, +0.831470, +0.392847}, {0.875000, 0.343750}},
-	{{+0.624264, +0.282843, +0.624264}, {+0.500000, +0.707107, +0.500000}, {0.875000, 0.375000}},
-	{{+0.659439, +0.222228, +0.659439}, {+0.587938, +0.555570, +0.587938}, {0.875000, 0.406250}},
-	{{+0.685577, +0.153073, +0.685577}, {+0.653281, +0.382683, +0.653281}, {0.875000, 0.437500}},
-	{{+0.701672, +0.078036, +0.701672}, {+0.693520, +0.195090, +0.693520}, {0.875000, 0.468750}},
-	{{+0.707107, +0.000000, +0.707107}, {+0.707107, +0.000000, +0.707107}, {0.875000, 0.500000}},
-	{{+0.701672, -0.078036, +0.701672}, {+0.693520, -0.195090, +0.693520}, {0.875000, 0.531250}},
-	{{+0.685577, -0.153073, +0.685577}, {+0.653281, -0.382683, +0.653281}, {0.875000, 0.562500}},
-	{{+0.659439, -0.222228, +0.659439}, {+0.587938, -0.555570, +0.587938}, {0.875000, 0.593750}},
-	{{+0.624264, -0.282843, +0.624264}, {+0.500000, -0.707107, +0.500000}, {0.875000, 0.625000}},
-	{{+0.581403, -0.332588, +0.581403}, {+0.392847, -0.831470, +0.392847}, {0.875000, 0.656250}},
-	{{+0.532503, -0.369552, +0.532503}, {+0.270598, -0.923880, +0.270598}, {0.875000, 0.687500}},
-	{{+0.479444, -0.392314, +0.479444}, {+0.137950, -0.980785, +0.137950}, {0.875000, 0.718750}},
-	{{+0.424264, -0.400000, +0.424264}, {+0.000000, -1.000000, +0.000000}, {0.875000, 0.750000}},
-	{{+0.369084, -0.392314, +0.369084}, {-0.137950, -0.980785, -0.137950}, {0.875000, 0.781250}},
-	{{+0.316025, -0.369552, +0.316025}, {-0.270598, -0.923880, -0.270598}, {0.875000, 0.812500}},
-	{{+0.267125, -0.332588, +0.267125}, {-0.392847, -0.831470, -0.392847}, {0.875000, 0.843750}},
-	{{+0.224264, -0.282843, +0.224264}, {-0.500000, -0.707107, -0.500000}, {0.875000, 0.875000}},
-	{{+0.189089, -0.222228, +0.189089}, {-0.587938, -0.555570, -0.587938}, {0.875000, 0.906250}},
-	{{+0.162951, -0.153073, +0.162951}, {-0.653281, -0.382683, -0.653281}, {0.875000, 0.937500}},
-	{{+0.146856, -0.078036, +0.146856}, {-0.693520, -0.195090, -0.693520}, {0.875000, 0.968750}},
-	{{+0.141421, -0.000000, +0.141421}, {-0.707107, -0.000000, -0.707107}, {0.875000, 1.000000}},
-
-	{{+0.154602, +0.000000, +0.126879}, {-0.773010, +0.000000, -0.634393}, {0.890625, 0.000000}},
-	{{+0.160543, +0.078036, +0.131755}, {-0.758157, +0.195090, -0.622204}, {0.890625, 0.031250}},
-	{{+0.178139, +0.153073, +0.146195}, {-0.714169, +0.382683, -0.586103}, {0.890625, 0.062500}},
-	{{+0.206712, +0.222228, +0.169644}, {-0.642735, +0.555570, -0.527479}, {0.890625, 0.093750}},
-	{{+0.245166, +0.282843, +0.201202}, {-0.546601, +0.707107, -0.448584}, {0.890625, 0.125000}},
-	{{+0.292022, +0.332588, +0.239656}, {-0.429462, +0.831470, -0.352450}, {0.890625, 0.156250}},
-	{{+0.345479, +0.369552, +0.283527}, {-0.295818, +0.923880, -0.242772}, {0.890625, 0.187500}},
-	{{+0.403484, +0.392314, +0.331130}, {-0.150807, +0.980785, -0.123764}, {0.890625, 0.218750}},
-	{{+0.463806, +0.400000, +0.380636}, {-0.000000, +1.000000, -0.000000}, {0.890625, 0.250000}},
-	{{+0.524129, +0.392314, +0.430142}, {+0.150807, +0.980785, +0.123764}, {0.890625, 0.281250}},
-	{{+0.582134, +0.369552, +0.477745}, {+0.295818, +0.923880, +0.242772}, {0.890625, 0.312500}},
-	{{+0.635591, +0.332588, +0.521616}, {+0.429462, +0.831470, +0.352450}, {0.890625, 0.343750}},
-	{{+0.682447, +0.282843, +0.560069}, {+0.546601, +0.707107, +0.448584}, {0.890625, 0.375000}},
-	{{+0.720900, +0.222228, +0.591627}, {+0.642735, +0.555570, +0.527479}, {0.890625, 0.406250}},
-	{{+0.749474, +0.153073, +0.615077}, {+0.714169, +0.382683, +0.586103}, {0.890625, 0.437500}},
-	{{+0.767069, +0.078036, +0.629517}, {+0.758157, +0.195090, +0.622204}, {0.890625, 0.468750}},
-	{{+0.773010, +0.000000, +0.634393}, {+0.773010, +0.000000, +0.634393}, {0.890625, 0.500000}},
-	{{+0.767069, -0.078036, +0.629517}, {+0.758157, -0.195090, +0.622204}, {0.890625, 0.531250}},
-	{{+0.749474, -0.153073, +0.615077}, {+0.714169, -0.382683, +0.586103}, {0.890625, 0.562500}},
-	{{+0.720900, -0.222228, +0.591627}, {+0.642735, -0.555570, +0.527479}, {0.890625, 0.593750}},
-	{{+0.682447, -0.282843, +0.560069}, {+0.546601, -0.707107, +0.448584}, {0.890625, 0.625000}},
-	{{+0.635591, -0.332588, +0.521616}, {+0.429462, -0.831470, +0.352450}, {0.890625, 0.656250}},
-	{{+0.582134, -0.369552, +0.477745}, {+0.295818, -0.923880, +0.242772}, {0.890625, 0.687500}},
-	{{+0.524129, -0.392314, +0.430142}, {+0.150807, -0.980785, +0.123764}, {0.890625, 0.718750}},
-	{{+0.463806, -0.400000, +0.380636}, {+0.000000, -1.000000, +0.000000}, {0.890625, 0.750000}},
-	{{+0.403484, -0.392314, +0.331130}, {-0.150807, -0.980785, -0.123764}, {0.890625, 0.781250}},
-	{{+0.345479, -0.369552, +0.283527}, {-0.295818, -0.923880, -0.242772}, {0.890625, 0.812500}},
-	{{+0.292022, -0.332588, +0.239656}, {-0.429462, -0.831470, -0.352450}, {0.890625, 0.843750}},
-	{{+0.245166, -0.282843, +0.201202}, {-0.546601, -0.707107, -0.448584}, {0.890625, 0.875000}},
-	{{+0.206712, -0.222228, +0.169644}, {-0.642735, -0.555570, -0.527479}, {0.890625, 0.906250}},
-	{{+0.178139, -0.153073, +0.146195}, {-0.714169, -0.382683, -0.586103}, {0.890625, 0.937500}},
-	{{+0.160543, -0.078036, +0.131755}, {-0.758157, -0.195090, -0.622204}, {0.890625, 0.968750}},
-	{{+0.154602, -0.000000, +0.126879}, {-0.773010, -0.000000, -0.634393}, {0.890625, 1.000000}},
-
-	{{+0.166294, +0.000000, +0.111114}, {-0.831470, +0.000000, -0.555570}, {0.906250, 0.000000}},
-	{{+0.172685, +0.078036, +0.115384}, {-0.815493, +0.195090, -0.544895}, {0.906250, 0.031250}},
-	{{+0.191611, +0.153073, +0.128030}, {-0.768178, +0.382683, -0.513280}, {0.906250, 0.062500}},
-	{{+0.222345, +0.222228, +0.148566}, {-0.691342, +0.555570, -0.461940}, {0.906250, 0.093750}},
-	{{+0.263707, +0.282843, +0.176203}, {-0.587938, +0.707107, -0.392847}, {0.906250, 0.125000}},
-	{{+0.314106, +0.332588, +0.209879}, {-0.461940, +0.831470, -0.308658}, {0.906250, 0.156250}},
-	{{+0.371606, +0.369552, +0.248299}, {-0.318190, +0.923880, -0.212608}, {0.906250, 0.187500}},
-	{{+0.433997, +0.392314, +0.289988}, {-0.162212, +0.980785, -0.108386}, {0.906250, 0.218750}},
-	{{+0.498882, +0.400000, +0.333342}, {-0.000000, +1.000000, -0.000000}, {0.906250, 0.250000}},
-	{{+0.563766, +0.392314, +0.376697}, {+0.162212, +0.980785, +0.108386}, {0.906250, 0.281250}},
-	{{+0.626158, +0.369552, +0.418385}, {+0.318190, +0.923880, +0.212608}, {0.906250, 0.312500}},
-	{{+0.683658, +0.332588, +0.456805}, {+0.461940, +0.831470, +0.308658}, {0.906250, 0.343750}},
-	{{+0.734057, +0.282843, +0.490481}, {+0.587938, +0.707107, +0.392847}, {0.906250, 0.375000}},
-	{{+0.775418, +0.222228, +0.518118}, {+0.691342, +0.555570, +0.461940}, {0.906250, 0.406250}},
-	{{+0.806153, +0.153073, +0.538654}, {+0.768178, +0.382683, +0.513280}, {0.906250, 0.437500}},
-	{{+0.825079, +0.078036, +0.551300}, {+0.815493, +0.195090, +0.544895}, {0.906250, 0.468750}},
-	{{+0.831470, +0.000000, +0.555570}, {+0.831470, +0.000000, +0.555570}, {0.906250, 0.500000}},
-	{{+0.825079, -0.078036, +0.551300}, {+0.815493, -0.195090, +0.544895}, {0.906250, 0.531250}},
-	{{+0.806153, -0.153073, +0.538654}, {+0.768178, -0.382683, +0.513280}, {0.906250, 0.562500}},
-	{{+0.775418, -0.222228, +0.518118}, {+0.691342, -0.555570, +0.461940}, {0.906250, 0.593750}},
-	{{+0.734057, -0.282843, +0.490481}, {+0.587938, -0.707107, +0.392847}, {0.906250, 0.625000}},
-	{{+0.683658, -0.332588, +0.456805}, {+0.461940, -0.831470, +0.308658}, {0.906250, 0.656250}},
-	{{+0.626158, -0.369552, +0.418385}, {+0.318190, -0.923880, +0.212608}, {0.906250, 0.687500}},
-	{{+0.563766, -0.392314, +0.376697}, {+0.162212, -0.980785, +0.108386}, {0.906250, 0.718750}},
-	{{+0.498882, -0.400000, +0.333342}, {+0.000000, -1.000000, +0.000000}, {0.906250, 0.750000}},
-	{{+0.433997, -0.392314, +0.289988}, {-0.162212, -0.980785, -0.108386}, {0.906250, 0.781250}},
-	{{+0.371606, -0.369552, +0.248299}, {-0.318190, -0.923880, -0.212608}, {0.906250, 0.812500}},
-	{{+0.314106, -0.332588, +0.209879}, {-0.461940, -0.831470, -0.308658}, {0.906250, 0.843750}},
-	{{+0.263707, -0.282843, +0.176203}, {-0.587938, -0.707107, -0.392847}, {0.906250, 0.875000}},
-	{{+0.222345, -0.222228, +0.148566}, {-0.691342, -0.555570, -0.461940}, {0.906250, 0.906250}},
-	{{+0.191611, -0.153073, +0.128030}, {-0.768178, -0.382683, -0.513280}, {0.906250, 0.937500}},
-	{{+0.172685, -0.078036, +0.115384}, {-0.815493, -0.195090, -0.544895}, {0.906250, 0.968750}},
-	{{+0.166294, -0.000000, +0.111114}, {-0.831470, -0.000000, -0.555570}, {0.906250, 1.000000}},
-
-	{{+0.176384, +0.000000, +0.094279}, {-0.881921, +0.000000, -0.471397}, {0.921875, 0.000000}},
-	{{+0.183163, +0.078036, +0.097902}, {-0.864975, +0.195090, -0.462339}, {0.921875, 0.031250}},
-	{{+0.203237, +0.153073, +0.108633}, {-0.814789, +0.382683, -0.435514}, {0.921875, 0.062500}},
-	{{+0.235836, +0.222228, +0.126057}, {-0.733291, +0.555570, -0.391952}, {0.921875, 0.093750}},
-	{{+0.279708, +0.282843, +0.149507}, {-0.623613, +0.707107, -0.333328}, {0.921875, 0.125000}},
-	{{+0.333165, +0.332588, +0.178080}, {-0.489969, +0.831470, -0.261894}, {0.921875, 0.156250}},
-	{{+0.394154, +0.369552, +0.210680}, {-0.337497, +0.923880, -0.180396}, {0.921875, 0.187500}},
-	{{+0.460331, +0.392314, +0.246052}, {-0.172054, +0.980785, -0.091965}, {0.921875, 0.218750}},
-	{{+0.529153, +0.400000, +0.282838}, {-0.000000, +1.000000, -0.000000}, {0.921875, 0.250000}},
-	{{+0.597974, +0.392314, +0.319624}, {+0.172054, +0.980785, +0.091965}, {0.921875, 0.281250}},
-	{{+0.664151, +0.369552, +0.354996}, {+0.337497, +0.923880, +0.180396}, {0.921875, 0.312500}},
-	{{+0.725140, +0.332588, +0.387596}, {+0.489969, +0.831470, +0.261894}, {0.921875, 0.343750}},
-	{{+0.778598, +0.282843, +0.416169}, {+0.623613, +0.707107, +0.333328}, {0.921875, 0.375000}},
-	{{+0.822469, +0.222228, +0.439619}, {+0.733291, +0.555570, +0.391952}, {0.921875, 0.406250}},
-	{{+0.855068, +0.153073, +0.457044}, {+0.814789, +0.382683, +0.435514}, {0.921875, 0.437500}},
-	{{+0.875143, +0.078036, +0.467774}, {+0.864975, +0.195090, +0.462339}, {0.921875, 0.468750}},
-	{{+0.881921, +0.000000, +0.471397}, {+0.881921, +0.000000, +0.471397}, {0.921875, 0.500000}},
-	{{+0.875143, -0.078036, +0.467774}, {+0.864975, -0.195090, +0.462339}, {0.921875, 0.531250}},
-	{{+0.855068, -0.153073, +0.457044}, {+0.814789, -0.382683, +0.435514}, {0.921875, 0.562500}},
-	{{+0.822469, -0.222228, +0.439619}, {+0.733291, -0.555570, +0.391952}, {0.921875, 0.593750}},
-	{{+0.778598, -0.282843, +0.416169}, {+0.623613, -0.707107, +0.333328}, {0.921875, 0.625000}},
-	{{+0.725140, -0.332588, +0.387596}, {+0.489969, -0.831470, +0.261894}, {0.921875, 0.656250}},
-	{{+0.664151, -0.369552, +0.354996}, {+0.337497, -0.923880, +0.180396}, {0.921875, 0.687500}},
-	{{+0.597974, -0.392314, +0.319624}, {+0.172054, -0.980785, +0.091965}, {0.921875, 0.718750}},
-	{{+0.529153, -0.400000, +0.282838}, {+0.000000, -1.000000, +0.000000}, {0.921875, 0.750000}},
-	{{+0.460331, -0.392314, +0.246052}, {-0.172054, -0.980785, -0.091965}, {0.921875, 0.781250}},
-	{{+0.394154, -0.369552, +0.210680}, {-0.337497, -0.923880, -0.180396}, {0.921875, 0.812500}},
-	{{+0.333165, -0.332588, +0.178080}, {-0.489969, -0.831470, -0.261894}, {0.921875, 0.843750}},
-	{{+0.279708, -0.282843, +0.149507}, {-0.623613, -0.707107, -0.333328}, {0.921875, 0.875000}},
-	{{+0.235836, -0.222228, +0.126057}, {-0.733291, -0.555570, -0.391952}, {0.921875, 0.906250}},
-	{{+0.203237, -0.153073, +0.108633}, {-0.814789, -0.382683, -0.435514}, {0.921875, 0.937500}},
-	{{+0.183163, -0.078036, +0.097902}, {-0.864975, -0.195090, -0.462339}, {0.921875, 0.968750}},
-	{{+0.176384, -0.000000, +0.094279}, {-0.881921, -0.000000, -0.471397}, {0.921875, 1.000000}},
-
-	{{+0.184776, +0.000000, +0.076537}, {-0.923880, +0.000000, -0.382683}, {0.937500, 0.000000}},
-	{{+0.191877, +0.078036, +0.079478}, {-0.906127, +0.195090, -0.375330}, {0.937500, 0.031250}},
-	{{+0.212906, +0.153073, +0.088189}, {-0.853553, +0.382683, -0.353553}, {0.937500, 0.062500}},
-	{{+0.247057, +0.222228, +0.102334}, {-0.768178, +0.555570, -0.318190}, {0.937500, 0.093750}},
-	{{+0.293015, +0.282843, +0.121371}, {-0.653281, +0.707107, -0.270598}, {0.937500, 0.125000}},
-	{{+0.349016, +0.332588, +0.144567}, {-0.513280, +0.831470, -0.212608}, {0.937500, 0.156250}},
-	{{+0.412906, +0.369552, +0.171031}, {-0.353553, +0.923880, -0.146447}, {0.937500, 0.187500}},
-	{{+0.482232, +0.392314, +0.199747}, {-0.180240, +0.980785, -0.074658}, {0.937500, 0.218750}},
-	{{+0.554328, +0.400000, +0.229610}, {-0.000000, +1.000000, -0.000000}, {0.937500, 0.250000}},
-	{{+0.626424, +0.392314, +0.259473}, {+0.180240, +0.980785, +0.074658}, {0.937500, 0.281250}},
-	{{+0.695749, +0.369552, +0.288189}, {+0.353553, +0.923880, +0.146447}, {0.937500, 0.312500}},
-	{{+0.759640, +0.332588, +0.314653}, {+0.513280, +0.831470, +0.212608}, {0.937500, 0.343750}},
-	{{+0.815640, +0.282843, +0.337849}, {+0.653281, +0.707107, +0.270598}, {0.937500, 0.375000}},
-	{{+0.861599, +0.222228, +0.356886}, {+0.768178, +0.555570, +0.318190}, {0.937500, 0.406250}},
-	{{+0.895749, +0.153073, +0.371031}, {+0.853553, +0.382683, +0.353553}, {0.937500, 0.437500}},
-	{{+0.916779, +0.078036, +0.379742}, {+0.906127, +0.195090, +0.375330}, {0.937500, 0.468750}},
-	{{+0.923880, +0.000000, +0.382683}, {+0.923880, +0.000000, +0.382683}, {0.937500, 0.500000}},
-	{{+0.916779, -0.078036, +0.379742}, {+0.906127, -0.195090, +0.375330}, {0.937500, 0.531250}},
-	{{+0.895749, -0.153073, +0.371031}, {+0.853553, -0.382683, +0.353553}, {0.937500, 0.562500}},
-	{{+0.861599, -0.222228, +0.356886}, {+0.768178, -0.555570, +0.318190}, {0.937500, 0.593750}},
-	{{+0.815640, -0.282843, +0.337849}, {+0.653281, -0.707107, +0.270598}, {0.937500, 0.625000}},
-	{{+0.759640, -0.332588, +0.314653}, {+0.513280, -0.831470, +0.212608}, {0.937500, 0.656250}},
-	{{+0.695749, -0.369552, +0.288189}, {+0.353553, -0.923880, +0.146447}, {0.937500, 0.687500}},
-	{{+0.626424, -0.392314, +0.259473}, {+0.180240, -0.980785, +0.074658}, {0.937500, 0.718750}},
-	{{+0.554328, -0.400000, +0.229610}, {+0.000000, -1.000000, +0.000000}, {0.937500, 0.750000}},
-	{{+0.482232, -0.392314, +0.199747}, {-0.180240, -0.980785, -0.074658}, {0.937500, 0.781250}},
-	{{+0.412906, -0.369552, +0.171031}, {-0.353553, -0.923880, -0.146447}, {0.937500, 0.812500}},
-	{{+0.349016, -0.332588, +0.144567}, {-0.513280, -0.831470, -0.212608}, {0.937500, 0.843750}},
-	{{+0.293015, -0.282843, +0.121371}, {-0.653281, -0.707107, -0.270598}, {0.937500, 0.875000}},
-	{{+0.247057, -0.222228, +0.102334}, {-0.768178, -0.555570, -0.318190}, {0.937500, 0.906250}},
-	{{+0.212906, -0.153073, +0.088189}, {-0.853553, -0.382683, -0.353553}, {0.937500, 0.937500}},
-	{{+0.191877, -0.078036, +0.079478}, {-0.906127, -0.195090, -0.375330}, {0.937500, 0.968750}},
-	{{+0.184776, -0.000000, +0.076537}, {-0.923880, -0.000000, -0.382683}, {0.937500, 1.000000}},
-
-	{{+0.191388, +0.000000, +0.058057}, {-0.956940, +0.000000, -0.290285}, {0.953125, 0.000000}},
-	{{+0.198743, +0.078036, +0.060288}, {-0.938553, +0.195090, -0.284707}, {0.953125, 0.031250}},
-	{{+0.220525, +0.153073, +0.066896}, {-0.884098, +0.382683, -0.268188}, {0.953125, 0.062500}},
-	{{+0.255897, +0.222228, +0.077626}, {-0.795667, +0.555570, -0.241363}, {0.953125, 0.093750}},
-	{{+0.303501, +0.282843, +0.092066}, {-0.676659, +0.707107, -0.205262}, {0.953125, 0.125000}},
-	{{+0.361505, +0.332588, +0.109661}, {-0.531648, +0.831470, -0.161274}, {0.953125, 0.156250}},
-	{{+0.427682, +0.369552, +0.129736}, {-0.366205, +0.923880, -0.111087}, {0.953125, 0.187500}},
-	{{+0.499488, +0.392314, +0.151518}, {-0.186690, +0.980785, -0.056632}, {0.953125, 0.218750}},
-	{{+0.574164, +0.400000, +0.174171}, {-0.000000, +1.000000, -0.000000}, {0.953125, 0.250000}},
-	{{+0.648840, +0.392314, +0.196823}, {+0.186690, +0.980785, +0.056632}, {0.953125, 0.281250}},
-	{{+0.720646, +0.369552, +0.218606}, {+0.366205, +0.923880, +0.111087}, {0.953125, 0.312500}},
-	{{+0.786823, +0.332588, +0.238680}, {+0.531648, +0.831470, +0.161274}, {0.953125, 0.343750}},
-	{{+0.844828, +0.282843, +0.256276}, {+0.676659, +0.707107, +0.205262}, {0.953125, 0.375000}},
-	{{+0.892431, +0.222228, +0.270716}, {+0.795667, +0.555570, +0.241363}, {0.953125, 0.406250}},
-	{{+0.927803, +0.153073, +0.281446}, {+0.884098, +0.382683, +0.268188}, {0.953125, 0.437500}},
-	{{+0.949585, +0.078036, +0.288054}, {+0.938553, +0.195090, +0.284707}, {0.953125, 0.468750}},
-	{{+0.956940, +0.000000, +0.290285}, {+0.956940, +0.000000, +0.290285}, {0.953125, 0.500000}},
-	{{+0.949585, -0.078036, +0.288054}, {+0.938553, -0.195090, +0.284707}, {0.953125, 0.531250}},
-	{{+0.927803, -0.153073, +0.281446}, {+0.884098, -0.382683, +0.268188}, {0.953125, 0.562500}},
-	{{+0.892431, -0.222228, +0.270716}, {+0.795667, -0.555570, +0.241363}, {0.953125, 0.593750}},
-	{{+0.844828, -0.282843, +0.256276}, {+0.676659, -0.707107, +0.205262}, {0.953125, 0.625000}},
-	{{+0.786823, -0.332588, +0.238680}, {+0.531648, -0.831470, +0.161274}, {0.953125, 0.656250}},
-	{{+0.720646, -0.369552, +0.218606}, {+0.366205, -0.923880, +0.111087}, {0.953125, 0.687500}},
-	{{+0.648840, -0.392314, +0.196823}, {+0.186690, -0.980785, +0.056632}, {0.953125, 0.718750}},
-	{{+0.574164, -0.400000, +0.174171}, {+0.000000, -1.000000, +0.000000}, {0.953125, 0.750000}},
-	{{+0.499488, -0.392314, +0.151518}, {-0.186690, -0.980785, -0.056632}, {0.953125, 0.781250}},
-	{{+0.427682, -0.369552, +0.129736}, {-0.366205, -0.923880, -0.111087}, {0.953125, 0.812500}},
-	{{+0.361505, -0.332588, +0.109661}, {-0.531648, -0.831470, -0.161274}, {0.953125, 0.843750}},
-	{{+0.303501, -0.282843, +0.092066}, {-0.676659, -0.707107, -0.205262}, {0.953125, 0.875000}},
-	{{+0.255897, -0.222228, +0.077626}, {-0.795667, -0.555570, -0.241363}, {0.953125, 0.906250}},
-	{{+0.220525, -0.153073, +0.066896}, {-0.884098, -0.382683, -0.268188}, {0.953125, 0.937500}},
-	{{+0.198743, -0.078036, +0.060288}, {-0.938553, -0.195090, -0.284707}, {0.953125, 0.968750}},
-	{{+0.191388, -0.000000, +0.058057}, {-0.956940, -0.000000, -0.290285}, {0.953125, 1.000000}},
-
-	{{+0.196157, +0.000000, +0.039018}, {-0.980785, +0.000000, -0.195090}, {0.968750, 0.000000}},
-	{{+0.203695, +0.078036, +0.040518}, {-0.961940, +0.195090, -0.191342}, {0.968750, 0.031250}},
-	{{+0.226020, +0.153073, +0.044958}, {-0.906127, +0.382683, -0.180240}, {0.968750, 0.062500}},
-	{{+0.262274, +0.222228, +0.052170}, {-0.815493, +0.555570, -0.162212}, {0.968750, 0.093750}},
-	{{+0.311063, +0.282843, +0.061874}, {-0.693520, +0.707107, -0.137950}, {0.968750, 0.125000}},
-	{{+0.370513, +0.332588, +0.073700}, {-0.544895, +0.831470, -0.108386}, {0.968750, 0.156250}},
-	{{+0.438339, +0.369552, +0.087191}, {-0.375330, +0.923880, -0.074658}, {0.968750, 0.187500}},
-	{{+0.511934, +0.392314, +0.101830}, {-0.191342, +0.980785, -0.038060}, {0.968750, 0.218750}},
-	{{+0.588471, +0.400000, +0.117054}, {-0.000000, +1.000000, -0.000000}, {0.968750, 0.250000}},
-	{{+0.665008, +0.392314, +0.132278}, {+0.191342, +0.980785, +0.038060}, {0.968750, 0.281250}},
-	{{+0.738603, +0.369552, +0.146917}, {+0.375330, +0.923880, +0.074658}, {0.968750, 0.312500}},
-	{{+0.806429, +0.332588, +0.160409}, {+0.544895, +0.831470, +0.108386}, {0.968750, 0.343750}},
-	{{+0.865879, +0.282843, +0.172234}, {+0.693520, +0.707107, +0.137950}, {0.968750, 0.375000}},
-	{{+0.914668, +0.222228, +0.181939}, {+0.815493, +0.555570, +0.162212}, {0.968750, 0.406250}},
-	{{+0.950922, +0.153073, +0.189150}, {+0.906127, +0.382683, +0.180240}, {0.968750, 0.437500}},
-	{{+0.973247, +0.078036, +0.193591}, {+0.961940, +0.195090, +0.191342}, {0.968750, 0.468750}},
-	{{+0.980785, +0.000000, +0.195090}, {+0.980785, +0.000000, +0.195090}, {0.968750, 0.500000}},
-	{{+0.973247, -0.078036, +0.193591}, {+0.961940, -0.195090, +0.191342}, {0.968750, 0.531250}},
-	{{+0.950922, -0.153073, +0.189150}, {+0.906127, -0.382683, +0.180240}, {0.968750, 0.562500}},
-	{{+0.914668, -0.222228, +0.181939}, {+0.815493, -0.555570, +0.162212}, {0.968750, 0.593750}},
-	{{+0.865879, -0.282843, +0.172234}, {+0.693520, -0.707107, +0.137950}, {0.968750, 0.625000}},
-	{{+0.806429, -0.332588, +0.160409}, {+0.544895, -0.831470, +0.108386}, {0.968750, 0.656250}},
-	{{+0.738603, -0.369552, +0.146917}, {+0.375330, -0.923880, +0.074658}, {0.968750, 0.687500}},
-	{{+0.665008, -0.392314, +0.132278}, {+0.191342, -0.980785, +0.038060}, {0.968750, 0.718750}},
-	{{+0.588471, -0.400000, +0.117054}, {+0.000000, -1.000000, +0.000000}, {0.968750, 0.750000}},
-	{{+0.511934, -0.392314, +0.101830}, {-0.191342, -0.980785, -0.038060}, {0.968750, 0.781250}},
-	{{+0.438339, -0.369552, +0.087191}, {-0.375330, -0.923880, -0.074658}, {0.968750, 0.812500}},
-	{{+0.370513, -0.332588, +0.073700}, {-0.544895, -0.831470, -0.108386}, {0.968750, 0.843750}},
-	{{+0.311063, -0.282843, +0.061874}, {-0.693520, -0.707107, -0.137950}, {0.968750, 0.875000}},
-	{{+0.262274, -0.222228, +0.052170}, {-0.815493, -0.555570, -0.162212}, {0.968750, 0.906250}},
-	{{+0.226020, -0.153073, +0.044958}, {-0.906127, -0.382683, -0.180240}, {0.968750, 0.937500}},
-	{{+0.203695, -0.078036, +0.040518}, {-0.961940, -0.195090, -0.191342}, {0.968750, 0.968750}},
-	{{+0.196157, -0.000000, +0.039018}, {-0.980785, -0.000000, -0.195090}, {0.968750, 1.000000}},
-
-	{{+0.199037, +0.000000, +0.019603}, {-0.995185, +0.000000, -0.098017}, {0.984375, 0.000000}},
-	{{+0.206686, +0.078036, +0.020357}, {-0.976063, +0.195090, -0.096134}, {0.984375, 0.031250}},
-	{{+0.229339, +0.153073, +0.022588}, {-0.919431, +0.382683, -0.090556}, {0.984375, 0.062500}},
-	{{+0.266124, +0.222228, +0.026211}, {-0.827466, +0.555570, -0.081498}, {0.984375, 0.093750}},
-	{{+0.315630, +0.282843, +0.031087}, {-0.703702, +0.707107, -0.069309}, {0.984375, 0.125000}},
-	{{+0.375953, +0.332588, +0.037028}, {-0.552895, +0.831470, -0.054455}, {0.984375, 0.156250}},
-	{{+0.444775, +0.369552, +0.043806}, {-0.380841, +0.923880, -0.037510}, {0.984375, 0.187500}},
-	{{+0.519450, +0.392314, +0.051161}, {-0.194151, +0.980785, -0.019122}, {0.984375, 0.218750}},
-	{{+0.597111, +0.400000, +0.058810}, {-0.000000, +1.000000, -0.000000}, {0.984375, 0.250000}},
-	{{+0.674771, +0.392314, +0.066459}, {+0.194151, +0.980785, +0.019122}, {0.984375, 0.281250}},
-	{{+0.749447, +0.369552, +0.073814}, {+0.380841, +0.923880, +0.037510}, {0.984375, 0.312500}},
-	{{+0.818269, +0.332588, +0.080592}, {+0.552895, +0.831470, +0.054455}, {0.984375, 0.343750}},
-	{{+0.878592, +0.282843, +0.086534}, {+0.703702, +0.707107, +0.069309}, {0.984375, 0.375000}},
-	{{+0.928097, +0.222228, +0.091410}, {+0.827466, +0.555570, +0.081498}, {0.984375, 0.406250}},
-	{{+0.964883, +0.153073, +0.095033}, {+0.919431, +0.382683, +0.090556}, {0.984375, 0.437500}},
-	{{+0.987536, +0.078036, +0.097264}, {+0.976063, +0.195090, +0.096134}, {0.984375, 0.468750}},
-	{{+0.995185, +0.000000, +0.098017}, {+0.995185, +0.000000, +0.098017}, {0.984375, 0.500000}},
-	{{+0.987536, -0.078036, +0.097264}, {+0.976063, -0.195090, +0.096134}, {0.984375, 0.531250}},
-	{{+0.964883, -0.153073, +0.095033}, {+0.919431, -0.382683, +0.090556}, {0.984375, 0.562500}},
-	{{+0.928097, -0.222228, +0.091410}, {+0.827466, -0.555570, +0.081498}, {0.984375, 0.593750}},
-	{{+0.878592, -0.282843, +0.086534}, {+0.703702, -0.707107, +0.069309}, {0.984375, 0.625000}},
-	{{+0.818269, -0.332588, +0.080592}, {+0.552895, -0.831470, +0.054455}, {0.984375, 0.656250}},
-	{{+0.749447, -0.369552, +0.073814}, {+0.380841, -0.923880, +0.037510}, {0.984375, 0.687500}},
-	{{+0.674771, -0.392314, +0.066459}, {+0.194151, -0.980785, +0.019122}, {0.984375, 0.718750}},
-	{{+0.597111, -0.400000, +0.058810}, {+0.000000, -1.000000, +0.000000}, {0.984375, 0.750000}},
-	{{+0.519450, -0.392314, +0.051161}, {-0.194151, -0.980785, -0.019122}, {0.984375, 0.781250}},
-	{{+0.444775, -0.369552, +0.043806}, {-0.380841, -0.923880, -0.037510}, {0.984375, 0.812500}},
-	{{+0.375953, -0.332588, +0.037028}, {-0.552895, -0.831470, -0.054455}, {0.984375, 0.843750}},
-	{{+0.315630, -0.282843, +0.031087}, {-0.703702, -0.707107, -0.069309}, {0.984375, 0.875000}},
-	{{+0.266124, -0.222228, +0.026211}, {-0.827466, -0.555570, -0.081498}, {0.984375, 0.906250}},
-	{{+0.229339, -0.153073, +0.022588}, {-0.919431, -0.382683, -0.090556}, {0.984375, 0.937500}},
-	{{+0.206686, -0.078036, +0.020357}, {-0.976063, -0.195090, -0.096134}, {0.984375, 0.968750}},
-	{{+0.199037, -0.000000, +0.019603}, {-0.995185, -0.000000, -0.098017}, {0.984375, 1.000000}},
-	{{+0.200000, +0.000000, +0.000000}, {-1.000000, +0.000000, -0.000000}, {1.000000, 0.000000}},
-	{{+0.207686, +0.078036, +0.000000}, {-0.980785, +0.195090, -0.000000}, {1.000000, 0.031250}},
-	{{+0.230448, +0.153073, -0.000000}, {-0.923880, +0.382683, -0.000000}, {1.000000, 0.062500}},
-	{{+0.267412, +0.222228, +0.000000}, {-0.831470, +0.555570, +0.000000}, {1.000000, 0.093750}},
-	{{+0.317157, +0.282843, +0.000000}, {-0.707107, +0.707107, -0.000000}, {1.000000, 0.125000}},
-	{{+0.377772, +0.332588, +0.000000}, {-0.555570, +0.831470, -0.000000}, {1.000000, 0.156250}},
-	{{+0.446927, +0.369552, -0.000000}, {-0.382683, +0.923880, +0.000000}, {1.000000, 0.187500}},
-	{{+0.521964, +0.392314, -0.000000}, {-0.195090, +0.980785, +0.000000}, {1.000000, 0.218750}},
-	{{+0.600000, +0.400000, +0.000000}, {-0.000000, +1.000000, -0.000000}, {1.000000, 0.250000}},
-	{{+0.678036, +0.392314, +0.000000}, {+0.195090, +0.980785, -0.000000}, {1.000000, 0.281250}},
-	{{+0.753073, +0.369552, +0.000000}, {+0.382683, +0.923880, +0.000000}, {1.000000, 0.312500}},
-	{{+0.822228, +0.332588, +0.000000}, {+0.555570, +0.831470, +0.000000}, {1.000000, 0.343750}},
-	{{+0.882843, +0.282843, +0.000000}, {+0.707107, +0.707107, +0.000000}, {1.000000, 0.375000}},
-	{{+0.932588, +0.222228, +0.000000}, {+0.831470, +0.555570, -0.000000}, {1.000000, 0.406250}},
-	{{+0.969552, +0.153073, -0.000000}, {+0.923880, +0.382683, +0.000000}, {1.000000, 0.437500}},
-	{{+0.992314, +0.078036, +0.000000}, {+0.980785, +0.195090, +0.000000}, {1.000000, 0.468750}},
-	{{+1.000000, +0.000000, +0.000000}, {+1.000000, +0.000000, +0.000000}, {1.000000, 0.500000}},
-	{{+0.992314, -0.078036, +0.000000}, {+0.980785, -0.195090, +0.000000}, {1.000000, 0.531250}},
-	{{+0.969552, -0.153073, +0.000000}, {+0.923880, -0.382683, +0.000000}, {1.000000, 0.562500}},
-	{{+0.932588, -0.222228, +0.000000}, {+0.831470, -0.555570, +0.000000}, {1.000000, 0.593750}},
-	{{+0.882843, -0.282843, +0.000000}, {+0.707107, -0.707107, -0.000000}, {1.000000, 0.625000}},
-	{{+0.822228, -0.332588, +0.000000}, {+0.555570, -0.831470, +0.000000}, {1.000000, 0.656250}},
-	{{+0.753073, -0.369552, +0.000000}, {+0.382683, -0.923880, -0.000000}, {1.000000, 0.687500}},
-	{{+0.678036, -0.392314, +0.000000}, {+0.195090, -0.980785, +0.000000}, {1.000000, 0.718750}},
-	{{+0.600000, -0.400000, +0.000000}, {+0.000000, -1.000000, -0.000000}, {1.000000, 0.750000}},
-	{{+0.521964, -0.392314, -0.000000}, {-0.195090, -0.980785, -0.000000}, {1.000000, 0.781250}},
-	{{+0.446927, -0.369552, -0.000000}, {-0.382683, -0.923880, +0.000000}, {1.000000, 0.812500}},
-	{{+0.377772, -0.332588, +0.000000}, {-0.555570, -0.831470, -0.000000}, {1.000000, 0.843750}},
-	{{+0.317157, -0.282843, +0.000000}, {-0.707107, -0.707107, -0.000000}, {1.000000, 0.875000}},
-	{{+0.267412, -0.222228, +0.000000}, {-0.831470, -0.555570, +0.000000}, {1.000000, 0.906250}},
-	{{+0.230448, -0.153073, +0.000000}, {-0.923880, -0.382683, -0.000000}, {1.000000, 0.937500}},
-	{{+0.207686, -0.078036, +0.000000}, {-0.980785, -0.195090, -0.000000}, {1.000000, 0.968750}},
-	{{+0.200000, -0.000000, +0.000000}, {-1.000000, -0.000000, -0.000000}, {1.000000, 1.000000}}
-};
-
-static GLuint indices[] = {
-	0, 33, 1,
-	1, 33, 34,
-	1, 34, 2,
-	2, 34, 35,
-	2, 35, 3,
-	3, 35, 36,
-	3, 36, 4,
-	4, 36, 37,
-	4, 37, 5,
-	5, 37, 38,
-	5, 38, 6,
-	6, 38, 39,
-	6, 39, 7,
-	7, 39, 40,
-	7, 40, 8,
-	8, 40, 41,
-	8, 41, 9,
-	9, 41, 42,
-	9, 42, 10,
-	10, 42, 43,
-	10, 43, 11,
-	11, 43, 44,
-	11, 44, 12,
-	12, 44, 45,
-	12, 45, 13,
-	13, 45, 46,
-	13, 46, 14,
-	14, 46, 47,
-	14, 47, 15,
-	15, 47, 48,
-	15, 48, 16,
-	16, 48, 49,
-	16, 49, 17,
-	17, 49, 50,
-	17, 50, 18,
-	18, 50, 51,
-	18, 51, 19,
-	19, 51, 52,
-	19, 52, 20,
-	20, 52, 53,
-	20, 53, 21,
-	21, 53, 54,
-	21, 54, 22,
-	22, 54, 55,
-	22, 55, 23,
-	23, 55, 56,
-	23, 56, 24,
-	24, 56, 57,
-	24, 57, 25,
-	25, 57, 58,
-	25, 58, 26,
-	26, 58, 59,
-	26, 59, 27,
-	27, 59, 60,
-	27, 60, 28,
-	28, 60, 61,
-	28, 61, 29,
-	29, 61, 62,
-	29, 62, 30,
-	30, 62, 63,
-	30, 63, 31,
-	31, 63, 64,
-	31, 64, 32,
-	32, 64, 65,
-
-	33, 66, 34,
-	34, 66, 67,
-	34, 67, 35,
-	35, 67, 68,
-	35, 68, 36,
-	36, 68, 69,
-	36, 69, 37,
-	37, 69, 70,
-	37, 70, 38,
-	38, 70, 71,
-	38, 71, 39,
-	39, 71, 72,
-	39, 72, 40,
-	40, 72, 73,
-	40, 73, 41,
-	41, 73, 74,
-	41, 74, 42,
-	42, 74, 75,
-	42, 75, 43,
-	43, 75, 76,
-	43, 76, 44,
-	44, 76, 77,
-	44, 77, 45,
-	45, 77, 78,
-	45, 78, 46,
-	46, 78, 79,
-	46, 79, 47,
-	47, 79, 80,
-	47, 80, 48,
-	48, 80, 81,
-	48, 81, 49,
-	49, 81, 82,
-	49, 82, 50,
-	50, 82, 83,
-	50, 83, 51,
-	51, 83, 84,
-	51, 84, 52,
-	52, 84, 85,
-	52, 85, 53,
-	53, 85, 86,
-	53, 86, 54,
-	54, 86, 87,
-	54, 87, 55,
-	55, 87, 88,
-	55, 88, 56,
-	56, 88, 89,
-	56, 89, 57,
-	57, 89, 90,
-	57, 90, 58,
-	58, 90, 91,
-	58, 91, 59,
-	59, 91, 92,
-	59, 92, 60,
-	60, 92, 93,
-	60, 93, 61,
-	61, 93, 94,
-	61, 94, 62,
-	62, 94, 95,
-	62, 95, 63,
-	63, 95, 96,
-	63, 96, 64,
-	64, 96, 97,
-	64, 97, 65,
-	65, 97, 98,
-
-	66, 99, 67,
-	67, 99, 100,
-	67, 100, 68,
-	68, 100, 101,
-	68, 101, 69,
-	69, 101, 102,
-	69, 102, 70,
-	70, 102, 103,
-	70, 103, 71,
-	71, 103, 104,
-	71, 104, 72,
-	72, 104, 105,
-	72, 105, 73,
-	73, 105, 106,
-	73, 106, 74,
-	74, 106, 107,
-	74, 107, 75,
-	75, 107, 108,
-	75, 108, 76,
-	76, 108, 109,
-	76, 109, 77,
-	77, 109, 110,
-	77, 110, 78,
-	78, 110, 111,
-	78, 111, 79,
-	79, 111, 112,
-	79, 112, 80,
-	80, 112, 113,
-	80, 113, 81,
-	81, 113, 114,
-	81, 114, 82,
-	82, 114, 115,
-	82, 115, 83,
-	83, 115, 116,
-	83, 116, 84,
-	84, 116, 117,
-	84, 117, 85,
-	85, 117, 118,
-	85, 118, 86,
-	86, 118, 119,
-	86, 119, 87,
-	87, 119, 120,
-	87, 120, 88,
-	88, 120, 121,
-	88, 121, 89,
-	89, 121, 122,
-	89, 122, 90,
-	90, 122, 123,
-	90, 123, 91,
-	91, 123, 124,
-	91, 124, 92,
-	92, 124, 125,
-	92, 125, 93,
-	93, 125, 126,
-	93, 126, 94,
-	94, 126, 127,
-	94, 127, 95,
-	95, 127, 128,
-	95, 128, 96,
-	96, 128, 129,
-	96, 129, 97,
-	97, 129, 130,
-	97, 130, 98,
-	98, 130, 131,
-
-	99, 132, 100,
-	100, 132, 133,
-	100, 133, 101,
-	101, 133, 134,
-	101, 134, 102,
-	102, 134, 135,
-	102, 135, 103,
-	103, 135, 136,
-	103, 136, 104,
-	104, 136, 137,
-	104, 137, 105,
-	105, 137, 138,
-	105, 138, 106,
-	106, 138, 139,
-	106, 139, 107,
-	107, 139, 140,
-	107, 140, 108,
-	108, 140, 141,
-	108, 141, 109,
-	109, 141, 142,
-	109, 142, 110,
-	110, 142, 143,
-	110, 143, 111,
-	111, 143, 144,
-	111, 144, 112,
-	112, 144, 145,
-	112, 145, 113,
-	113, 145, 146,
-	113, 146, 114,
-	114, 146, 147,
-	114, 147, 115,
-	115, 147, 148,
-	115, 148, 116,
-	116, 148, 149,
-	116, 149, 117,
-	117, 149, 150,
-	117, 150, 118,
-	118, 150, 151,
-	118, 151, 119,
-	119, 151, 152,
-	119, 152, 120,
-	120, 152, 153,
-	120, 153, 121,
-	121, 153, 154,
-	121, 154, 122,
-	122, 154, 155,
-	122, 155, 123,
-	123, 155, 156,
-	123, 156, 124,
-	124, 156, 157,
-	124, 157, 125,
-	125, 157, 158,
-	125, 158, 126,
-	126, 158, 159,
-	126, 159, 127,
-	127, 159, 160,
-	127, 160, 128,
-	128, 160, 161,
-	128, 161, 129,
-	129, 161, 162,
-	129, 162, 130,
-	130, 162, 163,
-	130, 163, 131,
-	131, 163, 164,
-
-	132, 165, 133,
-	133, 165, 166,
-	133, 166, 134,
-	134, 166, 167,
-	134, 167, 135,
-	135, 167, 168,
-	135, 168, 136,
-	136, 168, 169,
-	136, 169, 137,
-	137, 169, 170,
-	137, 170, 138,
-	138, 170, 171,
-	138, 171, 139,
-	139, 171, 172,
-	139, 172, 140,
-	140, 172, 173,
-	140, 173, 141,
-	141, 173, 174,
-	141, 174, 142,
-	142, 174, 175,
-	142, 175, 143,
-	143, 175, 176,
-	143, 176, 144,
-	144, 176, 177,
-	144, 177, 145,
-	145, 177, 178,
-	145, 178, 146,
-	146, 178, 179,
-	146, 179, 147,
-	147, 179, 180,
-	147, 180, 148,
-	148, 180, 181,
-	148, 181, 149,
-	149, 181, 182,
-	149, 182, 150,
-	150, 182, 183,
-	150, 183, 151,
-	151, 183, 184,
-	151, 184, 152,
-	152, 184, 185,
-	152, 185, 153,
-	153, 185, 186,
-	153, 186, 154,
-	154, 186, 187,
-	154, 187, 155,
-	155, 187, 188,
-	155, 188, 156,
-	156, 188, 189,
-	156, 189, 157,
-	157, 189, 190,
-	157, 190, 158,
-	158, 190, 191,
-	158, 191, 159,
-	159, 191, 192,
-	159, 192, 160,
-	160, 192, 193,
-	160, 193, 161,
-	161, 193, 194,
-	161, 194, 162,
-	162, 194, 195,
-	162, 195, 163,
-	163, 195, 196,
-	163, 196, 164,
-	164, 196, 197,
-
-	165, 198, 166,
-	166, 198, 199,
-	166, 199, 167,
-	167, 199, 200,
-	167, 200, 168,
-	168, 200, 201,
-	168, 201, 169,
-	169, 201, 202,
-	169, 202, 170,
-	170, 202, 203,
-	170, 203, 171,
-	171, 203, 204,
-	171, 204, 172,
-	172, 204, 205,
-	172, 205, 173,
-	173, 205, 206,
-	173, 206, 174,
-	174, 206, 207,
-	174, 207, 175,
-	175, 207, 208,
-	175, 208, 176,
-	176, 208, 209,
-	176, 209, 177,
-	177, 209, 210,
-	177, 210, 178,
-	178, 210, 211,
-	178, 211, 179,
-	179, 211, 212,
-	179, 212, 180,
-	180, 212, 213,
-	180, 213, 181,
-	181, 213, 214,
-	181, 214, 182,
-	182, 214, 215,
-	182, 215, 183,
-	183, 215, 216,
-	183, 216, 184,
-	184, 216, 217,
-	184, 217, 185,
-	185, 217, 218,
-	185, 218, 186,
-	186, 218, 219,
-	186, 219, 187,
-	187, 219, 220,
-	187, 220, 188,
-	188, 220, 221,
-	188, 221, 189,
-	189, 221, 222,
-	189, 222, 190,
-	190, 222, 223,
-	190, 223, 191,
-	191, 223, 224,
-	191, 224, 192,
-	192, 224, 225,
-	192, 225, 193,
-	193, 225, 226,
-	193, 226, 194,
-	194, 226, 227,
-	194, 227, 195,
-	195, 227, 228,
-	195, 228, 196,
-	196, 228, 229,
-	196, 229, 197,
-	197, 229, 230,
-
-	198, 231, 199,
-	199, 231, 232,
-	199, 232, 200,
-	200, 232, 233,
-	200, 233, 201,
-	201, 233, 234,
-	201, 234, 202,
-	202, 234, 235,
-	202, 235, 203,
-	203, 235, 236,
-	203, 236, 204,
-	204, 236, 237,
-	204, 237, 205,
-	205, 237, 238,
-	205, 238, 206,
-	206, 238, 239,
-	206, 239, 207,
-	207, 239, 240,
-	207, 240, 208,
-	208, 240, 241,
-	208, 241, 209,
-	209, 241, 242,
-	209, 242, 210,
-	210, 242, 243,
-	210, 243, 211,
-	211, 243, 244,
-	211, 244, 212,
-	212, 244, 245,
-	212, 245, 213,
-	213, 245, 246,
-	213, 246, 214,
-	214, 246, 247,
-	214, 247, 215,
-	215, 247, 248,
-	215, 248, 216,
-	216, 248, 249,
-	216, 249, 217,
-	217, 249, 250,
-	217, 250, 218,
-	218, 250, 251,
-	218, 251, 219,
-	219, 251, 252,
-	219, 252, 220,
-	220, 252, 253,
-	220, 253, 221,
-	221, 253, 254,
-	221, 254, 222,
-	222, 254, 255,
-	222, 255, 223,
-	223, 255, 256,
-	223, 256, 224,
-	224, 256, 257,
-	224, 257, 225,
-	225, 257, 258,
-	225, 258, 226,
-	226, 258, 259,
-	226, 259, 227,
-	227, 259, 260,
-	227, 260, 228,
-	228, 260, 261,
-	228, 261, 229,
-	229, 261, 262,
-	229, 262, 230,
-	230, 262, 263,
-
-	231, 264, 232,
-	232, 264, 265,
-	232, 265, 233,
-	233, 265, 266,
-	233, 266, 234,
-	234, 266, 267,
-	234, 267, 235,
-	235, 267, 268,
-	235, 268, 236,
-	236, 268, 269,
-	236, 269, 237,
-	237, 269, 270,
-	237, 270, 238,
-	238, 270, 271,
-	238, 271, 239,
-	239, 271, 272,
-	239, 272, 240,
-	240, 272, 273,
-	240, 273, 241,
-	241, 273, 274,
-	241, 274, 242,
-	242, 274, 275,
-	242, 275, 243,
-	243, 275, 276,
-	243, 276, 244,
-	244, 276, 277,
-	244, 277, 245,
-	245, 277, 278,
-	245, 278, 246,
-	246, 278, 279,
-	246, 279, 247,
-	247, 279, 280,
-	247, 280, 248,
-	248, 280, 281,
-	248, 281, 249,
-	249, 281, 282,
-	249, 282, 250,
-	250, 282, 283,
-	250, 283, 251,
-	251, 283, 284,
-	251, 284, 252,
-	252, 284, 285,
-	252, 285, 253,
-	253, 285, 286,
-	253, 286, 254,
-	254, 286, 287,
-	254, 287, 255,
-	255, 287, 288,
-	255, 288, 256,
-	256, 288, 289,
-	256, 289, 257,
-	257, 289, 290,
-	257, 290, 258,
-	258, 290, 291,
-	258, 291, 259,
-	259, 291, 292,
-	259, 292, 260,
-	260, 292, 293,
-	260, 293, 261,
-	261, 293, 294,
-	261, 294, 262,
-	262, 294, 295,
-	262, 295, 263,
-	263, 295, 296,
-
-	264, 297, 265,
-	265, 297, 298,
-	265, 298, 266,
-	266, 298, 299,
-	266, 299, 267,
-	267, 299, 300,
-	267, 300, 268,
-	268, 300, 301,
-	268, 301, 269,
-	269, 301, 302,
-	269, 302, 270,
-	270, 302, 303,
-	270, 303, 271,
-	271, 303, 304,
-	271, 304, 272,
-	272, 304, 305,
-	272, 305, 273,
-	273, 305, 306,
-	273, 306, 274,
-	274, 306, 307,
-	274, 307, 275,
-	275, 307, 308,
-	275, 308, 276,
-	276, 308, 309,
-	276, 309, 277,
-	277, 309, 310,
-	277, 310, 278,
-	278, 310, 311,
-	278, 311, 279,
-	279, 311, 312,
-	279, 312, 280,
-	280, 312, 313,
-	280, 313, 281,
-	281, 313, 314,
-	281, 314, 282,
-	282, 314, 315,
-	282, 315, 283,
-	283, 315, 316,
-	283, 316, 284,
-	284, 316, 317,
-	284, 317, 285,
-	285, 317, 318,
-	285, 318, 286,
-	286, 318, 319,
-	286, 319, 287,
-	287, 319, 320,
-	287, 320, 288,
-	288, 320, 321,
-	288, 321, 289,
-	289, 321, 322,
-	289, 322, 290,
-	290, 322, 323,
-	290, 323, 291,
-	291, 323, 324,
-	291, 324, 292,
-	292, 324, 325,
-	292, 325, 293,
-	293, 325, 326,
-	293, 326, 294,
-	294, 326, 327,
-	294, 327, 295,
-	295, 327, 328,
-	295, 328, 296,
-	296, 328, 329,
-
-	297, 330, 298,
-	298, 330, 331,
-	298, 331, 299,
-	299, 331, 332,
-	299, 332, 300,
-	300, 332, 333,
-	300, 333, 301,
-	301, 333, 334,
-	301, 334, 302,
-	302, 334, 335,
-	302, 335, 303,
-	303, 335, 336,
-	303, 336, 304,
-	304, 336, 337,
-	304, 337, 305,
-	305, 337, 338,
-	305, 338, 306,
-	306, 338, 339,
-	306, 339, 307,
-	307, 339, 340,
-	307, 340, 308,
-	308, 340, 341,
-	308, 341, 309,
-	309, 341, 342,
-	309, 342, 310,
-	310, 342, 343,
-	310, 343, 311,
-	311, 343, 344,
-	311, 344, 312,
-	312, 344, 345,
-	312, 345, 313,
-	313, 345, 346,
-	313, 346, 314,
-	314, 346, 347,
-	314, 347, 315,
-	315, 347, 348,
-	315, 348, 316,
-	316, 348, 349,
-	316, 349, 317,
-	317, 349, 350,
-	317, 350, 318,
-	318, 350, 351,
-	318, 351, 319,
-	319, 351, 352,
-	319, 352, 320,
-	320, 352, 353,
-	320, 353, 321,
-	321, 353, 354,
-	321, 354, 322,
-	322, 354, 355,
-	322, 355, 323,
-	323, 355, 356,
-	323, 356, 324,
-	324, 356, 357,
-	324, 357, 325,
-	325, 357, 358,
-	325, 358, 326,
-	326, 358, 359,
-	326, 359, 327,
-	327, 359, 360,
-	327, 360, 328,
-	328, 360, 361,
-	328, 361, 329,
-	329, 361, 362,
-
-	330, 363, 331,
-	331, 363, 364,
-	331, 364, 332,
-	332, 364, 365,
-	332, 365, 333,
-	333, 365, 366,
-	333, 366, 334,
-	334, 366, 367,
-	334, 367, 335,
-	335, 367, 368,
-	335, 368, 336,
-	336, 368, 369,
-	336, 369, 337,
-	337, 369, 370,
-	337, 370, 338,
-	338, 370, 371,
-	338, 371, 339,
-	339, 371, 372,
-	339, 372, 340,
-	340, 372, 373,
-	340, 373, 341,
-	341, 373, 374,
-	341, 374, 342,
-	342, 374, 375,
-	342, 375, 343,
-	343, 375, 376,
-	343, 376, 344,
-	344, 376, 377,
-	344, 377, 345,
-	345, 377, 378,
-	345, 378, 346,
-	346, 378, 379,
-	346, 379, 347,
-	347, 379, 380,
-	347, 380, 348,
-	348, 380, 381,
-	348, 381, 349,
-	349, 381, 382,
-	349, 382, 350,
-	350, 382, 383,
-	350, 383, 351,
-	351, 383, 384,
-	351, 384, 352,
-	352, 384, 385,
-	352, 385, 353,
-	353, 385, 386,
-	353, 386, 354,
-	354, 386, 387,
-	354, 387, 355,
-	355, 387, 388,
-	355, 388, 356,
-	356, 388, 389,
-	356, 389, 357,
-	357, 389, 390,
-	357, 390, 358,
-	358, 390, 391,
-	358, 391, 359,
-	359, 391, 392,
-	359, 392, 360,
-	360, 392, 393,
-	360, 393, 361,
-	361, 393, 394,
-	361, 394, 362,
-	362, 394, 395,
-
-	363, 396, 364,
-	364, 396, 397,
-	364, 397, 365,
-	365, 397, 398,
-	365, 398, 366,
-	366, 398, 399,
-	366, 399, 367,
-	367, 399, 400,
-	367, 400, 368,
-	368, 400, 401,
-	368, 401, 369,
-	369, 401, 402,
-	369, 402, 370,
-	370, 402, 403,
-	370, 403, 371,
-	371, 403, 404,
-	371, 404, 372,
-	372, 404, 405,
-	372, 405, 373,
-	373, 405, 406,
-	373, 406, 374,
-	374, 406, 407,
-	374, 407, 375,
-	375, 407, 408,
-	375, 408, 376,
-	376, 408, 409,
-	376, 409, 377,
-	377, 409, 410,
-	377, 410, 378,
-	378, 410, 411,
-	378, 411, 379,
-	379, 411, 412,
-	379, 412, 380,
-	380, 412, 413,
-	380, 413, 381,
-	381, 413, 414,
-	381, 414, 382,
-	382, 414, 415,
-	382, 415, 383,
-	383, 415, 416,
-	383, 416, 384,
-	384, 416, 417,
-	384, 417, 385,
-	385, 417, 418,
-	385, 418, 386,
-	386, 418, 419,
-	386, 419, 387,
-	387, 419, 420,
-	387, 420, 388,
-	388, 420, 421,
-	388, 421, 389,
-	389, 421, 422,
-	389, 422, 390,
-	390, 422, 423,
-	390, 423, 391,
-	391, 423, 424,
-	391, 424, 392,
-	392, 424, 425,
-	392, 425, 393,
-	393, 425, 426,
-	393, 426, 394,
-	394, 426, 427,
-	394, 427, 395,
-	395, 427, 428,
-
-	396, 429, 397,
-	397, 429, 430,
-	397, 430, 398,
-	398, 430, 431,
-	398, 431, 399,
-	399, 431, 432,
-	399, 432, 400,
-	400, 432, 433,
-	400, 433, 401,
-	401, 433, 434,
-	401, 434, 402,
-	402, 434, 435,
-	402, 435, 403,
-	403, 435, 436,
-	403, 436, 404,
-	404, 436, 437,
-	404, 437, 405,
-	405, 437, 438,
-	405, 438, 406,
-	406, 438, 439,
-	406, 439, 407,
-	407, 439, 440,
-	407, 440, 408,
-	408, 440, 441,
-	408, 441, 409,
-	409, 441, 442,
-	409, 442, 410,
-	410, 442, 443,
-	410, 443, 411,
-	411, 443, 444,
-	411, 444, 412,
-	412, 444, 445,
-	412, 445, 413,
-	413, 445, 446,
-	413, 446, 414,
-	414, 446, 447,
-	414, 447, 415,
-	415, 447, 448,
-	415, 448, 416,
-	416, 448, 449,
-	416, 449, 417,
-	417, 449, 450,
-	417, 450, 418,
-	418, 450, 451,
-	418, 451, 419,
-	419, 451, 452,
-	419, 452, 420,
-	420, 452, 453,
-	420, 453, 421,
-	421, 453, 454,
-	421, 454, 422,
-	422, 454, 455,
-	422, 455, 423,
-	423, 455, 456,
-	423, 456, 424,
-	424, 456, 457,
-	424, 457, 425,
-	425, 457, 458,
-	425, 458, 426,
-	426, 458, 459,
-	426, 459, 427,
-	427, 459, 460,
-	427, 460, 428,
-	428, 460, 461,
-
-	429, 462, 430,
-	430, 462, 463,
-	430, 463, 431,
-	431, 463, 464,
-	431, 464, 432,
-	432, 464, 465,
-	432, 465, 433,
-	433, 465, 466,
-	433, 466, 434,
-	434, 466, 467,
-	434, 467, 435,
-	435, 467, 468,
-	435, 468, 436,
-	436, 468, 469,
-	436, 469, 437,
-	437, 469, 470,
-	437, 470, 438,
-	438, 470, 471,
-	438, 471, 439,
-	439, 471, 472,
-	439, 472, 440,
-	440, 472, 473,
-	440, 473, 441,
-	441, 473, 474,
-	441, 474, 442,
-	442, 474, 475,
-	442, 475, 443,
-	443, 475, 476,
-	443, 476, 444,
-	444, 476, 477,
-	444, 477, 445,
-	445, 477, 478,
-	445, 478, 446,
-	446, 478, 479,
-	446, 479, 447,
-	447, 479, 480,
-	447, 480, 448,
-	448, 480, 481,
-	448, 481, 449,
-	449, 481, 482,
-	449, 482, 450,
-	450, 482, 483,
-	450, 483, 451,
-	451, 483, 484,
-	451, 484, 452,
-	452, 484, 485,
-	452, 485, 453,
-	453, 485, 486,
-	453, 486, 454,
-	454, 486, 487,
-	454, 487, 455,
-	455, 487, 488,
-	455, 488, 456,
-	456, 488, 489,
-	456, 489, 457,
-	457, 489, 490,
-	457, 490, 458,
-	458, 490, 491,
-	458, 491, 459,
-	459, 491, 492,
-	459, 492, 460,
-	460, 492, 493,
-	460, 493, 461,
-	461, 493, 494,
-
-	462, 495, 463,
-	463, 495, 496,
-	463, 496, 464,
-	464, 496, 497,
-	464, 497, 465,
-	465, 497, 498,
-	465, 498, 466,
-	466, 498, 499,
-	466, 499, 467,
-	467, 499, 500,
-	467, 500, 468,
-	468, 500, 501,
-	468, 501, 469,
-	469, 501, 502,
-	469, 502, 470,
-	470, 502, 503,
-	470, 503, 471,
-	471, 503, 504,
-	471, 504, 472,
-	472, 504, 505,
-	472, 505, 473,
-	473, 505, 506,
-	473, 506, 474,
-	474, 506, 507,
-	474, 507, 475,
-	475, 507, 508,
-	475, 508, 476,
-	476, 508, 509,
-	476, 509, 477,
-	477, 509, 510,
-	477, 510, 478,
-	478, 510, 511,
-	478, 511, 479,
-	479, 511, 512,
-	479, 512, 480,
-	480, 512, 513,
-	480, 513, 481,
-	481, 513, 514,
-	481, 514, 482,
-	482, 514, 515,
-	482, 515, 483,
-	483, 515, 516,
-	483, 516, 484,
-	484, 516, 517,
-	484, 517, 485,
-	485, 517, 518,
-	485, 518, 486,
-	486, 518, 519,
-	486, 519, 487,
-	487, 519, 520,
-	487, 520, 488,
-	488, 520, 521,
-	488, 521, 489,
-	489, 521, 522,
-	489, 522, 490,
-	490, 522, 523,
-	490, 523, 491,
-	491, 523, 524,
-	491, 524, 492,
-	492, 524, 525,
-	492, 525, 493,
-	493, 525, 526,
-	493, 526, 494,
-	494, 526, 527,
-
-	495, 528, 496,
-	496, 528, 529,
-	496, 529, 497,
-	497, 529, 530,
-	497, 530, 498,
-	498, 530, 531,
-	498, 531, 499,
-	499, 531, 532,
-	499, 532, 500,
-	500, 532, 533,
-	500, 533, 501,
-	501, 533, 534,
-	501, 534, 502,
-	502, 534, 535,
-	502, 535, 503,
-	503, 535, 536,
-	503, 536, 504,
-	504, 536, 537,
-	504, 537, 505,
-	505, 537, 538,
-	505, 538, 506,
-	506, 538, 539,
-	506, 539, 507,
-	507, 539, 540,
-	507, 540, 508,
-	508, 540, 541,
-	508, 541, 509,
-	509, 541, 542,
-	509, 542, 510,
-	510, 542, 543,
-	510, 543, 511,
-	511, 543, 544,
-	511, 544, 512,
-	512, 544, 545,
-	512, 545, 513,
-	513, 545, 546,
-	513, 546, 514,
-	514, 546, 547,
-	514, 547, 515,
-	515, 547, 548,
-	515, 548, 516,
-	516, 548, 549,
-	516, 549, 517,
-	517, 549, 550,
-	517, 550, 518,
-	518, 550, 551,
-	518, 551, 519,
-	519, 551, 552,
-	519, 552, 520,
-	520, 552, 553,
-	520, 553, 521,
-	521, 553, 554,
-	521, 554, 522,
-	522, 554, 555,
-	522, 555, 523,
-	523, 555, 556,
-	523, 556, 524,
-	524, 556, 557,
-	524, 557, 525,
-	525, 557, 558,
-	525, 558, 526,
-	526, 558, 559,
-	526, 559, 527,
-	527, 559, 560,
-
-	528, 561, 529,
-	529, 561, 562,
-	529, 562, 530,
-	530, 562, 563,
-	530, 563, 531,
-	531, 563, 564,
-	531, 564, 532,
-	532, 564, 565,
-	532, 565, 533,
-	533, 565, 566,
-	533, 566, 534,
-	534, 566, 567,
-	534, 567, 535,
-	535, 567, 568,
-	535, 568, 536,
-	536, 568, 569,
-	536, 569, 537,
-	537, 569, 570,
-	537, 570, 538,
-	538, 570, 571,
-	538, 571, 539,
-	539, 571, 572,
-	539, 572, 540,
-	540, 572, 573,
-	540, 573, 541,
-	541, 573, 574,
-	541, 574, 542,
-	542, 574, 575,
-	542, 575, 543,
-	543, 575, 576,
-	543, 576, 544,
-	544, 576, 577,
-	544, 577, 545,
-	545, 577, 578,
-	545, 578, 546,
-	546, 578, 579,
-	546, 579, 547,
-	547, 579, 580,
-	547, 580, 548,
-	548, 580, 581,
-	548, 581, 549,
-	549, 581, 582,
-	549, 582, 550,
-	550, 582, 583,
-	550, 583, 551,
-	551, 583, 584,
-	551, 584, 552,
-	552, 584, 585,
-	552, 585, 553,
-	553, 585, 586,
-	553, 586, 554,
-	554, 586, 587,
-	554, 587, 555,
-	555, 587, 588,
-	555, 588, 556,
-	556, 588, 589,
-	556, 589, 557,
-	557, 589, 590,
-	557, 590, 558,
-	558, 590, 591,
-	558, 591, 559,
-	559, 591, 592,
-	559, 592, 560,
-	560, 592, 593,
-
-	561, 594, 562,
-	562, 594, 595,
-	562, 595, 563,
-	563, 595, 596,
-	563, 596, 564,
-	564, 596, 597,
-	564, 597, 565,
-	565, 597, 598,
-	565, 598, 566,
-	566, 598, 599,
-	566, 599, 567,
-	567, 599, 600,
-	567, 600, 568,
-	568, 600, 601,
-	568, 601, 569,
-	569, 601, 602,
-	569, 602, 570,
-	570, 602, 603,
-	570, 603, 571,
-	571, 603, 604,
-	571, 604, 572,
-	572, 604, 605,
-	572, 605, 573,
-	573, 605, 606,
-	573, 606, 574,
-	574, 606, 607,
-	574, 607, 575,
-	575, 607, 608,
-	575, 608, 576,
-	576, 608, 609,
-	576, 609, 577,
-	577, 609, 610,
-	577, 610, 578,
-	578, 610, 611,
-	578, 611, 579,
-	579, 611, 612,
-	579, 612, 580,
-	580, 612, 613,
-	580, 613, 581,
-	581, 613, 614,
-	581, 614, 582,
-	582, 614, 615,
-	582, 615, 583,
-	583, 615, 616,
-	583, 616, 584,
-	584, 616, 617,
-	584, 617, 585,
-	585, 617, 618,
-	585, 618, 586,
-	586, 618, 619,
-	586, 619, 587,
-	587, 619, 620,
-	587, 620, 588,
-	588, 620, 621,
-	588, 621, 589,
-	589, 621, 622,
-	589, 622, 590,
-	590, 622, 623,
-	590, 623, 591,
-	591, 623, 624,
-	591, 624, 592,
-	592, 624, 625,
-	592, 625, 593,
-	593, 625, 626,
-
-	594, 627, 595,
-	595, 627, 628,
-	595, 628, 596,
-	596, 628, 629,
-	596, 629, 597,
-	597, 629, 630,
-	597, 630, 598,
-	598, 630, 631,
-	598, 631, 599,
-	599, 631, 632,
-	599, 632, 600,
-	600, 632, 633,
-	600, 633, 601,
-	601, 633, 634,
-	601, 634, 602,
-	602, 634, 635,
-	602, 635, 603,
-	603, 635, 636,
-	603, 636, 604,
-	604, 636, 637,
-	604, 637, 605,
-	605, 637, 638,
-	605, 638, 606,
-	606, 638, 639,
-	606, 639, 607,
-	607, 639, 640,
-	607, 640, 608,
-	608, 640, 641,
-	608, 641, 609,
-	609, 641, 642,
-	609, 642, 610,
-	610, 642, 643,
-	610, 643, 611,
-	611, 643, 644,
-	611, 644, 612,
-	612, 644, 645,
-	612, 645, 613,
-	613, 645, 646,
-	613, 646, 614,
-	614, 646, 647,
-	614, 647, 615,
-	615, 647, 648,
-	615, 648, 616,
-	616, 648, 649,
-	616, 649, 617,
-	617, 649, 650,
-	617, 650, 618,
-	618, 650, 651,
-	618, 651, 619,
-	619, 651, 652,
-	619, 652, 620,
-	620, 652, 653,
-	620, 653, 621,
-	621, 653, 654,
-	621, 654, 622,
-	622, 654, 655,
-	622, 655, 623,
-	623, 655, 656,
-	623, 656, 624,
-	624, 656, 657,
-	624, 657, 625,
-	625, 657, 658,
-	625, 658, 626,
-	626, 658, 659,
-
-	627, 660, 628,
-	628, 660, 661,
-	628, 661, 629,
-	629, 661, 662,
-	629, 662, 630,
-	630, 662, 663,
-	630, 663, 631,
-	631, 663, 664,
-	631, 664, 632,
-	632, 664, 665,
-	632, 665, 633,
-	633, 665, 666,
-	633, 666, 634,
-	634, 666, 667,
-	634, 667, 635,
-	635, 667, 668,
-	635, 668, 636,
-	636, 668, 669,
-	636, 669, 637,
-	637, 669, 670,
-	637, 670, 638,
-	638, 670, 671,
-	638, 671, 639,
-	639, 671, 672,
-	639, 672, 640,
-	640, 672, 673,
-	640, 673, 641,
-	641, 673, 674,
-	641, 674, 642,
-	642, 674, 675,
-	642, 675, 643,
-	643, 675, 676,
-	643, 676, 644,
-	644, 676, 677,
-	644, 677, 645,
-	645, 677, 678,
-	645, 678, 646,
-	646, 678, 679,
-	646, 679, 647,
-	647, 679, 680,
-	647, 680, 648,
-	648, 680, 681,
-	648, 681, 649,
-	649, 681, 682,
-	649, 682, 650,
-	650, 682, 683,
-	650, 683, 651,
-	651, 683, 684,
-	651, 684, 652,
-	652, 684, 685,
-	652, 685, 653,
-	653, 685, 686,
-	653, 686, 654,
-	654, 686, 687,
-	654, 687, 655,
-	655, 687, 688,
-	655, 688, 656,
-	656, 688, 689,
-	656, 689, 657,
-	657, 689, 690,
-	657, 690, 658,
-	658, 690, 691,
-	658, 691, 659,
-	659, 691, 692,
-
-	660, 693, 661,
-	661, 693, 694,
-	661, 694, 662,
-	662, 694, 695,
-	662, 695, 663,
-	663, 695, 696,
-	663, 696, 664,
-	664, 696, 697,
-	664, 697, 665,
-	665, 697, 698,
-	665, 698, 666,
-	666, 698, 699,
-	666, 699, 667,
-	667, 699, 700,
-	667, 700, 668,
-	668, 700, 701,
-	668, 701, 669,
-	669, 701, 702,
-	669, 702, 670,
-	670, 702, 703,
-	670, 703, 671,
-	671, 703, 704,
-	671, 704, 672,
-	672, 704, 705,
-	672, 705, 673,
-	673, 705, 706,
-	673, 706, 674,
-	674, 706, 707,
-	674, 707, 675,
-	675, 707, 708,
-	675, 708, 676,
-	676, 708, 709,
-	676, 709, 677,
-	677, 709, 710,
-	677, 710, 678,
-	678, 710, 711,
-	678, 711, 679,
-	679, 711, 712,
-	679, 712, 680,
-	680, 712, 713,
-	680, 713, 681,
-	681, 713, 714,
-	681, 714, 682,
-	682, 714, 715,
-	682, 715, 683,
-	683, 715, 716,
-	683, 716, 684,
-	684, 716, 717,
-	684, 717, 685,
-	685, 717, 718,
-	685, 718, 686,
-	686, 718, 719,
-	686, 719, 687,
-	687, 719, 720,
-	687, 720, 688,
-	688, 720, 721,
-	688, 721, 689,
-	689, 721, 722,
-	689, 722, 690,
-	690, 722, 723,
-	690, 723, 691,
-	691, 723, 724,
-	691, 724, 692,
-	692, 724, 725,
-
-	693, 726, 694,
-	694, 726, 727,
-	694, 727, 695,
-	695, 727, 728,
-	695, 728, 696,
-	696, 728, 729,
-	696, 729, 697,
-	697, 729, 730,
-	697, 730, 698,
-	698, 730, 731,
-	698, 731, 699,
-	699, 731, 732,
-	699, 732, 700,
-	700, 732, 733,
-	700, 733, 701,
-	701, 733, 734,
-	701, 734, 702,
-	702, 734, 735,
-	702, 735, 703,
-	703, 735, 736,
-	703, 736, 704,
-	704, 736, 737,
-	704, 737, 705,
-	705, 737, 738,
-	705, 738, 706,
-	706, 738, 739,
-	706, 739, 707,
-	707, 739, 740,
-	707, 740, 708,
-	708, 740, 741,
-	708, 741, 709,
-	709, 741, 742,
-	709, 742, 710,
-	710, 742, 743,
-	710, 743, 711,
-	711, 743, 744,
-	711, 744, 712,
-	712, 744, 745,
-	712, 745, 713,
-	713, 745, 746,
-	713, 746, 714,
-	714, 746, 747,
-	714, 747, 715,
-	715, 747, 748,
-	715, 748, 716,
-	716, 748, 749,
-	716, 749, 717,
-	717, 749, 750,
-	717, 750, 718,
-	718, 750, 751,
-	718, 751, 719,
-	719, 751, 752,
-	719, 752, 720,
-	720, 752, 753,
-	720, 753, 721,
-	721, 753, 754,
-	721, 754, 722,
-	722, 754, 755,
-	722, 755, 723,
-	723, 755, 756,
-	723, 756, 724,
-	724, 756, 757,
-	724, 757, 725,
-	725, 757, 758,
-
-	726, 759, 727,
-	727, 759, 760,
-	727, 760, 728,
-	728, 760, 761,
-	728, 761, 729,
-	729, 761, 762,
-	729, 762, 730,
-	730, 762, 763,
-	730, 763, 731,
-	731, 763, 764,
-	731, 764, 732,
-	732, 764, 765,
-	732, 765, 733,
-	733, 765, 766,
-	733, 766, 734,
-	734, 766, 767,
-	734, 767, 735,
-	735, 767, 768,
-	735, 768, 736,
-	736, 768, 769,
-	736, 769, 737,
-	737, 769, 770,
-	737, 770, 738,
-	738, 770, 771,
-	738, 771, 739,
-	739, 771, 772,
-	739, 772, 740,
-	740, 772, 773,
-	740, 773, 741,
-	741, 773, 774,
-	741, 774, 742,
-	742, 774, 775,
-	742, 775, 743,
-	743, 775, 776,
-	743, 776, 744,
-	744, 776, 777,
-	744, 777, 745,
-	745, 777, 778,
-	745, 778, 746,
-	746, 778, 779,
-	746, 779, 747,
-	747, 779, 780,
-	747, 780, 748,
-	748, 780, 781,
-	748, 781, 749,
-	749, 781, 782,
-	749, 782, 750,
-	750, 782, 783,
-	750, 783, 751,
-	751, 783, 784,
-	751, 784, 752,
-	752, 784, 785,
-	752, 785, 753,
-	753, 785, 786,
-	753, 786, 754,
-	754, 786, 787,
-	754, 787, 755,
-	755, 787, 788,
-	755, 788, 756,
-	756, 788, 789,
-	756, 789, 757,
-	757, 789, 790,
-	757, 790, 758,
-	758, 790, 791,
-
-	759, 792, 760,
-	760, 792, 793,
-	760, 793, 761,
-	761, 793, 794,
-	761, 794, 762,
-	762, 794, 795,
-	762, 795, 763,
-	763, 795, 796,
-	763, 796, 764,
-	764, 796, 797,
-	764, 797, 765,
-	765, 797, 798,
-	765, 798, 766,
-	766, 798, 799,
-	766, 799, 767,
-	767, 799, 800,
-	767, 800, 768,
-	768, 800, 801,
-	768, 801, 769,
-	769, 801, 802,
-	769, 802, 770,
-	770, 802, 803,
-	770, 803, 771,
-	771, 803, 804,
-	771, 804, 772,
-	772, 804, 805,
-	772, 805, 773,
-	773, 805, 806,
-	773, 806, 774,
-	774, 806, 807,
-	774, 807, 775,
-	775, 807, 808,
-	775, 808, 776,
-	776, 808, 809,
-	776, 809, 777,
-	777, 809, 810,
-	777, 810, 778,
-	778, 810, 811,
-	778, 811, 779,
-	779, 811, 812,
-	779, 812, 780,
-	780, 812, 813,
-	780, 813, 781,
-	781, 813, 814,
-	781, 814, 782,
-	782, 814, 815,
-	782, 815, 783,
-	783, 815, 816,
-	783, 816, 784,
-	784, 816, 817,
-	784, 817, 785,
-	785, 817, 818,
-	785, 818, 786,
-	786, 818, 819,
-	786, 819, 787,
-	787, 819, 820,
-	787, 820, 788,
-	788, 820, 821,
-	788, 821, 789,
-	789, 821, 822,
-	789, 822, 790,
-	790, 822, 823,
-	790, 823, 791,
-	791, 823, 824,
-
-	792, 825, 793,
-	793, 825, 826,
-	793, 826, 794,
-	794, 826, 827,
-	794, 827, 795,
-	795, 827, 828,
-	795, 828, 796,
-	796, 828, 829,
-	796, 829, 797,
-	797, 829, 830,
-	797, 830, 798,
-	798, 830, 831,
-	798, 831, 799,
-	799, 831, 832,
-	799, 832, 800,
-	800, 832, 833,
-	800, 833, 801,
-	801, 833, 834,
-	801, 834, 802,
-	802, 834, 835,
-	802, 835, 803,
-	803, 835, 836,
-	803, 836, 804,
-	804, 836, 837,
-	804, 837, 805,
-	805, 837, 838,
-	805, 838, 806,
-	806, 838, 839,
-	806, 839, 807,
-	807, 839, 840,
-	807, 840, 808,
-	808, 840, 841,
-	808, 841, 809,
-	809, 841, 842,
-	809, 842, 810,
-	810, 842, 843,
-	810, 843, 811,
-	811, 843, 844,
-	811, 844, 812,
-	812, 844, 845,
-	812, 845, 813,
-	813, 845, 846,
-	813, 846, 814,
-	814, 846, 847,
-	814, 847, 815,
-	815, 847, 848,
-	815, 848, 816,
-	816, 848, 849,
-	816, 849, 817,
-	817, 849, 850,
-	817, 850, 818,
-	818, 850, 851,
-	818, 851, 819,
-	819, 851, 852,
-	819, 852, 820,
-	820, 852, 853,
-	820, 853, 821,
-	821, 853, 854,
-	821, 854, 822,
-	822, 854, 855,
-	822, 855, 823,
-	823, 855, 856,
-	823, 856, 824,
-	824, 856, 857,
-
-	825, 858, 826,
-	826, 858, 859,
-	826, 859, 827,
-	827, 859, 860,
-	827, 860, 828,
-	828, 860, 861,
-	828, 861, 829,
-	829, 861, 862,
-	829, 862, 830,
-	830, 862, 863,
-	830, 863, 831,
-	831, 863, 864,
-	831, 864, 832,
-	832, 864, 865,
-	832, 865, 833,
-	833, 865, 866,
-	833, 866, 834,
-	834, 866, 867,
-	834, 867, 835,
-	835, 867, 868,
-	835, 868, 836,
-	836, 868, 869,
-	836, 869, 837,
-	837, 869, 870,
-	837, 870, 838,
-	838, 870, 871,
-	838, 871, 839,
-	839, 871, 872,
-	839, 872, 840,
-	840, 872, 873,
-	840, 873, 841,
-	841, 873, 874,
-	841, 874, 842,
-	842, 874, 875,
-	842, 875, 843,
-	843, 875, 876,
-	843, 876, 844,
-	844, 876, 877,
-	844, 877, 845,
-	845, 877, 878,
-	845, 878, 846,
-	846, 878, 879,
-	846, 879, 847,
-	847, 879, 880,
-	847, 880, 848,
-	848, 880, 881,
-	848, 881, 849,
-	849, 881, 882,
-	849, 882, 850,
-	850, 882, 883,
-	850, 883, 851,
-	851, 883, 884,
-	851, 884, 852,
-	852, 884, 885,
-	852, 885, 853,
-	853, 885, 886,
-	853, 886, 854,
-	854, 886, 887,
-	854, 887, 855,
-	855, 887, 888,
-	855, 888, 856,
-	856, 888, 889,
-	856, 889, 857,
-	857, 889, 890,
-
-	858, 891, 859,
-	859, 891, 892,
-	859, 892, 860,
-	860, 892, 893,
-	860, 893, 861,
-	861, 893, 894,
-	861, 894, 862,
-	862, 894, 895,
-	862, 895, 863,
-	863, 895, 896,
-	863, 896, 864,
-	864, 896, 897,
-	864, 897, 865,
-	865, 897, 898,
-	865, 898, 866,
-	866, 898, 899,
-	866, 899, 867,
-	867, 899, 900,
-	867, 900, 868,
-	868, 900, 901,
-	868, 901, 869,
-	869, 901, 902,
-	869, 902, 870,
-	870, 902, 903,
-	870, 903, 871,
-	871, 903, 904,
-	871, 904, 872,
-	872, 904, 905,
-	872, 905, 873,
-	873, 905, 906,
-	873, 906, 874,
-	874, 906, 907,
-	874, 907, 875,
-	875, 907, 908,
-	875, 908, 876,
-	876, 908, 909,
-	876, 909, 877,
-	877, 909, 910,
-	877, 910, 878,
-	878, 910, 911,
-	878, 911, 879,
-	879, 911, 912,
-	879, 912, 880,
-	880, 912, 913,
-	880, 913, 881,
-	881, 913, 914,
-	881, 914, 882,
-	882, 914, 915,
-	882, 915, 883,
-	883, 915, 916,
-	883, 916, 884,
-	884, 916, 917,
-	884, 917, 885,
-	885, 917, 918,
-	885, 918, 886,
-	886, 918, 919,
-	886, 919, 887,
-	887, 919, 920,
-	887, 920, 888,
-	888, 920, 921,
-	888, 921, 889,
-	889, 921, 922,
-	889, 922, 890,
-	890, 922, 923,
-
-	891, 924, 892,
-	892, 924, 925,
-	892, 925, 893,
-	893, 925, 926,
-	893, 926, 894,
-	894, 926, 927,
-	894, 927, 895,
-	895, 927, 928,
-	895, 928, 896,
-	896, 928, 929,
-	896, 929, 897,
-	897, 929, 930,
-	897, 930, 898,
-	898, 930, 931,
-	898, 931, 899,
-	899, 931, 932,
-	899, 932, 900,
-	900, 932, 933,
-	900, 933, 901,
-	901, 933, 934,
-	901, 934, 902,
-	902, 934, 935,
-	902, 935, 903,
-	903, 935, 936,
-	903, 936, 904,
-	904, 936, 937,
-	904, 937, 905,
-	905, 937, 938,
-	905, 938, 906,
-	906, 938, 939,
-	906, 939, 907,
-	907, 939, 940,
-	907, 940, 908,
-	908, 940, 941,
-	908, 941, 909,
-	909, 941, 942,
-	909, 942, 910,
-	910, 942, 943,
-	910, 943, 911,
-	911, 943, 944,
-	911, 944, 912,
-	912, 944, 945,
-	912, 945, 913,
-	913, 945, 946,
-	913, 946, 914,
-	914, 946, 947,
-	914, 947, 915,
-	915, 947, 948,
-	915, 948, 916,
-	916, 948, 949,
-	916, 949, 917,
-	917, 949, 950,
-	917, 950, 918,
-	918, 950, 951,
-	918, 951, 919,
-	919, 951, 952,
-	919, 952, 920,
-	920, 952, 953,
-	920, 953, 921,
-	921, 953, 954,
-	921, 954, 922,
-	922, 954, 955,
-	922, 955, 923,
-	923, 955, 956,
-
-	924, 957, 925,
-	925, 957, 958,
-	925, 958, 926,
-	926, 958, 959,
-	926, 959, 927,
-	927, 959, 960,
-	927, 960, 928,
-	928, 960, 961,
-	928, 961, 929,
-	929, 961, 962,
-	929, 962, 930,
-	930, 962, 963,
-	930, 963, 931,
-	931, 963, 964,
-	931, 964, 932,
-	932, 964, 965,
-	932, 965, 933,
-	933, 965, 966,
-	933, 966, 934,
-	934, 966, 967,
-	934, 967, 935,
-	935, 967, 968,
-	935, 968, 936,
-	936, 968, 969,
-	936, 969, 937,
-	937, 969, 970,
-	937, 970, 938,
-	938, 970, 971,
-	938, 971, 939,
-	939, 971, 972,
-	939, 972, 940,
-	940, 972, 973,
-	940, 973, 941,
-	941, 973, 974,
-	941, 974, 942,
-	942, 974, 975,
-	942, 975, 943,
-	943, 975, 976,
-	943, 976, 944,
-	944, 976, 977,
-	944, 977, 945,
-	945, 977, 978,
-	945, 978, 946,
-	946, 978, 979,
-	946, 979, 947,
-	947, 979, 980,
-	947, 980, 948,
-	948, 980, 981,
-	948, 981, 949,
-	949, 981, 982,
-	949, 982, 950,
-	950, 982, 983,
-	950, 983, 951,
-	951, 983, 984,
-	951, 984, 952,
-	952, 984, 985,
-	952, 985, 953,
-	953, 985, 986,
-	953, 986, 954,
-	954, 986, 987,
-	954, 987, 955,
-	955, 987, 988,
-	955, 988, 956,
-	956, 988, 989,
-
-	957, 990, 958,
-	958, 990, 991,
-	958, 991, 959,
-	959, 991, 992,
-	959, 992, 960,
-	960, 992, 993,
-	960, 993, 961,
-	961, 993, 994,
-	961, 994, 962,
-	962, 994, 995,
-	962, 995, 963,
-	963, 995, 996,
-	963, 996, 964,
-	964, 996, 997,
-	964, 997, 965,
-	965, 997, 998,
-	965, 998, 966,
-	966, 998, 999,
-	966, 999, 967,
-	967, 999, 1000,
-	967, 1000, 968,
-	968, 1000, 1001,
-	968, 1001, 969,
-	969, 1001, 1002,
-	969, 1002, 970,
-	970, 1002, 1003,
-	970, 1003, 971,
-	971, 1003, 1004,
-	971, 1004, 972,
-	972, 1004, 1005,
-	972, 1005, 973,
-	973, 1005, 1006,
-	973, 1006, 974,
-	974, 1006, 1007,
-	974, 1007, 975,
-	975, 1007, 1008,
-	975, 1008, 976,
-	976, 1008, 1009,
-	976, 1009, 977,
-	977, 1009, 1010,
-	977, 1010, 978,
-	978, 1010, 1011,
-	978, 1011, 979,
-	979, 1011, 1012,
-	979, 1012, 980,
-	980, 1012, 1013,
-	980, 1013, 981,
-	981, 1013, 1014,
-	981, 1014, 982,
-	982, 1014, 1015,
-	982, 1015, 983,
-	983, 1015, 1016,
-	983, 1016, 984,
-	984, 1016, 1017,
-	984, 1017, 985,
-	985, 1017, 1018,
-	985, 1018, 986,
-	986, 1018, 1019,
-	986, 1019, 987,
-	987, 1019, 1020,
-	987, 1020, 988,
-	988, 1020, 1021,
-	988, 1021, 989,
-	989, 1021, 1022,
-
-	990, 1023, 991,
-	991, 1023, 1024,
-	991, 1024, 992,
-	992, 1024, 1025,
-	992, 1025, 993,
-	993, 1025, 1026,
-	993, 1026, 994,
-	994, 1026, 1027,
-	994, 1027, 995,
-	995, 1027, 1028,
-	995, 1028, 996,
-	996, 1028, 1029,
-	996, 1029, 997,
-	997, 1029, 1030,
-	997, 1030, 998,
-	998, 1030, 1031,
-	998, 1031, 999,
-	999, 1031, 1032,
-	999, 1032, 1000,
-	1000, 1032, 1033,
-	1000, 1033, 1001,
-	1001, 1033, 1034,
-	1001, 1034, 1002,
-	1002, 1034, 1035,
-	1002, 1035, 1003,
-	1003, 1035, 1036,
-	1003, 1036, 1004,
-	1004, 1036, 1037,
-	1004, 1037, 1005,
-	1005, 1037, 1038,
-	1005, 1038, 1006,
-	1006, 1038, 1039,
-	1006, 1039, 1007,
-	1007, 1039, 1040,
-	1007, 1040, 1008,
-	1008, 1040, 1041,
-	1008, 1041, 1009,
-	1009, 1041, 1042,
-	1009, 1042, 1010,
-	1010, 1042, 1043,
-	1010, 1043, 1011,
-	1011, 1043, 1044,
-	1011, 1044, 1012,
-	1012, 1044, 1045,
-	1012, 1045, 1013,
-	1013, 1045, 1046,
-	1013, 1046, 1014,
-	1014, 1046, 1047,
-	1014, 1047, 1015,
-	1015, 1047, 1048,
-	1015, 1048, 1016,
-	1016, 1048, 1049,
-	1016, 1049, 1017,
-	1017, 1049, 1050,
-	1017, 1050, 1018,
-	1018, 1050, 1051,
-	1018, 1051, 1019,
-	1019, 1051, 1052,
-	1019, 1052, 1020,
-	1020, 1052, 1053,
-	1020, 1053, 1021,
-	1021, 1053, 1054,
-	1021, 1054, 1022,
-	1022, 1054, 1055,
-
-	1023, 1056, 1024,
-	1024, 1056, 1057,
-	1024, 1057, 1025,
-	1025, 1057, 1058,
-	1025, 1058, 1026,
-	1026, 1058, 1059,
-	1026, 1059, 1027,
-	1027, 1059, 1060,
-	1027, 1060, 1028,
-	1028, 1060, 1061,
-	1028, 1061, 1029,
-	1029, 1061, 1062,
-	1029, 1062, 1030,
-	1030, 1062, 1063,
-	1030, 1063, 1031,
-	1031, 1063, 1064,
-	1031, 1064, 1032,
-	1032, 1064, 1065,
-	1032, 1065, 1033,
-	1033, 1065, 1066,
-	1033, 1066, 1034,
-	1034, 1066, 1067,
-	1034, 1067, 1035,
-	1035, 1067, 1068,
-	1035, 1068, 1036,
-	1036, 1068, 1069,
-	1036, 1069, 1037,
-	1037, 1069, 1070,
-	1037, 1070, 1038,
-	1038, 1070, 1071,
-	1038, 1071, 1039,
-	1039, 1071, 1072,
-	1039, 1072, 1040,
-	1040, 1072, 1073,
-	1040, 1073, 1041,
-	1041, 1073, 1074,
-	1041, 1074, 1042,
-	1042, 1074, 1075,
-	1042, 1075, 1043,
-	1043, 1075, 1076,
-	1043, 1076, 1044,
-	1044, 1076, 1077,
-	1044, 1077, 1045,
-	1045, 1077, 1078,
-	1045, 1078, 1046,
-	1046, 1078, 1079,
-	1046, 1079, 1047,
-	1047, 1079, 1080,
-	1047, 1080, 1048,
-	1048, 1080, 1081,
-	1048, 1081, 1049,
-	1049, 1081, 1082,
-	1049, 1082, 1050,
-	1050, 1082, 1083,
-	1050, 1083, 1051,
-	1051, 1083, 1084,
-	1051, 1084, 1052,
-	1052, 1084, 1085,
-	1052, 1085, 1053,
-	1053, 1085, 1086,
-	1053, 1086, 1054,
-	1054, 1086, 1087,
-	1054, 1087, 1055,
-	1055, 1087, 1088,
-
-	1056, 1089, 1057,
-	1057, 1089, 1090,
-	1057, 1090, 1058,
-	1058, 1090, 1091,
-	1058, 1091, 1059,
-	1059, 1091, 1092,
-	1059, 1092, 1060,
-	1060, 1092, 1093,
-	1060, 1093, 1061,
-	1061, 1093, 1094,
-	1061, 1094, 1062,
-	1062, 1094, 1095,
-	1062, 1095, 1063,
-	1063, 1095, 1096,
-	1063, 1096, 1064,
-	1064, 1096, 1097,
-	1064, 1097, 1065,
-	1065, 1097, 1098,
-	1065, 1098, 1066,
-	1066, 1098, 1099,
-	1066, 1099, 1067,
-	1067, 1099, 1100,
-	1067, 1100, 1068,
-	1068, 1100, 1101,
-	1068, 1101, 1069,
-	1069, 1101, 1102,
-	1069, 1102, 1070,
-	1070, 1102, 1103,
-	1070, 1103, 1071,
-	1071, 1103, 1104,
-	1071, 1104, 1072,
-	1072, 1104, 1105,
-	1072, 1105, 1073,
-	1073, 1105, 1106,
-	1073, 1106, 1074,
-	1074, 1106, 1107,
-	1074, 1107, 1075,
-	1075, 1107, 1108,
-	1075, 1108, 1076,
-	1076, 1108, 1109,
-	1076, 1109, 1077,
-	1077, 1109, 1110,
-	1077, 1110, 1078,
-	1078, 1110, 1111,
-	1078, 1111, 1079,
-	1079, 1111, 1112,
-	1079, 1112, 1080,
-	1080, 1112, 1113,
-	1080, 1113, 1081,
-	1081, 1113, 1114,
-	1081, 1114, 1082,
-	1082, 1114, 1115,
-	1082, 1115, 1083,
-	1083, 1115, 1116,
-	1083, 1116, 1084,
-	1084, 1116, 1117,
-	1084, 1117, 1085,
-	1085, 1117, 1118,
-	1085, 1118, 1086,
-	1086, 1118, 1119,
-	1086, 1119, 1087,
-	1087, 1119, 1120,
-	1087, 1120, 1088,
-	1088, 1120, 1121,
-
-	1089, 1122, 1090,
-	1090, 1122, 1123,
-	1090, 1123, 1091,
-	1091, 1123, 1124,
-	1091, 1124, 1092,
-	1092, 1124, 1125,
-	1092, 1125, 1093,
-	1093, 1125, 1126,
-	1093, 1126, 1094,
-	1094, 1126, 1127,
-	1094, 1127, 1095,
-	1095, 1127, 1128,
-	1095, 1128, 1096,
-	1096, 1128, 1129,
-	1096, 1129, 1097,
-	1097, 1129, 1130,
-	1097, 1130, 1098,
-	1098, 1130, 1131,
-	1098, 1131, 1099,
-	1099, 1131, 1132,
-	1099, 1132, 1100,
-	1100, 1132, 1133,
-	1100, 1133, 1101,
-	1101, 1133, 1134,
-	1101, 1134, 1102,
-	1102, 1134, 1135,
-	1102, 1135, 1103,
-	1103, 1135, 1136,
-	1103, 1136, 1104,
-	1104, 1136, 1137,
-	1104, 1137, 1105,
-	1105, 1137, 1138,
-	1105, 1138, 1106,
-	1106, 1138, 1139,
-	1106, 1139, 1107,
-	1107, 1139, 1140,
-	1107, 1140, 1108,
-	1108, 1140, 1141,
-	1108, 1141, 1109,
-	1109, 1141, 1142,
-	1109, 1142, 1110,
-	1110, 1142, 1143,
-	1110, 1143, 1111,
-	1111, 1143, 1144,
-	1111, 1144, 1112,
-	1112, 1144, 1145,
-	1112, 1145, 1113,
-	1113, 1145, 1146,
-	1113, 1146, 1114,
-	1114, 1146, 1147,
-	1114, 1147, 1115,
-	1115, 1147, 1148,
-	1115, 1148, 1116,
-	1116, 1148, 1149,
-	1116, 1149, 1117,
-	1117, 1149, 1150,
-	1117, 1150, 1118,
-	1118, 1150, 1151,
-	1118, 1151, 1119,
-	1119, 1151, 1152,
-	1119, 1152, 1120,
-	1120, 1152, 1153,
-	1120, 1153, 1121,
-	1121, 1153, 1154,
-
-	1122, 1155, 1123,
-	1123, 1155, 1156,
-	1123, 1156, 1124,
-	1124, 1156, 1157,
-	1124, 1157, 1125,
-	1125, 1157, 1158,
-	1125, 1158, 1126,
-	1126, 1158, 1159,
-	1126, 1159, 1127,
-	1127, 1159, 1160,
-	1127, 1160, 1128,
-	1128, 1160, 1161,
-	1128, 1161, 1129,
-	1129, 1161, 1162,
-	1129, 1162, 1130,
-	1130, 1162, 1163,
-	1130, 1163, 1131,
-	1131, 1163, 1164,
-	1131, 1164, 1132,
-	1132, 1164, 1165,
-	1132, 1165, 1133,
-	1133, 1165, 1166,
-	1133, 1166, 1134,
-	1134, 1166, 1167,
-	1134, 1167, 1135,
-	1135, 1167, 1168,
-	1135, 1168, 1136,
-	1136, 1168, 1169,
-	1136, 1169, 1137,
-	1137, 1169, 1170,
-	1137, 1170, 1138,
-	1138, 1170, 1171,
-	1138, 1171, 1139,
-	1139, 1171, 1172,
-	1139, 1172, 1140,
-	1140, 1172, 1173,
-	1140, 1173, 1141,
-	1141, 1173, 1174,
-	1141, 1174, 1142,
-	1142, 1174, 1175,
-	1142, 1175, 1143,
-	1143, 1175, 1176,
-	1143, 1176, 1144,
-	1144, 1176, 1177,
-	1144, 1177, 1145,
-	1145, 1177, 1178,
-	1145, 1178, 1146,
-	1146, 1178, 1179,
-	1146, 1179, 1147,
-	1147, 1179, 1180,
-	1147, 1180, 1148,
-	1148, 1180, 1181,
-	1148, 1181, 1149,
-	1149, 1181, 1182,
-	1149, 1182, 1150,
-	1150, 1182, 1183,
-	1150, 1183, 1151,
-	1151, 1183, 1184,
-	1151, 1184, 1152,
-	1152, 1184, 1185,
-	1152, 1185, 1153,
-	1153, 1185, 1186,
-	1153, 1186, 1154,
-	1154, 1186, 1187,
-
-	1155, 1188, 1156,
-	1156, 1188, 1189,
-	1156, 1189, 1157,
-	1157, 1189, 1190,
-	1157, 1190, 1158,
-	1158, 1190, 1191,
-	1158, 1191, 1159,
-	1159, 1191, 1192,
-	1159, 1192, 1160,
-	1160, 1192, 1193,
-	1160, 1193, 1161,
-	1161, 1193, 1194,
-	1161, 1194, 1162,
-	1162, 1194, 1195,
-	1162, 1195, 1163,
-	1163, 1195, 1196,
-	1163, 1196, 1164,
-	1164, 1196, 1197,
-	1164, 1197, 1165,
-	1165, 1197, 1198,
-	1165, 1198, 1166,
-	1166, 1198, 1199,
-	1166, 1199, 1167,
-	1167, 1199, 1200,
-	1167, 1200, 1168,
-	1168, 1200, 1201,
-	1168, 1201, 1169,
-	1169, 1201, 1202,
-	1169, 1202, 1170,
-	1170, 1202, 1203,
-	1170, 1203, 1171,
-	1171, 1203, 1204,
-	1171, 1204, 1172,
-	1172, 1204, 1205,
-	1172, 1205, 1173,
-	1173, 1205, 1206,
-	1173, 1206, 1174,
-	1174, 1206, 1207,
-	1174, 1207, 1175,
-	1175, 1207, 1208,
-	1175, 1208, 1176,
-	1176, 1208, 1209,
-	1176, 1209, 1177,
-	1177, 1209, 1210,
-	1177, 1210, 1178,
-	1178, 1210, 1211,
-	1178, 1211, 1179,
-	1179, 1211, 1212,
-	1179, 1212, 1180,
-	1180, 1212, 1213,
-	1180, 1213, 1181,
-	1181, 1213, 1214,
-	1181, 1214, 1182,
-	1182, 1214, 1215,
-	1182, 1215, 1183,
-	1183, 1215, 1216,
-	1183, 1216, 1184,
-	1184, 1216, 1217,
-	1184, 1217, 1185,
-	1185, 1217, 1218,
-	1185, 1218, 1186,
-	1186, 1218, 1219,
-	1186, 1219, 1187,
-	1187, 1219, 1220,
-
-	1188, 1221, 1189,
-	1189, 1221, 1222,
-	1189, 1222, 1190,
-	1190, 1222, 1223,
-	1190, 1223, 1191,
-	1191, 1223, 1224,
-	1191, 1224, 1192,
-	1192, 1224, 1225,
-	1192, 1225, 1193,
-	1193, 1225, 1226,
-	1193, 1226, 1194,
-	1194, 1226, 1227,
-	1194, 1227, 1195,
-	1195, 1227, 1228,
-	1195, 1228, 1196,
-	1196, 1228, 1229,
-	1196, 1229, 1197,
-	1197, 1229, 1230,
-	1197, 1230, 1198,
-	1198, 1230, 1231,
-	1198, 1231, 1199,
-	1199, 1231, 1232,
-	1199, 1232, 1200,
-	1200, 1232, 1233,
-	1200, 1233, 1201,
-	1201, 1233, 1234,
-	1201, 1234, 1202,
-	1202, 1234, 1235,
-	1202, 1235, 1203,
-	1203, 1235, 1236,
-	1203, 1236, 1204,
-	1204, 1236, 1237,
-	1204, 1237, 1205,
-	1205, 1237, 1238,
-	1205, 1238, 1206,
-	1206, 1238, 1239,
-	1206, 1239, 1207,
-	1207, 1239, 1240,
-	1207, 1240, 1208,
-	1208, 1240, 1241,
-	1208, 1241, 1209,
-	1209, 1241, 1242,
-	1209, 1242, 1210,
-	1210, 1242, 1243,
-	1210, 1243, 1211,
-	1211, 1243, 1244,
-	1211, 1244, 1212,
-	1212, 1244, 1245,
-	1212, 1245, 1213,
-	1213, 1245, 1246,
-	1213, 1246, 1214,
-	1214, 1246, 1247,
-	1214, 1247, 1215,
-	1215, 1247, 1248,
-	1215, 1248, 1216,
-	1216, 1248, 1249,
-	1216, 1249, 1217,
-	1217, 1249, 1250,
-	1217, 1250, 1218,
-	1218, 1250, 1251,
-	1218, 1251, 1219,
-	1219, 1251, 1252,
-	1219, 1252, 1220,
-	1220, 1252, 1253,
-
-	1221, 1254, 1222,
-	1222, 1254, 1255,
-	1222, 1255, 1223,
-	1223, 1255, 1256,
-	1223, 1256, 1224,
-	1224, 1256, 1257,
-	1224, 1257, 1225,
-	1225, 1257, 1258,
-	1225, 1258, 1226,
-	1226, 1258, 1259,
-	1226, 1259, 1227,
-	1227, 1259, 1260,
-	1227, 1260, 1228,
-	1228, 1260, 1261,
-	1228, 1261, 1229,
-	1229, 1261, 1262,
-	1229, 1262, 1230,
-	1230, 1262, 1263,
-	1230, 1263, 1231,
-	1231, 1263, 1264,
-	1231, 1264, 1232,
-	1232, 1264, 1265,
-	1232, 1265, 1233,
-	1233, 1265, 1266,
-	1233, 1266, 1234,
-	1234, 1266, 1267,
-	1234, 1267, 1235,
-	1235, 1267, 1268,
-	1235, 1268, 1236,
-	1236, 1268, 1269,
-	1236, 1269, 1237,
-	1237, 1269, 1270,
-	1237, 1270, 1238,
-	1238, 1270, 1271,
-	1238, 1271, 1239,
-	1239, 1271, 1272,
-	1239, 1272, 1240,
-	1240, 1272, 1273,
-	1240, 1273, 1241,
-	1241, 1273, 1274,
-	1241, 1274, 1242,
-	1242, 1274, 1275,
-	1242, 1275, 1243,
-	1243, 1275, 1276,
-	1243, 1276, 1244,
-	1244, 1276, 1277,
-	1244, 1277, 1245,
-	1245, 1277, 1278,
-	1245, 1278, 1246,
-	1246, 1278, 1279,
-	1246, 1279, 1247,
-	1247, 1279, 1280,
-	1247, 1280, 1248,
-	1248, 1280, 1281,
-	1248, 1281, 1249,
-	1249, 1281, 1282,
-	1249, 1282, 1250,
-	1250, 1282, 1283,
-	1250, 1283, 1251,
-	1251, 1283, 1284,
-	1251, 1284, 1252,
-	1252, 1284, 1285,
-	1252, 1285, 1253,
-	1253, 1285, 1286,
-
-	1254, 1287, 1255,
-	1255, 1287, 1288,
-	1255, 1288, 1256,
-	1256, 1288, 1289,
-	1256, 1289, 1257,
-	1257, 1289, 1290,
-	1257, 1290, 1258,
-	1258, 1290, 1291,
-	1258, 1291, 1259,
-	1259, 1291, 1292,
-	1259, 1292, 1260,
-	1260, 1292, 1293,
-	1260, 1293, 1261,
-	1261, 1293, 1294,
-	1261, 1294, 1262,
-	1262, 1294, 1295,
-	1262, 1295, 1263,
-	1263, 1295, 1296,
-	1263, 1296, 1264,
-	1264, 1296, 1297,
-	1264, 1297, 1265,
-	1265, 1297, 1298,
-	1265, 1298, 1266,
-	1266, 1298, 1299,
-	1266, 1299, 1267,
-	1267, 1299, 1300,
-	1267, 1300, 1268,
-	1268, 1300, 1301,
-	1268, 1301, 1269,
-	1269, 1301, 1302,
-	1269, 1302, 1270,
-	1270, 1302, 1303,
-	1270, 1303, 1271,
-	1271, 1303, 1304,
-	1271, 1304, 1272,
-	1272, 1304, 1305,
-	1272, 1305, 1273,
-	1273, 1305, 1306,
-	1273, 1306, 1274,
-	1274, 1306, 1307,
-	1274, 1307, 1275,
-	1275, 1307, 1308,
-	1275, 1308, 1276,
-	1276, 1308, 1309,
-	1276, 1309, 1277,
-	1277, 1309, 1310,
-	1277, 1310, 1278,
-	1278, 1310, 1311,
-	1278, 1311, 1279,
-	1279, 1311, 1312,
-	1279, 1312, 1280,
-	1280, 1312, 1313,
-	1280, 1313, 1281,
-	1281, 1313, 1314,
-	1281, 1314, 1282,
-	1282, 1314, 1315,
-	1282, 1315, 1283,
-	1283, 1315, 1316,
-	1283, 1316, 1284,
-	1284, 1316, 1317,
-	1284, 1317, 1285,
-	1285, 1317, 1318,
-	1285, 1318, 1286,
-	1286, 1318, 1319,
-
-	1287, 1320, 1288,
-	1288, 1320, 1321,
-	1288, 1321, 1289,
-	1289, 1321, 1322,
-	1289, 1322, 1290,
-	1290, 1322, 1323,
-	1290, 1323, 1291,
-	1291, 1323, 1324,
-	1291, 1324, 1292,
-	1292, 1324, 1325,
-	1292, 1325, 1293,
-	1293, 1325, 1326,
-	1293, 1326, 1294,
-	1294, 1326, 1327,
-	1294, 1327, 1295,
-	1295, 1327, 1328,
-	1295, 1328, 1296,
-	1296, 1328, 1329,
-	1296, 1329, 1297,
-	1297, 1329, 1330,
-	1297, 1330, 1298,
-	1298, 1330, 1331,
-	1298, 1331, 1299,
-	1299, 1331, 1332,
-	1299, 1332, 1300,
-	1300, 1332, 1333,
-	1300, 1333, 1301,
-	1301, 1333, 1334,
-	1301, 1334, 1302,
-	1302, 1334, 1335,
-	1302, 1335, 1303,
-	1303, 1335, 1336,
-	1303, 1336, 1304,
-	1304, 1336, 1337,
-	1304, 1337, 1305,
-	1305, 1337, 1338,
-	1305, 1338, 1306,
-	1306, 1338, 1339,
-	1306, 1339, 1307,
-	1307, 1339, 1340,
-	1307, 1340, 1308,
-	1308, 1340, 1341,
-	1308, 1341, 1309,
-	1309, 1341, 1342,
-	1309, 1342, 1310,
-	1310, 1342, 1343,
-	1310, 1343, 1311,
-	1311, 1343, 1344,
-	1311, 1344, 1312,
-	1312, 1344, 1345,
-	1312, 1345, 1313,
-	1313, 1345, 1346,
-	1313, 1346, 1314,
-	1314, 1346, 1347,
-	1314, 1347, 1315,
-	1315, 1347, 1348,
-	1315, 1348, 1316,
-	1316, 1348, 1349,
-	1316, 1349, 1317,
-	1317, 1349, 1350,
-	1317, 1350, 1318,
-	1318, 1350, 1351,
-	1318, 1351, 1319,
-	1319, 1351, 1352,
-
-	1320, 1353, 1321,
-	1321, 1353, 1354,
-	1321, 1354, 1322,
-	1322, 1354, 1355,
-	1322, 1355, 1323,
-	1323, 1355, 1356,
-	1323, 1356, 1324,
-	1324, 1356, 1357,
-	1324, 1357, 1325,
-	1325, 1357, 1358,
-	1325, 1358, 1326,
-	1326, 1358, 1359,
-	1326, 1359, 1327,
-	1327, 1359, 1360,
-	1327, 1360, 1328,
-	1328, 1360, 1361,
-	1328, 1361, 1329,
-	1329, 1361, 1362,
-	1329, 1362, 1330,
-	1330, 1362, 1363,
-	1330, 1363, 1331,
-	1331, 1363, 1364,
-	1331, 1364, 1332,
-	1332, 1364, 1365,
-	1332, 1365, 1333,
-	1333, 1365, 1366,
-	1333, 1366, 1334,
-	1334, 1366, 1367,
-	1334, 1367, 1335,
-	1335, 1367, 1368,
-	1335, 1368, 1336,
-	1336, 1368, 1369,
-	1336, 1369, 1337,
-	1337, 1369, 1370,
-	1337, 1370, 1338,
-	1338, 1370, 1371,
-	1338, 1371, 1339,
-	1339, 1371, 1372,
-	1339, 1372, 1340,
-	1340, 1372, 1373,
-	1340, 1373, 1341,
-	1341, 1373, 1374,
-	1341, 1374, 1342,
-	1342, 1374, 1375,
-	1342, 1375, 1343,
-	1343, 1375, 1376,
-	1343, 1376, 1344,
-	1344, 1376, 1377,
-	1344, 1377, 1345,
-	1345, 1377, 1378,
-	1345, 1378, 1346,
-	1346, 1378, 1379,
-	1346, 1379, 1347,
-	1347, 1379, 1380,
-	1347, 1380, 1348,
-	1348, 1380, 1381,
-	1348, 1381, 1349,
-	1349, 1381, 1382,
-	1349, 1382, 1350,
-	1350, 1382, 1383,
-	1350, 1383, 1351,
-	1351, 1383, 1384,
-	1351, 1384, 1352,
-	1352, 1384, 1385,
-
-	1353, 1386, 1354,
-	1354, 1386, 1387,
-	1354, 1387, 1355,
-	1355, 1387, 1388,
-	1355, 1388, 1356,
-	1356, 1388, 1389,
-	1356, 1389, 1357,
-	1357, 1389, 1390,
-	1357, 1390, 1358,
-	1358, 1390, 1391,
-	1358, 1391, 1359,
-	1359, 1391, 1392,
-	1359, 1392, 1360,
-	1360, 1392, 1393,
-	1360, 1393, 1361,
-	1361, 1393, 1394,
-	1361, 1394, 1362,
-	1362, 1394, 1395,
-	1362, 1395, 1363,
-	1363, 1395, 1396,
-	1363, 1396, 1364,
-	1364, 1396, 1397,
-	1364, 1397, 1365,
-	1365, 1397, 1398,
-	1365, 1398, 1366,
-	1366, 1398, 1399,
-	1366, 1399, 1367,
-	1367, 1399, 1400,
-	1367, 1400, 1368,
-	1368, 1400, 1401,
-	1368, 1401, 1369,
-	1369, 1401, 1402,
-	1369, 1402, 1370,
-	1370, 1402, 1403,
-	1370, 1403, 1371,
-	1371, 1403, 1404,
-	1371, 1404, 1372,
-	1372, 1404, 1405,
-	1372, 1405, 1373,
-	1373, 1405, 1406,
-	1373, 1406, 1374,
-	1374, 1406, 1407,
-	1374, 1407, 1375,
-	1375, 1407, 1408,
-	1375, 1408, 1376,
-	1376, 1408, 1409,
-	1376, 1409, 1377,
-	1377, 1409, 1410,
-	1377, 1410, 1378,
-	1378, 1410, 1411,
-	1378, 1411, 1379,
-	1379, 1411, 1412,
-	1379, 1412, 1380,
-	1380, 1412, 1413,
-	1380, 1413, 1381,
-	1381, 1413, 1414,
-	1381, 1414, 1382,
-	1382, 1414, 1415,
-	1382, 1415, 1383,
-	1383, 1415, 1416,
-	1383, 1416, 1384,
-	1384, 1416, 1417,
-	1384, 1417, 1385,
-	1385, 1417, 1418,
-
-	1386, 1419, 1387,
-	1387, 1419, 1420,
-	1387, 1420, 1388,
-	1388, 1420, 1421,
-	1388, 1421, 1389,
-	1389, 1421, 1422,
-	1389, 1422, 1390,
-	1390, 1422, 1423,
-	1390, 1423, 1391,
-	1391, 1423, 1424,
-	1391, 1424, 1392,
-	1392, 1424, 1425,
-	1392, 1425, 1393,
-	1393, 1425, 1426,
-	1393, 1426, 1394,
-	1394, 1426, 1427,
-	1394, 1427, 1395,
-	1395, 1427, 1428,
-	1395, 1428, 1396,
-	1396, 1428, 1429,
-	1396, 1429, 1397,
-	1397, 1429, 1430,
-	1397, 1430, 1398,
-	1398, 1430, 1431,
-	1398, 1431, 1399,
-	1399, 1431, 1432,
-	1399, 1432, 1400,
-	1400, 1432, 1433,
-	1400, 1433, 1401,
-	1401, 1433, 1434,
-	1401, 1434, 1402,
-	1402, 1434, 1435,
-	1402, 1435, 1403,
-	1403, 1435, 1436,
-	1403, 1436, 1404,
-	1404, 1436, 1437,
-	1404, 1437, 1405,
-	1405, 1437, 1438,
-	1405, 1438, 1406,
-	1406, 1438, 1439,
-	1406, 1439, 1407,
-	1407, 1439, 1440,
-	1407, 1440, 1408,
-	1408, 1440, 1441,
-	1408, 1441, 1409,
-	1409, 1441, 1442,
-	1409, 1442, 1410,
-	1410, 1442, 1443,
-	1410, 1443, 1411,
-	1411, 1443, 1444,
-	1411, 1444, 1412,
-	1412, 1444, 1445,
-	1412, 1445, 1413,
-	1413, 1445, 1446,
-	1413, 1446, 1414,
-	1414, 1446, 1447,
-	1414, 1447, 1415,
-	1415, 1447, 1448,
-	1415, 1448, 1416,
-	1416, 1448, 1449,
-	1416, 1449, 1417,
-	1417, 1449, 1450,
-	1417, 1450, 1418,
-	1418, 1450, 1451,
-
-	1419, 1452, 1420,
-	1420, 1452, 1453,
-	1420, 1453, 1421,
-	1421, 1453, 1454,
-	1421, 1454, 1422,
-	1422, 1454, 1455,
-	1422, 1455, 1423,
-	1423, 1455, 1456,
-	1423, 1456, 1424,
-	1424, 1456, 1457,
-	1424, 1457, 1425,
-	1425, 1457, 1458,
-	1425, 1458, 1426,
-	1426, 1458, 1459,
-	1426, 1459, 1427,
-	1427, 1459, 1460,
-	1427, 1460, 1428,
-	1428, 1460, 1461,
-	1428, 1461, 1429,
-	1429, 1461, 1462,
-	1429, 1462, 1430,
-	1430, 1462, 1463,
-	1430, 1463, 1431,
-	1431, 1463, 1464,
-	1431, 1464, 1432,
-	1432, 1464, 1465,
-	1432, 1465, 1433,
-	1433, 1465, 1466,
-	1433, 1466, 1434,
-	1434, 1466, 1467,
-	1434, 1467, 1435,
-	1435, 1467, 1468,
-	1435, 1468, 1436,
-	1436, 1468, 1469,
-	1436, 1469, 1437,
-	1437, 1469, 1470,
-	1437, 1470, 1438,
-	1438, 1470, 1471,
-	1438, 1471, 1439,
-	1439, 1471, 1472,
-	1439, 1472, 1440,
-	1440, 1472, 1473,
-	1440, 1473, 1441,
-	1441, 1473, 1474,
-	1441, 1474, 1442,
-	1442, 1474, 1475,
-	1442, 1475, 1443,
-	1443, 1475, 1476,
-	1443, 1476, 1444,
-	1444, 1476, 1477,
-	1444, 1477, 1445,
-	1445, 1477, 1478,
-	1445, 1478, 1446,
-	1446, 1478, 1479,
-	1446, 1479, 1447,
-	1447, 1479, 1480,
-	1447, 1480, 1448,
-	1448, 1480, 1481,
-	1448, 1481, 1449,
-	1449, 1481, 1482,
-	1449, 1482, 1450,
-	1450, 1482, 1483,
-	1450, 1483, 1451,
-	1451, 1483, 1484,
-
-	1452, 1485, 1453,
-	1453, 1485, 1486,
-	1453, 1486, 1454,
-	1454, 1486, 1487,
-	1454, 1487, 1455,
-	1455, 1487, 1488,
-	1455, 1488, 1456,
-	1456, 1488, 1489,
-	1456, 1489, 1457,
-	1457, 1489, 1490,
-	1457, 1490, 1458,
-	1458, 1490, 1491,
-	1458, 1491, 1459,
-	1459, 1491, 1492,
-	1459, 1492, 1460,
-	1460, 1492, 1493,
-	1460, 1493, 1461,
-	1461, 1493, 1494,
-	1461, 1494, 1462,
-	1462, 1494, 1495,
-	1462, 1495, 1463,
-	1463, 1495, 1496,
-	1463, 1496, 1464,
-	1464, 1496, 1497,
-	1464, 1497, 1465,
-	1465, 1497, 1498,
-	1465, 1498, 1466,
-	1466, 1498, 1499,
-	1466, 1499, 1467,
-	1467, 1499, 1500,
-	1467, 1500, 1468,
-	1468, 1500, 1501,
-	1468, 1501, 1469,
-	1469, 1501, 1502,
-	1469, 1502, 1470,
-	1470, 1502, 1503,
-	1470, 1503, 1471,
-	1471, 1503, 1504,
-	1471, 1504, 1472,
-	1472, 1504, 1505,
-	1472, 1505, 1473,
-	1473, 1505, 1506,
-	1473, 1506, 1474,
-	1474, 1506, 1507,
-	1474, 1507, 1475,
-	1475, 1507, 1508,
-	1475, 1508, 1476,
-	1476, 1508, 1509,
-	1476, 1509, 1477,
-	1477, 1509, 1510,
-	1477, 1510, 1478,
-	1478, 1510, 1511,
-	1478, 1511, 1479,
-	1479, 1511, 1512,
-	1479, 1512, 1480,
-	1480, 1512, 1513,
-	1480, 1513, 1481,
-	1481, 1513, 1514,
-	1481, 1514, 1482,
-	1482, 1514, 1515,
-	1482, 1515, 1483,
-	1483, 1515, 1516,
-	1483, 1516, 1484,
-	1484, 1516, 1517,
-
-	1485, 1518, 1486,
-	1486, 1518, 1519,
-	1486, 1519, 1487,
-	1487, 1519, 1520,
-	1487, 1520, 1488,
-	1488, 1520, 1521,
-	1488, 1521, 1489,
-	1489, 1521, 1522,
-	1489, 1522, 1490,
-	1490, 1522, 1523,
-	1490, 1523, 1491,
-	1491, 1523, 1524,
-	1491, 1524, 1492,
-	1492, 1524, 1525,
-	1492, 1525, 1493,
-	1493, 1525, 1526,
-	1493, 1526, 1494,
-	1494, 1526, 1527,
-	1494, 1527, 1495,
-	1495, 1527, 1528,
-	1495, 1528, 1496,
-	1496, 1528, 1529,
-	1496, 1529, 1497,
-	1497, 1529, 1530,
-	1497, 1530, 1498,
-	1498, 1530, 1531,
-	1498, 1531, 1499,
-	1499, 1531, 1532,
-	1499, 1532, 1500,
-	1500, 1532, 1533,
-	1500, 1533, 1501,
-	1501, 1533, 1534,
-	1501, 1534, 1502,
-	1502, 1534, 1535,
-	1502, 1535, 1503,
-	1503, 1535, 1536,
-	1503, 1536, 1504,
-	1504, 1536, 1537,
-	1504, 1537, 1505,
-	1505, 1537, 1538,
-	1505, 1538, 1506,
-	1506, 1538, 1539,
-	1506, 1539, 1507,
-	1507, 1539, 1540,
-	1507, 1540, 1508,
-	1508, 1540, 1541,
-	1508, 1541, 1509,
-	1509, 1541, 1542,
-	1509, 1542, 1510,
-	1510, 1542, 1543,
-	1510, 1543, 1511,
-	1511, 1543, 1544,
-	1511, 1544, 1512,
-	1512, 1544, 1545,
-	1512, 1545, 1513,
-	1513, 1545, 1546,
-	1513, 1546, 1514,
-	1514, 1546, 1547,
-	1514, 1547, 1515,
-	1515, 1547, 1548,
-	1515, 1548, 1516,
-	1516, 1548, 1549,
-	1516, 1549, 1517,
-	1517, 1549, 1550,
-
-	1518, 1551, 1519,
-	1519, 1551, 1552,
-	1519, 1552, 1520,
-	1520, 1552, 1553,
-	1520, 1553, 1521,
-	1521, 1553, 1554,
-	1521, 1554, 1522,
-	1522, 1554, 1555,
-	1522, 1555, 1523,
-	1523, 1555, 1556,
-	1523, 1556, 1524,
-	1524, 1556, 1557,
-	1524, 1557, 1525,
-	1525, 1557, 1558,
-	1525, 1558, 1526,
-	1526, 1558, 1559,
-	1526, 1559, 1527,
-	1527, 1559, 1560,
-	1527, 1560, 1528,
-	1528, 1560, 1561,
-	1528, 1561, 1529,
-	1529, 1561, 1562,
-	1529, 1562, 1530,
-	1530, 1562, 1563,
-	1530, 1563, 1531,
-	1531, 1563, 1564,
-	1531, 1564, 1532,
-	1532, 1564, 1565,
-	1532, 1565, 1533,
-	1533, 1565, 1566,
-	1533, 1566, 1534,
-	1534, 1566, 1567,
-	1534, 1567, 1535,
-	1535, 1567, 1568,
-	1535, 1568, 1536,
-	1536, 1568, 1569,
-	1536, 1569, 1537,
-	1537, 1569, 1570,
-	1537, 1570, 1538,
-	1538, 1570, 1571,
-	1538, 1571, 1539,
-	1539, 1571, 1572,
-	1539, 1572, 1540,
-	1540, 1572, 1573,
-	1540, 1573, 1541,
-	1541, 1573, 1574,
-	1541, 1574, 1542,
-	1542, 1574, 1575,
-	1542, 1575, 1543,
-	1543, 1575, 1576,
-	1543, 1576, 1544,
-	1544, 1576, 1577,
-	1544, 1577, 1545,
-	1545, 1577, 1578,
-	1545, 1578, 1546,
-	1546, 1578, 1579,
-	1546, 1579, 1547,
-	1547, 1579, 1580,
-	1547, 1580, 1548,
-	1548, 1580, 1581,
-	1548, 1581, 1549,
-	1549, 1581, 1582,
-	1549, 1582, 1550,
-	1550, 1582, 1583,
-
-	1551, 1584, 1552,
-	1552, 1584, 1585,
-	1552, 1585, 1553,
-	1553, 1585, 1586,
-	1553, 1586, 1554,
-	1554, 1586, 1587,
-	1554, 1587, 1555,
-	1555, 1587, 1588,
-	1555, 1588, 1556,
-	1556, 1588, 1589,
-	1556, 1589, 1557,
-	1557, 1589, 1590,
-	1557, 1590, 1558,
-	1558, 1590, 1591,
-	1558, 1591, 1559,
-	1559, 1591, 1592,
-	1559, 1592, 1560,
-	1560, 1592, 1593,
-	1560, 1593, 1561,
-	1561, 1593, 1594,
-	1561, 1594, 1562,
-	1562, 1594, 1595,
-	1562, 1595, 1563,
-	1563, 1595, 1596,
-	1563, 1596, 1564,
-	1564, 1596, 1597,
-	1564, 1597, 1565,
-	1565, 1597, 1598,
-	1565, 1598, 1566,
-	1566, 1598, 1599,
-	1566, 1599, 1567,
-	1567, 1599, 1600,
-	1567, 1600, 1568,
-	1568, 1600, 1601,
-	1568, 1601, 1569,
-	1569, 1601, 1602,
-	1569, 1602, 1570,
-	1570, 1602, 1603,
-	1570, 1603, 1571,
-	1571, 1603, 1604,
-	1571, 1604, 1572,
-	1572, 1604, 1605,
-	1572, 1605, 1573,
-	1573, 1605, 1606,
-	1573, 1606, 1574,
-	1574, 1606, 1607,
-	1574, 1607, 1575,
-	1575, 1607, 1608,
-	1575, 1608, 1576,
-	1576, 1608, 1609,
-	1576, 1609, 1577,
-	1577, 1609, 1610,
-	1577, 1610, 1578,
-	1578, 1610, 1611,
-	1578, 1611, 1579,
-	1579, 1611, 1612,
-	1579, 1612, 1580,
-	1580, 1612, 1613,
-	1580, 1613, 1581,
-	1581, 1613, 1614,
-	1581, 1614, 1582,
-	1582, 1614, 1615,
-	1582, 1615, 1583,
-	1583, 1615, 1616,
-
-	1584, 1617, 1585,
-	1585, 1617, 1618,
-	1585, 1618, 1586,
-	1586, 1618, 1619,
-	1586, 1619, 1587,
-	1587, 1619, 1620,
-	1587, 1620, 1588,
-	1588, 1620, 1621,
-	1588, 1621, 1589,
-	1589, 1621, 1622,
-	1589, 1622, 1590,
-	1590, 1622, 1623,
-	1590, 1623, 1591,
-	1591, 1623, 1624,
-	1591, 1624, 1592,
-	1592, 1624, 1625,
-	1592, 1625, 1593,
-	1593, 1625, 1626,
-	1593, 1626, 1594,
-	1594, 1626, 1627,
-	1594, 1627, 1595,
-	1595, 1627, 1628,
-	1595, 1628, 1596,
-	1596, 1628, 1629,
-	1596, 1629, 1597,
-	1597, 1629, 1630,
-	1597, 1630, 1598,
-	1598, 1630, 1631,
-	1598, 1631, 1599,
-	1599, 1631, 1632,
-	1599, 1632, 1600,
-	1600, 1632, 1633,
-	1600, 1633, 1601,
-	1601, 1633, 1634,
-	1601, 1634, 1602,
-	1602, 1634, 1635,
-	1602, 1635, 1603,
-	1603, 1635, 1636,
-	1603, 1636, 1604,
-	1604, 1636, 1637,
-	1604, 1637, 1605,
-	1605, 1637, 1638,
-	1605, 1638, 1606,
-	1606, 1638, 1639,
-	1606, 1639, 1607,
-	1607, 1639, 1640,
-	1607, 1640, 1608,
-	1608, 1640, 1641,
-	1608, 1641, 1609,
-	1609, 1641, 1642,
-	1609, 1642, 1610,
-	1610, 1642, 1643,
-	1610, 1643, 1611,
-	1611, 1643, 1644,
-	1611, 1644, 1612,
-	1612, 1644, 1645,
-	1612, 1645, 1613,
-	1613, 1645, 1646,
-	1613, 1646, 1614,
-	1614, 1646, 1647,
-	1614, 1647, 1615,
-	1615, 1647, 1648,
-	1615, 1648, 1616,
-	1616, 1648, 1649,
-
-	1617, 1650, 1618,
-	1618, 1650, 1651,
-	1618, 1651, 1619,
-	1619, 1651, 1652,
-	1619, 1652, 1620,
-	1620, 1652, 1653,
-	1620, 1653, 1621,
-	1621, 1653, 1654,
-	1621, 1654, 1622,
-	1622, 1654, 1655,
-	1622, 1655, 1623,
-	1623, 1655, 1656,
-	1623, 1656, 1624,
-	1624, 1656, 1657,
-	1624, 1657, 1625,
-	1625, 1657, 1658,
-	1625, 1658, 1626,
-	1626, 1658, 1659,
-	1626, 1659, 1627,
-	1627, 1659, 1660,
-	1627, 1660, 1628,
-	1628, 1660, 1661,
-	1628, 1661, 1629,
-	1629, 1661, 1662,
-	1629, 1662, 1630,
-	1630, 1662, 1663,
-	1630, 1663, 1631,
-	1631, 1663, 1664,
-	1631, 1664, 1632,
-	1632, 1664, 1665,
-	1632, 1665, 1633,
-	1633, 1665, 1666,
-	1633, 1666, 1634,
-	1634, 1666, 1667,
-	1634, 1667, 1635,
-	1635, 1667, 1668,
-	1635, 1668, 1636,
-	1636, 1668, 1669,
-	1636, 1669, 1637,
-	1637, 1669, 1670,
-	1637, 1670, 1638,
-	1638, 1670, 1671,
-	1638, 1671, 1639,
-	1639, 1671, 1672,
-	1639, 1672, 1640,
-	1640, 1672, 1673,
-	1640, 1673, 1641,
-	1641, 1673, 1674,
-	1641, 1674, 1642,
-	1642, 1674, 1675,
-	1642, 1675, 1643,
-	1643, 1675, 1676,
-	1643, 1676, 1644,
-	1644, 1676, 1677,
-	1644, 1677, 1645,
-	1645, 1677, 1678,
-	1645, 1678, 1646,
-	1646, 1678, 1679,
-	1646, 1679, 1647,
-	1647, 1679, 1680,
-	1647, 1680, 1648,
-	1648, 1680, 1681,
-	1648, 1681, 1649,
-	1649, 1681, 1682,
-
-	1650, 1683, 1651,
-	1651, 1683, 1684,
-	1651, 1684, 1652,
-	1652, 1684, 1685,
-	1652, 1685, 1653,
-	1653, 1685, 1686,
-	1653, 1686, 1654,
-	1654, 1686, 1687,
-	1654, 1687, 1655,
-	1655, 1687, 1688,
-	1655, 1688, 1656,
-	1656, 1688, 1689,
-	1656, 1689, 1657,
-	1657, 1689, 1690,
-	1657, 1690, 1658,
-	1658, 1690, 1691,
-	1658, 1691, 1659,
-	1659, 1691, 1692,
-	1659, 1692, 1660,
-	1660, 1692, 1693,
-	1660, 1693, 1661,
-	1661, 1693, 1694,
-	1661, 1694, 1662,
-	1662, 1694, 1695,
-	1662, 1695, 1663,
-	1663, 1695, 1696,
-	1663, 1696, 1664,
-	1664, 1696, 1697,
-	1664, 1697, 1665,
-	1665, 1697, 1698,
-	1665, 1698, 1666,
-	1666, 1698, 1699,
-	1666, 1699, 1667,
-	1667, 1699, 1700,
-	1667, 1700, 1668,
-	1668, 1700, 1701,
-	1668, 1701, 1669,
-	1669, 1701, 1702,
-	1669, 1702, 1670,
-	1670, 1702, 1703,
-	1670, 1703, 1671,
-	1671, 1703, 1704,
-	1671, 1704, 1672,
-	1672, 1704, 1705,
-	1672, 1705, 1673,
-	1673, 1705, 1706,
-	1673, 1706, 1674,
-	1674, 1706, 1707,
-	1674, 1707, 1675,
-	1675, 1707, 1708,
-	1675, 1708, 1676,
-	1676, 1708, 1709,
-	1676, 1709, 1677,
-	1677, 1709, 1710,
-	1677, 1710, 1678,
-	1678, 1710, 1711,
-	1678, 1711, 1679,
-	1679, 1711, 1712,
-	1679, 1712, 1680,
-	1680, 1712, 1713,
-	1680, 1713, 1681,
-	1681, 1713, 1714,
-	1681, 1714, 1682,
-	1682, 1714, 1715,
-
-	1683, 1716, 1684,
-	1684, 1716, 1717,
-	1684, 1717, 1685,
-	1685, 1717, 1718,
-	1685, 1718, 1686,
-	1686, 1718, 1719,
-	1686, 1719, 1687,
-	1687, 1719, 1720,
-	1687, 1720, 1688,
-	1688, 1720, 1721,
-	1688, 1721, 1689,
-	1689, 1721, 1722,
-	1689, 1722, 1690,
-	1690, 1722, 1723,
-	1690, 1723, 1691,
-	1691, 1723, 1724,
-	1691, 1724, 1692,
-	1692, 1724, 1725,
-	1692, 1725, 1693,
-	1693, 1725, 1726,
-	1693, 1726, 1694,
-	1694, 1726, 1727,
-	1694, 1727, 1695,
-	1695, 1727, 1728,
-	1695, 1728, 1696,
-	1696, 1728, 1729,
-	1696, 1729, 1697,
-	1697, 1729, 1730,
-	1697, 1730, 1698,
-	1698, 1730, 1731,
-	1698, 1731, 1699,
-	1699, 1731, 1732,
-	1699, 1732, 1700,
-	1700, 1732, 1733,
-	1700, 1733, 1701,
-	1701, 1733, 1734,
-	1701, 1734, 1702,
-	1702, 1734, 1735,
-	1702, 1735, 1703,
-	1703, 1735, 1736,
-	1703, 1736, 1704,
-	1704, 1736, 1737,
-	1704, 1737, 1705,
-	1705, 1737, 1738,
-	1705, 1738, 1706,
-	1706, 1738, 1739,
-	1706, 1739, 1707,
-	1707, 1739, 1740,
-	1707, 1740, 1708,
-	1708, 1740, 1741,
-	1708, 1741, 1709,
-	1709, 1741, 1742,
-	1709, 1742, 1710,
-	1710, 1742, 1743,
-	1710, 1743, 1711,
-	1711, 1743, 1744,
-	1711, 1744, 1712,
-	1712, 1744, 1745,
-	1712, 1745, 1713,
-	1713, 1745, 1746,
-	1713, 1746, 1714,
-	1714, 1746, 1747,
-	1714, 1747, 1715,
-	1715, 1747, 1748,
-
-	1716, 1749, 1717,
-	1717, 1749, 1750,
-	1717, 1750, 1718,
-	1718, 1750, 1751,
-	1718, 1751, 1719,
-	1719, 1751, 1752,
-	1719, 1752, 1720,
-	1720, 1752, 1753,
-	1720, 1753, 1721,
-	1721, 1753, 1754,
-	1721, 1754, 1722,
-	1722, 1754, 1755,
-	1722, 1755, 1723,
-	1723, 1755, 1756,
-	1723, 1756, 1724,
-	1724, 1756, 1757,
-	1724, 1757, 1725,
-	1725, 1757, 1758,
-	1725, 1758, 1726,
-	1726, 1758, 1759,
-	1726, 1759, 1727,
-	1727, 1759, 1760,
-	1727, 1760, 1728,
-	1728, 1760, 1761,
-	1728, 1761, 1729,
-	1729, 1761, 1762,
-	1729, 1762, 1730,
-	1730, 1762, 1763,
-	1730, 1763, 1731,
-	1731, 1763, 1764,
-	1731, 1764, 1732,
-	1732, 1764, 1765,
-	1732, 1765, 1733,
-	1733, 1765, 1766,
-	1733, 1766, 1734,
-	1734, 1766, 1767,
-	1734, 1767, 1735,
-	1735, 1767, 1768,
-	1735, 1768, 1736,
-	1736, 1768, 1769,
-	1736, 1769, 1737,
-	1737, 1769, 1770,
-	1737, 1770, 1738,
-	1738, 1770, 1771,
-	1738, 1771, 1739,
-	1739, 1771, 1772,
-	1739, 1772, 1740,
-	1740, 1772, 1773,
-	1740, 1773, 1741,
-	1741, 1773, 1774,
-	1741, 1774, 1742,
-	1742, 1774, 1775,
-	1742, 1775, 1743,
-	1743, 1775, 1776,
-	1743, 1776, 1744,
-	1744, 1776, 1777,
-	1744, 1777, 1745,
-	1745, 1777, 1778,
-	1745, 1778, 1746,
-	1746, 1778, 1779,
-	1746, 1779, 1747,
-	1747, 1779, 1780,
-	1747, 1780, 1748,
-	1748, 1780, 1781,
-
-	1749, 1782, 1750,
-	1750, 1782, 1783,
-	1750, 1783, 1751,
-	1751, 1783, 1784,
-	1751, 1784, 1752,
-	1752, 1784, 1785,
-	1752, 1785, 1753,
-	1753, 1785, 1786,
-	1753, 1786, 1754,
-	1754, 1786, 1787,
-	1754, 1787, 1755,
-	1755, 1787, 1788,
-	1755, 1788, 1756,
-	1756, 1788, 1789,
-	1756, 1789, 1757,
-	1757, 1789, 1790,
-	1757, 1790, 1758,
-	1758, 1790, 1791,
-	1758, 1791, 1759,
-	1759, 1791, 1792,
-	1759, 1792, 1760,
-	1760, 1792, 1793,
-	1760, 1793, 1761,
-	1761, 1793, 1794,
-	1761, 1794, 1762,
-	1762, 1794, 1795,
-	1762, 1795, 1763,
-	1763, 1795, 1796,
-	1763, 1796, 1764,
-	1764, 1796, 1797,
-	1764, 1797, 1765,
-	1765, 1797, 1798,
-	1765, 1798, 1766,
-	1766, 1798, 1799,
-	1766, 1799, 1767,
-	1767, 1799, 1800,
-	1767, 1800, 1768,
-	1768, 1800, 1801,
-	1768, 1801, 1769,
-	1769, 1801, 1802,
-	1769, 1802, 1770,
-	1770, 1802, 1803,
-	1770, 1803, 1771,
-	1771, 1803, 1804,
-	1771, 1804, 1772,
-	1772, 1804, 1805,
-	1772, 1805, 1773,
-	1773, 1805, 1806,
-	1773, 1806, 1774,
-	1774, 1806, 1807,
-	1774, 1807, 1775,
-	1775, 1807, 1808,
-	1775, 1808, 1776,
-	1776, 1808, 1809,
-	1776, 1809, 1777,
-	1777, 1809, 1810,
-	1777, 1810, 1778,
-	1778, 1810, 1811,
-	1778, 1811, 1779,
-	1779, 1811, 1812,
-	1779, 1812, 1780,
-	1780, 1812, 1813,
-	1780, 1813, 1781,
-	1781, 1813, 1814,
-
-	1782, 1815, 1783,
-	1783, 1815, 1816,
-	1783, 1816, 1784,
-	1784, 1816, 1817,
-	1784, 1817, 1785,
-	1785, 1817, 1818,
-	1785, 1818, 1786,
-	1786, 1818, 1819,
-	1786, 1819, 1787,
-	1787, 1819, 1820,
-	1787, 1820, 1788,
-	1788, 1820, 1821,
-	1788, 1821, 1789,
-	1789, 1821, 1822,
-	1789, 1822, 1790,
-	1790, 1822, 1823,
-	1790, 1823, 1791,
-	1791, 1823, 1824,
-	1791, 1824, 1792,
-	1792, 1824, 1825,
-	1792, 1825, 1793,
-	1793, 1825, 1826,
-	1793, 1826, 1794,
-	1794, 1826, 1827,
-	1794, 1827, 1795,
-	1795, 1827, 1828,
-	1795, 1828, 1796,
-	1796, 1828, 1829,
-	1796, 1829, 1797,
-	1797, 1829, 1830,
-	1797, 1830, 1798,
-	1798, 1830, 1831,
-	1798, 1831, 1799,
-	1799, 1831, 1832,
-	1799, 1832, 1800,
-	1800, 1832, 1833,
-	1800, 1833, 1801,
-	1801, 1833, 1834,
-	1801, 1834, 1802,
-	1802, 1834, 1835,
-	1802, 1835, 1803,
-	1803, 1835, 1836,
-	1803, 1836, 1804,
-	1804, 1836, 1837,
-	1804, 1837, 1805,
-	1805, 1837, 1838,
-	1805, 1838, 1806,
-	1806, 1838, 1839,
-	1806, 1839, 1807,
-	1807, 1839, 1840,
-	1807, 1840, 1808,
-	1808, 1840, 1841,
-	1808, 1841, 1809,
-	1809, 1841, 1842,
-	1809, 1842, 1810,
-	1810, 1842, 1843,
-	1810, 1843, 1811,
-	1811, 1843, 1844,
-	1811, 1844, 1812,
-	1812, 1844, 1845,
-	1812, 1845, 1813,
-	1813, 1845, 1846,
-	1813, 1846, 1814,
-	1814, 1846, 1847,
-
-	1815, 1848, 1816,
-	1816, 1848, 1849,
-	1816, 1849, 1817,
-	1817, 1849, 1850,
-	1817, 1850, 1818,
-	1818, 1850, 1851,
-	1818, 1851, 1819,
-	1819, 1851, 1852,
-	1819, 1852, 1820,
-	1820, 1852, 1853,
-	1820, 1853, 1821,
-	1821, 1853, 1854,
-	1821, 1854, 1822,
-	1822, 1854, 1855,
-	1822, 1855, 1823,
-	1823, 1855, 1856,
-	1823, 1856, 1824,
-	1824, 1856, 1857,
-	1824, 1857, 1825,
-	1825, 1857, 1858,
-	1825, 1858, 1826,
-	1826, 1858, 1859,
-	1826, 1859, 1827,
-	1827, 1859, 1860,
-	1827, 1860, 1828,
-	1828, 1860, 1861,
-	1828, 1861, 1829,
-	1829, 1861, 1862,
-	1829, 1862, 1830,
-	1830, 1862, 1863,
-	1830, 1863, 1831,
-	1831, 1863, 1864,
-	1831, 1864, 1832,
-	1832, 1864, 1865,
-	1832, 1865, 1833,
-	1833, 1865, 1866,
-	1833, 1866, 1834,
-	1834, 1866, 1867,
-	1834, 1867, 1835,
-	1835, 1867, 1868,
-	1835, 1868, 1836,
-	1836, 1868, 1869,
-	1836, 1869, 1837,
-	1837, 1869, 1870,
-	1837, 1870, 1838,
-	1838, 1870, 1871,
-	1838, 1871, 1839,
-	1839, 1871, 1872,
-	1839, 1872, 1840,
-	1840, 1872, 1873,
-	1840, 1873, 1841,
-	1841, 1873, 1874,
-	1841, 1874, 1842,
-	1842, 1874, 1875,
-	1842, 1875, 1843,
-	1843, 1875, 1876,
-	1843, 1876, 1844,
-	1844, 1876, 1877,
-	1844, 1877, 1845,
-	1845, 1877, 1878,
-	1845, 1878, 1846,
-	1846, 1878, 1879,
-	1846, 1879, 1847,
-	1847, 1879, 1880,
-
-	1848, 1881, 1849,
-	1849, 1881, 1882,
-	1849, 1882, 1850,
-	1850, 1882, 1883,
-	1850, 1883, 1851,
-	1851, 1883, 1884,
-	1851, 1884, 1852,
-	1852, 1884, 1885,
-	1852, 1885, 1853,
-	1853, 1885, 1886,
-	1853, 1886, 1854,
-	1854, 1886, 1887,
-	1854, 1887, 1855,
-	1855, 1887, 1888,
-	1855, 1888, 1856,
-	1856, 1888, 1889,
-	1856, 1889, 1857,
-	1857, 1889, 1890,
-	1857, 1890, 1858,
-	1858, 1890, 1891,
-	1858, 1891, 1859,
-	1859, 1891, 1892,
-	1859, 1892, 1860,
-	1860, 1892, 1893,
-	1860, 1893, 1861,
-	1861, 1893, 1894,
-	1861, 1894, 1862,
-	1862, 1894, 1895,
-	1862, 1895, 1863,
-	1863, 1895, 1896,
-	1863, 1896, 1864,
-	1864, 1896, 1897,
-	1864, 1897, 1865,
-	1865, 1897, 1898,
-	1865, 1898, 1866,
-	1866, 1898, 1899,
-	1866, 1899, 1867,
-	1867, 1899, 1900,
-	1867, 1900, 1868,
-	1868, 1900, 1901,
-	1868, 1901, 1869,
-	1869, 1901, 1902,
-	1869, 1902, 1870,
-	1870, 1902, 1903,
-	1870, 1903, 1871,
-	1871, 1903, 1904,
-	1871, 1904, 1872,
-	1872, 1904, 1905,
-	1872, 1905, 1873,
-	1873, 1905, 1906,
-	1873, 1906, 1874,
-	1874, 1906, 1907,
-	1874, 1907, 1875,
-	1875, 1907, 1908,
-	1875, 1908, 1876,
-	1876, 1908, 1909,
-	1876, 1909, 1877,
-	1877, 1909, 1910,
-	1877, 1910, 1878,
-	1878, 1910, 1911,
-	1878, 1911, 1879,
-	1879, 1911, 1912,
-	1879, 1912, 1880,
-	1880, 1912, 1913,
-
-	1881, 1914, 1882,
-	1882, 1914, 1915,
-	1882, 1915, 1883,
-	1883, 1915, 1916,
-	1883, 1916, 1884,
-	1884, 1916, 1917,
-	1884, 1917, 1885,
-	1885, 1917, 1918,
-	1885, 1918, 1886,
-	1886, 1918, 1919,
-	1886, 1919, 1887,
-	1887, 1919, 1920,
-	1887, 1920, 1888,
-	1888, 1920, 1921,
-	1888, 1921, 1889,
-	1889, 1921, 1922,
-	1889, 1922, 1890,
-	1890, 1922, 1923,
-	1890, 1923, 1891,
-	1891, 1923, 1924,
-	1891, 1924, 1892,
-	1892, 1924, 1925,
-	1892, 1925, 1893,
-	1893, 1925, 1926,
-	1893, 1926, 1894,
-	1894, 1926, 1927,
-	1894, 1927, 1895,
-	1895, 1927, 1928,
-	1895, 1928, 1896,
-	1896, 1928, 1929,
-	1896, 1929, 1897,
-	1897, 1929, 1930,
-	1897, 1930, 1898,
-	1898, 1930, 1931,
-	1898, 1931, 1899,
-	1899, 1931, 1932,
-	1899, 1932, 1900,
-	1900, 1932, 1933,
-	1900, 1933, 1901,
-	1901, 1933, 1934,
-	1901, 1934, 1902,
-	1902, 1934, 1935,
-	1902, 1935, 1903,
-	1903, 1935, 1936,
-	1903, 1936, 1904,
-	1904, 1936, 1937,
-	1904, 1937, 1905,
-	1905, 1937, 1938,
-	1905, 1938, 1906,
-	1906, 1938, 1939,
-	1906, 1939, 1907,
-	1907, 1939, 1940,
-	1907, 1940, 1908,
-	1908, 1940, 1941,
-	1908, 1941, 1909,
-	1909, 1941, 1942,
-	1909, 1942, 1910,
-	1910, 1942, 1943,
-	1910, 1943, 1911,
-	1911, 1943, 1944,
-	1911, 1944, 1912,
-	1912, 1944, 1945,
-	1912, 1945, 1913,
-	1913, 1945, 1946,
-
-	1914, 1947, 1915,
-	1915, 1947, 1948,
-	1915, 1948, 1916,
-	1916, 1948, 1949,
-	1916, 1949, 1917,
-	1917, 1949, 1950,
-	1917, 1950, 1918,
-	1918, 1950, 1951,
-	1918, 1951, 1919,
-	1919, 1951, 1952,
-	1919, 1952, 1920,
-	1920, 1952, 1953,
-	1920, 1953, 1921,
-	1921, 1953, 1954,
-	1921, 1954, 1922,
-	1922, 1954, 1955,
-	1922, 1955, 1923,
-	1923, 1955, 1956,
-	1923, 1956, 1924,
-	1924, 1956, 1957,
-	1924, 1957, 1925,
-	1925, 1957, 1958,
-	1925, 1958, 1926,
-	1926, 1958, 1959,
-	1926, 1959, 1927,
-	1927, 1959, 1960,
-	1927, 1960, 1928,
-	1928, 1960, 1961,
-	1928, 1961, 1929,
-	1929, 1961, 1962,
-	1929, 1962, 1930,
-	1930, 1962, 1963,
-	1930, 1963, 1931,
-	1931, 1963, 1964,
-	1931, 1964, 1932,
-	1932, 1964, 1965,
-	1932, 1965, 1933,
-	1933, 1965, 1966,
-	1933, 1966, 1934,
-	1934, 1966, 1967,
-	1934, 1967, 1935,
-	1935, 1967, 1968,
-	1935, 1968, 1936,
-	1936, 1968, 1969,
-	1936, 1969, 1937,
-	1937, 1969, 1970,
-	1937, 1970, 1938,
-	1938, 1970, 1971,
-	1938, 1971, 1939,
-	1939, 1971, 1972,
-	1939, 1972, 1940,
-	1940, 1972, 1973,
-	1940, 1973, 1941,
-	1941, 1973, 1974,
-	1941, 1974, 1942,
-	1942, 1974, 1975,
-	1942, 1975, 1943,
-	1943, 1975, 1976,
-	1943, 1976, 1944,
-	1944, 1976, 1977,
-	1944, 1977, 1945,
-	1945, 1977, 1978,
-	1945, 1978, 1946,
-	1946, 1978, 1979,
-
-	1947, 1980, 1948,
-	1948, 1980, 1981,
-	1948, 1981, 1949,
-	1949, 1981, 1982,
-	1949, 1982, 1950,
-	1950, 1982, 1983,
-	1950, 1983, 1951,
-	1951, 1983, 1984,
-	1951, 1984, 1952,
-	1952, 1984, 1985,
-	1952, 1985, 1953,
-	1953, 1985, 1986,
-	1953, 1986, 1954,
-	1954, 1986, 1987,
-	1954, 1987, 1955,
-	1955, 1987, 1988,
-	1955, 1988, 1956,
-	1956, 1988, 1989,
-	1956, 1989, 1957,
-	1957, 1989, 1990,
-	1957, 1990, 1958,
-	1958, 1990, 1991,
-	1958, 1991, 1959,
-	1959, 1991, 1992,
-	1959, 1992, 1960,
-	1960, 1992, 1993,
-	1960, 1993, 1961,
-	1961, 1993, 1994,
-	1961, 1994, 1962,
-	1962, 1994, 1995,
-	1962, 1995, 1963,
-	1963, 1995, 1996,
-	1963, 1996, 1964,
-	1964, 1996, 1997,
-	1964, 1997, 1965,
-	1965, 1997, 1998,
-	1965, 1998, 1966,
-	1966, 1998, 1999,
-	1966, 1999, 1967,
-	1967, 1999, 2000,
-	1967, 2000, 1968,
-	1968, 2000, 2001,
-	1968, 2001, 1969,
-	1969, 2001, 2002,
-	1969, 2002, 1970,
-	1970, 2002, 2003,
-	1970, 2003, 1971,
-	1971, 2003, 2004,
-	1971, 2004, 1972,
-	1972, 2004, 2005,
-	1972, 2005, 1973,
-	1973, 2005, 2006,
-	1973, 2006, 1974,
-	1974, 2006, 2007,
-	1974, 2007, 1975,
-	1975, 2007, 2008,
-	1975, 2008, 1976,
-	1976, 2008, 2009,
-	1976, 2009, 1977,
-	1977, 2009, 2010,
-	1977, 2010, 1978,
-	1978, 2010, 2011,
-	1978, 2011, 1979,
-	1979, 2011, 2012,
-
-	1980, 2013, 1981,
-	1981, 2013, 2014,
-	1981, 2014, 1982,
-	1982, 2014, 2015,
-	1982, 2015, 1983,
-	1983, 2015, 2016,
-	1983, 2016, 1984,
-	1984, 2016, 2017,
-	1984, 2017, 1985,
-	1985, 2017, 2018,
-	1985, 2018, 1986,
-	1986, 2018, 2019,
-	1986, 2019, 1987,
-	1987, 2019, 2020,
-	1987, 2020, 1988,
-	1988, 2020, 2021,
-	1988, 2021, 1989,
-	1989, 2021, 2022,
-	1989, 2022, 1990,
-	1990, 2022, 2023,
-	1990, 2023, 1991,
-	1991, 2023, 2024,
-	1991, 2024, 1992,
-	1992, 2024, 2025,
-	1992, 2025, 1993,
-	1993, 2025, 2026,
-	1993, 2026, 1994,
-	1994, 2026, 2027,
-	1994, 2027, 1995,
-	1995, 2027, 2028,
-	1995, 2028, 1996,
-	1996, 2028, 2029,
-	1996, 2029, 1997,
-	1997, 2029, 2030,
-	1997, 2030, 1998,
-	1998, 2030, 2031,
-	1998, 2031, 1999,
-	1999, 2031, 2032,
-	1999, 2032, 2000,
-	2000, 2032, 2033,
-	2000, 2033, 2001,
-	2001, 2033, 2034,
-	2001, 2034, 2002,
-	2002, 2034, 2035,
-	2002, 2035, 2003,
-	2003, 2035, 2036,
-	2003, 2036, 2004,
-	2004, 2036, 2037,
-	2004, 2037, 2005,
-	2005, 2037, 2038,
-	2005, 2038, 2006,
-	2006, 2038, 2039,
-	2006, 2039, 2007,
-	2007, 2039, 2040,
-	2007, 2040, 2008,
-	2008, 2040, 2041,
-	2008, 2041, 2009,
-	2009, 2041, 2042,
-	2009, 2042, 2010,
-	2010, 2042, 2043,
-	2010, 2043, 2011,
-	2011, 2043, 2044,
-	2011, 2044, 2012,
-	2012, 2044, 2045,
-
-	2013, 2046, 2014,
-	2014, 2046, 2047,
-	2014, 2047, 2015,
-	2015, 2047, 2048,
-	2015, 2048, 2016,
-	2016, 2048, 2049,
-	2016, 2049, 2017,
-	2017, 2049, 2050,
-	2017, 2050, 2018,
-	2018, 2050, 2051,
-	2018, 2051, 2019,
-	2019, 2051, 2052,
-	2019, 2052, 2020,
-	2020, 2052, 2053,
-	2020, 2053, 2021,
-	2021, 2053, 2054,
-	2021, 2054, 2022,
-	2022, 2054, 2055,
-	2022, 2055, 2023,
-	2023, 2055, 2056,
-	2023, 2056, 2024,
-	2024, 2056, 2057,
-	2024, 2057, 2025,
-	2025, 2057, 2058,
-	2025, 2058, 2026,
-	2026, 2058, 2059,
-	2026, 2059, 2027,
-	2027, 2059, 2060,
-	2027, 2060, 2028,
-	2028, 2060, 2061,
-	2028, 2061, 2029,
-	2029, 2061, 2062,
-	2029, 2062, 2030,
-	2030, 2062, 2063,
-	2030, 2063, 2031,
-	2031, 2063, 2064,
-	2031, 2064, 2032,
-	2032, 2064, 2065,
-	2032, 2065, 2033,
-	2033, 2065, 2066,
-	2033, 2066, 2034,
-	2034, 2066, 2067,
-	2034, 2067, 2035,
-	2035, 2067, 2068,
-	2035, 2068, 2036,
-	2036, 2068, 2069,
-	2036, 2069, 2037,
-	2037, 2069, 2070,
-	2037, 2070, 2038,
-	2038, 2070, 2071,
-	2038, 2071, 2039,
-	2039, 2071, 2072,
-	2039, 2072, 2040,
-	2040, 2072, 2073,
-	2040, 2073, 2041,
-	2041, 2073, 2074,
-	2041, 2074, 2042,
-	2042, 2074, 2075,
-	2042, 2075, 2043,
-	2043, 2075, 2076,
-	2043, 2076, 2044,
-	2044, 2076, 2077,
-	2044, 2077, 2045,
-	2045, 2077, 2078,
-
-	2046, 2079, 2047,
-	2047, 2079, 2080,
-	2047, 2080, 2048,
-	2048, 2080, 2081,
-	2048, 2081, 2049,
-	2049, 2081, 2082,
-	2049, 2082, 2050,
-	2050, 2082, 2083,
-	2050, 2083, 2051,
-	2051, 2083, 2084,
-	2051, 2084, 2052,
-	2052, 2084, 2085,
-	2052, 2085, 2053,
-	2053, 2085, 2086,
-	2053, 2086, 2054,
-	2054, 2086, 2087,
-	2054, 2087, 2055,
-	2055, 2087, 2088,
-	2055, 2088, 2056,
-	2056, 2088, 2089,
-	2056, 2089, 2057,
-	2057, 2089, 2090,
-	2057, 2090, 2058,
-	2058, 2090, 2091,
-	2058, 2091, 2059,
-	2059, 2091, 2092,
-	2059, 2092, 2060,
-	2060, 2092, 2093,
-	2060, 2093, 2061,
-	2061, 2093, 2094,
-	2061, 2094, 2062,
-	2062, 2094, 2095,
-	2062, 2095, 2063,
-	2063, 2095, 2096,
-	2063, 2096, 2064,
-	2064, 2096, 2097,
-	2064, 2097, 2065,
-	2065, 2097, 2098,
-	2065, 2098, 2066,
-	2066, 2098, 2099,
-	2066, 2099, 2067,
-	2067, 2099, 2100,
-	2067, 2100, 2068,
-	2068, 2100, 2101,
-	2068, 2101, 2069,
-	2069, 2101, 2102,
-	2069, 2102, 2070,
-	2070, 2102, 2103,
-	2070, 2103, 2071,
-	2071, 2103, 2104,
-	2071, 2104, 2072,
-	2072, 2104, 2105,
-	2072, 2105, 2073,
-	2073, 2105, 2106,
-	2073, 2106, 2074,
-	2074, 2106, 2107,
-	2074, 2107, 2075,
-	2075, 2107, 2108,
-	2075, 2108, 2076,
-	2076, 2108, 2109,
-	2076, 2109, 2077,
-	2077, 2109, 2110,
-	2077, 2110, 2078,
-	2078, 2110, 2111,
-
-	2079, 2112, 2080,
-	2080, 2112, 2113,
-	2080, 2113, 2081,
-	2081, 2113, 2114,
-	2081, 2114, 2082,
-	2082, 2114, 2115,
-	2082, 2115, 2083,
-	2083, 2115, 2116,
-	2083, 2116, 2084,
-	2084, 2116, 2117,
-	2084, 2117, 2085,
-	2085, 2117, 2118,
-	2085, 2118, 2086,
-	2086, 2118, 2119,
-	2086, 2119, 2087,
-	2087, 2119, 2120,
-	2087, 2120, 2088,
-	2088, 2120, 2121,
-	2088, 2121, 2089,
-	2089, 2121, 2122,
-	2089, 2122, 2090,
-	2090, 2122, 2123,
-	2090, 2123, 2091,
-	2091, 2123, 2124,
-	2091, 2124, 2092,
-	2092, 2124, 2125,
-	2092, 2125, 2093,
-	2093, 2125, 2126,
-	2093, 2126, 2094,
-	2094, 2126, 2127,
-	2094, 2127, 2095,
-	2095, 2127, 2128,
-	2095, 2128, 2096,
-	2096, 2128, 2129,
-	2096, 2129, 2097,
-	2097, 2129, 2130,
-	2097, 2130, 2098,
-	2098, 2130, 2131,
-	2098, 2131, 2099,
-	2099, 2131, 2132,
-	2099, 2132, 2100,
-	2100, 2132, 2133,
-	2100, 2133, 2101,
-	2101, 2133, 2134,
-	2101, 2134, 2102,
-	2102, 2134, 2135,
-	2102, 2135, 2103,
-	2103, 2135, 2136,
-	2103, 2136, 2104,
-	2104, 2136, 2137,
-	2104, 2137, 2105,
-	2105, 2137, 2138,
-	2105, 2138, 2106,
-	2106, 2138, 2139,
-	2106, 2139, 2107,
-	2107, 2139, 2140,
-	2107, 2140, 2108,
-	2108, 2140, 2141,
-	2108, 2141, 2109,
-	2109, 2141, 2142,
-	2109, 2142, 2110,
-	2110, 2142, 2143,
-	2110, 2143, 2111,
-	2111, 2143, 2144
-};
@@ -1,41 +0,0 @@
-#define phy ((1.0 + sqrt(5.0)) / 2.0)
-#define a 0.5
-#define b (1.0 / (2.0 * phy))
-
-static vertex_t vertices[] = {
-	{{ 0,  b, -a}, { 0,  b, -a}, {0, 0}},
-	{{ b,  a,  0}, { b,  a,  0}, {0, 0}},
-	{{-b,  a,  0}, {-b,  a,  0}, {0, 0}},
-	{{ 0,  b,  a}, { 0,  b,  a}, {0, 0}},
-	{{ 0, -b,  a}, { 0, -b,  a}, {0, 0}},
-	{{-a,  0,  b}, {-a,  0,  b}, {0, 0}},
-	{{ 0, -b, -a}, { 0, -b, -a}, {0, 0}},
-	{{ a,  0, -b}, { a,  0, -b}, {0, 0}},
-	{{ a,  0,  b}, { a,  0,  b}, {0, 0}},
-	{{-a,  0, -b}, {-a,  0, -b}, {0, 0}},
-	{{ b, -a,  0}, { b, -a,  0}, {0, 0}},
-	{{-b, -a,  0}, {-b, -a,  0}, {0, 0}}
-};
-
-static GLuint indices[] = {
-	0, 1, 2,
-	3, 2, 1,
-	3, 4, 5,
-	3, 8, 4,
-	0, 6, 7,
-	0, 9, 6,
-	4, 10, 11,
-	6, 11, 10,
-	2, 5, 9,
-	11, 9, 5,
-	1, 7, 8,
-	10, 8, 7,
-	3, 5, 2,
-	3, 1, 8,
-	0, 2, 9,
-	0, 7, 1,
-	6, 9, 11,
-	6, 10, 7,
-	4, 11, 5,
-	4, 8, 10
-};
@@ -4,14 +4,11 @@
 #include <epoxy/gl.h>
 #include <shader_make.h>
 #include <glmath.h>
-
-typedef struct {
-	vec3 position;
-	vec3 normal;
-	vec2 texture;
-} vertex_t;
-
-#include "data.c"
+#include <mesh.h>
+#include <mesh_lod.h>
+#include <meshfile.h>
+#include <glbfile.h>
+#include <texture_cache.h>
 
 static GLuint vao;
 static GLuint vbo;
@@ -19,6 +16,15 @@ static GLuint ebo;
 static GLuint program;
 static GLuint texture;
 
+static GLenum mode;
+static GLenum type;
+static mat4 decode;
+
+static mesh_lod_t lods[MESH_LOD_MAX];
+static gsize lod_offsets[MESH_LOD_MAX];
+static GLuint lod_count;
+static GLuint lod;
+
 static vec3 cameraPos = { 0.0f, 0.0f, 5.0f };
 static vec3 cameraFront = { 0.0f, 0.0f, -1.0f };
 static vec3 cameraUp = { 0.0f, 1.0f, 0.0f };
@@ -35,6 +41,99 @@ static GLfloat lastFrame = 0.0f;	// Time of last frame
 GTimer *timer;
 static mat4 model;
 
+static gchar *gltf = NULL;
+
+static const GOptionEntry entries[] = {
+	{ "gltf", 'g', 0, G_OPTION_ARG_FILENAME, &gltf, "Draw the default scene of a glTF binary instead of the torus", "FILE" },
+	G_OPTION_ENTRY_NULL
+};
+
+/* the glTF scene stays mapped for its node and primitive tables, one vertex array per primitive */
+static glbfile_t *scene;
+static GLuint *buffers;
+static GLuint *vaos;
+static mat4 fit;
+
+static void scene_load(void)
+{
+	GError *error = NULL;
+
+	scene = glbfile_open(gltf, &error);
+	if (scene == NULL) {
+		g_error("Error loading scene: #%d %s\n", error->code, error->message);
+		g_error_free(error);
+	}
+
+	buffers = g_new(GLuint, MAX(scene->view_count, 1));
+	glGenBuffers(scene->view_count, buffers);
+	glbfile_upload(scene, buffers);
+
+	vaos = g_new(GLuint, MAX(scene->primitive_count, 1));
+	glGenVertexArrays(scene->primitive_count, vaos);
+	for (guint p = 0; p < scene->primitive_count; ++p) {
+		const glbfile_primitive_t *primitive = &scene->primitives[p];
+
+		glBindVertexArray(vaos[p]);
+		glbfile_attrib_pointer(scene, primitive, MESH_ATTRIB_POSITION, buffers, glGetAttribLocation(program, "vec_position"));
+		glbfile_attrib_pointer(scene, primitive, MESH_ATTRIB_NORMAL, buffers, glGetAttribLocation(program, "vec_normal"));
+		glbfile_attrib_pointer(scene, primitive, MESH_ATTRIB_TEXTURE, buffers, glGetAttribLocation(program, "tex_coord"));
+		glbfile_bind_indices(scene, primitive, buffers);
+	}
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	/* centre the scene and scale it to the size of the torus */
+	vec3 min = { G_MAXFLOAT, G_MAXFLOAT, G_MAXFLOAT };
+	vec3 max = { -G_MAXFLOAT, -G_MAXFLOAT, -G_MAXFLOAT };
+
+	for (guint n = 0; n < scene->node_count; ++n) {
+		const glbfile_node_t *node = &scene->nodes[n];
+
+		for (guint p = 0; node->mesh >= 0 && p < scene->meshes[node->mesh].count; ++p) {
+			const glbfile_primitive_t *primitive = &scene->primitives[scene->meshes[node->mesh].first + p];
+
+			for (guint corner = 0; corner < 8; ++corner) {
+				const vec4 local = {
+					corner & 1 ? primitive->max.x : primitive->min.x,
+					corner & 2 ? primitive->max.y : primitive->min.y,
+					corner & 4 ? primitive->max.z : primitive->min.z,
+					1.0f
+				};
+				const vec4 world = mat4_mulv(node->world, local);
+
+				min = (vec3) { MIN(min.x, world.x), MIN(min.y, world.y), MIN(min.z, world.z) };
+				max = (vec3) { MAX(max.x, world.x), MAX(max.y, world.y), MAX(max.z, world.z) };
+			}
+		}
+	}
+
+	const GLfloat size = MAX(MAX(max.x - min.x, max.y - min.y), max.z - min.z);
+	const GLfloat scale = size > 0.0f ? 2.0f / size : 1.0f;
+
+	fit = mat4_mul(mat4_scaling((vec3) { scale, scale, scale }), mat4_translation(vec3_mulf(vec3_add(min, max), -0.5f)));
+}
+
+static void scene_draw(void)
+{
+	const GLint location = glGetUniformLocation(program, "model");
+
+	for (guint n = 0; n < scene->node_count; ++n) {
+		const glbfile_node_t *node = &scene->nodes[n];
+		const mat4 node_model = mat4_mul(model, mat4_mul(fit, node->world));
+
+		if (node->mesh < 0) {
+			continue;
+		}
+		glUniformMatrix4fv(location, 1, GL_FALSE, (const GLfloat *) &node_model);
+		for (guint p = 0; p < scene->meshes[node->mesh].count; ++p) {
+			const guint primitive = scene->meshes[node->mesh].first + p;
+
+			glBindVertexArray(vaos[primitive]);
+			glbfile_draw(scene, &scene->primitives[primitive]);
+		}
+	}
+}
+
 static void realize(GtkGLArea *area, gpointer user_data)
 {
 	gtk_gl_area_make_current(area);
@@ -45,56 +144,50 @@ static void realize(GtkGLArea *area, gpointer user_data)
 	glClearColor(0.2, 0.3, 0.3, 1.0);
 
 	program = shader_make();
+	decode = mat4_identity();
+
+	if (gltf != NULL) {
+		scene_load();
+	}
+	else {
+		GError *error = NULL;
+		meshfile_t *mesh = meshfile_open(MESH_FILE, &error);
 
-	{
-		GLint index;
+		if (mesh == NULL) {
+			g_error("Error loading mesh: #%d %s\n", error->code, error->message);
+			g_error_free(error);
+		}
+
+		const meshfile_header_t *header = meshfile_get_header(mesh);
+
+		mode = header->mode;
+		type = header->index_type;
+		lod_count = header->lod_count;
+		for (GLuint i = 0; i < lod_count; ++i) {
+			lods[i] = header->lods[i];
+			lod_offsets[i] = meshfile_lod_offset(mesh, i);
+		}
+		decode = meshfile_position_decode(mesh);
+		if (mode == GL_TRIANGLE_STRIP) {
+			mesh_restart_enable(type);
+		}
 
 		glGenVertexArrays(1, &vao);
 		glBindVertexArray(vao);
 
 		glGenBuffers(1, &vbo);
-		glBindBuffer(GL_ARRAY_BUFFER, vbo);
-		glBufferData(GL_ARRAY_BUFFER, sizeof vertices, vertices, GL_STATIC_DRAW);
-
 		glGenBuffers(1, &ebo);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof indices, indices, GL_STATIC_DRAW);
-
-		index = glGetAttribLocation(program, "vec_position");
-		glVertexAttribPointer(index, 3, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (const GLvoid *) offsetof(vertex_t, position));
-		glEnableVertexAttribArray(index);
-		index = glGetAttribLocation(program, "vec_normal");
-		glVertexAttribPointer(index, 3, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (const GLvoid *) offsetof(vertex_t, normal));
-		glEnableVertexAttribArray(index);
-		index = glGetAttribLocation(program, "tex_coord");
-		glVertexAttribPointer(index, 2, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (const GLvoid *) offsetof(vertex_t, texture));
-		glEnableVertexAttribArray(index);
+		meshfile_upload(mesh, vbo, ebo);
 
-		glBindVertexArray(0);
-	}
+		meshfile_attrib_pointer(mesh, MESH_ATTRIB_POSITION, glGetAttribLocation(program, "vec_position"));
+		meshfile_attrib_pointer(mesh, MESH_ATTRIB_NORMAL, glGetAttribLocation(program, "vec_normal"));
+		meshfile_attrib_pointer(mesh, MESH_ATTRIB_TEXTURE, glGetAttribLocation(program, "tex_coord"));
 
-	glGenTextures(1, &texture);
-	glBindTexture(GL_TEXTURE_2D, texture);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-	GError *error = NULL;
-	GdkPixbuf *pixbuf = gdk_pixbuf_new_from_file("container.jpg", &error);
-
-	if (pixbuf == NULL) {
-		g_error("Error loading file: #%d %s\n", error->code, error->message);
-		g_error_free(error);
+		glBindVertexArray(0);
+		meshfile_close(mesh);
 	}
-	const GLint width = gdk_pixbuf_get_width(pixbuf);
-	const GLint height = gdk_pixbuf_get_height(pixbuf);
-	const GLint format = gdk_pixbuf_get_has_alpha(pixbuf) ? GL_RGBA : GL_RGB;
-	const guint8 *bytes = gdk_pixbuf_read_pixels(pixbuf);
 
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, format, GL_UNSIGNED_BYTE, bytes);
-	glGenerateMipmap(GL_TEXTURE_2D);
-	g_object_unref(G_OBJECT(pixbuf));
+	texture = texture_cache_acquire_async("container.jpg", &TEXTURE_SAMPLER_DEFAULT, texture_cache_ready_queue_render, area);
 
 	const mat4 view = mat4_translation((vec3) { 0.0f, 0.0f, -3.0f });
 	model = mat4_identity();
@@ -102,6 +195,7 @@ static void realize(GtkGLArea *area, gpointer user_data)
 	glUseProgram(program);
 	glUniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE, (const GLfloat *) &view);
 	glUniformMatrix4fv(glGetUniformLocation(program, "model"), 1, GL_FALSE, (const GLfloat *) &model);
+	glUniformMatrix4fv(glGetUniformLocation(program, "decode"), 1, GL_FALSE, (const GLfloat *) &decode);
 	glUseProgram(0);
 
 	// glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
@@ -116,7 +210,15 @@ static void unrealize(GtkGLArea *area, gpointer user_data)
 		return;
 	}
 
-	glDeleteTextures(1, &texture);
+	texture_cache_release(texture);
+	if (scene != NULL) {
+		glDeleteVertexArrays(scene->primitive_count, vaos);
+		glDeleteBuffers(scene->view_count, buffers);
+		g_free(vaos);
+		g_free(buffers);
+		glbfile_close(scene);
+		scene = NULL;
+	}
 	glDeleteVertexArrays(1, &vao);
 	glDeleteBuffers(1, &vbo);
 	glDeleteBuffers(1, &ebo);
@@ -133,6 +235,8 @@ static gboolean render(GtkGLArea *area, GdkGLContext *context, gpointer user_dat
 	const GLint height = gtk_widget_get_allocated_height(GTK_WIDGET(area));
 	const mat4 projection = mat4_perspective(radians(fov), ((GLfloat) width) / ((GLfloat) height), 1., 100.);
 
+	texture_cache_upload_queue_render(area);
+
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 	glUseProgram(program);
@@ -152,8 +256,19 @@ static gboolean render(GtkGLArea *area, GdkGLContext *context, gpointer user_dat
 	glUniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE, (const GLfloat *) &view);
 	glUniformMatrix4fv(glGetUniformLocation(program, "projection"), 1, GL_FALSE, (const GLfloat *) &projection);
 
-	glBindVertexArray(vao);
-	glDrawElements(GL_TRIANGLES, G_N_ELEMENTS(indices), GL_UNSIGNED_INT, NULL);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, texture);
+
+	if (scene != NULL) {
+		scene_draw();
+	}
+	else {
+		/* the torus sits at the origin with unit scale */
+		lod = mesh_lod_select(lods, lod_count, mesh_lod_scale(radians(fov), height) / MAX(vec3_abs(cameraPos), 0.1f), MESH_LOD_THRESHOLD, lod);
+
+		glBindVertexArray(vao);
+		glDrawElements(mode, lods[lod].index_count, type, (const GLvoid *) lod_offsets[lod]);
+	}
 
 	glBindVertexArray(0);
 	glUseProgram(0);
@@ -161,18 +276,8 @@ static gboolean render(GtkGLArea *area, GdkGLContext *context, gpointer user_dat
 	return TRUE;
 }
 
-static gboolean key_press_event(GtkGLArea *drawing, GdkEvent *event, gpointer user_data)
+static gboolean key_pressed(GtkEventControllerKey *controller, guint keyval, guint keycode, GdkModifierType state, gpointer user_data)
 {
-	if (gdk_event_get_event_type(event) != GDK_KEY_PRESS) {
-		return FALSE;
-	}
-
-	guint keyval;
-
-	if (gdk_event_get_keyval(event, &keyval) == FALSE) {
-		return FALSE;
-	}
-
 	const GLfloat cameraSpeed = 2.5 * deltaTime;
 
 	switch (keyval) {
@@ -192,38 +297,23 @@ static gboolean key_press_event(GtkGLArea *drawing, GdkEvent *event, gpointer us
 	case 'd':
 		cameraPos = vec3_add(cameraPos, vec3_mulf(vec3_normalize(vec3_cross(cameraFront, cameraUp)), cameraSpeed));
 		break;
+	default:
+		return FALSE;
 	}
 
-	gtk_gl_area_queue_render(drawing);
+	gtk_gl_area_queue_render(GTK_GL_AREA(user_data));
 
 	return TRUE;
 }
 
-static gboolean enter_notify_event(GtkGLArea *drawing, GdkEvent *event, gpointer user_data)
+static void pointer_enter(GtkEventControllerMotion *controller, gdouble xpos, gdouble ypos, gpointer user_data)
 {
-	if (gdk_event_get_event_type(event) != GDK_ENTER_NOTIFY) {
-		return FALSE;
-	}
-
-	gdouble xpos, ypos;
-
-	gdk_event_get_coords(event, &xpos, &ypos);
 	lastX = xpos;
 	lastY = ypos;
-
-	return TRUE;
 }
 
-static gboolean motion_notify_event(GtkGLArea *drawing, GdkEvent *event, gpointer user_data)
+static void pointer_motion(GtkEventControllerMotion *controller, gdouble xpos, gdouble ypos, gpointer user_data)
 {
-	if (gdk_event_get_event_type(event) != GDK_MOTION_NOTIFY) {
-		return FALSE;
-	}
-
-	gdouble xpos, ypos;
-
-	gdk_event_get_coords(event, &xpos, &ypos);
-
 	const gdouble xoffset = -(xpos - lastX);
 	const gdouble yoffset = -(lastY - ypos);
 	const gdouble sensitivity = 0.05f;
@@ -247,29 +337,11 @@ static gboolean motion_notify_event(GtkGLArea *drawing, GdkEvent *event, gpointe
 	};
 	cameraFront = vec3_normalize(front);
 
-	gtk_gl_area_queue_render(drawing);
-
-	return TRUE;
+	gtk_gl_area_queue_render(GTK_GL_AREA(user_data));
 }
 
-static gboolean scroll_event(GtkGLArea *drawing, GdkEvent *event, gpointer user_data)
+static gboolean scroll(GtkEventControllerScroll *controller, gdouble xoffset, gdouble yoffset, gpointer user_data)
 {
-	if (gdk_event_get_event_type(event) != GDK_SCROLL) {
-		return FALSE;
-	}
-
-	gdouble xoffset, yoffset;
-
-	if (gdk_event_get_scroll_deltas(event, &xoffset, &yoffset) == FALSE) {
-		GdkScrollDirection direction;
-
-		if (gdk_event_get_scroll_direction(event, &direction) == FALSE) {
-			return FALSE;
-		}
-		xoffset = direction == GDK_SCROLL_LEFT ? -1 : (direction == GDK_SCROLL_RIGHT ? 1 : 0);
-		yoffset = direction == GDK_SCROLL_UP ? -1 : (direction == GDK_SCROLL_DOWN ? 1 : 0);
-	}
-
 	fov -= yoffset;
 	if (fov <= FOV_MIN) {
 		fov = FOV_MIN;
@@ -277,7 +349,7 @@ static gboolean scroll_event(GtkGLArea *drawing, GdkEvent *event, gpointer user_
 	else if (fov >= FOV_MAX) {
 		fov = FOV_MAX;
 	}
-	gtk_gl_area_queue_render(drawing);
+	gtk_gl_area_queue_render(GTK_GL_AREA(user_data));
 
 	return TRUE;
 }
@@ -310,13 +382,23 @@ static void activate(GtkApplication *application, gpointer user_data)
 	g_signal_connect(G_OBJECT(drawing), "realize", G_CALLBACK(realize), NULL);
 	g_signal_connect(G_OBJECT(drawing), "unrealize", G_CALLBACK(unrealize), NULL);
 	g_signal_connect(G_OBJECT(drawing), "render", G_CALLBACK(render), NULL);
-	g_signal_connect(G_OBJECT(drawing), "enter-notify-event", G_CALLBACK(enter_notify_event), NULL);
-	g_signal_connect(G_OBJECT(drawing), "motion-notify-event", G_CALLBACK(motion_notify_event), NULL);
-	g_signal_connect(G_OBJECT(drawing), "scroll-event", G_CALLBACK(scroll_event), NULL);
-	g_signal_connect(G_OBJECT(drawing), "key-press-event", G_CALLBACK(key_press_event), NULL);
 	gtk_widget_add_tick_callback(drawing, ontick, NULL, NULL);
-	gtk_widget_add_events(drawing, GDK_ENTER_NOTIFY_MASK | GDK_POINTER_MOTION_MASK | GDK_SCROLL_MASK);
-	gtk_widget_set_can_focus(drawing, TRUE);
+
+	/* GTK 4 delivers input through event controllers, the keys need the focus */
+	GtkEventController *controller = gtk_event_controller_key_new();
+
+	g_signal_connect(G_OBJECT(controller), "key-pressed", G_CALLBACK(key_pressed), drawing);
+	gtk_widget_add_controller(drawing, controller);
+
+	controller = gtk_event_controller_motion_new();
+	g_signal_connect(G_OBJECT(controller), "enter", G_CALLBACK(pointer_enter), drawing);
+	g_signal_connect(G_OBJECT(controller), "motion", G_CALLBACK(pointer_motion), drawing);
+	gtk_widget_add_controller(drawing, controller);
+
+	controller = gtk_event_controller_scroll_new(GTK_EVENT_CONTROLLER_SCROLL_BOTH_AXES);
+	g_signal_connect(G_OBJECT(controller), "scroll", G_CALLBACK(scroll), drawing);
+	gtk_widget_add_controller(drawing, controller);
+	gtk_widget_set_focusable(drawing, TRUE);
 
 	window = gtk_application_window_new(application);
 	gtk_window_set_default_size(GTK_WINDOW(window), 800, 600);
@@ -331,6 +413,7 @@ int main(int argc, char *argv[])
 	GtkApplication *application;
 
 	application = gtk_application_new(NULL, G_APPLICATION_FLAGS_NONE);
+	g_application_add_main_option_entries(G_APPLICATION(application), entries);
 	g_signal_connect(G_OBJECT(application), "activate", G_CALLBACK(activate), NULL);
 	result = g_application_run(G_APPLICATION(application), argc, argv);
 	g_object_unref(G_OBJECT(application));
@@ -8,14 +8,17 @@ out vec3 fragment;
 out vec3 normal;
 out vec2 texcoord;
 
+uniform mat4 decode;
 uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
 
 void main()
 {
-    fragment = vec3(model * vec4(vec_position, 1.0));
+    vec4 position = model * decode * vec4(vec_position, 1.0);
+
+    fragment = vec3(position);
     normal = vec3(model * vec4(vec_normal, 0.0));
     texcoord = tex_coord;
-    gl_Position = projection * view * model * vec4(vec_position, 1.0);
+    gl_Position = projection * view * position;
 }
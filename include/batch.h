@@ -0,0 +1,40 @@
+#ifndef __BATCH_H__
+#define __BATCH_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+#include <glmath.h>
+#include <mesh.h>
+
+#define BATCH_TEXTURE_MAX 4
+
+/* batches stay this small so that their bounds are still worth culling against */
+#define BATCH_VERTEX_MAX 65536
+
+/* what a draw binds, objects only share a batch when all of it matches */
+typedef struct {
+	GLuint program;
+	GLuint material;	/* whatever the shader selects its material with, 0 when unused */
+	GLuint textures[BATCH_TEXTURE_MAX];	/* by texture unit, 0 for none */
+} batch_state_t;
+
+typedef struct {
+	const mesh_t *mesh;
+	mat4 model;
+	batch_state_t state;
+} batch_object_t;
+
+/* static geometry of many objects merged and pre-transformed into world space */
+typedef struct {
+	batch_state_t state;
+	mesh_t *mesh;
+	vec3 min;
+	vec3 max;
+	GLuint object_count;
+} batch_t;
+
+batch_t *batch_build(const batch_object_t *objects, guint count, guint *batch_count);
+void batch_free(batch_t *batches, guint count);
+gboolean batch_visible(const batch_t *batch, const mat4 *view_projection);
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef __FRUSTUM_H__
+#define __FRUSTUM_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+#include <glmath.h>
+
+/*
+ * The six clip planes of a view projection matrix in world space, as
+ * (normal, distance) with unit normals pointing inwards: left, right,
+ * bottom, top, near, far. A point p is inside a plane when
+ * dot(normal, p) + distance >= 0, the same test shaders make with a vec4.
+ */
+typedef struct {
+	vec4 planes[6];
+} frustum_t;
+
+frustum_t frustum_from_matrix(const mat4 *view_projection);
+gboolean frustum_sphere(const frustum_t *frustum, vec3 center, GLfloat radius);
+GLfloat frustum_scale(const mat4 *model);
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef __GLBFILE_H__
+#define __GLBFILE_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+#include <glmath.h>
+#include <vertex_format.h>
+
+/*
+ * glTF 2.0 binary container, little endian:
+ *
+ *	header		magic, version 2 and total length
+ *	JSON chunk	length, "JSON", the scene description padded with spaces
+ *	BIN chunk	length, "BIN\0", buffer 0 padded with zeros
+ *
+ * Chunks start 4 byte aligned and accessors are aligned to their component
+ * size, so the buffer views of the mapped BIN chunk go to GL as they are,
+ * one buffer each. glTF component types and primitive modes are GL enums
+ * already, accessors become vertex attributes without any repacking.
+ */
+
+#define GLBFILE_MAGIC		0x46546c67	/* "glTF" */
+#define GLBFILE_VERSION		2
+#define GLBFILE_CHUNK_JSON	0x4e4f534a	/* "JSON" */
+#define GLBFILE_CHUNK_BIN	0x004e4942	/* "BIN\0" */
+
+#define GLBFILE_ERROR glbfile_error_quark()
+
+typedef enum {
+	GLBFILE_ERROR_INVALID,
+	GLBFILE_ERROR_VERSION,
+	GLBFILE_ERROR_UNSUPPORTED
+} glbfile_error_t;
+
+typedef struct {
+	guint32 offset;		/* within the BIN chunk */
+	guint32 length;
+	guint32 stride;		/* 0 when tightly packed */
+	GLenum target;		/* GL_ARRAY_BUFFER or GL_ELEMENT_ARRAY_BUFFER, 0 when no primitive uses it */
+} glbfile_view_t;
+
+typedef struct {
+	gint view;
+	guint32 offset;		/* within the view */
+	guint32 count;
+	GLenum type;		/* GL_FLOAT, GL_UNSIGNED_SHORT, ... */
+	GLint size;		/* components, 1 for indices */
+	GLboolean normalized;
+} glbfile_accessor_t;
+
+typedef struct {
+	GLenum mode;
+	gint attributes[MESH_ATTRIB_COUNT];	/* accessors, -1 when absent */
+	gint indices;		/* accessor, -1 for glDrawArrays() */
+	gint material;		/* -1 for the default material */
+	vec3 min;		/* bounds of the positions */
+	vec3 max;
+} glbfile_primitive_t;
+
+typedef struct {
+	guint first;		/* into primitives */
+	guint count;
+} glbfile_mesh_t;
+
+/* the default scene depth first, parents always before their children */
+typedef struct {
+	mat4 local;
+	mat4 world;		/* local composed with all of its ancestors */
+	gint parent;		/* -1 for the roots */
+	gint mesh;		/* -1 for nodes that only transform */
+} glbfile_node_t;
+
+typedef struct {
+	GMappedFile *mapped;
+	const guint8 *bin;
+	gsize bin_length;
+	glbfile_view_t *views;
+	guint view_count;
+	glbfile_accessor_t *accessors;
+	guint accessor_count;
+	glbfile_primitive_t *primitives;
+	guint primitive_count;
+	glbfile_mesh_t *meshes;
+	guint mesh_count;
+	glbfile_node_t *nodes;
+	guint node_count;
+} glbfile_t;
+
+GQuark glbfile_error_quark(void);
+
+glbfile_t *glbfile_open(const gchar *filename, GError **error);
+void glbfile_close(glbfile_t *file);
+
+void glbfile_upload(const glbfile_t *file, GLuint *buffers);
+void glbfile_attrib_pointer(const glbfile_t *file, const glbfile_primitive_t *primitive, mesh_attrib_t semantic, const GLuint *buffers, GLint index);
+void glbfile_bind_indices(const glbfile_t *file, const glbfile_primitive_t *primitive, const GLuint *buffers);
+void glbfile_draw(const glbfile_t *file, const glbfile_primitive_t *primitive);
+
+#endif
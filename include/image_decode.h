@@ -0,0 +1,24 @@
+#ifndef __IMAGE_DECODE_H__
+#define __IMAGE_DECODE_H__
+
+#include <glib.h>
+#include <gio/gio.h>
+#include <gdk-pixbuf/gdk-pixbuf.h>
+
+/*
+ * Images decoded no larger than they are needed, for previews, distant
+ * objects or a low memory budget. With max_size > 0 the result fits in
+ * max_size x max_size and keeps its aspect ratio, and only images already
+ * smaller are left alone. JPEG goes through the scaled IDCT of libjpeg at
+ * 1/2, 1/4 or 1/8, so the pixels that would be thrown away are never
+ * computed. Adam7 interlaced PNG stops after the first passes, which hold
+ * every eighth, fourth or second pixel, and the rest of the file is never
+ * inflated. The reduction is the largest that stays at or above max_size,
+ * whatever is left is scaled down bilinearly. Other images, and all of
+ * them without libjpeg or libpng at build time, are decoded in full by
+ * gdk-pixbuf first. max_size <= 0 decodes in full.
+ */
+GdkPixbuf *image_decode(const gchar *filename, gint max_size, GError **error);
+void image_decode_in_thread(GTask *task, const gchar *filename, gint max_size);
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef __INSTANCE_H__
+#define __INSTANCE_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+#include <glmath.h>
+
+/* the most instances one draw call takes in the chapters, enough for a stress test */
+#define INSTANCE_MAX 100000
+
+/*
+ * Per instance vertex data, advanced once per instance by
+ * glVertexAttribDivisor(). In the vertex shader
+ *
+ *	in mat4 instance_model;
+ *	in mat3 instance_normal;
+ *	in uint instance_material;
+ *
+ * take 4 + 3 + 1 consecutive attribute locations.
+ */
+typedef struct {
+	mat4 model;
+	mat3 normal;		/* inverse transpose of the upper 3x3 of model */
+	GLuint material;
+} instance_t;
+
+void instance_set(instance_t *instance, mat4 model, GLuint material);
+void instance_attrib_pointer(GLint model, GLint normal, GLint material);
+
+#endif
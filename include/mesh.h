@@ -0,0 +1,33 @@
+#ifndef __MESH_H__
+#define __MESH_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+#include <glmath.h>
+
+typedef struct {
+	vec3 position;
+	vec3 normal;
+	vec2 texture;
+} vertex_t;
+
+/* separates the strips of a GL_TRIANGLE_STRIP mesh, stored as the maximum of the index type */
+#define MESH_RESTART_INDEX G_MAXUINT32
+
+/* CPU side indexed triangle mesh, as produced by the generators and loaders */
+typedef struct {
+	vertex_t *vertices;
+	GLuint vertex_count;
+	GLuint *indices;
+	GLuint index_count;
+	GLenum mode;		/* GL_TRIANGLES or GL_TRIANGLE_STRIP */
+} mesh_t;
+
+mesh_t *mesh_new(GLuint vertex_count, GLuint index_count);
+void mesh_free(mesh_t *mesh);
+void mesh_bounds(const mesh_t *mesh, vec3 *min, vec3 *max);
+GLuint mesh_triangle_count(const mesh_t *mesh);
+
+void mesh_restart_enable(GLenum index_type);
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef __MESH_LOD_H__
+#define __MESH_LOD_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+
+#define MESH_LOD_MAX 8
+/* a coarser level is taken once its projected error drops below threshold * MESH_LOD_HYSTERESIS */
+#define MESH_LOD_HYSTERESIS 0.75f
+/* projected error in pixels tolerated before switching to a finer level */
+#define MESH_LOD_THRESHOLD 1.0f
+
+/*
+ * One level of detail as a range of the mesh index buffer. All levels share
+ * the vertex buffer, level 0 is the full detail mesh and error is the
+ * largest object space distance from a vertex of the full detail mesh to
+ * the level, so it grows with the level and projects to pixels.
+ */
+typedef struct {
+	GLuint index_offset;
+	GLuint index_count;
+	GLfloat error;
+} mesh_lod_t;
+
+GLfloat mesh_lod_scale(GLfloat fovy, GLint height);
+GLuint mesh_lod_select(const mesh_lod_t *lods, GLuint count, GLfloat pixels, GLfloat threshold, GLuint current);
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef __MESH_OPTIMIZE_H__
+#define __MESH_OPTIMIZE_H__
+
+#include <mesh.h>
+#include <mesh_lod.h>
+
+/* post-transform cache modelled as a FIFO of this many vertices */
+#define MESH_CACHE_SIZE 16
+
+/* allowed ACMR degradation when splitting clusters for overdraw ordering */
+#define MESH_OVERDRAW_THRESHOLD 1.05f
+
+typedef struct {
+	GLfloat acmr;	/* cache misses per triangle */
+	GLfloat atvr;	/* cache misses per referenced vertex */
+} mesh_cache_stats_t;
+
+mesh_cache_stats_t mesh_cache_stats(const mesh_t *mesh, GLuint cache_size);
+
+void mesh_optimize_vertex_cache(mesh_t *mesh, GLuint cache_size);
+void mesh_optimize_overdraw(mesh_t *mesh, GLuint cache_size, GLfloat threshold);
+void mesh_optimize_vertex_fetch(mesh_t *mesh);
+void mesh_optimize(mesh_t *mesh);
+void mesh_optimize_lods(mesh_t *mesh, const mesh_lod_t *lods, GLuint lod_count);
+
+#endif
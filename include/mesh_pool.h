@@ -0,0 +1,47 @@
+#ifndef __MESH_POOL_H__
+#define __MESH_POOL_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+#include <glmath.h>
+#include <mesh.h>
+
+/* the layout glMultiDrawElementsIndirect() reads from GL_DRAW_INDIRECT_BUFFER */
+typedef struct {
+	GLuint count;
+	GLuint instance_count;
+	GLuint first_index;
+	GLint base_vertex;
+	GLuint base_instance;
+} draw_command_t;
+
+/* where one mesh ended up in the shared buffers */
+typedef struct {
+	GLuint first_index;
+	GLuint index_count;
+	GLint base_vertex;
+	GLuint vertex_count;
+	vec3 center;		/* bounding sphere of the positions */
+	GLfloat radius;
+} mesh_pool_entry_t;
+
+/*
+ * Many GL_TRIANGLES meshes appended into one vertex and one index array,
+ * so that they share a single vertex array object and any of them can be
+ * drawn by a draw_command_t. Indices stay relative to each mesh, the
+ * command base vertex offsets them.
+ */
+typedef struct {
+	GArray *vertices;	/* vertex_t */
+	GArray *indices;	/* GLuint */
+	GArray *entries;	/* mesh_pool_entry_t */
+} mesh_pool_t;
+
+mesh_pool_t *mesh_pool_new(void);
+void mesh_pool_free(mesh_pool_t *pool);
+guint mesh_pool_add(mesh_pool_t *pool, const mesh_t *mesh);
+const mesh_pool_entry_t *mesh_pool_entry(const mesh_pool_t *pool, guint mesh);
+draw_command_t mesh_pool_command(const mesh_pool_t *pool, guint mesh, GLuint instance_count, GLuint base_instance);
+void mesh_pool_upload(const mesh_pool_t *pool, GLuint vbo, GLuint ebo);
+
+#endif
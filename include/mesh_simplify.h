@@ -0,0 +1,13 @@
+#ifndef __MESH_SIMPLIFY_H__
+#define __MESH_SIMPLIFY_H__
+
+#include <mesh.h>
+#include <mesh_lod.h>
+
+/* each level of a generated chain aims for this fraction of the triangles of the previous one */
+#define MESH_SIMPLIFY_RATIO 0.5f
+
+GLuint mesh_simplify(const mesh_t *mesh, const GLuint *indices, GLuint index_count, GLuint target_count, GLuint *destination, GLfloat *error);
+GLuint mesh_simplify_lods(mesh_t *mesh, GLuint lod_count, GLfloat ratio, mesh_lod_t *lods);
+
+#endif
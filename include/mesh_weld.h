@@ -0,0 +1,11 @@
+#ifndef __MESH_WELD_H__
+#define __MESH_WELD_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+
+#define MESH_WELD_EPSILON 1.0e-6f
+
+GLuint mesh_weld(gconstpointer vertices, GLuint count, gsize stride, GLfloat epsilon, gpointer welded, GLuint *indices);
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef __MESHFILE_H__
+#define __MESHFILE_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+#include <mesh.h>
+#include <mesh_lod.h>
+#include <vertex_format.h>
+
+/*
+ * Binary mesh container, little endian:
+ *
+ *	meshfile_header_t	vertex layout, blob locations, bounds and levels of detail
+ *	vertex blob		vertex_count * vertex_stride bytes, MESHFILE_ALIGNMENT aligned,
+ *				encoded as described by the vertex_attrib_t descriptors
+ *	index blob		index_count * sizeof index_type bytes, MESHFILE_ALIGNMENT aligned
+ *
+ * The blobs are laid out exactly as GL expects them, so a mapped file is uploaded
+ * without any intermediate copy. The levels of detail are ranges of the index
+ * blob, finest first, all drawing from the one vertex blob.
+ */
+
+#define MESHFILE_MAGIC		0x4853454d	/* "MESH" */
+#define MESHFILE_VERSION	3
+#define MESHFILE_ALIGNMENT	64
+#define MESHFILE_ATTRIB_MAX	8
+
+#define MESHFILE_ERROR meshfile_error_quark()
+
+typedef enum {
+	MESHFILE_ERROR_INVALID,
+	MESHFILE_ERROR_VERSION
+} meshfile_error_t;
+
+typedef struct {
+	guint32 magic;
+	guint16 version;
+	guint16 header_size;
+	guint32 mode;		/* GL_TRIANGLES, or GL_TRIANGLE_STRIP restarted at the maximum index */
+	guint32 attrib_count;
+	vertex_attrib_t attribs[MESHFILE_ATTRIB_MAX];
+	guint32 vertex_stride;
+	guint32 vertex_count;
+	guint64 vertex_offset;
+	guint64 vertex_size;
+	guint32 index_type;	/* GL_UNSIGNED_SHORT when the vertices allow, else GL_UNSIGNED_INT */
+	guint32 index_count;
+	guint64 index_offset;
+	guint64 index_size;
+	GLfloat bounds_min[3];
+	GLfloat bounds_max[3];
+	guint32 lod_count;	/* at least one, the whole index blob when nothing was simplified */
+	mesh_lod_t lods[MESH_LOD_MAX];
+	guint32 reserved;
+} meshfile_header_t;
+
+typedef struct meshfile meshfile_t;
+
+GQuark meshfile_error_quark(void);
+
+meshfile_t *meshfile_open(const gchar *filename, GError **error);
+void meshfile_close(meshfile_t *file);
+
+const meshfile_header_t *meshfile_get_header(const meshfile_t *file);
+const vertex_attrib_t *meshfile_get_attrib(const meshfile_t *file, mesh_attrib_t semantic);
+gconstpointer meshfile_get_vertices(const meshfile_t *file);
+gconstpointer meshfile_get_indices(const meshfile_t *file);
+
+void meshfile_upload(const meshfile_t *file, GLuint vbo, GLuint ebo);
+void meshfile_attrib_pointer(const meshfile_t *file, mesh_attrib_t semantic, GLint index);
+void meshfile_attrib_format(const meshfile_t *file, mesh_attrib_t semantic, GLuint binding, GLint index);
+mat4 meshfile_position_decode(const meshfile_t *file);
+gsize meshfile_lod_offset(const meshfile_t *file, GLuint lod);
+
+gboolean meshfile_write(const gchar *filename, const mesh_t *mesh, const mesh_lod_t *lods, GLuint lod_count, const vertex_format_t *format, GError **error);
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef __OBJFILE_H__
+#define __OBJFILE_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+#include <glmath.h>
+#include <mesh.h>
+
+/* files are split into about this many bytes per parsing task */
+#define OBJFILE_CHUNK_SIZE (4 << 20)
+
+#define OBJFILE_ERROR objfile_error_quark()
+
+typedef enum {
+	OBJFILE_ERROR_INVALID
+} objfile_error_t;
+
+/* the subset of MTL the chapters light with, maps are resolved against the MTL directory */
+typedef struct {
+	gchar *name;
+	vec3 ambient;
+	vec3 diffuse;
+	vec3 specular;
+	GLfloat shininess;
+	gchar *diffuse_map;
+	gchar *specular_map;
+} objfile_material_t;
+
+typedef struct {
+	mesh_t *mesh;
+	GLint material;		/* index into materials, -1 for faces before any usemtl */
+} objfile_mesh_t;
+
+/* one indexed mesh per material, vertices deduplicated on their position/texture/normal triple */
+typedef struct {
+	objfile_mesh_t *meshes;
+	guint mesh_count;
+	objfile_material_t *materials;
+	guint material_count;
+	guint64 bytes;		/* size of the OBJ file */
+	gdouble seconds;	/* wall time to map, parse and merge it */
+} objfile_t;
+
+GQuark objfile_error_quark(void);
+
+objfile_t *objfile_load(const gchar *filename, GError **error);
+void objfile_free(objfile_t *obj);
+
+mesh_t *objfile_merge(const objfile_t *obj);
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef __PBO_POOL_H__
+#define __PBO_POOL_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+
+/* one pixel unpack buffer, persistently mapped so any thread may fill it */
+typedef struct {
+	GLuint buffer;
+	guint8 *data;
+	GLsync fence;		/* of the last transfer out of it, NULL once passed */
+	gboolean used;		/* handed out and not released yet */
+} pbo_t;
+
+/*
+ * A few equally sized GL_PIXEL_UNPACK_BUFFER buffers for staging texture
+ * uploads. The GL thread acquires one, a worker writes the pixels through
+ * data, and the GL thread transfers them with glTexSubImage2D() from the
+ * bound buffer and releases it. A released buffer is only handed out
+ * again once the GPU has passed the fence of that transfer. Needs GL 4.4
+ * or ARB_buffer_storage.
+ */
+typedef struct {
+	pbo_t *pbos;
+	guint count;
+	GLsizeiptr size;
+} pbo_pool_t;
+
+pbo_pool_t *pbo_pool_new(guint count, GLsizeiptr size);
+void pbo_pool_free(pbo_pool_t *pool);
+pbo_t *pbo_pool_acquire(pbo_pool_t *pool);
+void pbo_pool_release(pbo_pool_t *pool, pbo_t *pbo);
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef __RING_BUFFER_H__
+#define __RING_BUFFER_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+
+/* regions in flight, the CPU writes one while the GPU may still read the others */
+#define RING_BUFFER_FRAMES 3
+
+/*
+ * A buffer mapped once with GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT and
+ * split into RING_BUFFER_FRAMES equal regions. Each frame bump allocates
+ * from its own region and fences it when done, a region is only written
+ * again once the GPU has passed its fence. Nothing is re-specified or
+ * mapped per frame, so uploads never stall on the driver, only on the
+ * fence, and that wait is what wait_time accumulates.
+ */
+typedef struct {
+	GLuint buffer;
+	guint8 *data;		/* the whole persistent mapping */
+	GLsizeiptr region_size;
+	GLsizeiptr alignment;	/* of every allocation, at least the uniform and storage buffer offset alignment */
+	guint frame;		/* region being written */
+	GLsizeiptr offset;	/* within the region */
+	GLsync fences[RING_BUFFER_FRAMES];
+	gint64 wait_time;	/* microseconds blocked on fences since the last reset */
+	guint waits;		/* begins that had to block */
+} ring_buffer_t;
+
+ring_buffer_t *ring_buffer_new(GLsizeiptr region_size, guint allocations);
+void ring_buffer_free(ring_buffer_t *ring);
+void ring_buffer_begin(ring_buffer_t *ring);
+gpointer ring_buffer_alloc(ring_buffer_t *ring, GLsizeiptr size, GLintptr *offset);
+void ring_buffer_end(ring_buffer_t *ring);
+void ring_buffer_reset_stats(ring_buffer_t *ring);
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef __SHAPES_H__
+#define __SHAPES_H__
+
+#include <mesh.h>
+#include <mesh_lod.h>
+
+/* mode is GL_TRIANGLES or GL_TRIANGLE_STRIP */
+mesh_t *shape_torus(GLuint rings, GLuint sides, GLfloat radius, GLfloat width, GLenum mode);
+mesh_t *shape_cylinder(GLuint segments, GLenum mode);
+mesh_t *shape_cube(void);
+mesh_t *shape_icosahedron(void);
+/* levels is 1 to MESH_LOD_MAX, lods receives one entry per level, finest first */
+mesh_t *shape_icosphere(GLuint levels, mesh_lod_t *lods);
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef __TEXFILE_H__
+#define __TEXFILE_H__
+
+#include <glib.h>
+#include <gio/gio.h>
+#include <gdk-pixbuf/gdk-pixbuf.h>
+#include <epoxy/gl.h>
+
+/*
+ * Binary mipmapped texture container, little endian, after the layout of KTX2
+ * without its data format descriptor:
+ *
+ *	texfile_header_t	format, size and the location of every level
+ *	level blobs		finest first, each TEXFILE_ALIGNMENT aligned, rows
+ *				padded to 4 bytes as GL_UNPACK_ALIGNMENT expects by default,
+ *				or rows of 4 x 4 blocks for the compressed formats
+ *
+ * Every level is precomputed when baking, so loading is a mapping and one
+ * glTexSubImage2D() per level, with no image decode and no glGenerateMipmap().
+ */
+
+#define TEXFILE_MAGIC		0x32584554	/* "TEX2" */
+#define TEXFILE_VERSION		2
+#define TEXFILE_ALIGNMENT	64
+#define TEXFILE_LEVEL_MAX	16
+
+#define TEXFILE_ERROR texfile_error_quark()
+
+typedef enum {
+	TEXFILE_ERROR_INVALID,
+	TEXFILE_ERROR_VERSION
+} texfile_error_t;
+
+typedef struct {
+	guint64 offset;
+	guint64 size;
+	guint32 width;
+	guint32 height;
+	guint32 row_pitch;	/* bytes from one row to the next, of blocks when compressed */
+	guint32 reserved;
+} texfile_level_t;
+
+typedef struct {
+	guint32 magic;
+	guint16 version;
+	guint16 header_size;
+	guint32 internal_format;	/* GL_RGB8, GL_RGBA8 or one of the texture_compress formats */
+	guint32 format;			/* GL_RGB or GL_RGBA of GL_UNSIGNED_BYTE, 0 when compressed */
+	guint32 width;
+	guint32 height;
+	guint32 level_count;		/* down to 1 x 1 */
+	guint32 flags;
+	texfile_level_t levels[TEXFILE_LEVEL_MAX];
+} texfile_header_t;
+
+/* flags, how the levels were filtered */
+#define TEXFILE_FLAG_LINEAR	(1 << 0)	/* texels filtered as they are, not decoded from sRGB first */
+
+typedef struct texfile texfile_t;
+
+GQuark texfile_error_quark(void);
+
+texfile_t *texfile_open(const gchar *filename, GError **error);
+texfile_t *texfile_open_baked(const gchar *filename);
+void texfile_close(texfile_t *file);
+
+const texfile_header_t *texfile_get_header(const texfile_t *file);
+gconstpointer texfile_get_level(const texfile_t *file, guint level);
+gboolean texfile_supported(const texfile_t *file);
+void texfile_prefetch(const texfile_t *file);
+void texfile_prefetch_in_thread(GTask *task, texfile_t *file);
+
+void texfile_upload(const texfile_t *file, gint max_size);
+
+gboolean texfile_write(const gchar *filename, GdkPixbuf *pixbuf, GLenum internal_format, guint32 flags, GError **error);
+
+#endif
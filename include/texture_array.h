@@ -0,0 +1,28 @@
+#ifndef __TEXTURE_ARRAY_H__
+#define __TEXTURE_ARRAY_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+#include <texture_cache.h>
+
+/*
+ * Images packed as the layers of one mipmapped GL_TEXTURE_2D_ARRAY, layer i
+ * from filenames[i]. Objects pick their layer with a material index in a
+ * vertex attribute or storage buffer, so objects with different images
+ * share one texture binding and one draw. When every image has a baked
+ * file of the same size and format, the levels are copied from those as
+ * they are. Otherwise the images are decoded, scaled to the largest of
+ * them, and mipmapped on the GPU.
+ */
+typedef struct {
+	GLuint texture;
+	GLsizei width;
+	GLsizei height;
+	GLsizei layers;
+	GLenum internal_format;
+} texture_array_t;
+
+texture_array_t *texture_array_new(const gchar *const *filenames, guint count, const texture_sampler_t *sampler, GError **error);
+void texture_array_free(texture_array_t *array);
+
+#endif
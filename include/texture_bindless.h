@@ -0,0 +1,30 @@
+#ifndef __TEXTURE_BINDLESS_H__
+#define __TEXTURE_BINDLESS_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+#include <texture_cache.h>
+
+/*
+ * One texture per material, each from the texture cache and named in the
+ * shaders by a resident GL_ARB_bindless_texture handle instead of a texture
+ * unit. The handles are a std430 uvec2 array in buffer, material i at
+ * index i, for shaders to turn into a sampler2D with the material index of
+ * the draw or instance. Nothing is bound between objects, and unlike a
+ * texture array the images keep their own sizes and formats. A handle fixes
+ * the state of its texture, so the images are acquired synchronously and
+ * whoever else shares them must not change them either. Where the context
+ * lacks the extension, texture_array_t is the way to the same single draw.
+ */
+typedef struct {
+	GLuint buffer;
+	guint count;
+	GLuint *textures;
+	GLuint64 *handles;
+} texture_bindless_t;
+
+gboolean texture_bindless_supported(void);
+texture_bindless_t *texture_bindless_new(const gchar *const *filenames, guint count, const texture_sampler_t *sampler, GError **error);
+void texture_bindless_free(texture_bindless_t *bindless);
+
+#endif
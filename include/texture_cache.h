@@ -0,0 +1,54 @@
+#ifndef __TEXTURE_CACHE_H__
+#define __TEXTURE_CACHE_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+
+/* the texture parameters an image is uploaded with, part of the cache key */
+typedef struct {
+	GLint wrap_s;
+	GLint wrap_t;
+	GLint min_filter;
+	GLint mag_filter;
+} texture_sampler_t;
+
+/* what the chapters have always used */
+#define TEXTURE_SAMPLER_DEFAULT ((texture_sampler_t) { GL_REPEAT, GL_REPEAT, GL_LINEAR, GL_LINEAR })
+
+/* milliseconds of a frame the chapters give texture_cache_upload() */
+#define TEXTURE_UPLOAD_BUDGET 2.0
+
+/* staging buffers for uploads, each large enough for a 2048 x 2048 RGBA image */
+#define TEXTURE_PBO_COUNT 4
+#define TEXTURE_PBO_SIZE (16 << 20)
+
+typedef void (*texture_ready_func)(gpointer user_data);
+
+/*
+ * Mipmapped GL_TEXTURE_2D textures shared by everyone asking for the same
+ * file with the same sampler. The first acquire decodes and uploads, later
+ * ones take a reference, and the last release deletes the texture. Images
+ * of res that texconv baked into the build tree are mapped with all their
+ * levels instead of decoded and mipmapped, unless texture_cache_use_baked()
+ * turns that off. The async variant decodes on GTask worker threads
+ * instead and leaves the uploads to texture_cache_upload() calls from the
+ * render loop. Where the context has buffer storage those go through a
+ * pbo_pool_t: a worker copies the pixels into a mapped buffer and the
+ * render loop only issues the transfer. All users have to share the GL
+ * context, or contexts sharing objects.
+ */
+GLuint texture_cache_acquire(const gchar *filename, const texture_sampler_t *sampler, GError **error);
+GLuint texture_cache_acquire_async(const gchar *filename, const texture_sampler_t *sampler, texture_ready_func ready, gpointer user_data);
+guint texture_cache_upload(gdouble budget);
+guint texture_cache_pending(void);
+void texture_cache_release(GLuint texture);
+void texture_cache_use_pbo(gboolean enable);
+void texture_cache_use_baked(gboolean enable);
+void texture_cache_max_size(gint size);
+guint texture_cache_decodes(void);
+
+/* for the chapters, user_data and area are their GtkGLArea */
+void texture_cache_ready_queue_render(gpointer user_data);
+void texture_cache_upload_queue_render(gpointer area);
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef __TEXTURE_COMPRESS_H__
+#define __TEXTURE_COMPRESS_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+
+/*
+ * Block compressed formats of 4 x 4 texel blocks. texture_compress() encodes
+ * BC1 (GL_COMPRESSED_RGB_S3TC_DXT1_EXT), BC3 (GL_COMPRESSED_RGBA_S3TC_DXT5_EXT)
+ * and BC5 (GL_COMPRESSED_RG_RGTC2). BC7 and ETC2 can only be loaded, from files
+ * made by other encoders.
+ */
+gsize texture_compress_block_bytes(GLenum internal_format);
+gsize texture_compress_level_bytes(GLenum internal_format, guint width, guint height);
+gboolean texture_compress_encodable(GLenum internal_format);
+gboolean texture_compress_supported(GLenum internal_format);
+void texture_compress(GLenum internal_format, const guint8 *rgba, guint width, guint height, guint8 *blocks);
+
+#endif
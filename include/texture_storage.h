@@ -0,0 +1,24 @@
+#ifndef __TEXTURE_STORAGE_H__
+#define __TEXTURE_STORAGE_H__
+
+#include <glib.h>
+#include <gdk-pixbuf/gdk-pixbuf.h>
+#include <epoxy/gl.h>
+
+/*
+ * Texture allocation and uploads straight from gdk-pixbuf memory. Storage
+ * is immutable, glTexStorage2D() with the sized format matching the pixels
+ * where the context has it, so the driver never converts. Rows are read
+ * with GL_UNPACK_ALIGNMENT and GL_UNPACK_ROW_LENGTH set from the rowstride,
+ * so no pixbuf is repacked whatever its width or padding. The unpack state
+ * is back at the GL defaults after every call.
+ */
+GLsizei texture_storage_levels(GLsizei width, GLsizei height);
+gsize texture_storage_bytes(GLsizei width, GLsizei height);
+GLenum texture_storage_format(gboolean alpha, GLenum *format);
+void texture_storage_2d(GLenum internal_format, GLsizei levels, GLsizei width, GLsizei height);
+void texture_storage_unpack(GLsizei width, GLenum format, gint rowstride);
+void texture_storage_unpack_reset(void);
+void texture_storage_pixbuf(GdkPixbuf *pixbuf);
+
+#endif
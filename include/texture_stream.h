@@ -0,0 +1,70 @@
+#ifndef __TEXTURE_STREAM_H__
+#define __TEXTURE_STREAM_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+#include <texfile.h>
+#include <texture_cache.h>
+
+/*
+ * Textures that hold only the mip levels the frame needs, under a budget
+ * of bytes for all of them. Every frame the users request each texture
+ * with the size in pixels it covers on screen, texture_stream_update()
+ * then works out the level that size needs. Finer levels are loaded on
+ * GTask workers, reduced by image_decode() or from the levels of a baked
+ * file, and the texture is replaced with one holding them. When the
+ * resident levels and those on their way would go over the budget, the
+ * least recently requested textures lose their finest level, copied on
+ * the GPU into a texture one level shorter. Textures requested this frame
+ * keep what they need, and a load that does not fit even after evicting
+ * comes as the finest level that does. Each texture starts as a single
+ * grey texel, so its GL name changes as it streams: take it with
+ * texture_stream_texture() every frame. Needs GL 4.3 for the copies.
+ */
+typedef struct texture_stream texture_stream_t;
+
+typedef struct {
+	gchar *filename;
+	texture_sampler_t sampler;
+	GLuint texture;
+	GLsizei width;		/* of the finest level in texture */
+	GLsizei height;
+	GLsizei levels;		/* of the full image, down to 1 x 1 */
+	GLsizei size;		/* the larger side of the full image */
+	GLsizei base;		/* finest resident level, levels while only the placeholder is */
+	GLsizei wanted;		/* level the requests of this frame need, levels when none came */
+	GLenum internal_format;	/* of texture */
+	guint64 used;		/* frame of the last request */
+	gboolean loading;	/* from the start of a load to its upload */
+	gboolean busy;		/* a worker has it */
+	gboolean released;	/* freed with the stream while busy, the load frees it */
+	gboolean failed;	/* stays as it is, a load did not decode */
+	GdkPixbuf *pixbuf;	/* loaded, waiting for its upload */
+	texfile_t *file;
+	GLsizei load;		/* level being loaded */
+	gsize chain[TEXFILE_LEVEL_MAX];	/* bytes from each level down to 1 x 1 */
+	texture_stream_t *stream;
+} texture_stream_item_t;
+
+struct texture_stream {
+	gsize budget;		/* bytes of texels */
+	gsize resident;		/* in the textures now */
+	gsize loading;		/* more they will be once the loads in flight are in */
+	guint64 frame;
+	GPtrArray *items;
+	GQueue loaded;		/* waiting for an upload */
+	guint complete;		/* textures with every level their requests need */
+	guint loads;		/* started since the last reset */
+	guint evictions;	/* levels dropped since the last reset */
+	guint deferred;		/* loads coarser than requested, or none, to fit since the last reset */
+};
+
+texture_stream_t *texture_stream_new(gsize budget);
+void texture_stream_free(texture_stream_t *stream);
+texture_stream_item_t *texture_stream_add(texture_stream_t *stream, const gchar *filename, const texture_sampler_t *sampler, GError **error);
+void texture_stream_request(texture_stream_t *stream, texture_stream_item_t *item, GLfloat pixels);
+void texture_stream_update(texture_stream_t *stream, gdouble budget);
+GLuint texture_stream_texture(const texture_stream_item_t *item);
+void texture_stream_reset_stats(texture_stream_t *stream);
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef __VERTEX_FORMAT_H__
+#define __VERTEX_FORMAT_H__
+
+#include <glib.h>
+#include <epoxy/gl.h>
+#include <mesh.h>
+
+typedef enum {
+	MESH_ATTRIB_POSITION,
+	MESH_ATTRIB_NORMAL,
+	MESH_ATTRIB_TEXTURE,
+	MESH_ATTRIB_COUNT
+} mesh_attrib_t;
+
+typedef enum {
+	VERTEX_FLOAT,		/* 32 bit floats */
+	VERTEX_HALF,		/* 16 bit floats */
+	VERTEX_UNORM16,		/* 16 bit normalised, positions relative to the mesh bounds */
+	VERTEX_INT_2_10_10_10,	/* packed 10 bit signed normalised, normals only */
+	VERTEX_OCTAHEDRAL,	/* two 16 bit signed normalised, normals only */
+	VERTEX_ENCODING_COUNT
+} vertex_encoding_t;
+
+/*
+ * Octahedral normals arrive in the shader as a vec2 and are decoded with
+ *
+ *	vec3 octahedral(vec2 e)
+ *	{
+ *		vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+ *		if (n.z < 0.0)
+ *			n.xy = (1.0 - abs(n.yx)) * mix(vec2(-1.0), vec2(1.0), step(0.0, n.xy));
+ *		return normalize(n);
+ *	}
+ *
+ * VERTEX_UNORM16 positions need the matrix from vertex_format_decode().
+ */
+typedef struct {
+	vertex_encoding_t position;
+	vertex_encoding_t normal;
+	vertex_encoding_t texture;
+} vertex_format_t;
+
+/* one vertex attribute as stored in mesh files */
+typedef struct {
+	guint8 semantic;	/* mesh_attrib_t */
+	guint8 size;		/* number of components */
+	guint8 normalized;
+	guint8 encoding;	/* vertex_encoding_t */
+	guint32 type;		/* GL_FLOAT, ... */
+	guint32 offset;		/* within the vertex */
+} vertex_attrib_t;
+
+extern const vertex_format_t vertex_format_float;
+extern const vertex_format_t vertex_format_compact;
+
+guint vertex_format_layout(const vertex_format_t *format, vertex_attrib_t attribs[MESH_ATTRIB_COUNT], guint32 *stride);
+void vertex_format_pack(const vertex_format_t *format, const mesh_t *mesh, vec3 min, vec3 max, gpointer output);
+mat4 vertex_format_decode(const vertex_attrib_t *position, vec3 min, vec3 max);
+
+gsize vertex_attrib_bytes(const vertex_attrib_t *attrib);
+void vertex_attrib_pointer(const vertex_attrib_t *attrib, GLsizei stride, GLint index);
+void vertex_attrib_format(const vertex_attrib_t *attrib, GLuint binding, GLint index);
+
+guint16 vertex_half(GLfloat value);
+guint16 vertex_unorm16(GLfloat value);
+guint32 vertex_int_2_10_10_10(vec3 normal);
+void vertex_octahedral(vec3 normal, gint16 encoded[2]);
+
+#endif
@@ -0,0 +1,255 @@
+#include <string.h>
+#include <batch.h>
+
+/* objects per transform task, small enough to spread a few thousand cubes over every processor */
+#define BATCH_TASK_OBJECTS 256
+
+typedef struct {
+	const batch_object_t *objects;
+	const guint *order;		/* object indices grouped by batch */
+	const guint *slot_batch;	/* batch of each slot of order */
+	const GLuint *vertex_base;	/* first vertex of each slot within its batch */
+	const GLuint *index_base;
+	batch_t *batches;
+	vec3 *min;			/* world bounds of each slot */
+	vec3 *max;
+} batch_job_t;
+
+typedef struct {
+	const batch_job_t *job;
+	guint first;
+	guint last;
+} batch_task_t;
+
+typedef struct {
+	const batch_object_t *objects;
+	const guint32 *codes;
+} batch_sort_t;
+
+static guint32 batch_spread(guint32 x)
+{
+	x &= 0x3ff;
+	x = (x | (x << 16)) & 0x030000ff;
+	x = (x | (x << 8)) & 0x0300f00f;
+	x = (x | (x << 4)) & 0x030c30c3;
+	x = (x | (x << 2)) & 0x09249249;
+
+	return x;
+}
+
+/* objects of one state go along a Morton curve, so neighbours in a batch are neighbours in space */
+static gint batch_compare(gconstpointer a, gconstpointer b, gpointer user_data)
+{
+	const batch_sort_t *sort = user_data;
+	const guint i = *(const guint *) a;
+	const guint j = *(const guint *) b;
+	const gint state = memcmp(&sort->objects[i].state, &sort->objects[j].state, sizeof (batch_state_t));
+
+	if (state != 0) {
+		return state;
+	}
+	if (sort->objects[i].mesh->mode != sort->objects[j].mesh->mode) {
+		return sort->objects[i].mesh->mode < sort->objects[j].mesh->mode ? -1 : 1;
+	}
+	if (sort->codes[i] != sort->codes[j]) {
+		return sort->codes[i] < sort->codes[j] ? -1 : 1;
+	}
+	return i < j ? -1 : i > j;
+}
+
+static void batch_transform(gpointer data, gpointer user_data)
+{
+	const batch_task_t *task = data;
+	const batch_job_t *job = task->job;
+
+	for (guint slot = task->first; slot < task->last; ++slot) {
+		const batch_object_t *object = &job->objects[job->order[slot]];
+		const mesh_t *source = object->mesh;
+		mesh_t *target = job->batches[job->slot_batch[slot]].mesh;
+		const mat3 normal = mat3_normal(object->model);
+		const GLuint base = job->vertex_base[slot];
+		vertex_t *vertices = target->vertices + base;
+		GLuint *indices = target->indices + job->index_base[slot];
+		vec3 min = { G_MAXFLOAT, G_MAXFLOAT, G_MAXFLOAT };
+		vec3 max = { -G_MAXFLOAT, -G_MAXFLOAT, -G_MAXFLOAT };
+
+		for (GLuint v = 0; v < source->vertex_count; ++v) {
+			const vertex_t *vertex = &source->vertices[v];
+			const vec4 position = mat4_mulv(object->model, (vec4) { vertex->position.x, vertex->position.y, vertex->position.z, 1.0f });
+
+			vertices[v] = (vertex_t) {
+				.position = { position.x, position.y, position.z },
+				.normal = vec3_normalize(mat3_mulv(normal, vertex->normal)),
+				.texture = vertex->texture
+			};
+			min = (vec3) { MIN(min.x, position.x), MIN(min.y, position.y), MIN(min.z, position.z) };
+			max = (vec3) { MAX(max.x, position.x), MAX(max.y, position.y), MAX(max.z, position.z) };
+		}
+		for (GLuint i = 0; i < source->index_count; ++i) {
+			indices[i] = source->indices[i] == MESH_RESTART_INDEX ? MESH_RESTART_INDEX : source->indices[i] + base;
+		}
+		job->min[slot] = min;
+		job->max[slot] = max;
+	}
+}
+
+/*
+ * Merges objects that never move into as few meshes as their states allow.
+ * Objects with equal state and primitive mode are ordered along a Morton
+ * curve of their position and cut into batches of up to BATCH_VERTEX_MAX
+ * vertices. Vertices are then transformed into world space on a thread
+ * pool, each task writing its own range of the preallocated batch meshes.
+ * Returns the batches, to be released with batch_free().
+ */
+batch_t *batch_build(const batch_object_t *objects, guint count, guint *batch_count)
+{
+	guint *order = g_new(guint, count);
+	guint32 *codes = g_new(guint32, count);
+	vec3 low = { G_MAXFLOAT, G_MAXFLOAT, G_MAXFLOAT };
+	vec3 high = { -G_MAXFLOAT, -G_MAXFLOAT, -G_MAXFLOAT };
+
+	for (guint i = 0; i < count; ++i) {
+		const mat4 *model = &objects[i].model;
+
+		low = (vec3) { MIN(low.x, model->a14), MIN(low.y, model->a24), MIN(low.z, model->a34) };
+		high = (vec3) { MAX(high.x, model->a14), MAX(high.y, model->a24), MAX(high.z, model->a34) };
+	}
+	for (guint i = 0; i < count; ++i) {
+		const mat4 *model = &objects[i].model;
+		const vec3 extent = vec3_sub(high, low);
+		const guint32 x = extent.x > 0.0f ? 1023.0f * (model->a14 - low.x) / extent.x : 0;
+		const guint32 y = extent.y > 0.0f ? 1023.0f * (model->a24 - low.y) / extent.y : 0;
+		const guint32 z = extent.z > 0.0f ? 1023.0f * (model->a34 - low.z) / extent.z : 0;
+
+		order[i] = i;
+		codes[i] = batch_spread(x) | batch_spread(y) << 1 | batch_spread(z) << 2;
+	}
+
+	batch_sort_t sort = { objects, codes };
+
+	g_qsort_with_data(order, count, sizeof (guint), batch_compare, &sort);
+	g_free(codes);
+
+	guint *slot_batch = g_new(guint, count);
+	GLuint *vertex_base = g_new(GLuint, count);
+	GLuint *index_base = g_new(GLuint, count);
+	GArray *batches = g_array_new(FALSE, TRUE, sizeof (batch_t));
+	GLuint vertices = 0;
+	GLuint indices = 0;
+
+	for (guint slot = 0; slot < count; ++slot) {
+		const batch_object_t *object = &objects[order[slot]];
+		batch_t *batch = batches->len > 0 ? &g_array_index(batches, batch_t, batches->len - 1) : NULL;
+		const batch_object_t *previous = slot > 0 ? &objects[order[slot - 1]] : NULL;
+
+		/* the vertex limit gives way for a single object larger than it */
+		if (batch == NULL || memcmp(&previous->state, &object->state, sizeof (batch_state_t)) != 0 ||
+		    previous->mesh->mode != object->mesh->mode ||
+		    (vertices > 0 && vertices + object->mesh->vertex_count > BATCH_VERTEX_MAX)) {
+			const batch_t next = { .state = object->state };
+
+			if (batch != NULL) {
+				batch->mesh = mesh_new(vertices, indices);
+				batch->mesh->mode = previous->mesh->mode;
+			}
+			g_array_append_val(batches, next);
+			vertices = 0;
+			indices = 0;
+		}
+		slot_batch[slot] = batches->len - 1;
+		vertex_base[slot] = vertices;
+		index_base[slot] = indices;
+		vertices += object->mesh->vertex_count;
+		indices += object->mesh->index_count;
+		g_array_index(batches, batch_t, batches->len - 1).object_count++;
+	}
+	if (batches->len > 0) {
+		batch_t *batch = &g_array_index(batches, batch_t, batches->len - 1);
+
+		batch->mesh = mesh_new(vertices, indices);
+		batch->mesh->mode = objects[order[count - 1]].mesh->mode;
+	}
+
+	batch_job_t job = {
+		.objects = objects,
+		.order = order,
+		.slot_batch = slot_batch,
+		.vertex_base = vertex_base,
+		.index_base = index_base,
+		.batches = (batch_t *) batches->data,
+		.min = g_new(vec3, count),
+		.max = g_new(vec3, count)
+	};
+	const guint task_count = (count + BATCH_TASK_OBJECTS - 1) / BATCH_TASK_OBJECTS;
+	batch_task_t *tasks = g_new(batch_task_t, task_count);
+	GThreadPool *pool = g_thread_pool_new(batch_transform, NULL, g_get_num_processors(), FALSE, NULL);
+
+	for (guint t = 0; t < task_count; ++t) {
+		tasks[t] = (batch_task_t) { &job, t * BATCH_TASK_OBJECTS, MIN(count, (t + 1) * BATCH_TASK_OBJECTS) };
+		g_thread_pool_push(pool, &tasks[t], NULL);
+	}
+	g_thread_pool_free(pool, FALSE, TRUE);
+	g_free(tasks);
+
+	for (guint b = 0; b < batches->len; ++b) {
+		batch_t *batch = &g_array_index(batches, batch_t, b);
+
+		batch->min = (vec3) { G_MAXFLOAT, G_MAXFLOAT, G_MAXFLOAT };
+		batch->max = (vec3) { -G_MAXFLOAT, -G_MAXFLOAT, -G_MAXFLOAT };
+	}
+	for (guint slot = 0; slot < count; ++slot) {
+		batch_t *batch = &g_array_index(batches, batch_t, slot_batch[slot]);
+		const vec3 min = job.min[slot];
+		const vec3 max = job.max[slot];
+
+		batch->min = (vec3) { MIN(batch->min.x, min.x), MIN(batch->min.y, min.y), MIN(batch->min.z, min.z) };
+		batch->max = (vec3) { MAX(batch->max.x, max.x), MAX(batch->max.y, max.y), MAX(batch->max.z, max.z) };
+	}
+
+	g_free(job.min);
+	g_free(job.max);
+	g_free(index_base);
+	g_free(vertex_base);
+	g_free(slot_batch);
+	g_free(order);
+
+	*batch_count = batches->len;
+
+	return (batch_t *) g_array_free(batches, FALSE);
+}
+
+void batch_free(batch_t *batches, guint count)
+{
+	for (guint b = 0; b < count; ++b) {
+		mesh_free(batches[b].mesh);
+	}
+	g_free(batches);
+}
+
+/* conservative: FALSE only when all corners of the bounds are outside one clip plane */
+gboolean batch_visible(const batch_t *batch, const mat4 *view_projection)
+{
+	guint outside[6] = { 0 };
+
+	for (guint corner = 0; corner < 8; ++corner) {
+		const vec4 p = mat4_mulv(*view_projection, (vec4) {
+			corner & 1 ? batch->max.x : batch->min.x,
+			corner & 2 ? batch->max.y : batch->min.y,
+			corner & 4 ? batch->max.z : batch->min.z,
+			1.0f
+		});
+
+		outside[0] += p.x < -p.w;
+		outside[1] += p.x > p.w;
+		outside[2] += p.y < -p.w;
+		outside[3] += p.y > p.w;
+		outside[4] += p.z < -p.w;
+		outside[5] += p.z > p.w;
+	}
+	for (guint plane = 0; plane < G_N_ELEMENTS(outside); ++plane) {
+		if (outside[plane] == 8) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
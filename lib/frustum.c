@@ -0,0 +1,50 @@
+#include <math.h>
+#include <frustum.h>
+
+static vec4 frustum_plane(vec4 plane)
+{
+	const GLfloat length = sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+
+	return (vec4) { plane.x / length, plane.y / length, plane.z / length, plane.w / length };
+}
+
+/* Gribb and Hartmann: each plane is the last row of the matrix plus or minus one of the others */
+frustum_t frustum_from_matrix(const mat4 *m)
+{
+	const vec4 x = { m->a11, m->a12, m->a13, m->a14 };
+	const vec4 y = { m->a21, m->a22, m->a23, m->a24 };
+	const vec4 z = { m->a31, m->a32, m->a33, m->a34 };
+	const vec4 w = { m->a41, m->a42, m->a43, m->a44 };
+
+	return (frustum_t) { {
+		frustum_plane((vec4) { w.x + x.x, w.y + x.y, w.z + x.z, w.w + x.w }),
+		frustum_plane((vec4) { w.x - x.x, w.y - x.y, w.z - x.z, w.w - x.w }),
+		frustum_plane((vec4) { w.x + y.x, w.y + y.y, w.z + y.z, w.w + y.w }),
+		frustum_plane((vec4) { w.x - y.x, w.y - y.y, w.z - y.z, w.w - y.w }),
+		frustum_plane((vec4) { w.x + z.x, w.y + z.y, w.z + z.z, w.w + z.w }),
+		frustum_plane((vec4) { w.x - z.x, w.y - z.y, w.z - z.z, w.w - z.w })
+	} };
+}
+
+/* conservative, spheres near a frustum corner may pass although they are outside */
+gboolean frustum_sphere(const frustum_t *frustum, vec3 center, GLfloat radius)
+{
+	for (guint i = 0; i < G_N_ELEMENTS(frustum->planes); ++i) {
+		const vec4 plane = frustum->planes[i];
+
+		if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+/* the largest axis scale of model, which bounding sphere radii grow with */
+GLfloat frustum_scale(const mat4 *m)
+{
+	const GLfloat x = m->a11 * m->a11 + m->a21 * m->a21 + m->a31 * m->a31;
+	const GLfloat y = m->a12 * m->a12 + m->a22 * m->a22 + m->a32 * m->a32;
+	const GLfloat z = m->a13 * m->a13 + m->a23 * m->a23 + m->a33 * m->a33;
+
+	return sqrt(MAX(x, MAX(y, z)));
+}
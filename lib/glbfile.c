@@ -0,0 +1,571 @@
+#include <string.h>
+#include <sys/mman.h>
+#include <json-glib/json-glib.h>
+#include <glbfile.h>
+
+G_STATIC_ASSERT(G_BYTE_ORDER == G_LITTLE_ENDIAN);
+
+typedef struct {
+	guint32 magic;
+	guint32 version;
+	guint32 length;
+} glbfile_header_t;
+
+typedef struct {
+	guint32 length;
+	guint32 type;
+} glbfile_chunk_t;
+
+G_DEFINE_QUARK(glbfile-error-quark, glbfile_error)
+
+static const gchar *const attribute_names[MESH_ATTRIB_COUNT] = {
+	"POSITION",
+	"NORMAL",
+	"TEXCOORD_0"
+};
+
+static const GLint attribute_sizes[MESH_ATTRIB_COUNT] = { 3, 3, 2 };
+
+static JsonArray *member_array(JsonObject *object, const gchar *name)
+{
+	JsonNode *node = object != NULL ? json_object_get_member(object, name) : NULL;
+
+	return node != NULL && JSON_NODE_HOLDS_ARRAY(node) ? json_node_get_array(node) : NULL;
+}
+
+static JsonObject *member_object(JsonObject *object, const gchar *name)
+{
+	JsonNode *node = object != NULL ? json_object_get_member(object, name) : NULL;
+
+	return node != NULL && JSON_NODE_HOLDS_OBJECT(node) ? json_node_get_object(node) : NULL;
+}
+
+static gint64 member_int(JsonObject *object, const gchar *name, gint64 fallback)
+{
+	JsonNode *node = object != NULL ? json_object_get_member(object, name) : NULL;
+
+	return node != NULL && JSON_NODE_HOLDS_VALUE(node) ? json_node_get_int(node) : fallback;
+}
+
+/* FALSE unless name is an array of exactly count numbers */
+static gboolean member_floats(JsonObject *object, const gchar *name, GLfloat *values, guint count)
+{
+	JsonArray *array = member_array(object, name);
+
+	if (array == NULL || json_array_get_length(array) != count) {
+		return FALSE;
+	}
+	for (guint i = 0; i < count; ++i) {
+		values[i] = json_array_get_double_element(array, i);
+	}
+	return TRUE;
+}
+
+static guint array_length(JsonArray *array)
+{
+	return array != NULL ? json_array_get_length(array) : 0;
+}
+
+static JsonObject *element_object(JsonArray *array, guint index)
+{
+	JsonNode *node = json_array_get_element(array, index);
+
+	return JSON_NODE_HOLDS_OBJECT(node) ? json_node_get_object(node) : NULL;
+}
+
+static GLint accessor_size(const gchar *type)
+{
+	if (g_strcmp0(type, "SCALAR") == 0) {
+		return 1;
+	}
+	if (g_strcmp0(type, "VEC2") == 0) {
+		return 2;
+	}
+	if (g_strcmp0(type, "VEC3") == 0) {
+		return 3;
+	}
+	if (g_strcmp0(type, "VEC4") == 0) {
+		return 4;
+	}
+	/* matrices never feed a vertex attribute here */
+	return 0;
+}
+
+static vertex_attrib_t accessor_attrib(const glbfile_accessor_t *accessor, mesh_attrib_t semantic)
+{
+	return (vertex_attrib_t) {
+		.semantic = semantic,
+		.size = accessor->size,
+		.normalized = accessor->normalized,
+		/* glTF positions are always floats, so nothing needs vertex_format_decode() */
+		.encoding = accessor->type == GL_UNSIGNED_SHORT && accessor->normalized ? VERTEX_UNORM16 : VERTEX_FLOAT,
+		.type = accessor->type,
+		.offset = accessor->offset
+	};
+}
+
+static gboolean accessor_type_valid(const glbfile_accessor_t *accessor, gint semantic)
+{
+	switch (semantic) {
+	case MESH_ATTRIB_POSITION:
+	case MESH_ATTRIB_NORMAL:
+		return accessor->type == GL_FLOAT;
+	case MESH_ATTRIB_TEXTURE:
+		return accessor->type == GL_FLOAT || (accessor->normalized && (accessor->type == GL_UNSIGNED_BYTE || accessor->type == GL_UNSIGNED_SHORT));
+	}
+	return !accessor->normalized && (accessor->type == GL_UNSIGNED_BYTE || accessor->type == GL_UNSIGNED_SHORT || accessor->type == GL_UNSIGNED_INT);
+}
+
+/* an attribute for semantic, or indices when semantic is -1, that GL can read from its view as it is */
+static gboolean accessor_validate(glbfile_t *file, const gboolean *resident, gint index, gint semantic, GError **error)
+{
+	const gchar *name = semantic >= 0 ? attribute_names[semantic] : "indices";
+
+	if (index < 0 || (guint) index >= file->accessor_count) {
+		g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_INVALID, "invalid %s accessor #%d", name, index);
+		return FALSE;
+	}
+
+	const glbfile_accessor_t *accessor = &file->accessors[index];
+
+	if (accessor->view < 0 || resident[accessor->view] == FALSE) {
+		g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_UNSUPPORTED, "%s accessor #%d is sparse, empty or outside the BIN chunk", name, index);
+		return FALSE;
+	}
+	if (accessor->size != (semantic >= 0 ? attribute_sizes[semantic] : 1) || accessor_type_valid(accessor, semantic) == FALSE) {
+		g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_INVALID, "%s accessor #%d has the wrong type", name, index);
+		return FALSE;
+	}
+
+	glbfile_view_t *view = &file->views[accessor->view];
+	const vertex_attrib_t attrib = accessor_attrib(accessor, semantic);
+	const gsize component = vertex_attrib_bytes(&attrib) / accessor->size;
+	const gsize element = vertex_attrib_bytes(&attrib);
+	const gsize stride = view->stride != 0 ? view->stride : element;
+
+	if ((view->offset + accessor->offset) % component != 0 || (semantic < 0 && view->stride != 0)) {
+		g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_INVALID, "%s accessor #%d is misaligned", name, index);
+		return FALSE;
+	}
+	if (accessor->count > 0 && accessor->offset + stride * (accessor->count - 1) + element > view->length) {
+		g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_INVALID, "%s accessor #%d overruns its view", name, index);
+		return FALSE;
+	}
+	view->target = semantic >= 0 ? GL_ARRAY_BUFFER : GL_ELEMENT_ARRAY_BUFFER;
+
+	return TRUE;
+}
+
+/* bounds are mandatory for positions, but cheap enough to recover from the mapped data */
+static void primitive_bounds(const glbfile_t *file, JsonObject *json, glbfile_primitive_t *primitive)
+{
+	const glbfile_accessor_t *accessor = &file->accessors[primitive->attributes[MESH_ATTRIB_POSITION]];
+	const glbfile_view_t *view = &file->views[accessor->view];
+
+	if (member_floats(json, "min", &primitive->min.x, 3) && member_floats(json, "max", &primitive->max.x, 3)) {
+		return;
+	}
+
+	const guint8 *data = file->bin + view->offset + accessor->offset;
+	const gsize stride = view->stride != 0 ? view->stride : sizeof (vec3);
+
+	primitive->min = (vec3) { G_MAXFLOAT, G_MAXFLOAT, G_MAXFLOAT };
+	primitive->max = (vec3) { -G_MAXFLOAT, -G_MAXFLOAT, -G_MAXFLOAT };
+	for (guint32 i = 0; i < accessor->count; ++i, data += stride) {
+		vec3 p;
+
+		memcpy(&p, data, sizeof p);
+		primitive->min = (vec3) { MIN(primitive->min.x, p.x), MIN(primitive->min.y, p.y), MIN(primitive->min.z, p.z) };
+		primitive->max = (vec3) { MAX(primitive->max.x, p.x), MAX(primitive->max.y, p.y), MAX(primitive->max.z, p.z) };
+	}
+}
+
+static gboolean glbfile_parse_buffers(glbfile_t *file, JsonObject *root, gboolean **resident, GError **error)
+{
+	JsonArray *buffers = member_array(root, "buffers");
+	JsonArray *views = member_array(root, "bufferViews");
+	JsonArray *accessors = member_array(root, "accessors");
+	/* only buffer 0 without an uri lives in the BIN chunk, anything else is never uploaded */
+	const gboolean embedded = file->bin != NULL && array_length(buffers) > 0 && element_object(buffers, 0) != NULL &&
+		json_object_has_member(element_object(buffers, 0), "uri") == FALSE;
+
+	file->view_count = array_length(views);
+	file->views = g_new0(glbfile_view_t, file->view_count);
+	*resident = g_new0(gboolean, file->view_count);
+	for (guint i = 0; i < file->view_count; ++i) {
+		JsonObject *json = element_object(views, i);
+		const gint64 buffer = member_int(json, "buffer", -1);
+		const gint64 offset = member_int(json, "byteOffset", 0);
+		const gint64 length = member_int(json, "byteLength", 0);
+		const gint64 stride = member_int(json, "byteStride", 0);
+
+		if (json == NULL || offset < 0 || length < 0 || stride < 0 || stride > 252) {
+			g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_INVALID, "invalid buffer view #%u", i);
+			return FALSE;
+		}
+		file->views[i] = (glbfile_view_t) { offset, length, stride, 0 };
+		(*resident)[i] = embedded && buffer == 0 && offset <= (gint64) file->bin_length && length <= (gint64) file->bin_length - offset;
+	}
+
+	file->accessor_count = array_length(accessors);
+	file->accessors = g_new0(glbfile_accessor_t, file->accessor_count);
+	for (guint i = 0; i < file->accessor_count; ++i) {
+		JsonObject *json = element_object(accessors, i);
+		const gint64 view = member_int(json, "bufferView", -1);
+		const gint64 offset = member_int(json, "byteOffset", 0);
+		const gint64 count = member_int(json, "count", 0);
+
+		if (json == NULL || view >= file->view_count || offset < 0 || count < 0 || count > G_MAXUINT32) {
+			g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_INVALID, "invalid accessor #%u", i);
+			return FALSE;
+		}
+		file->accessors[i] = (glbfile_accessor_t) {
+			/* sparse accessors would need a patched copy, they are treated like missing data */
+			.view = json_object_has_member(json, "sparse") ? -1 : view,
+			.offset = MIN(offset, G_MAXUINT32),
+			.count = count,
+			.type = member_int(json, "componentType", 0),
+			.size = accessor_size(json_object_get_string_member_with_default(json, "type", NULL)),
+			.normalized = json_object_get_boolean_member_with_default(json, "normalized", FALSE)
+		};
+	}
+
+	return TRUE;
+}
+
+static gboolean glbfile_parse_meshes(glbfile_t *file, JsonObject *root, const gboolean *resident, GError **error)
+{
+	JsonArray *meshes = member_array(root, "meshes");
+	JsonArray *accessors = member_array(root, "accessors");
+	GArray *primitives = g_array_new(FALSE, FALSE, sizeof (glbfile_primitive_t));
+	gboolean result = TRUE;
+
+	file->mesh_count = array_length(meshes);
+	file->meshes = g_new0(glbfile_mesh_t, file->mesh_count);
+	for (guint m = 0; m < file->mesh_count && result; ++m) {
+		JsonArray *list = member_array(element_object(meshes, m), "primitives");
+
+		file->meshes[m].first = primitives->len;
+		for (guint p = 0; p < array_length(list) && result; ++p) {
+			JsonObject *json = element_object(list, p);
+			JsonObject *attributes = member_object(json, "attributes");
+			glbfile_primitive_t primitive = {
+				.mode = member_int(json, "mode", GL_TRIANGLES),
+				.indices = member_int(json, "indices", -1),
+				.material = member_int(json, "material", -1)
+			};
+
+			for (guint k = 0; k < MESH_ATTRIB_COUNT; ++k) {
+				primitive.attributes[k] = member_int(attributes, attribute_names[k], -1);
+				if (result && (k == MESH_ATTRIB_POSITION || primitive.attributes[k] >= 0)) {
+					result = accessor_validate(file, resident, primitive.attributes[k], k, error);
+				}
+			}
+			if (result && primitive.indices >= 0) {
+				result = accessor_validate(file, resident, primitive.indices, -1, error);
+			}
+			if (result && primitive.mode > GL_TRIANGLE_FAN) {
+				g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_INVALID, "invalid mode %u", primitive.mode);
+				result = FALSE;
+			}
+			if (result) {
+				primitive_bounds(file, element_object(accessors, primitive.attributes[MESH_ATTRIB_POSITION]), &primitive);
+				g_array_append_val(primitives, primitive);
+			}
+			else {
+				g_prefix_error(error, "mesh #%u primitive #%u: ", m, p);
+			}
+		}
+		file->meshes[m].count = primitives->len - file->meshes[m].first;
+	}
+
+	file->primitive_count = primitives->len;
+	file->primitives = (glbfile_primitive_t *) g_array_free(primitives, FALSE);
+
+	return result;
+}
+
+/* translation, rotation quaternion and scale, applied in reverse */
+static mat4 node_local(JsonObject *json)
+{
+	mat4 local;
+	vec3 translation = { 0.0f, 0.0f, 0.0f };
+	vec4 q = { 0.0f, 0.0f, 0.0f, 1.0f };
+	vec3 scale = { 1.0f, 1.0f, 1.0f };
+
+	/* both are column major */
+	if (member_floats(json, "matrix", &local.a11, 16)) {
+		return local;
+	}
+	member_floats(json, "translation", &translation.x, 3);
+	member_floats(json, "rotation", &q.x, 4);
+	member_floats(json, "scale", &scale.x, 3);
+
+	const mat4 rotation = {
+		.a11 = 1.0f - 2.0f * (q.y * q.y + q.z * q.z),
+		.a12 = 2.0f * (q.x * q.y - q.z * q.w),
+		.a13 = 2.0f * (q.x * q.z + q.y * q.w),
+		.a21 = 2.0f * (q.x * q.y + q.z * q.w),
+		.a22 = 1.0f - 2.0f * (q.x * q.x + q.z * q.z),
+		.a23 = 2.0f * (q.y * q.z - q.x * q.w),
+		.a31 = 2.0f * (q.x * q.z - q.y * q.w),
+		.a32 = 2.0f * (q.y * q.z + q.x * q.w),
+		.a33 = 1.0f - 2.0f * (q.x * q.x + q.y * q.y),
+		.a44 = 1.0f
+	};
+
+	return mat4_mul(mat4_translation(translation), mat4_mul(rotation, mat4_scaling(scale)));
+}
+
+/* flattens the default scene, or every parentless node without one, into depth first order */
+static gboolean glbfile_parse_nodes(glbfile_t *file, JsonObject *root, GError **error)
+{
+	JsonArray *nodes = member_array(root, "nodes");
+	JsonArray *scenes = member_array(root, "scenes");
+	const guint count = array_length(nodes);
+	const gint64 scene = member_int(root, "scene", 0);
+	gint *parents = g_new(gint, count);
+	gboolean *visited = g_new0(gboolean, count);
+	GArray *stack = g_array_new(FALSE, FALSE, sizeof (gint));
+	GArray *output = g_array_new(FALSE, FALSE, sizeof (glbfile_node_t));
+	gboolean result = TRUE;
+
+	for (guint i = 0; i < count; ++i) {
+		parents[i] = -1;
+	}
+	for (guint i = 0; i < count && result; ++i) {
+		JsonArray *children = member_array(element_object(nodes, i), "children");
+
+		for (guint c = 0; c < array_length(children) && result; ++c) {
+			const gint64 child = json_array_get_int_element(children, c);
+
+			if (child < 0 || child >= count || parents[child] >= 0 || child == i) {
+				g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_INVALID, "invalid child #%" G_GINT64_FORMAT " of node #%u", child, i);
+				result = FALSE;
+			}
+			else {
+				parents[child] = i;
+			}
+		}
+	}
+
+	JsonArray *roots = scene >= 0 && scene < array_length(scenes) ? member_array(element_object(scenes, scene), "nodes") : NULL;
+
+	/* pushed in reverse so the first root comes out first, each entry is node then output parent */
+	for (gint r = (roots != NULL ? array_length(roots) : count) - 1; r >= 0 && result; --r) {
+		const gint node = roots != NULL ? json_array_get_int_element(roots, r) : r;
+		const gint parent = -1;
+
+		if (roots != NULL && (node < 0 || (guint) node >= count || parents[node] >= 0)) {
+			g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_INVALID, "invalid root node #%d", node);
+			result = FALSE;
+		}
+		else if (parents[node] < 0) {
+			g_array_append_val(stack, parent);
+			g_array_append_val(stack, node);
+		}
+	}
+	while (stack->len > 0 && result) {
+		const gint node = g_array_index(stack, gint, stack->len - 1);
+		const gint parent = g_array_index(stack, gint, stack->len - 2);
+		JsonObject *json = element_object(nodes, node);
+		JsonArray *children = member_array(json, "children");
+		glbfile_node_t output_node = {
+			.local = node_local(json),
+			.parent = parent,
+			.mesh = member_int(json, "mesh", -1)
+		};
+
+		g_array_set_size(stack, stack->len - 2);
+		if (visited[node] || output_node.mesh >= (gint) file->mesh_count) {
+			g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_INVALID, "invalid node #%d", node);
+			result = FALSE;
+			break;
+		}
+		visited[node] = TRUE;
+		output_node.world = parent >= 0 ? mat4_mul(g_array_index(output, glbfile_node_t, parent).world, output_node.local) : output_node.local;
+
+		const gint index = output->len;
+
+		g_array_append_val(output, output_node);
+		for (gint c = array_length(children) - 1; c >= 0; --c) {
+			const gint child = json_array_get_int_element(children, c);
+
+			g_array_append_val(stack, index);
+			g_array_append_val(stack, child);
+		}
+	}
+
+	file->node_count = output->len;
+	file->nodes = (glbfile_node_t *) g_array_free(output, FALSE);
+	g_array_free(stack, TRUE);
+	g_free(visited);
+	g_free(parents);
+
+	return result;
+}
+
+static gboolean glbfile_parse(glbfile_t *file, const guint8 *data, gsize length, GError **error)
+{
+	const glbfile_header_t *header = (const glbfile_header_t *) data;
+
+	if (length < sizeof (glbfile_header_t) + sizeof (glbfile_chunk_t) || header->magic != GLBFILE_MAGIC) {
+		g_set_error_literal(error, GLBFILE_ERROR, GLBFILE_ERROR_INVALID, "not a glTF binary");
+		return FALSE;
+	}
+	if (header->version != GLBFILE_VERSION) {
+		g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_VERSION, "unsupported glTF version %u", header->version);
+		return FALSE;
+	}
+	length = MIN(length, header->length);
+
+	const glbfile_chunk_t *json = (const glbfile_chunk_t *) (data + sizeof (glbfile_header_t));
+	const gsize bin_offset = sizeof (glbfile_header_t) + sizeof (glbfile_chunk_t) + (gsize) json->length;
+
+	if (json->type != GLBFILE_CHUNK_JSON || json->length % 4 != 0 || bin_offset > length) {
+		g_set_error_literal(error, GLBFILE_ERROR, GLBFILE_ERROR_INVALID, "invalid JSON chunk");
+		return FALSE;
+	}
+	if (bin_offset + sizeof (glbfile_chunk_t) <= length) {
+		const glbfile_chunk_t *bin = (const glbfile_chunk_t *) (data + bin_offset);
+
+		if (bin->type == GLBFILE_CHUNK_BIN && bin->length <= length - bin_offset - sizeof (glbfile_chunk_t)) {
+			file->bin = data + bin_offset + sizeof (glbfile_chunk_t);
+			file->bin_length = bin->length;
+		}
+	}
+
+	JsonParser *parser = json_parser_new();
+	gboolean *resident = NULL;
+	gboolean result = json_parser_load_from_data(parser, (const gchar *) (json + 1), json->length, error);
+
+	if (result) {
+		JsonNode *node = json_parser_get_root(parser);
+		JsonObject *root = node != NULL && JSON_NODE_HOLDS_OBJECT(node) ? json_node_get_object(node) : NULL;
+		JsonObject *asset = member_object(root, "asset");
+		const gchar *version = asset != NULL ? json_object_get_string_member_with_default(asset, "version", "") : "";
+
+		if (root == NULL || g_str_has_prefix(version, "2.") == FALSE) {
+			g_set_error(error, GLBFILE_ERROR, GLBFILE_ERROR_VERSION, "unsupported glTF asset version '%s'", version);
+			result = FALSE;
+		}
+		result = result && glbfile_parse_buffers(file, root, &resident, error);
+		result = result && glbfile_parse_meshes(file, root, resident, error);
+		result = result && glbfile_parse_nodes(file, root, error);
+	}
+	g_free(resident);
+	g_object_unref(parser);
+
+	return result;
+}
+
+/*
+ * Maps a .glb file and resolves its default scene. Nothing is copied: the
+ * views, accessors and primitives describe ranges of the mapped BIN chunk,
+ * which stays mapped until glbfile_close().
+ */
+glbfile_t *glbfile_open(const gchar *filename, GError **error)
+{
+	GMappedFile *mapped = g_mapped_file_new(filename, FALSE, error);
+
+	if (mapped == NULL) {
+		return NULL;
+	}
+
+	const gsize length = g_mapped_file_get_length(mapped);
+	const guint8 *data = (const guint8 *) g_mapped_file_get_contents(mapped);
+	glbfile_t *file = g_new0(glbfile_t, 1);
+
+	file->mapped = mapped;
+	if (glbfile_parse(file, data, length, error) == FALSE) {
+		g_prefix_error(error, "%s: ", filename);
+		glbfile_close(file);
+		return NULL;
+	}
+
+	/* start paging the BIN chunk in while the caller sets up the GL objects */
+	if (file->bin_length > 0) {
+		const gsize start = (file->bin - data) & ~((gsize) 4095);
+
+		madvise((void *) (data + start), file->bin - data - start + file->bin_length, MADV_WILLNEED);
+	}
+
+	return file;
+}
+
+void glbfile_close(glbfile_t *file)
+{
+	if (file == NULL) {
+		return;
+	}
+	g_mapped_file_unref(file->mapped);
+	g_free(file->views);
+	g_free(file->accessors);
+	g_free(file->primitives);
+	g_free(file->meshes);
+	g_free(file->nodes);
+	g_free(file);
+}
+
+/*
+ * buffers holds view_count names from glGenBuffers(). Every view a primitive
+ * reads is uploaded straight from the mapped pages, the others stay empty.
+ * GL_ARRAY_BUFFER is used for all of them so that the element array binding
+ * of the current vertex array is left alone.
+ */
+void glbfile_upload(const glbfile_t *file, GLuint *buffers)
+{
+	const gboolean storage = epoxy_gl_version() >= 44 || epoxy_has_gl_extension("GL_ARB_buffer_storage");
+
+	for (guint i = 0; i < file->view_count; ++i) {
+		const glbfile_view_t *view = &file->views[i];
+
+		if (view->target == 0) {
+			continue;
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[i]);
+		if (storage) {
+			glBufferStorage(GL_ARRAY_BUFFER, view->length, file->bin + view->offset, 0);
+		}
+		else {
+			glBufferData(GL_ARRAY_BUFFER, view->length, file->bin + view->offset, GL_STATIC_DRAW);
+		}
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void glbfile_attrib_pointer(const glbfile_t *file, const glbfile_primitive_t *primitive, mesh_attrib_t semantic, const GLuint *buffers, GLint index)
+{
+	if (primitive->attributes[semantic] < 0) {
+		if (index >= 0) {
+			glDisableVertexAttribArray(index);
+		}
+		return;
+	}
+
+	const glbfile_accessor_t *accessor = &file->accessors[primitive->attributes[semantic]];
+	const vertex_attrib_t attrib = accessor_attrib(accessor, semantic);
+
+	glBindBuffer(GL_ARRAY_BUFFER, buffers[accessor->view]);
+	vertex_attrib_pointer(&attrib, file->views[accessor->view].stride, index);
+}
+
+/* attaches the index view to the currently bound vertex array */
+void glbfile_bind_indices(const glbfile_t *file, const glbfile_primitive_t *primitive, const GLuint *buffers)
+{
+	if (primitive->indices >= 0) {
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[file->accessors[primitive->indices].view]);
+	}
+}
+
+void glbfile_draw(const glbfile_t *file, const glbfile_primitive_t *primitive)
+{
+	if (primitive->indices >= 0) {
+		const glbfile_accessor_t *indices = &file->accessors[primitive->indices];
+
+		glDrawElements(primitive->mode, indices->count, indices->type, (const GLvoid *) (gsize) indices->offset);
+	}
+	else {
+		glDrawArrays(primitive->mode, 0, file->accessors[primitive->attributes[MESH_ATTRIB_POSITION]].count);
+	}
+}
@@ -0,0 +1,285 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <glib/gstdio.h>
+#include <image_decode.h>
+#ifdef HAVE_JPEG
+#include <setjmp.h>
+#include <jpeglib.h>
+#endif
+#ifdef HAVE_PNG
+#include <png.h>
+#endif
+
+/* the power of two, up to 8, that reduces size the most without going under max_size */
+static guint image_reduction(guint size, gint max_size)
+{
+	guint reduction = 1;
+
+	while (reduction < 8 && (size + 2 * reduction - 1) / (2 * reduction) >= (guint) max_size) {
+		reduction *= 2;
+	}
+	return reduction;
+}
+
+#ifdef HAVE_JPEG
+typedef struct {
+	struct jpeg_error_mgr manager;
+	jmp_buf jump;
+} image_jpeg_error_t;
+
+static void image_jpeg_error_exit(j_common_ptr info)
+{
+	longjmp(((image_jpeg_error_t *) info->err)->jump, 1);
+}
+
+/* corrupt data warnings, gdk-pixbuf gets to report them on the full decode */
+static void image_jpeg_output_message(j_common_ptr info)
+{
+}
+
+/* NULL for anything libjpeg does not decode to RGB, or decodes with an error */
+static GdkPixbuf *image_decode_jpeg(FILE *file, gint max_size)
+{
+	struct jpeg_decompress_struct info;
+	image_jpeg_error_t error;
+	GdkPixbuf *volatile pixbuf = NULL;
+
+	info.err = jpeg_std_error(&error.manager);
+	error.manager.error_exit = image_jpeg_error_exit;
+	error.manager.output_message = image_jpeg_output_message;
+	if (setjmp(error.jump)) {
+		jpeg_destroy_decompress(&info);
+		if (pixbuf != NULL) {
+			g_object_unref(G_OBJECT(pixbuf));
+		}
+		return NULL;
+	}
+
+	jpeg_create_decompress(&info);
+	jpeg_stdio_src(&info, file);
+	jpeg_read_header(&info, TRUE);
+	if (info.jpeg_color_space == JCS_CMYK || info.jpeg_color_space == JCS_YCCK) {
+		jpeg_destroy_decompress(&info);
+		return NULL;
+	}
+	info.out_color_space = info.num_components == 1 ? JCS_GRAYSCALE : JCS_RGB;
+	info.scale_num = 1;
+	info.scale_denom = image_reduction(MAX(info.image_width, info.image_height), max_size);
+	jpeg_start_decompress(&info);
+
+	pixbuf = gdk_pixbuf_new(GDK_COLORSPACE_RGB, FALSE, 8, info.output_width, info.output_height);
+	if (pixbuf == NULL) {
+		jpeg_destroy_decompress(&info);
+		return NULL;
+	}
+
+	guchar *pixels = gdk_pixbuf_get_pixels(pixbuf);
+	const gint rowstride = gdk_pixbuf_get_rowstride(pixbuf);
+
+	while (info.output_scanline < info.output_height) {
+		guchar *row = pixels + (gsize) info.output_scanline * rowstride;
+
+		jpeg_read_scanlines(&info, &row, 1);
+		/* grey into the start of the row, spread from the end so nothing is overwritten before it is read */
+		if (info.output_components == 1) {
+			for (guint x = info.output_width; x-- > 0;) {
+				row[3 * x] = row[3 * x + 1] = row[3 * x + 2] = row[x];
+			}
+		}
+	}
+	jpeg_finish_decompress(&info);
+	jpeg_destroy_decompress(&info);
+
+	return pixbuf;
+}
+#endif
+
+#ifdef HAVE_PNG
+static void image_png_warning(png_structp png, png_const_charp message)
+{
+}
+
+/* NULL unless the image is interlaced and large enough to reduce, or on errors */
+static GdkPixbuf *image_decode_png(FILE *file, gint max_size)
+{
+	png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, image_png_warning);
+	png_infop info = png != NULL ? png_create_info_struct(png) : NULL;
+	GdkPixbuf *volatile pixbuf = NULL;
+	guchar *volatile row = NULL;
+
+	if (info == NULL) {
+		png_destroy_read_struct(&png, NULL, NULL);
+		return NULL;
+	}
+	if (setjmp(png_jmpbuf(png))) {
+		png_destroy_read_struct(&png, &info, NULL);
+		if (pixbuf != NULL) {
+			g_object_unref(G_OBJECT(pixbuf));
+		}
+		g_free(row);
+		return NULL;
+	}
+
+	png_init_io(png, file);
+	png_read_info(png, info);
+
+	const png_uint_32 width = png_get_image_width(png, info);
+	const png_uint_32 height = png_get_image_height(png, info);
+	const guint reduction = image_reduction(MAX(width, height), max_size);
+
+	/* rows of a plain PNG follow one another, there is nothing to skip */
+	if (png_get_interlace_type(png, info) != PNG_INTERLACE_ADAM7 || reduction == 1) {
+		png_destroy_read_struct(&png, &info, NULL);
+		return NULL;
+	}
+	png_set_expand(png);
+	png_set_strip_16(png);
+	png_set_gray_to_rgb(png);
+	png_read_update_info(png, info);
+
+	const guint channels = png_get_channels(png, info);
+
+	pixbuf = gdk_pixbuf_new(GDK_COLORSPACE_RGB, channels == 4, 8, (width + reduction - 1) / reduction, (height + reduction - 1) / reduction);
+	if (pixbuf == NULL) {
+		png_destroy_read_struct(&png, &info, NULL);
+		return NULL;
+	}
+	row = g_malloc(png_get_rowbytes(png, info));
+
+	guchar *pixels = gdk_pixbuf_get_pixels(pixbuf);
+	const gint rowstride = gdk_pixbuf_get_rowstride(pixbuf);
+	/*
+	 * Without interlace handling every pass comes as its own small image.
+	 * Pass 0 holds the pixels on multiples of 8, passes 1 and 2 add those on
+	 * multiples of 4, passes 3 and 4 those on multiples of 2.
+	 */
+	const gint passes = reduction == 8 ? 1 : reduction == 4 ? 3 : 5;
+
+	for (gint pass = 0; pass < passes; ++pass) {
+		const png_uint_32 columns = PNG_PASS_COLS(width, pass);
+		const png_uint_32 rows = columns > 0 ? PNG_PASS_ROWS(height, pass) : 0;
+
+		for (png_uint_32 r = 0; r < rows; ++r) {
+			const png_uint_32 y = PNG_ROW_FROM_PASS_ROW(r, pass);
+
+			png_read_row(png, row, NULL);
+			if (y % reduction != 0) {
+				continue;
+			}
+			for (png_uint_32 c = 0; c < columns; ++c) {
+				const png_uint_32 x = PNG_COL_FROM_PASS_COL(c, pass);
+
+				if (x % reduction == 0) {
+					memcpy(pixels + (gsize) (y / reduction) * rowstride + (x / reduction) * channels, row + c * channels, channels);
+				}
+			}
+		}
+	}
+	png_destroy_read_struct(&png, &info, NULL);
+	g_free(row);
+
+	return pixbuf;
+}
+#endif
+
+/* the reduced decoders where they apply, NULL otherwise */
+#if defined(HAVE_JPEG) || defined(HAVE_PNG)
+static GdkPixbuf *image_decode_reduced(const gchar *filename, gint max_size)
+{
+	FILE *file = g_fopen(filename, "rb");
+	GdkPixbuf *pixbuf = NULL;
+
+	if (file == NULL) {
+		return NULL;
+	}
+
+	guchar magic[8] = { 0 };
+	const gsize length = fread(magic, 1, sizeof magic, file);
+
+	rewind(file);
+#ifdef HAVE_JPEG
+	if (length >= 3 && magic[0] == 0xff && magic[1] == 0xd8 && magic[2] == 0xff) {
+		pixbuf = image_decode_jpeg(file, max_size);
+	}
+#endif
+#ifdef HAVE_PNG
+	if (length == sizeof magic && png_sig_cmp(magic, 0, sizeof magic) == 0) {
+		pixbuf = image_decode_png(file, max_size);
+	}
+#endif
+	fclose(file);
+
+	return pixbuf;
+}
+#else
+static GdkPixbuf *image_decode_reduced(const gchar *filename, gint max_size)
+{
+	return NULL;
+}
+#endif
+
+/* returns NULL and sets error when filename cannot be decoded */
+GdkPixbuf *image_decode(const gchar *filename, gint max_size, GError **error)
+{
+	GdkPixbuf *pixbuf = max_size > 0 ? image_decode_reduced(filename, max_size) : NULL;
+
+	if (pixbuf == NULL) {
+		pixbuf = gdk_pixbuf_new_from_file(filename, error);
+	}
+	if (pixbuf == NULL) {
+		return NULL;
+	}
+
+	const gint width = gdk_pixbuf_get_width(pixbuf);
+	const gint height = gdk_pixbuf_get_height(pixbuf);
+
+	if (max_size > 0 && MAX(width, height) > max_size) {
+		const gdouble scale = (gdouble) max_size / MAX(width, height);
+		GdkPixbuf *scaled = gdk_pixbuf_scale_simple(pixbuf, MAX(1, lround(width * scale)), MAX(1, lround(height * scale)), GDK_INTERP_BILINEAR);
+
+		g_object_unref(G_OBJECT(pixbuf));
+		pixbuf = scaled;
+	}
+
+	return pixbuf;
+}
+
+/* what a decode worker gets, nothing of its caller */
+typedef struct {
+	gchar *filename;
+	gint max_size;
+} image_decode_request_t;
+
+static void image_decode_request_free(gpointer data)
+{
+	image_decode_request_t *request = data;
+
+	g_free(request->filename);
+	g_free(request);
+}
+
+/* on a worker of the GTask pool, nothing GL */
+static void image_decode_worker(GTask *task, gpointer source_object, gpointer task_data, GCancellable *cancellable)
+{
+	const image_decode_request_t *request = task_data;
+	GError *error = NULL;
+	GdkPixbuf *pixbuf = image_decode(request->filename, request->max_size, &error);
+
+	if (pixbuf == NULL) {
+		g_task_return_error(task, error);
+		return;
+	}
+	g_task_return_pointer(task, pixbuf, g_object_unref);
+}
+
+/* image_decode() on a worker, task returns the GdkPixbuf or the error */
+void image_decode_in_thread(GTask *task, const gchar *filename, gint max_size)
+{
+	image_decode_request_t *request = g_new(image_decode_request_t, 1);
+
+	request->filename = g_strdup(filename);
+	request->max_size = max_size;
+	g_task_set_task_data(task, request, image_decode_request_free);
+	g_task_run_in_thread(task, image_decode_worker);
+}
@@ -0,0 +1,34 @@
+#include <stddef.h>
+#include <instance.h>
+
+void instance_set(instance_t *instance, mat4 model, GLuint material)
+{
+	instance->model = model;
+	instance->normal = mat3_normal(model);
+	instance->material = material;
+}
+
+/*
+ * Sets up the instance attributes of the bound vertex array from the buffer
+ * bound to GL_ARRAY_BUFFER, which holds an array of instance_t. Matrices
+ * take one location per column. Locations below 0 are skipped, as
+ * glGetAttribLocation() returns for attributes the shader does not use.
+ */
+void instance_attrib_pointer(GLint model, GLint normal, GLint material)
+{
+	for (GLint column = 0; model >= 0 && column < 4; ++column) {
+		glVertexAttribPointer(model + column, 4, GL_FLOAT, GL_FALSE, sizeof (instance_t), (const GLvoid *) (offsetof(instance_t, model) + column * sizeof (vec4)));
+		glVertexAttribDivisor(model + column, 1);
+		glEnableVertexAttribArray(model + column);
+	}
+	for (GLint column = 0; normal >= 0 && column < 3; ++column) {
+		glVertexAttribPointer(normal + column, 3, GL_FLOAT, GL_FALSE, sizeof (instance_t), (const GLvoid *) (offsetof(instance_t, normal) + column * sizeof (vec3)));
+		glVertexAttribDivisor(normal + column, 1);
+		glEnableVertexAttribArray(normal + column);
+	}
+	if (material >= 0) {
+		glVertexAttribIPointer(material, 1, GL_UNSIGNED_INT, sizeof (instance_t), (const GLvoid *) offsetof(instance_t, material));
+		glVertexAttribDivisor(material, 1);
+		glEnableVertexAttribArray(material);
+	}
+}
@@ -0,0 +1,86 @@
+#include <mesh.h>
+
+mesh_t *mesh_new(GLuint vertex_count, GLuint index_count)
+{
+	mesh_t *mesh = g_new(mesh_t, 1);
+
+	mesh->vertices = g_new0(vertex_t, vertex_count);
+	mesh->vertex_count = vertex_count;
+	mesh->indices = g_new0(GLuint, index_count);
+	mesh->index_count = index_count;
+	mesh->mode = GL_TRIANGLES;
+
+	return mesh;
+}
+
+void mesh_free(mesh_t *mesh)
+{
+	if (mesh == NULL) {
+		return;
+	}
+	g_free(mesh->vertices);
+	g_free(mesh->indices);
+	g_free(mesh);
+}
+
+void mesh_bounds(const mesh_t *mesh, vec3 *min, vec3 *max)
+{
+	if (mesh->vertex_count == 0) {
+		*min = *max = vec3_zero();
+		return;
+	}
+
+	*min = *max = mesh->vertices[0].position;
+	for (GLuint i = 1; i < mesh->vertex_count; ++i) {
+		const vec3 p = mesh->vertices[i].position;
+
+		min->x = MIN(min->x, p.x);
+		min->y = MIN(min->y, p.y);
+		min->z = MIN(min->z, p.z);
+		max->x = MAX(max->x, p.x);
+		max->y = MAX(max->y, p.y);
+		max->z = MAX(max->z, p.z);
+	}
+}
+
+GLuint mesh_triangle_count(const mesh_t *mesh)
+{
+	if (mesh->mode != GL_TRIANGLE_STRIP) {
+		return mesh->index_count / 3;
+	}
+
+	GLuint count = 0;
+	GLuint length = 0;
+
+	for (GLuint i = 0; i < mesh->index_count; ++i) {
+		if (mesh->indices[i] == MESH_RESTART_INDEX) {
+			length = 0;
+		}
+		else if (++length >= 3) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/* restarts strips at the maximum value of index_type */
+void mesh_restart_enable(GLenum index_type)
+{
+	if (epoxy_gl_version() >= 43 || epoxy_has_gl_extension("GL_ARB_ES3_compatibility")) {
+		glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+		return;
+	}
+	glEnable(GL_PRIMITIVE_RESTART);
+	switch (index_type) {
+	case GL_UNSIGNED_BYTE:
+		glPrimitiveRestartIndex(G_MAXUINT8);
+		break;
+	case GL_UNSIGNED_SHORT:
+		glPrimitiveRestartIndex(G_MAXUINT16);
+		break;
+	default:
+		glPrimitiveRestartIndex(G_MAXUINT32);
+		break;
+	}
+}
@@ -0,0 +1,34 @@
+#include <math.h>
+#include <mesh_lod.h>
+
+/*
+ * Pixels covered by one object space unit at distance one for a
+ * perspective projection with vertical field of view fovy, drawn to a
+ * viewport height pixels high. Divide by the distance to the object and
+ * multiply by its scale to get the pixels per unit of an instance.
+ */
+GLfloat mesh_lod_scale(GLfloat fovy, GLint height)
+{
+	return height / (2.0f * tanf(fovy / 2.0f));
+}
+
+/*
+ * Picks the coarsest level whose error projects to at most threshold
+ * pixels. current is the level the instance used last frame: refining
+ * happens as soon as its error is visible, coarsening only when the next
+ * level stays below the hysteresis band, so an instance sitting near a
+ * switching distance does not flip between two levels every frame.
+ */
+GLuint mesh_lod_select(const mesh_lod_t *lods, GLuint count, GLfloat pixels, GLfloat threshold, GLuint current)
+{
+	GLuint lod = MIN(current, count - 1);
+
+	while (lod > 0 && lods[lod].error * pixels > threshold) {
+		lod--;
+	}
+	while (lod + 1 < count && lods[lod + 1].error * pixels <= threshold * MESH_LOD_HYSTERESIS) {
+		lod++;
+	}
+
+	return lod;
+}
@@ -0,0 +1,384 @@
+#include <stdlib.h>
+#include <string.h>
+#include <mesh_optimize.h>
+
+typedef struct {
+	GLuint *offsets;	/* vertex_count + 1 */
+	GLuint *triangles;
+} adjacency_t;
+
+typedef struct {
+	GLuint start;
+	GLuint end;
+	GLfloat sort;
+} cluster_t;
+
+static void adjacency_init(adjacency_t *adjacency, const GLuint *indices, GLuint index_count, GLuint vertex_count)
+{
+	GLuint *fill = g_new0(GLuint, vertex_count);
+
+	adjacency->offsets = g_new0(GLuint, vertex_count + 1);
+	adjacency->triangles = g_new(GLuint, index_count);
+
+	for (GLuint i = 0; i < index_count; ++i) {
+		adjacency->offsets[indices[i] + 1]++;
+	}
+	for (GLuint v = 0; v < vertex_count; ++v) {
+		adjacency->offsets[v + 1] += adjacency->offsets[v];
+	}
+	for (GLuint i = 0; i < index_count; ++i) {
+		const GLuint v = indices[i];
+
+		adjacency->triangles[adjacency->offsets[v] + fill[v]++] = i / 3;
+	}
+	g_free(fill);
+}
+
+static void adjacency_clear(adjacency_t *adjacency)
+{
+	g_free(adjacency->offsets);
+	g_free(adjacency->triangles);
+}
+
+/* FIFO emulation: a vertex is cached while fewer than cache_size misses happened since it was loaded */
+static GLuint cache_misses(const GLuint *indices, GLuint index_count, GLuint *timestamps, GLuint *time, GLuint cache_size)
+{
+	GLuint misses = 0;
+
+	for (GLuint i = 0; i < index_count; ++i) {
+		const GLuint v = indices[i];
+
+		if (v == MESH_RESTART_INDEX) {
+			continue;
+		}
+		if (*time - timestamps[v] >= cache_size) {
+			timestamps[v] = (*time)++;
+			misses++;
+		}
+	}
+
+	return misses;
+}
+
+mesh_cache_stats_t mesh_cache_stats(const mesh_t *mesh, GLuint cache_size)
+{
+	GLuint *timestamps = g_new0(GLuint, mesh->vertex_count);
+	GLuint time = cache_size;
+	GLuint referenced = 0;
+	const GLuint triangles = mesh_triangle_count(mesh);
+
+	const GLuint misses = cache_misses(mesh->indices, mesh->index_count, timestamps, &time, cache_size);
+
+	for (GLuint v = 0; v < mesh->vertex_count; ++v) {
+		referenced += timestamps[v] != 0;
+	}
+	g_free(timestamps);
+
+	return (mesh_cache_stats_t) {
+		.acmr = triangles > 0 ? misses / (GLfloat) triangles : 0.0f,
+		.atvr = referenced > 0 ? misses / (GLfloat) referenced : 0.0f
+	};
+}
+
+/*
+ * Tipsify, Sander, Nehab & Barczak, "Fast Triangle Reordering for Vertex
+ * Locality and Reduced Overdraw", 2007. Fans around a vertex at a time and
+ * picks the next fanning vertex that is still in the cache. The positions
+ * where the walk hits a dead end are returned as hard cluster boundaries.
+ */
+static void tipsify(GLuint *indices, GLuint index_count, GLuint vertex_count, GLuint cache_size, GArray *boundaries)
+{
+	const GLuint triangle_count = index_count / 3;
+	adjacency_t adjacency;
+
+	adjacency_init(&adjacency, indices, index_count, vertex_count);
+
+	GLuint *live = g_new(GLuint, vertex_count);
+	GLuint *timestamps = g_new0(GLuint, vertex_count);
+	gboolean *emitted = g_new0(gboolean, triangle_count);
+	GLuint *stack = g_new(GLuint, index_count);
+	GLuint *output = g_new(GLuint, index_count);
+	GLuint *candidates = g_new(GLuint, index_count);
+	GLuint stack_size = 0;
+	GLuint output_size = 0;
+	GLuint time = cache_size + 1;
+	GLuint cursor = 0;
+	GLint fanning = -1;
+
+	for (GLuint v = 0; v < vertex_count; ++v) {
+		live[v] = adjacency.offsets[v + 1] - adjacency.offsets[v];
+		if (fanning < 0 && live[v] > 0) {
+			fanning = v;
+			cursor = v;
+		}
+	}
+
+	while (fanning >= 0) {
+		GLuint candidate_count = 0;
+
+		for (GLuint a = adjacency.offsets[fanning]; a < adjacency.offsets[fanning + 1]; ++a) {
+			const GLuint t = adjacency.triangles[a];
+
+			if (emitted[t]) {
+				continue;
+			}
+			emitted[t] = TRUE;
+			for (GLuint k = 0; k < 3; ++k) {
+				const GLuint v = indices[t * 3 + k];
+
+				output[output_size++] = v;
+				stack[stack_size++] = v;
+				candidates[candidate_count++] = v;
+				live[v]--;
+				if (time - timestamps[v] > cache_size) {
+					timestamps[v] = time++;
+				}
+			}
+		}
+
+		/* prefer the oldest candidate that stays in the cache after its remaining fans */
+		GLint best = -1;
+		GLint best_priority = -1;
+
+		for (GLuint c = 0; c < candidate_count; ++c) {
+			const GLuint v = candidates[c];
+
+			if (live[v] == 0) {
+				continue;
+			}
+
+			GLint priority = 0;
+
+			if (time - timestamps[v] + 2 * live[v] <= cache_size) {
+				priority = time - timestamps[v];
+			}
+			if (priority > best_priority) {
+				best = v;
+				best_priority = priority;
+			}
+		}
+		if (best >= 0) {
+			fanning = best;
+			continue;
+		}
+
+		/* dead end: back track through recently used vertices, then scan in input order */
+		if (output_size < index_count) {
+			g_array_append_val(boundaries, output_size);
+		}
+		fanning = -1;
+		while (stack_size > 0) {
+			const GLuint v = stack[--stack_size];
+
+			if (live[v] > 0) {
+				fanning = v;
+				break;
+			}
+		}
+		while (fanning < 0 && cursor < vertex_count) {
+			if (live[cursor] > 0) {
+				fanning = cursor;
+			}
+			cursor++;
+		}
+	}
+
+	memcpy(indices, output, output_size * sizeof (GLuint));
+
+	g_free(candidates);
+	g_free(output);
+	g_free(stack);
+	g_free(emitted);
+	g_free(timestamps);
+	g_free(live);
+	adjacency_clear(&adjacency);
+}
+
+void mesh_optimize_vertex_cache(mesh_t *mesh, GLuint cache_size)
+{
+	g_return_if_fail(mesh->mode == GL_TRIANGLES);
+
+	GArray *boundaries = g_array_new(FALSE, FALSE, sizeof (GLuint));
+
+	tipsify(mesh->indices, mesh->index_count, mesh->vertex_count, cache_size, boundaries);
+	g_array_free(boundaries, TRUE);
+}
+
+static int cluster_compare(const void *a, const void *b)
+{
+	const cluster_t *ca = a;
+	const cluster_t *cb = b;
+
+	if (ca->sort != cb->sort) {
+		return ca->sort > cb->sort ? -1 : 1;
+	}
+	return ca->start < cb->start ? -1 : 1;
+}
+
+/*
+ * Splits the Tipsify order into clusters wherever the cache efficiency allows
+ * and draws the clusters facing away from the mesh centre first, so they
+ * tend to occlude the inner ones rather than be overdrawn by them.
+ */
+void mesh_optimize_overdraw(mesh_t *mesh, GLuint cache_size, GLfloat threshold)
+{
+	g_return_if_fail(mesh->mode == GL_TRIANGLES);
+
+	GArray *boundaries = g_array_new(FALSE, FALSE, sizeof (GLuint));
+	const GLuint end = mesh->index_count;
+
+	tipsify(mesh->indices, mesh->index_count, mesh->vertex_count, cache_size, boundaries);
+	g_array_append_val(boundaries, end);
+
+	const mesh_cache_stats_t stats = mesh_cache_stats(mesh, cache_size);
+	GArray *clusters = g_array_new(FALSE, FALSE, sizeof (cluster_t));
+	GLuint *timestamps = g_new0(GLuint, mesh->vertex_count);
+	GLuint time = cache_size;
+	GLuint start = 0;
+
+	for (GLuint b = 0; b < boundaries->len; ++b) {
+		const GLuint hard = g_array_index(boundaries, GLuint, b);
+		GLuint misses = 0;
+
+		time += cache_size;
+		for (GLuint i = start; i < hard; i += 3) {
+			misses += cache_misses(&mesh->indices[i], 3, timestamps, &time, cache_size);
+			if (i + 3 < hard && (i + 3 - start) / 3 >= cache_size && misses <= stats.acmr * ((i + 3 - start) / 3)) {
+				const cluster_t cluster = { start, i + 3, 0.0f };
+
+				g_array_append_val(clusters, cluster);
+				start = i + 3;
+				misses = 0;
+				time += cache_size;
+			}
+		}
+		if (start < hard) {
+			const cluster_t cluster = { start, hard, 0.0f };
+
+			g_array_append_val(clusters, cluster);
+		}
+		start = hard;
+	}
+	g_free(timestamps);
+	g_array_free(boundaries, TRUE);
+
+	vec3 centre = vec3_zero();
+	GLfloat total = 0.0f;
+	vec3 *centroids = g_new(vec3, clusters->len);
+	vec3 *normals = g_new(vec3, clusters->len);
+
+	for (GLuint c = 0; c < clusters->len; ++c) {
+		const cluster_t *cluster = &g_array_index(clusters, cluster_t, c);
+		vec3 centroid = vec3_zero();
+		vec3 normal = vec3_zero();
+		GLfloat area = 0.0f;
+
+		for (GLuint i = cluster->start; i < cluster->end; i += 3) {
+			const vec3 a = mesh->vertices[mesh->indices[i + 0]].position;
+			const vec3 b = mesh->vertices[mesh->indices[i + 1]].position;
+			const vec3 c = mesh->vertices[mesh->indices[i + 2]].position;
+			const vec3 n = vec3_cross(vec3_sub(b, a), vec3_sub(c, a));
+			const GLfloat w = vec3_abs(n);
+
+			centroid = vec3_add(centroid, vec3_mulf(vec3_add(vec3_add(a, b), c), w / 3.0f));
+			normal = vec3_add(normal, n);
+			area += w;
+		}
+		centre = vec3_add(centre, centroid);
+		total += area;
+		centroids[c] = area > 0.0f ? vec3_mulf(centroid, 1.0f / area) : centroid;
+		normals[c] = vec3_normalize(normal);
+	}
+	if (total > 0.0f) {
+		centre = vec3_mulf(centre, 1.0f / total);
+	}
+	for (GLuint c = 0; c < clusters->len; ++c) {
+		g_array_index(clusters, cluster_t, c).sort = vec3_dot(vec3_sub(centroids[c], centre), normals[c]);
+	}
+	g_free(normals);
+	g_free(centroids);
+
+	qsort(clusters->data, clusters->len, sizeof (cluster_t), cluster_compare);
+
+	GLuint *indices = g_new(GLuint, mesh->index_count);
+	GLuint *output = indices;
+
+	for (GLuint c = 0; c < clusters->len; ++c) {
+		const cluster_t *cluster = &g_array_index(clusters, cluster_t, c);
+
+		memcpy(output, &mesh->indices[cluster->start], (cluster->end - cluster->start) * sizeof (GLuint));
+		output += cluster->end - cluster->start;
+	}
+	g_array_free(clusters, TRUE);
+
+	/* the cluster joins cost extra misses, keep the plain Tipsify order if they cost too many */
+	mesh_t reordered = *mesh;
+
+	reordered.indices = indices;
+	if (mesh_cache_stats(&reordered, cache_size).acmr <= stats.acmr * threshold) {
+		g_free(mesh->indices);
+		mesh->indices = indices;
+	}
+	else {
+		g_free(indices);
+	}
+}
+
+/* renumbers vertices in first use order and drops unreferenced ones */
+void mesh_optimize_vertex_fetch(mesh_t *mesh)
+{
+	GLuint *remap = g_new(GLuint, mesh->vertex_count);
+	GLuint count = 0;
+
+	memset(remap, 0xff, mesh->vertex_count * sizeof (GLuint));
+	for (GLuint i = 0; i < mesh->index_count; ++i) {
+		if (mesh->indices[i] == MESH_RESTART_INDEX) {
+			continue;
+		}
+
+		GLuint *v = &remap[mesh->indices[i]];
+
+		if (*v == G_MAXUINT32) {
+			*v = count++;
+		}
+		mesh->indices[i] = *v;
+	}
+
+	vertex_t *vertices = g_new(vertex_t, count);
+
+	for (GLuint v = 0; v < mesh->vertex_count; ++v) {
+		if (remap[v] != G_MAXUINT32) {
+			vertices[remap[v]] = mesh->vertices[v];
+		}
+	}
+	g_free(mesh->vertices);
+	g_free(remap);
+	mesh->vertices = vertices;
+	mesh->vertex_count = count;
+}
+
+/* strips keep their generated order, only their vertices are renumbered */
+void mesh_optimize(mesh_t *mesh)
+{
+	if (mesh->mode == GL_TRIANGLES) {
+		mesh_optimize_overdraw(mesh, MESH_CACHE_SIZE, MESH_OVERDRAW_THRESHOLD);
+	}
+	mesh_optimize_vertex_fetch(mesh);
+}
+
+/* orders every level on its own, the vertex order then follows the finest level */
+void mesh_optimize_lods(mesh_t *mesh, const mesh_lod_t *lods, GLuint lod_count)
+{
+	g_return_if_fail(mesh->mode == GL_TRIANGLES);
+
+	for (GLuint i = 0; i < lod_count; ++i) {
+		mesh_t level = *mesh;
+
+		level.indices = g_memdup2(mesh->indices + lods[i].index_offset, lods[i].index_count * sizeof (GLuint));
+		level.index_count = lods[i].index_count;
+		mesh_optimize_overdraw(&level, MESH_CACHE_SIZE, MESH_OVERDRAW_THRESHOLD);
+		memcpy(mesh->indices + lods[i].index_offset, level.indices, lods[i].index_count * sizeof (GLuint));
+		g_free(level.indices);
+	}
+	mesh_optimize_vertex_fetch(mesh);
+}
@@ -0,0 +1,77 @@
+#include <mesh_pool.h>
+
+mesh_pool_t *mesh_pool_new(void)
+{
+	mesh_pool_t *pool = g_new(mesh_pool_t, 1);
+
+	pool->vertices = g_array_new(FALSE, FALSE, sizeof (vertex_t));
+	pool->indices = g_array_new(FALSE, FALSE, sizeof (GLuint));
+	pool->entries = g_array_new(FALSE, FALSE, sizeof (mesh_pool_entry_t));
+
+	return pool;
+}
+
+void mesh_pool_free(mesh_pool_t *pool)
+{
+	if (pool == NULL) {
+		return;
+	}
+	g_array_free(pool->vertices, TRUE);
+	g_array_free(pool->indices, TRUE);
+	g_array_free(pool->entries, TRUE);
+	g_free(pool);
+}
+
+/* one draw takes one primitive mode, so strip meshes have to be converted to triangles first */
+guint mesh_pool_add(mesh_pool_t *pool, const mesh_t *mesh)
+{
+	g_return_val_if_fail(mesh->mode == GL_TRIANGLES, G_MAXUINT);
+
+	mesh_pool_entry_t entry = {
+		.first_index = pool->indices->len,
+		.index_count = mesh->index_count,
+		.base_vertex = pool->vertices->len,
+		.vertex_count = mesh->vertex_count,
+		.radius = 0.0f
+	};
+	vec3 min, max;
+
+	mesh_bounds(mesh, &min, &max);
+	entry.center = vec3_mulf(vec3_add(min, max), 0.5f);
+	for (GLuint i = 0; i < mesh->vertex_count; ++i) {
+		entry.radius = MAX(entry.radius, vec3_abs(vec3_sub(mesh->vertices[i].position, entry.center)));
+	}
+
+	g_array_append_vals(pool->vertices, mesh->vertices, mesh->vertex_count);
+	g_array_append_vals(pool->indices, mesh->indices, mesh->index_count);
+	g_array_append_val(pool->entries, entry);
+
+	return pool->entries->len - 1;
+}
+
+const mesh_pool_entry_t *mesh_pool_entry(const mesh_pool_t *pool, guint mesh)
+{
+	return &g_array_index(pool->entries, mesh_pool_entry_t, mesh);
+}
+
+draw_command_t mesh_pool_command(const mesh_pool_t *pool, guint mesh, GLuint instance_count, GLuint base_instance)
+{
+	const mesh_pool_entry_t *entry = mesh_pool_entry(pool, mesh);
+
+	return (draw_command_t) {
+		.count = entry->index_count,
+		.instance_count = instance_count,
+		.first_index = entry->first_index,
+		.base_vertex = entry->base_vertex,
+		.base_instance = base_instance
+	};
+}
+
+/* fills vbo and ebo, leaving them bound to GL_ARRAY_BUFFER and GL_ELEMENT_ARRAY_BUFFER */
+void mesh_pool_upload(const mesh_pool_t *pool, GLuint vbo, GLuint ebo)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferData(GL_ARRAY_BUFFER, pool->vertices->len * sizeof (vertex_t), pool->vertices->data, GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, pool->indices->len * sizeof (GLuint), pool->indices->data, GL_STATIC_DRAW);
+}
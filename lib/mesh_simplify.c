@@ -0,0 +1,631 @@
+#include <stdlib.h>
+#include <string.h>
+#include <mesh_simplify.h>
+#include <mesh_weld.h>
+
+#define NONE G_MAXUINT32
+#define MULTIPLE (G_MAXUINT32 - 1)
+
+/*
+ * How a vertex may move. Vertices sharing a position with different normals
+ * or texture coordinates form a seam: such a vertex only slides along the
+ * seam, together with its twin on the other side, so the discontinuity
+ * survives. Border vertices only slide along the open edge, anything more
+ * tangled is locked in place.
+ */
+typedef enum {
+	KIND_MANIFOLD,
+	KIND_BORDER,
+	KIND_SEAM,
+	KIND_LOCKED
+} vertex_kind_t;
+
+/* sum of squared distances to a set of planes, p'Ap + 2b'p + c, over the sum of their weights */
+typedef struct {
+	gdouble a00, a11, a22;
+	gdouble a01, a02, a12;
+	gdouble b0, b1, b2;
+	gdouble c;
+	gdouble weight;
+} quadric_t;
+
+typedef struct {
+	GLuint from;
+	GLuint to;
+	gdouble cost;
+} collapse_t;
+
+typedef struct {
+	guint64 *keys;
+	GLuint capacity;
+} edge_table_t;
+
+static void quadric_plane(quadric_t *q, vec3 normal, GLfloat distance, gdouble weight)
+{
+	const gdouble x = normal.x;
+	const gdouble y = normal.y;
+	const gdouble z = normal.z;
+	const gdouble d = distance;
+
+	q->a00 += weight * x * x;
+	q->a11 += weight * y * y;
+	q->a22 += weight * z * z;
+	q->a01 += weight * x * y;
+	q->a02 += weight * x * z;
+	q->a12 += weight * y * z;
+	q->b0 += weight * x * d;
+	q->b1 += weight * y * d;
+	q->b2 += weight * z * d;
+	q->c += weight * d * d;
+	q->weight += weight;
+}
+
+static void quadric_add(quadric_t *q, const quadric_t *r)
+{
+	q->a00 += r->a00;
+	q->a11 += r->a11;
+	q->a22 += r->a22;
+	q->a01 += r->a01;
+	q->a02 += r->a02;
+	q->a12 += r->a12;
+	q->b0 += r->b0;
+	q->b1 += r->b1;
+	q->b2 += r->b2;
+	q->c += r->c;
+	q->weight += r->weight;
+}
+
+static gdouble quadric_eval(const quadric_t *q, vec3 p)
+{
+	const gdouble x = p.x;
+	const gdouble y = p.y;
+	const gdouble z = p.z;
+	const gdouble result =
+		q->a00 * x * x + q->a11 * y * y + q->a22 * z * z +
+		2.0 * (q->a01 * x * y + q->a02 * x * z + q->a12 * y * z) +
+		2.0 * (q->b0 * x + q->b1 * y + q->b2 * z) + q->c;
+
+	return q->weight > 0.0 ? MAX(result, 0.0) / q->weight : 0.0;
+}
+
+static inline guint64 edge_key(GLuint a, GLuint b)
+{
+	return (guint64) a << 32 | b;
+}
+
+static void edge_table_init(edge_table_t *table, const GLuint *indices, GLuint index_count)
+{
+	table->capacity = 16;
+	while (table->capacity < index_count * 2) {
+		table->capacity *= 2;
+	}
+	table->keys = g_new(guint64, table->capacity);
+	memset(table->keys, 0xff, table->capacity * sizeof (guint64));
+
+	for (GLuint i = 0; i < index_count; ++i) {
+		const guint64 key = edge_key(indices[i], indices[i - i % 3 + (i + 1) % 3]);
+		GLuint slot = (key * 11400714819323198485ull) >> 32 & (table->capacity - 1);
+
+		while (table->keys[slot] != G_MAXUINT64 && table->keys[slot] != key) {
+			slot = (slot + 1) & (table->capacity - 1);
+		}
+		table->keys[slot] = key;
+	}
+}
+
+static gboolean edge_table_has(const edge_table_t *table, GLuint a, GLuint b)
+{
+	const guint64 key = edge_key(a, b);
+	GLuint slot = (key * 11400714819323198485ull) >> 32 & (table->capacity - 1);
+
+	while (table->keys[slot] != G_MAXUINT64) {
+		if (table->keys[slot] == key) {
+			return TRUE;
+		}
+		slot = (slot + 1) & (table->capacity - 1);
+	}
+	return FALSE;
+}
+
+/* an edge is open when no triangle runs along it the other way */
+static gboolean edge_open(const edge_table_t *table, GLuint a, GLuint b)
+{
+	return (edge_table_has(table, a, b) && !edge_table_has(table, b, a)) ||
+	       (edge_table_has(table, b, a) && !edge_table_has(table, a, b));
+}
+
+static inline void open_link(GLuint *link, GLuint v)
+{
+	*link = *link == NONE ? v : MULTIPLE;
+}
+
+static void classify(const GLuint *indices, GLuint index_count, GLuint vertex_count, const GLuint *position, const GLuint *wedge, vertex_kind_t *kind)
+{
+	edge_table_t edges;
+	GLuint *open_out = g_new(GLuint, vertex_count);
+	GLuint *open_in = g_new(GLuint, vertex_count);
+
+	memset(open_out, 0xff, vertex_count * sizeof (GLuint));
+	memset(open_in, 0xff, vertex_count * sizeof (GLuint));
+
+	edge_table_init(&edges, indices, index_count);
+	for (GLuint i = 0; i < index_count; ++i) {
+		const GLuint a = indices[i];
+		const GLuint b = indices[i - i % 3 + (i + 1) % 3];
+
+		if (!edge_table_has(&edges, b, a)) {
+			open_link(&open_out[a], b);
+			open_link(&open_in[b], a);
+		}
+	}
+	g_free(edges.keys);
+
+	for (GLuint v = 0; v < vertex_count; ++v) {
+		const GLuint w = wedge[v];
+		const gboolean single = open_out[v] < MULTIPLE && open_in[v] < MULTIPLE;
+
+		if (w == v) {
+			if (open_out[v] == NONE && open_in[v] == NONE) {
+				kind[v] = KIND_MANIFOLD;
+			}
+			else {
+				kind[v] = single ? KIND_BORDER : KIND_LOCKED;
+			}
+		}
+		else if (wedge[w] == v && single && open_out[w] < MULTIPLE && open_in[w] < MULTIPLE &&
+		         position[open_out[v]] == position[open_in[w]] &&
+		         position[open_in[v]] == position[open_out[w]]) {
+			kind[v] = KIND_SEAM;
+		}
+		else {
+			kind[v] = KIND_LOCKED;
+		}
+	}
+
+	g_free(open_in);
+	g_free(open_out);
+}
+
+static int collapse_compare(const void *a, const void *b)
+{
+	const collapse_t *ca = a;
+	const collapse_t *cb = b;
+
+	return ca->cost < cb->cost ? -1 : ca->cost > cb->cost;
+}
+
+/* the copy of to on the far side of the seam, joined to the twin of from by an edge */
+static GLuint seam_twin(const edge_table_t *edges, const GLuint *wedge, GLuint from, GLuint to)
+{
+	const GLuint twin = wedge[from];
+
+	for (GLuint w = wedge[to]; w != to; w = wedge[w]) {
+		if (edge_table_has(edges, twin, w) || edge_table_has(edges, w, twin)) {
+			return w;
+		}
+	}
+	return NONE;
+}
+
+static gboolean collapse_allowed(const edge_table_t *edges, const vertex_kind_t *kind, GLuint from, GLuint to)
+{
+	switch (kind[from]) {
+	case KIND_MANIFOLD:
+		return TRUE;
+	case KIND_BORDER:
+		return kind[to] != KIND_MANIFOLD && edge_open(edges, from, to);
+	case KIND_SEAM:
+		return (kind[to] == KIND_SEAM || kind[to] == KIND_LOCKED) && edge_open(edges, from, to);
+	default:
+		return FALSE;
+	}
+}
+
+/* moving the position from onto to must not turn any remaining triangle around */
+static gboolean collapse_flips(const vec3 *points, const GLuint *position, const GLuint *indices,
+			       const GLuint *offsets, const GLuint *triangles, GLuint from, GLuint to)
+{
+	const vec3 target = points[to];
+
+	for (GLuint a = offsets[from]; a < offsets[from + 1]; ++a) {
+		const GLuint *t = &indices[triangles[a] * 3];
+		vec3 before[3];
+		vec3 after[3];
+		gboolean degenerate = FALSE;
+
+		for (GLuint k = 0; k < 3; ++k) {
+			const GLuint p = position[t[k]];
+
+			degenerate |= p == to;
+			before[k] = points[p];
+			after[k] = p == from ? target : points[p];
+		}
+		if (degenerate) {
+			continue;
+		}
+
+		const vec3 n0 = vec3_cross(vec3_sub(before[1], before[0]), vec3_sub(before[2], before[0]));
+		const vec3 n1 = vec3_cross(vec3_sub(after[1], after[0]), vec3_sub(after[2], after[0]));
+
+		if (vec3_dot(n0, n1) <= 1.0e-2f * vec3_abs(n0) * vec3_abs(n1)) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+static inline void touch_triangle(gboolean *touched, const GLuint *position, const GLuint *t)
+{
+	touched[position[t[0]]] = TRUE;
+	touched[position[t[1]]] = TRUE;
+	touched[position[t[2]]] = TRUE;
+}
+
+/* triangles around each position, offsets[p] to offsets[p + 1] of triangles */
+static void point_triangles(const GLuint *position, const GLuint *indices, GLuint index_count, GLuint point_count,
+			    GLuint *offsets, GLuint *triangles)
+{
+	memset(offsets, 0, (point_count + 1) * sizeof (GLuint));
+	for (GLuint i = 0; i < index_count; ++i) {
+		offsets[position[indices[i]] + 1]++;
+	}
+	for (GLuint p = 0; p < point_count; ++p) {
+		offsets[p + 1] += offsets[p];
+	}
+	for (GLuint i = 0; i < index_count; ++i) {
+		triangles[offsets[position[indices[i]]]++] = i / 3;
+	}
+	for (GLuint p = point_count; p > 0; --p) {
+		offsets[p] = offsets[p - 1];
+	}
+	offsets[0] = 0;
+}
+
+/* from p to the closest point of triangle abc, Ericson, "Real-Time Collision Detection", 5.1.5 */
+static GLfloat triangle_distance(vec3 p, vec3 a, vec3 b, vec3 c)
+{
+	const vec3 ab = vec3_sub(b, a);
+	const vec3 ac = vec3_sub(c, a);
+	const vec3 ap = vec3_sub(p, a);
+	const GLfloat d1 = vec3_dot(ab, ap);
+	const GLfloat d2 = vec3_dot(ac, ap);
+
+	if (d1 <= 0.0f && d2 <= 0.0f) {
+		return vec3_abs(ap);
+	}
+
+	const vec3 bp = vec3_sub(p, b);
+	const GLfloat d3 = vec3_dot(ab, bp);
+	const GLfloat d4 = vec3_dot(ac, bp);
+
+	if (d3 >= 0.0f && d4 <= d3) {
+		return vec3_abs(bp);
+	}
+
+	const GLfloat vc = d1 * d4 - d3 * d2;
+
+	if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+		return vec3_abs(vec3_sub(ap, vec3_mulf(ab, d1 / (d1 - d3))));
+	}
+
+	const vec3 cp = vec3_sub(p, c);
+	const GLfloat d5 = vec3_dot(ab, cp);
+	const GLfloat d6 = vec3_dot(ac, cp);
+
+	if (d6 >= 0.0f && d5 <= d6) {
+		return vec3_abs(cp);
+	}
+
+	const GLfloat vb = d5 * d2 - d1 * d6;
+
+	if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+		return vec3_abs(vec3_sub(ap, vec3_mulf(ac, d2 / (d2 - d6))));
+	}
+
+	const GLfloat va = d3 * d6 - d5 * d4;
+
+	if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f) {
+		return vec3_abs(vec3_sub(bp, vec3_mulf(vec3_sub(c, b), (d4 - d3) / ((d4 - d3) + (d5 - d6)))));
+	}
+
+	const GLfloat sum = va + vb + vc;
+
+	if (sum <= 0.0f) {
+		/* degenerate, the closest corner will do */
+		return MIN(vec3_abs(ap), MIN(vec3_abs(bp), vec3_abs(cp)));
+	}
+	return vec3_abs(vec3_sub(ap, vec3_add(vec3_mulf(ab, vb / sum), vec3_mulf(ac, vc / sum))));
+}
+
+/*
+ * Largest distance from a position of the input to the result. Each is
+ * measured to the triangles around the position it was collapsed onto,
+ * which bounds its distance to the whole surface from above.
+ */
+static GLfloat simplify_error(const vec3 *points, const GLuint *position, const gboolean *used, GLuint *moved, GLuint point_count,
+			      const GLuint *indices, GLuint index_count, GLuint *offsets, GLuint *triangles)
+{
+	GLfloat error = 0.0f;
+
+	point_triangles(position, indices, index_count, point_count, offsets, triangles);
+	for (GLuint p = 0; p < point_count; ++p) {
+		GLuint q = p;
+		GLfloat distance = G_MAXFLOAT;
+
+		if (!used[p] || moved[p] == p) {
+			continue;
+		}
+		while (moved[q] != q) {
+			q = moved[q];
+		}
+		moved[p] = q;
+		for (GLuint a = offsets[q]; a < offsets[q + 1]; ++a) {
+			const GLuint *t = &indices[triangles[a] * 3];
+
+			distance = MIN(distance, triangle_distance(points[p], points[position[t[0]]], points[position[t[1]]], points[position[t[2]]]));
+		}
+		/* everything around it collapsed away, the point it went to is all there is */
+		if (distance == G_MAXFLOAT) {
+			distance = vec3_abs(vec3_sub(points[p], points[q]));
+		}
+		error = MAX(error, distance);
+	}
+	return error;
+}
+
+/*
+ * Quadric error metric edge collapse, Garland & Heckbert, "Surface
+ * Simplification Using Quadric Error Metrics", 1997. Vertices only move onto
+ * existing vertices, so the result indexes the vertex buffer of the input
+ * and any number of levels share one vertex buffer. Runs passes of the
+ * cheapest independent collapses until target_count indices remain or
+ * nothing can collapse any more. error receives the largest object space
+ * distance from a vertex of the input to the result, measured to the
+ * triangles around the vertex it moved onto, so it never underestimates.
+ * Returns the number of indices written to destination, which may be
+ * indices itself.
+ */
+GLuint mesh_simplify(const mesh_t *mesh, const GLuint *indices, GLuint index_count, GLuint target_count, GLuint *destination, GLfloat *error)
+{
+	g_return_val_if_fail(mesh->mode == GL_TRIANGLES, 0);
+
+	const GLuint vertex_count = mesh->vertex_count;
+	GLuint *position = g_new(GLuint, vertex_count);
+	GLuint *wedge = g_new(GLuint, vertex_count);
+	vertex_kind_t *kind = g_new(vertex_kind_t, vertex_count);
+	vec3 *points = g_new(vec3, vertex_count);
+
+	memmove(destination, indices, index_count * sizeof (GLuint));
+
+	for (GLuint v = 0; v < vertex_count; ++v) {
+		points[v] = mesh->vertices[v].position;
+	}
+
+	const GLuint point_count = mesh_weld(points, vertex_count, sizeof (vec3), MESH_WELD_EPSILON, points, position);
+	GLuint *first = g_new(GLuint, point_count);
+
+	/* vertices sharing a position are linked in a ring */
+	memset(first, 0xff, point_count * sizeof (GLuint));
+	for (GLuint v = 0; v < vertex_count; ++v) {
+		GLuint *head = &first[position[v]];
+
+		if (*head == NONE) {
+			*head = v;
+			wedge[v] = v;
+		}
+		else {
+			wedge[v] = wedge[*head];
+			wedge[*head] = v;
+		}
+	}
+	g_free(first);
+
+	classify(destination, index_count, vertex_count, position, wedge, kind);
+
+	quadric_t *quadrics = g_new0(quadric_t, point_count);
+
+	for (GLuint i = 0; i < index_count; i += 3) {
+		const vec3 a = points[position[destination[i + 0]]];
+		const vec3 b = points[position[destination[i + 1]]];
+		const vec3 c = points[position[destination[i + 2]]];
+		const vec3 normal = vec3_normalize(vec3_cross(vec3_sub(b, a), vec3_sub(c, a)));
+		quadric_t q = { 0 };
+
+		quadric_plane(&q, normal, -vec3_dot(normal, a), 1.0);
+		for (GLuint k = 0; k < 3; ++k) {
+			quadric_add(&quadrics[position[destination[i + k]]], &q);
+		}
+
+		/* open edges also hold on to the plane standing on them, so borders and seams keep their line */
+		for (GLuint k = 0; k < 3; ++k) {
+			const GLuint v0 = destination[i + k];
+			const GLuint v1 = destination[i + (k + 1) % 3];
+
+			if (kind[v0] == KIND_MANIFOLD || kind[v1] == KIND_MANIFOLD) {
+				continue;
+			}
+
+			const vec3 p0 = points[position[v0]];
+			const vec3 p1 = points[position[v1]];
+			const vec3 side = vec3_normalize(vec3_cross(vec3_sub(p1, p0), normal));
+			quadric_t e = { 0 };
+
+			quadric_plane(&e, side, -vec3_dot(side, p0), 1.0);
+			quadric_add(&quadrics[position[v0]], &e);
+			quadric_add(&quadrics[position[v1]], &e);
+		}
+	}
+
+	GLuint *remap = g_new(GLuint, vertex_count);
+	gboolean *touched = g_new(gboolean, point_count);
+	gboolean *used = g_new0(gboolean, point_count);
+	GLuint *moved = g_new(GLuint, point_count);
+	GLuint *offsets = g_new(GLuint, point_count + 1);
+	GLuint *triangles = g_new(GLuint, index_count);
+	collapse_t *collapses = g_new(collapse_t, index_count);
+
+	for (GLuint i = 0; i < index_count; ++i) {
+		used[position[destination[i]]] = TRUE;
+	}
+	for (GLuint p = 0; p < point_count; ++p) {
+		moved[p] = p;
+	}
+
+	while (index_count > target_count) {
+		edge_table_t edges;
+		GLuint collapse_count = 0;
+		GLuint applied = 0;
+		GLuint removed = 0;
+
+		edge_table_init(&edges, destination, index_count);
+
+		for (GLuint i = 0; i < index_count; ++i) {
+			const GLuint a = destination[i];
+			const GLuint b = destination[i - i % 3 + (i + 1) % 3];
+			const GLuint pa = position[a];
+			const GLuint pb = position[b];
+
+			/* each undirected edge once, both ways round */
+			if (a > b && edge_table_has(&edges, b, a)) {
+				continue;
+			}
+
+			quadric_t q = quadrics[pa];
+
+			quadric_add(&q, &quadrics[pb]);
+
+			const gdouble ab = collapse_allowed(&edges, kind, a, b) ? quadric_eval(&q, points[pb]) : G_MAXDOUBLE;
+			const gdouble ba = collapse_allowed(&edges, kind, b, a) ? quadric_eval(&q, points[pa]) : G_MAXDOUBLE;
+
+			if (ab == G_MAXDOUBLE && ba == G_MAXDOUBLE) {
+				continue;
+			}
+			collapses[collapse_count++] = ab <= ba ? (collapse_t) { a, b, ab } : (collapse_t) { b, a, ba };
+		}
+		qsort(collapses, collapse_count, sizeof (collapse_t), collapse_compare);
+
+		/* for the flip test and to keep the collapses of a pass apart */
+		point_triangles(position, destination, index_count, point_count, offsets, triangles);
+
+		for (GLuint v = 0; v < vertex_count; ++v) {
+			remap[v] = v;
+		}
+		memset(touched, 0, point_count * sizeof (gboolean));
+
+		/* most collapses take two triangles with them, stop once the target is in reach */
+		for (GLuint c = 0; c < collapse_count && removed < index_count - target_count; ++c) {
+			const collapse_t *collapse = &collapses[c];
+			const GLuint from = position[collapse->from];
+			const GLuint to = position[collapse->to];
+			GLuint twin = NONE;
+
+			if (touched[from] || touched[to]) {
+				continue;
+			}
+			if (kind[collapse->from] == KIND_SEAM) {
+				twin = seam_twin(&edges, wedge, collapse->from, collapse->to);
+				if (twin == NONE) {
+					continue;
+				}
+			}
+			if (collapse_flips(points, position, destination, offsets, triangles, from, to)) {
+				continue;
+			}
+
+			remap[collapse->from] = collapse->to;
+			if (twin != NONE) {
+				remap[wedge[collapse->from]] = twin;
+			}
+			quadric_add(&quadrics[to], &quadrics[from]);
+			moved[from] = to;
+			/* the flip test of a neighbour looks at triangles this one changes, it waits for the next pass */
+			for (GLuint a = offsets[from]; a < offsets[from + 1]; ++a) {
+				touch_triangle(touched, position, &destination[triangles[a] * 3]);
+			}
+			for (GLuint a = offsets[to]; a < offsets[to + 1]; ++a) {
+				touch_triangle(touched, position, &destination[triangles[a] * 3]);
+			}
+			removed += kind[collapse->from] == KIND_BORDER ? 3 : 6;
+			applied++;
+		}
+		g_free(edges.keys);
+
+		if (applied == 0) {
+			break;
+		}
+
+		GLuint count = 0;
+
+		for (GLuint i = 0; i < index_count; i += 3) {
+			const GLuint a = remap[destination[i + 0]];
+			const GLuint b = remap[destination[i + 1]];
+			const GLuint c = remap[destination[i + 2]];
+
+			if (position[a] == position[b] || position[b] == position[c] || position[c] == position[a]) {
+				continue;
+			}
+			destination[count++] = a;
+			destination[count++] = b;
+			destination[count++] = c;
+		}
+		index_count = count;
+	}
+
+	if (error != NULL) {
+		*error = simplify_error(points, position, used, moved, point_count, destination, index_count, offsets, triangles);
+	}
+
+	g_free(collapses);
+	g_free(moved);
+	g_free(used);
+	g_free(triangles);
+	g_free(offsets);
+	g_free(touched);
+	g_free(remap);
+	g_free(quadrics);
+	g_free(points);
+	g_free(kind);
+	g_free(wedge);
+	g_free(position);
+
+	return index_count;
+}
+
+/*
+ * Replaces the indices of mesh with a chain of up to lod_count levels, the
+ * full mesh first and each further level simplified from it down to ratio
+ * times the triangles of the level before. The chain ends early when a
+ * level no longer gets meaningfully smaller. Returns the number of levels
+ * written to lods.
+ */
+GLuint mesh_simplify_lods(mesh_t *mesh, GLuint lod_count, GLfloat ratio, mesh_lod_t *lods)
+{
+	g_return_val_if_fail(lod_count >= 1 && lod_count <= MESH_LOD_MAX, 0);
+
+	const GLuint full = mesh->index_count;
+	GLuint *indices = g_new(GLuint, full * lod_count);
+	GLuint count = 1;
+
+	memcpy(indices, mesh->indices, full * sizeof (GLuint));
+	lods[0] = (mesh_lod_t) { 0, full, 0.0f };
+
+	for (; count < lod_count; ++count) {
+		const mesh_lod_t *previous = &lods[count - 1];
+		const GLuint offset = previous->index_offset + previous->index_count;
+		const GLuint target = (GLuint) (previous->index_count / 3 * ratio) * 3;
+		GLfloat error;
+
+		const GLuint index_count = mesh_simplify(mesh, indices, full, target, indices + offset, &error);
+
+		if (index_count == 0 || index_count > previous->index_count - previous->index_count / 10) {
+			break;
+		}
+		lods[count] = (mesh_lod_t) { offset, index_count, MAX(error, previous->error) };
+	}
+
+	g_free(mesh->indices);
+	mesh->indices = g_renew(GLuint, indices, lods[count - 1].index_offset + lods[count - 1].index_count);
+	mesh->index_count = lods[count - 1].index_offset + lods[count - 1].index_count;
+
+	return count;
+}
@@ -0,0 +1,85 @@
+#include <math.h>
+#include <string.h>
+#include <mesh_weld.h>
+
+/*
+ * Components are snapped to an epsilon grid before they are hashed and
+ * compared, so values closer than epsilon merge unless they straddle a grid
+ * line. An epsilon of zero welds bitwise equal vertices only.
+ */
+static inline gdouble weld_snap(GLfloat value, GLfloat epsilon)
+{
+	if (epsilon > 0.0f) {
+		return floor(value / (gdouble) epsilon + 0.5);
+	}
+	return value == 0.0f ? 0.0 : value;
+}
+
+static guint32 weld_hash(const GLfloat *vertex, guint components, GLfloat epsilon)
+{
+	guint64 hash = 14695981039346656037ull;
+
+	for (guint i = 0; i < components; ++i) {
+		const gdouble snapped = weld_snap(vertex[i], epsilon);
+		guint64 bits;
+
+		memcpy(&bits, &snapped, sizeof bits);
+		hash = (hash ^ bits) * 1099511628211ull;
+	}
+
+	return hash ^ (hash >> 32);
+}
+
+static gboolean weld_equal(const GLfloat *a, const GLfloat *b, guint components, GLfloat epsilon)
+{
+	for (guint i = 0; i < components; ++i) {
+		if (weld_snap(a[i], epsilon) != weld_snap(b[i], epsilon)) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+/*
+ * Deduplicates an array of vertices made of GLfloat components. The unique
+ * vertices are written to welded in first use order and indices receives
+ * one entry per input vertex. welded may be the input array itself. Returns
+ * the number of unique vertices.
+ */
+GLuint mesh_weld(gconstpointer vertices, GLuint count, gsize stride, GLfloat epsilon, gpointer welded, GLuint *indices)
+{
+	g_return_val_if_fail(stride % sizeof (GLfloat) == 0, 0);
+
+	const guint components = stride / sizeof (GLfloat);
+	const guint8 *source = vertices;
+	guint8 *target = welded;
+	GLuint capacity = 16;
+	GLuint unique = 0;
+
+	while (capacity < count * 2) {
+		capacity *= 2;
+	}
+
+	GLuint *table = g_new(GLuint, capacity);
+
+	memset(table, 0xff, capacity * sizeof (GLuint));
+	for (GLuint i = 0; i < count; ++i) {
+		const GLfloat *vertex = (const GLfloat *) (source + i * stride);
+		GLuint slot = weld_hash(vertex, components, epsilon) & (capacity - 1);
+
+		while (table[slot] != G_MAXUINT32) {
+			if (weld_equal(vertex, (const GLfloat *) (target + table[slot] * stride), components, epsilon)) {
+				break;
+			}
+			slot = (slot + 1) & (capacity - 1);
+		}
+		if (table[slot] == G_MAXUINT32) {
+			memmove(target + unique * stride, vertex, stride);
+			table[slot] = unique++;
+		}
+		indices[i] = table[slot];
+	}
+	g_free(table);
+
+	return unique;
+}
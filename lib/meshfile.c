@@ -0,0 +1,276 @@
+#include <string.h>
+#include <sys/mman.h>
+#include <meshfile.h>
+
+#define MESHFILE_ALIGN(x) (((x) + MESHFILE_ALIGNMENT - 1) & ~((guint64) MESHFILE_ALIGNMENT - 1))
+
+G_STATIC_ASSERT(sizeof (meshfile_header_t) == 288);
+G_STATIC_ASSERT(G_BYTE_ORDER == G_LITTLE_ENDIAN);
+
+struct meshfile {
+	GMappedFile *mapped;
+	const guint8 *data;
+	const meshfile_header_t *header;
+};
+
+G_DEFINE_QUARK(meshfile-error-quark, meshfile_error)
+
+static gsize meshfile_index_bytes(guint32 type)
+{
+	switch (type) {
+	case GL_UNSIGNED_BYTE:
+		return 1;
+	case GL_UNSIGNED_SHORT:
+		return 2;
+	case GL_UNSIGNED_INT:
+		return 4;
+	}
+	return 0;
+}
+
+static gboolean meshfile_validate(const guint8 *data, gsize length, GError **error)
+{
+	const meshfile_header_t *header = (const meshfile_header_t *) data;
+
+	if (length < sizeof (meshfile_header_t) || header->magic != MESHFILE_MAGIC) {
+		g_set_error_literal(error, MESHFILE_ERROR, MESHFILE_ERROR_INVALID, "not a mesh file");
+		return FALSE;
+	}
+	if (header->version != MESHFILE_VERSION || header->header_size != sizeof (meshfile_header_t)) {
+		g_set_error(error, MESHFILE_ERROR, MESHFILE_ERROR_VERSION, "unsupported mesh file version %u", header->version);
+		return FALSE;
+	}
+	if (header->attrib_count > MESHFILE_ATTRIB_MAX) {
+		g_set_error_literal(error, MESHFILE_ERROR, MESHFILE_ERROR_INVALID, "too many vertex attributes");
+		return FALSE;
+	}
+	for (guint32 i = 0; i < header->attrib_count; ++i) {
+		const vertex_attrib_t *attrib = &header->attribs[i];
+		const gsize bytes = vertex_attrib_bytes(attrib);
+
+		if (attrib->semantic >= MESH_ATTRIB_COUNT || attrib->encoding >= VERTEX_ENCODING_COUNT || bytes == 0 || attrib->offset + bytes > header->vertex_stride) {
+			g_set_error(error, MESHFILE_ERROR, MESHFILE_ERROR_INVALID, "invalid vertex attribute #%u", i);
+			return FALSE;
+		}
+	}
+
+	const gsize index_bytes = meshfile_index_bytes(header->index_type);
+
+	if (header->vertex_size != (guint64) header->vertex_count * header->vertex_stride ||
+	    header->vertex_offset % MESHFILE_ALIGNMENT != 0 ||
+	    header->vertex_offset < sizeof (meshfile_header_t) ||
+	    header->vertex_offset > length || header->vertex_size > length - header->vertex_offset) {
+		g_set_error_literal(error, MESHFILE_ERROR, MESHFILE_ERROR_INVALID, "invalid vertex blob");
+		return FALSE;
+	}
+	if (index_bytes == 0 ||
+	    header->index_size != (guint64) header->index_count * index_bytes ||
+	    header->index_offset % MESHFILE_ALIGNMENT != 0 ||
+	    header->index_offset < header->vertex_offset + header->vertex_size ||
+	    header->index_offset > length || header->index_size > length - header->index_offset) {
+		g_set_error_literal(error, MESHFILE_ERROR, MESHFILE_ERROR_INVALID, "invalid index blob");
+		return FALSE;
+	}
+	if (header->lod_count == 0 || header->lod_count > MESH_LOD_MAX) {
+		g_set_error_literal(error, MESHFILE_ERROR, MESHFILE_ERROR_INVALID, "invalid level of detail count");
+		return FALSE;
+	}
+	for (guint32 i = 0; i < header->lod_count; ++i) {
+		const mesh_lod_t *lod = &header->lods[i];
+
+		if (lod->index_offset > header->index_count || lod->index_count > header->index_count - lod->index_offset) {
+			g_set_error(error, MESHFILE_ERROR, MESHFILE_ERROR_INVALID, "invalid level of detail #%u", i);
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+meshfile_t *meshfile_open(const gchar *filename, GError **error)
+{
+	GMappedFile *mapped = g_mapped_file_new(filename, FALSE, error);
+
+	if (mapped == NULL) {
+		return NULL;
+	}
+
+	const gsize length = g_mapped_file_get_length(mapped);
+	const guint8 *data = (const guint8 *) g_mapped_file_get_contents(mapped);
+
+	if (meshfile_validate(data, length, error) == FALSE) {
+		g_prefix_error(error, "%s: ", filename);
+		g_mapped_file_unref(mapped);
+		return NULL;
+	}
+
+	/* start paging the blobs in while the caller sets up the GL objects */
+	madvise((void *) data, length, MADV_WILLNEED);
+
+	meshfile_t *file = g_new(meshfile_t, 1);
+
+	file->mapped = mapped;
+	file->data = data;
+	file->header = (const meshfile_header_t *) data;
+
+	return file;
+}
+
+void meshfile_close(meshfile_t *file)
+{
+	if (file == NULL) {
+		return;
+	}
+	g_mapped_file_unref(file->mapped);
+	g_free(file);
+}
+
+const meshfile_header_t *meshfile_get_header(const meshfile_t *file)
+{
+	return file->header;
+}
+
+const vertex_attrib_t *meshfile_get_attrib(const meshfile_t *file, mesh_attrib_t semantic)
+{
+	for (guint32 i = 0; i < file->header->attrib_count; ++i) {
+		if (file->header->attribs[i].semantic == semantic) {
+			return &file->header->attribs[i];
+		}
+	}
+	return NULL;
+}
+
+gconstpointer meshfile_get_vertices(const meshfile_t *file)
+{
+	return file->data + file->header->vertex_offset;
+}
+
+gconstpointer meshfile_get_indices(const meshfile_t *file)
+{
+	return file->data + file->header->index_offset;
+}
+
+static void meshfile_buffer(GLenum target, GLuint buffer, GLsizeiptr size, gconstpointer data)
+{
+	glBindBuffer(target, buffer);
+	if (epoxy_gl_version() >= 44 || epoxy_has_gl_extension("GL_ARB_buffer_storage")) {
+		glBufferStorage(target, size, data, 0);
+	}
+	else {
+		glBufferData(target, size, data, GL_STATIC_DRAW);
+	}
+}
+
+/*
+ * Uploads straight from the mapped pages into freshly generated buffers. The
+ * vertex buffer stays bound to GL_ARRAY_BUFFER for meshfile_attrib_pointer(),
+ * the index buffer is attached to the currently bound vertex array.
+ */
+void meshfile_upload(const meshfile_t *file, GLuint vbo, GLuint ebo)
+{
+	meshfile_buffer(GL_ARRAY_BUFFER, vbo, file->header->vertex_size, meshfile_get_vertices(file));
+	if (ebo != 0) {
+		meshfile_buffer(GL_ELEMENT_ARRAY_BUFFER, ebo, file->header->index_size, meshfile_get_indices(file));
+	}
+}
+
+void meshfile_attrib_pointer(const meshfile_t *file, mesh_attrib_t semantic, GLint index)
+{
+	const vertex_attrib_t *attrib = meshfile_get_attrib(file, semantic);
+
+	if (attrib == NULL) {
+		if (index >= 0) {
+			glDisableVertexAttribArray(index);
+		}
+		return;
+	}
+	vertex_attrib_pointer(attrib, file->header->vertex_stride, index);
+}
+
+/* the vertex buffer goes to glBindVertexBuffer(binding, vbo, 0, vertex_stride) */
+void meshfile_attrib_format(const meshfile_t *file, mesh_attrib_t semantic, GLuint binding, GLint index)
+{
+	const vertex_attrib_t *attrib = meshfile_get_attrib(file, semantic);
+
+	if (attrib == NULL) {
+		if (index >= 0) {
+			glDisableVertexAttribArray(index);
+		}
+		return;
+	}
+	vertex_attrib_format(attrib, binding, index);
+}
+
+mat4 meshfile_position_decode(const meshfile_t *file)
+{
+	const GLfloat *min = file->header->bounds_min;
+	const GLfloat *max = file->header->bounds_max;
+
+	return vertex_format_decode(meshfile_get_attrib(file, MESH_ATTRIB_POSITION), (vec3) { min[0], min[1], min[2] }, (vec3) { max[0], max[1], max[2] });
+}
+
+/* byte offset of a level in the index buffer, for the indices argument of glDrawElements() */
+gsize meshfile_lod_offset(const meshfile_t *file, GLuint lod)
+{
+	return file->header->lods[lod].index_offset * meshfile_index_bytes(file->header->index_type);
+}
+
+/* lods may be NULL for a single level covering all indices */
+gboolean meshfile_write(const gchar *filename, const mesh_t *mesh, const mesh_lod_t *lods, GLuint lod_count, const vertex_format_t *format, GError **error)
+{
+	g_return_val_if_fail(lods == NULL || (lod_count >= 1 && lod_count <= MESH_LOD_MAX), FALSE);
+
+	const gboolean short_indices = mesh->vertex_count <= G_MAXUINT16;
+	meshfile_header_t header = {
+		.magic = MESHFILE_MAGIC,
+		.version = MESHFILE_VERSION,
+		.header_size = sizeof (meshfile_header_t),
+		.mode = mesh->mode,
+		.vertex_count = mesh->vertex_count,
+		.index_type = short_indices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT,
+		.index_count = mesh->index_count,
+		.index_size = (guint64) mesh->index_count * (short_indices ? sizeof (GLushort) : sizeof (GLuint))
+	};
+	vec3 min, max;
+
+	if (lods != NULL) {
+		header.lod_count = lod_count;
+		memcpy(header.lods, lods, lod_count * sizeof (mesh_lod_t));
+	}
+	else {
+		header.lod_count = 1;
+		header.lods[0] = (mesh_lod_t) { 0, mesh->index_count, 0.0f };
+	}
+
+	header.attrib_count = vertex_format_layout(format != NULL ? format : &vertex_format_float, header.attribs, &header.vertex_stride);
+	header.vertex_size = (guint64) mesh->vertex_count * header.vertex_stride;
+
+	mesh_bounds(mesh, &min, &max);
+	memcpy(header.bounds_min, &min, sizeof header.bounds_min);
+	memcpy(header.bounds_max, &max, sizeof header.bounds_max);
+
+	header.vertex_offset = MESHFILE_ALIGN(sizeof header);
+	header.index_offset = MESHFILE_ALIGN(header.vertex_offset + header.vertex_size);
+
+	const gsize length = header.index_offset + header.index_size;
+	guint8 *data = g_malloc0(length);
+
+	memcpy(data, &header, sizeof header);
+	vertex_format_pack(format != NULL ? format : &vertex_format_float, mesh, min, max, data + header.vertex_offset);
+	if (short_indices) {
+		GLushort *indices = (GLushort *) (data + header.index_offset);
+
+		for (GLuint i = 0; i < mesh->index_count; ++i) {
+			indices[i] = mesh->indices[i] == MESH_RESTART_INDEX ? G_MAXUINT16 : mesh->indices[i];
+		}
+	}
+	else {
+		memcpy(data + header.index_offset, mesh->indices, header.index_size);
+	}
+
+	const gboolean result = g_file_set_contents(filename, (const gchar *) data, length, error);
+
+	g_free(data);
+
+	return result;
+}
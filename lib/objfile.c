@@ -0,0 +1,802 @@
+#include <math.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <objfile.h>
+
+#define MISSING G_MAXINT32
+
+enum {
+	CORNER_POSITION,
+	CORNER_TEXTURE,
+	CORNER_NORMAL,
+	CORNER_COUNT
+};
+
+/* negative OBJ indices count back from the data a chunk has seen, fixed up once the chunk bases are known */
+typedef struct {
+	gint32 index[CORNER_COUNT];
+	guint32 relative;
+} corner_t;
+
+typedef struct {
+	guint triangle;
+	gchar *name;
+} usemtl_t;
+
+/* open addressing from corners to dense ids, a free slot has a MISSING position */
+typedef struct {
+	corner_t *keys;
+	GLuint *values;
+	GLuint capacity;
+	GLuint count;
+} corner_table_t;
+
+typedef struct {
+	const gchar *start;
+	const gchar *end;
+	GArray *positions;
+	GArray *textures;
+	GArray *normals;
+	corner_table_t table;
+	GArray *unique;		/* corner_t by chunk local id */
+	GArray *corners;	/* chunk local ids, three per triangle */
+	GArray *usemtl;
+	GPtrArray *mtllib;
+	gboolean invalid;
+} chunk_t;
+
+typedef struct {
+	GArray *vertices;
+	GArray *indices;
+	GArray *smooth;		/* gboolean per vertex, TRUE when its normal is generated */
+	corner_table_t table;
+	GLint material;
+} builder_t;
+
+G_DEFINE_QUARK(objfile-error-quark, objfile_error)
+
+static const gdouble powers[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+	1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static inline gboolean is_blank(gchar c)
+{
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline const gchar *skip_blank(const gchar *p, const gchar *end)
+{
+	while (p < end && is_blank(*p)) {
+		p++;
+	}
+	return p;
+}
+
+static inline const gchar *skip_line(const gchar *p, const gchar *end)
+{
+	const gchar *newline = memchr(p, '\n', end - p);
+
+	return newline != NULL ? newline + 1 : end;
+}
+
+static inline guint32 corner_hash(const corner_t *corner)
+{
+	guint64 hash = 14695981039346656037ull;
+
+	for (guint k = 0; k < CORNER_COUNT; ++k) {
+		hash = (hash ^ (guint32) corner->index[k]) * 1099511628211ull;
+	}
+	hash = (hash ^ corner->relative) * 1099511628211ull;
+
+	return hash ^ (hash >> 32);
+}
+
+static void corner_table_grow(corner_table_t *table)
+{
+	const GLuint capacity = table->capacity;
+	corner_t *keys = table->keys;
+	GLuint *values = table->values;
+
+	table->capacity = capacity > 0 ? capacity * 2 : 1024;
+	table->keys = g_new(corner_t, table->capacity);
+	table->values = g_new(GLuint, table->capacity);
+	for (GLuint slot = 0; slot < table->capacity; ++slot) {
+		table->keys[slot].index[CORNER_POSITION] = MISSING;
+	}
+
+	for (GLuint i = 0; i < capacity; ++i) {
+		if (keys[i].index[CORNER_POSITION] == MISSING) {
+			continue;
+		}
+
+		GLuint slot = corner_hash(&keys[i]) & (table->capacity - 1);
+
+		while (table->keys[slot].index[CORNER_POSITION] != MISSING) {
+			slot = (slot + 1) & (table->capacity - 1);
+		}
+		table->keys[slot] = keys[i];
+		table->values[slot] = values[i];
+	}
+	g_free(values);
+	g_free(keys);
+}
+
+/* returns the id of corner, inserting it with the next dense id when it is new */
+static GLuint corner_table_insert(corner_table_t *table, const corner_t *corner, gboolean *inserted)
+{
+	if (table->count * 2 >= table->capacity) {
+		corner_table_grow(table);
+	}
+
+	GLuint slot = corner_hash(corner) & (table->capacity - 1);
+
+	while (table->keys[slot].index[CORNER_POSITION] != MISSING) {
+		if (memcmp(&table->keys[slot], corner, sizeof (corner_t)) == 0) {
+			*inserted = FALSE;
+			return table->values[slot];
+		}
+		slot = (slot + 1) & (table->capacity - 1);
+	}
+	table->keys[slot] = *corner;
+	table->values[slot] = table->count;
+	*inserted = TRUE;
+
+	return table->count++;
+}
+
+static void corner_table_clear(corner_table_t *table)
+{
+	g_free(table->keys);
+	g_free(table->values);
+	*table = (corner_table_t) { NULL, NULL, 0, 0 };
+}
+
+/*
+ * Decimal to float without locale or errno: up to 19 significant digits go
+ * into an integer mantissa which is scaled once by an exact power of ten.
+ * That is well within float precision and several times faster than
+ * strtod(). Returns p unchanged when there is no number.
+ */
+static const gchar *parse_float(const gchar *p, const gchar *end, GLfloat *result)
+{
+	const gchar *start = p;
+	gboolean negative = FALSE;
+	guint64 mantissa = 0;
+	gint digits = 0;
+	gint exponent = 0;
+	guint numerals = 0;
+
+	if (p < end && (*p == '-' || *p == '+')) {
+		negative = *p++ == '-';
+	}
+	for (; p < end && g_ascii_isdigit(*p); ++p, ++numerals) {
+		if (digits < 19) {
+			mantissa = mantissa * 10 + (*p - '0');
+			digits += mantissa > 0;
+		}
+		else {
+			exponent++;
+		}
+	}
+	if (p < end && *p == '.') {
+		for (++p; p < end && g_ascii_isdigit(*p); ++p, ++numerals) {
+			if (digits < 19) {
+				mantissa = mantissa * 10 + (*p - '0');
+				digits += mantissa > 0;
+				exponent--;
+			}
+		}
+	}
+	/* a sign or a point alone is no number */
+	if (numerals == 0) {
+		return start;
+	}
+	if (p < end && (*p == 'e' || *p == 'E')) {
+		const gchar *e = p + 1;
+		gboolean negative_exponent = FALSE;
+		gint value = 0;
+
+		if (e < end && (*e == '-' || *e == '+')) {
+			negative_exponent = *e++ == '-';
+		}
+		if (e < end && g_ascii_isdigit(*e)) {
+			for (; e < end && g_ascii_isdigit(*e); ++e) {
+				value = MIN(value * 10 + (*e - '0'), 1000);
+			}
+			exponent += negative_exponent ? -value : value;
+			p = e;
+		}
+	}
+
+	gdouble value = mantissa;
+
+	if (exponent < 0) {
+		value = -exponent < (gint) G_N_ELEMENTS(powers) ? value / powers[-exponent] : value * pow(10.0, exponent);
+	}
+	else if (exponent > 0) {
+		value = exponent < (gint) G_N_ELEMENTS(powers) ? value * powers[exponent] : value * pow(10.0, exponent);
+	}
+	*result = negative ? -value : value;
+
+	return p;
+}
+
+static const gchar *parse_int(const gchar *p, const gchar *end, gint32 *result)
+{
+	const gchar *start = p;
+	gboolean negative = FALSE;
+	gint64 value = 0;
+
+	if (p < end && (*p == '-' || *p == '+')) {
+		negative = *p++ == '-';
+	}
+	for (; p < end && g_ascii_isdigit(*p); ++p) {
+		value = MIN(value * 10 + (*p - '0'), G_MAXINT32 - 1);
+	}
+	if (p == start || !g_ascii_isdigit(p[-1])) {
+		return start;
+	}
+	*result = negative ? -value : value;
+
+	return p;
+}
+
+static const gchar *parse_floats(const gchar *p, const gchar *end, GLfloat *values, guint count)
+{
+	for (guint i = 0; i < count; ++i) {
+		p = parse_float(skip_blank(p, end), end, &values[i]);
+	}
+	return p;
+}
+
+/* v, v/t, v//n or v/t/n, made absolute where it is a 1 based index */
+static const gchar *parse_corner(const gchar *p, const gchar *end, const chunk_t *chunk, corner_t *corner)
+{
+	const guint counts[CORNER_COUNT] = { chunk->positions->len, chunk->textures->len, chunk->normals->len };
+
+	corner->relative = 0;
+	for (guint k = 0; k < CORNER_COUNT; ++k) {
+		gint32 index = 0;
+
+		corner->index[k] = MISSING;
+		if (k > 0) {
+			if (p >= end || *p != '/') {
+				continue;
+			}
+			p++;
+		}
+
+		const gchar *next = parse_int(p, end, &index);
+
+		if (next == p || index == 0) {
+			continue;
+		}
+		p = next;
+		if (index < 0) {
+			corner->index[k] = (gint32) counts[k] + index;
+			corner->relative |= 1u << k;
+		}
+		else {
+			corner->index[k] = index - 1;
+		}
+	}
+	return p;
+}
+
+static const gchar *parse_name(const gchar *p, const gchar *end, gchar **name)
+{
+	const gchar *start = skip_blank(p, end);
+	const gchar *stop = start;
+
+	while (stop < end && *stop != '\n') {
+		stop++;
+	}
+	p = stop;
+	while (stop > start && is_blank(stop[-1])) {
+		stop--;
+	}
+	*name = g_strndup(start, stop - start);
+
+	return p;
+}
+
+static void chunk_parse(gpointer data, gpointer user_data)
+{
+	chunk_t *chunk = data;
+	const gchar *p = chunk->start;
+	const gchar *end = chunk->end;
+
+	while (p < end) {
+		p = skip_blank(p, end);
+		if (p + 1 >= end) {
+			break;
+		}
+
+		if (p[0] == 'v' && is_blank(p[1])) {
+			vec3 position = { 0.0f, 0.0f, 0.0f };
+
+			parse_floats(p + 2, end, (GLfloat *) &position, 3);
+			g_array_append_val(chunk->positions, position);
+		}
+		else if (p[0] == 'v' && p[1] == 't' && p + 2 < end && is_blank(p[2])) {
+			vec2 texture = { 0.0f, 0.0f };
+
+			parse_floats(p + 3, end, (GLfloat *) &texture, 2);
+			g_array_append_val(chunk->textures, texture);
+		}
+		else if (p[0] == 'v' && p[1] == 'n' && p + 2 < end && is_blank(p[2])) {
+			vec3 normal = { 0.0f, 0.0f, 0.0f };
+
+			parse_floats(p + 3, end, (GLfloat *) &normal, 3);
+			g_array_append_val(chunk->normals, normal);
+		}
+		else if (p[0] == 'f' && is_blank(p[1])) {
+			GLuint first = 0;
+			GLuint previous = 0;
+			guint count = 0;
+
+			/* polygons become fans around their first corner */
+			p += 2;
+			for (;;) {
+				corner_t corner;
+
+				p = skip_blank(p, end);
+				if (p >= end || *p == '\n' || *p == '#') {
+					break;
+				}
+
+				const gchar *next = parse_corner(p, end, chunk, &corner);
+
+				if (next == p) {
+					break;
+				}
+				p = next;
+				if (corner.index[CORNER_POSITION] == MISSING) {
+					chunk->invalid = TRUE;
+					break;
+				}
+
+				gboolean inserted;
+				const GLuint id = corner_table_insert(&chunk->table, &corner, &inserted);
+
+				if (inserted) {
+					g_array_append_val(chunk->unique, corner);
+				}
+				if (count >= 2) {
+					g_array_append_val(chunk->corners, first);
+					g_array_append_val(chunk->corners, previous);
+					g_array_append_val(chunk->corners, id);
+				}
+				if (count == 0) {
+					first = id;
+				}
+				previous = id;
+				count++;
+			}
+		}
+		else if (strncmp(p, "usemtl", MIN(6, end - p)) == 0 && p + 6 < end && is_blank(p[6])) {
+			usemtl_t usemtl = { chunk->corners->len / 3, NULL };
+
+			p = parse_name(p + 6, end, &usemtl.name);
+			g_array_append_val(chunk->usemtl, usemtl);
+		}
+		else if (strncmp(p, "mtllib", MIN(6, end - p)) == 0 && p + 6 < end && is_blank(p[6])) {
+			gchar *name;
+
+			p = parse_name(p + 6, end, &name);
+			g_ptr_array_add(chunk->mtllib, name);
+		}
+
+		p = skip_line(p, end);
+	}
+
+	/* only the ids are needed from here on */
+	corner_table_clear(&chunk->table);
+}
+
+static void chunk_clear(chunk_t *chunk)
+{
+	for (guint i = 0; i < chunk->usemtl->len; ++i) {
+		g_free(g_array_index(chunk->usemtl, usemtl_t, i).name);
+	}
+	g_array_free(chunk->positions, TRUE);
+	g_array_free(chunk->textures, TRUE);
+	g_array_free(chunk->normals, TRUE);
+	g_array_free(chunk->unique, TRUE);
+	g_array_free(chunk->corners, TRUE);
+	g_array_free(chunk->usemtl, TRUE);
+	g_ptr_array_free(chunk->mtllib, TRUE);
+}
+
+static void parse_mtl(const gchar *filename, GArray *materials)
+{
+	gchar *contents;
+	gsize length;
+	GError *error = NULL;
+
+	if (g_file_get_contents(filename, &contents, &length, &error) == FALSE) {
+		g_warning("%s", error->message);
+		g_error_free(error);
+		return;
+	}
+
+	gchar *directory = g_path_get_dirname(filename);
+	const gchar *p = contents;
+	const gchar *end = contents + length;
+	objfile_material_t *material = NULL;
+
+	while (p < end) {
+		p = skip_blank(p, end);
+
+		const gchar *keyword = p;
+
+		while (p < end && !is_blank(*p) && *p != '\n') {
+			p++;
+		}
+
+		const gsize size = p - keyword;
+
+		if (size == 6 && strncmp(keyword, "newmtl", 6) == 0) {
+			const objfile_material_t defaults = {
+				.ambient = { 0.2f, 0.2f, 0.2f },
+				.diffuse = { 0.8f, 0.8f, 0.8f },
+				.specular = { 0.0f, 0.0f, 0.0f },
+				.shininess = 32.0f
+			};
+
+			g_array_append_val(materials, defaults);
+			material = &g_array_index(materials, objfile_material_t, materials->len - 1);
+			p = parse_name(p, end, &material->name);
+		}
+		else if (material != NULL && size == 2 && keyword[0] == 'K') {
+			vec3 *color = keyword[1] == 'a' ? &material->ambient : keyword[1] == 'd' ? &material->diffuse : keyword[1] == 's' ? &material->specular : NULL;
+
+			if (color != NULL) {
+				p = parse_floats(p, end, (GLfloat *) color, 3);
+			}
+		}
+		else if (material != NULL && size == 2 && strncmp(keyword, "Ns", 2) == 0) {
+			p = parse_floats(p, end, &material->shininess, 1);
+		}
+		else if (material != NULL && size == 6 && (strncmp(keyword, "map_Kd", 6) == 0 || strncmp(keyword, "map_Ks", 6) == 0)) {
+			gchar **map = keyword[5] == 'd' ? &material->diffuse_map : &material->specular_map;
+			gchar *name;
+
+			/* options before the file name are not supported, the last word is taken */
+			p = parse_name(p, end, &name);
+			g_free(*map);
+			*map = g_build_filename(directory, strrchr(name, ' ') != NULL ? strrchr(name, ' ') + 1 : name, NULL);
+			g_free(name);
+		}
+
+		p = skip_line(p, end);
+	}
+
+	g_free(directory);
+	g_free(contents);
+}
+
+static GLint find_material(GArray *materials, const gchar *name)
+{
+	for (guint i = 0; i < materials->len; ++i) {
+		if (g_strcmp0(g_array_index(materials, objfile_material_t, i).name, name) == 0) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static GLuint builder_vertex(builder_t *builder, const corner_t *corner, const GArray *positions, const GArray *textures, const GArray *normals)
+{
+	gboolean inserted;
+	const GLuint id = corner_table_insert(&builder->table, corner, &inserted);
+
+	if (inserted) {
+		const gint32 *index = corner->index;
+		const gboolean smooth = index[CORNER_NORMAL] == MISSING;
+		const vertex_t vertex = {
+			.position = g_array_index(positions, vec3, index[CORNER_POSITION]),
+			.normal = smooth ? vec3_zero() : g_array_index(normals, vec3, index[CORNER_NORMAL]),
+			.texture = index[CORNER_TEXTURE] != MISSING ? g_array_index(textures, vec2, index[CORNER_TEXTURE]) : (vec2) { 0.0f, 0.0f }
+		};
+
+		g_array_append_val(builder->vertices, vertex);
+		g_array_append_val(builder->smooth, smooth);
+	}
+
+	return id;
+}
+
+/* one builder per material, whichever chunk its faces come from */
+static builder_t *builder_find(GPtrArray *builders, GLint material)
+{
+	for (guint b = 0; b < builders->len; ++b) {
+		builder_t *builder = g_ptr_array_index(builders, b);
+
+		if (builder->material == material) {
+			return builder;
+		}
+	}
+
+	builder_t *builder = g_new0(builder_t, 1);
+
+	builder->vertices = g_array_new(FALSE, FALSE, sizeof (vertex_t));
+	builder->indices = g_array_new(FALSE, FALSE, sizeof (GLuint));
+	builder->smooth = g_array_new(FALSE, FALSE, sizeof (gboolean));
+	builder->material = material;
+	g_ptr_array_add(builders, builder);
+
+	return builder;
+}
+
+/* faces without vn get area weighted normals, smooth across the corners that share a vertex */
+static void builder_normals(builder_t *builder)
+{
+	const gboolean *missing = (const gboolean *) builder->smooth->data;
+	vertex_t *vertices = (vertex_t *) builder->vertices->data;
+	const GLuint *indices = (const GLuint *) builder->indices->data;
+
+	for (GLuint i = 0; i < builder->indices->len; i += 3) {
+		const vec3 a = vertices[indices[i + 0]].position;
+		const vec3 b = vertices[indices[i + 1]].position;
+		const vec3 c = vertices[indices[i + 2]].position;
+		const vec3 normal = vec3_cross(vec3_sub(b, a), vec3_sub(c, a));
+
+		for (GLuint k = 0; k < 3; ++k) {
+			if (missing[indices[i + k]]) {
+				vertices[indices[i + k]].normal = vec3_add(vertices[indices[i + k]].normal, normal);
+			}
+		}
+	}
+	for (GLuint v = 0; v < builder->vertices->len; ++v) {
+		if (missing[v]) {
+			vertices[v].normal = vec3_normalize(vertices[v].normal);
+		}
+	}
+}
+
+/*
+ * Loads a Wavefront OBJ file and the MTL libraries it names. The mapped file
+ * is cut at line ends into chunks of OBJFILE_CHUNK_SIZE bytes which are
+ * parsed on a thread pool, one per processor, each deduplicating its own
+ * corners. The chunks are then stitched in file order: their vertex data is
+ * concatenated, relative indices are offset by the data of the chunks
+ * before, and every usemtl range goes into the mesh of its material, so the
+ * serial part only sees each distinct corner of a chunk once.
+ */
+objfile_t *objfile_load(const gchar *filename, GError **error)
+{
+	GTimer *timer = g_timer_new();
+	GMappedFile *mapped = g_mapped_file_new(filename, FALSE, error);
+
+	if (mapped == NULL) {
+		g_timer_destroy(timer);
+		return NULL;
+	}
+
+	const gsize length = g_mapped_file_get_length(mapped);
+	const gchar *data = g_mapped_file_get_contents(mapped);
+	const guint chunk_count = MAX(1, length / OBJFILE_CHUNK_SIZE);
+	chunk_t *chunks = g_new0(chunk_t, chunk_count);
+
+	/* start reading the whole file ahead while the chunks are handed out */
+	if (length > 0) {
+		madvise((void *) data, length, MADV_WILLNEED);
+	}
+
+	GThreadPool *pool = g_thread_pool_new(chunk_parse, NULL, g_get_num_processors(), FALSE, NULL);
+	const gchar *start = data;
+
+	for (guint i = 0; i < chunk_count; ++i) {
+		chunk_t *chunk = &chunks[i];
+		const gchar *end = i + 1 < chunk_count ? data + (i + 1) * (length / chunk_count) : data + length;
+
+		chunk->start = start;
+		chunk->end = MAX(start, end) < data + length ? skip_line(MAX(start, end), data + length) : data + length;
+		chunk->positions = g_array_new(FALSE, FALSE, sizeof (vec3));
+		chunk->textures = g_array_new(FALSE, FALSE, sizeof (vec2));
+		chunk->normals = g_array_new(FALSE, FALSE, sizeof (vec3));
+		chunk->unique = g_array_new(FALSE, FALSE, sizeof (corner_t));
+		chunk->corners = g_array_new(FALSE, FALSE, sizeof (GLuint));
+		chunk->usemtl = g_array_new(FALSE, FALSE, sizeof (usemtl_t));
+		chunk->mtllib = g_ptr_array_new_with_free_func(g_free);
+		start = chunk->end;
+
+		g_thread_pool_push(pool, chunk, NULL);
+	}
+	g_thread_pool_free(pool, FALSE, TRUE);
+
+	GArray *positions = g_array_new(FALSE, FALSE, sizeof (vec3));
+	GArray *textures = g_array_new(FALSE, FALSE, sizeof (vec2));
+	GArray *normals = g_array_new(FALSE, FALSE, sizeof (vec3));
+	GArray *materials = g_array_new(FALSE, TRUE, sizeof (objfile_material_t));
+	gchar *directory = g_path_get_dirname(filename);
+
+	for (guint i = 0; i < chunk_count; ++i) {
+		for (guint l = 0; l < chunks[i].mtllib->len; ++l) {
+			gchar *path = g_build_filename(directory, g_ptr_array_index(chunks[i].mtllib, l), NULL);
+
+			parse_mtl(path, materials);
+			g_free(path);
+		}
+	}
+	g_free(directory);
+
+	GPtrArray *builders = g_ptr_array_new();
+	builder_t *builder = NULL;
+	GLint material = -1;
+	gboolean valid = TRUE;
+
+	for (guint i = 0; i < chunk_count && valid; ++i) {
+		const chunk_t *chunk = &chunks[i];
+		const guint bases[CORNER_COUNT] = { positions->len, textures->len, normals->len };
+		const guint unique_count = chunk->unique->len;
+		/* chunk ids already resolved into a builder, most chunks feed only one */
+		GLuint *resolved = g_new(GLuint, unique_count);
+		builder_t **owner = g_new0(builder_t *, unique_count);
+		guint next_usemtl = 0;
+
+		g_array_append_vals(positions, chunk->positions->data, chunk->positions->len);
+		g_array_append_vals(textures, chunk->textures->data, chunk->textures->len);
+		g_array_append_vals(normals, chunk->normals->data, chunk->normals->len);
+		valid = !chunk->invalid;
+
+		const guint counts[CORNER_COUNT] = { positions->len, textures->len, normals->len };
+
+		for (guint c = 0; c <= chunk->corners->len && valid; ++c) {
+			/* material switches happen between triangles and carry on into the next chunk */
+			while (c % 3 == 0 && next_usemtl < chunk->usemtl->len && g_array_index(chunk->usemtl, usemtl_t, next_usemtl).triangle <= c / 3) {
+				material = find_material(materials, g_array_index(chunk->usemtl, usemtl_t, next_usemtl).name);
+				builder = NULL;
+				next_usemtl++;
+			}
+			if (c == chunk->corners->len) {
+				break;
+			}
+			if (builder == NULL) {
+				builder = builder_find(builders, material);
+			}
+
+			const GLuint id = g_array_index(chunk->corners, GLuint, c);
+
+			if (owner[id] != builder) {
+				corner_t corner = g_array_index(chunk->unique, corner_t, id);
+
+				for (guint k = 0; k < CORNER_COUNT; ++k) {
+					if (corner.index[k] == MISSING) {
+						continue;
+					}
+					if (corner.relative & 1u << k) {
+						corner.index[k] += bases[k];
+					}
+					if (corner.index[k] < 0 || (guint) corner.index[k] >= counts[k]) {
+						valid = FALSE;
+					}
+				}
+				corner.relative = 0;
+				if (!valid) {
+					break;
+				}
+				resolved[id] = builder_vertex(builder, &corner, positions, textures, normals);
+				owner[id] = builder;
+			}
+			g_array_append_val(builder->indices, resolved[id]);
+		}
+
+		g_free(owner);
+		g_free(resolved);
+	}
+
+	objfile_t *obj = NULL;
+
+	if (valid) {
+		obj = g_new0(objfile_t, 1);
+		obj->mesh_count = builders->len;
+		obj->meshes = g_new(objfile_mesh_t, builders->len);
+		for (guint b = 0; b < builders->len; ++b) {
+			builder_t *builder = g_ptr_array_index(builders, b);
+
+			builder_normals(builder);
+
+			mesh_t *mesh = g_new(mesh_t, 1);
+
+			mesh->vertex_count = builder->vertices->len;
+			mesh->vertices = (vertex_t *) g_array_free(builder->vertices, FALSE);
+			mesh->index_count = builder->indices->len;
+			mesh->indices = (GLuint *) g_array_free(builder->indices, FALSE);
+			mesh->mode = GL_TRIANGLES;
+			obj->meshes[b] = (objfile_mesh_t) { mesh, builder->material };
+		}
+		obj->material_count = materials->len;
+		obj->materials = (objfile_material_t *) g_array_free(materials, FALSE);
+		obj->bytes = length;
+	}
+	else {
+		for (guint b = 0; b < builders->len; ++b) {
+			builder_t *builder = g_ptr_array_index(builders, b);
+
+			g_array_free(builder->vertices, TRUE);
+			g_array_free(builder->indices, TRUE);
+		}
+		for (guint m = 0; m < materials->len; ++m) {
+			objfile_material_t *material = &g_array_index(materials, objfile_material_t, m);
+
+			g_free(material->name);
+			g_free(material->diffuse_map);
+			g_free(material->specular_map);
+		}
+		g_array_free(materials, TRUE);
+		g_set_error(error, OBJFILE_ERROR, OBJFILE_ERROR_INVALID, "%s: face index out of range", filename);
+	}
+
+	for (guint b = 0; b < builders->len; ++b) {
+		builder_t *builder = g_ptr_array_index(builders, b);
+
+		corner_table_clear(&builder->table);
+		g_array_free(builder->smooth, TRUE);
+		g_free(builder);
+	}
+	g_ptr_array_free(builders, TRUE);
+	g_array_free(positions, TRUE);
+	g_array_free(textures, TRUE);
+	g_array_free(normals, TRUE);
+	for (guint i = 0; i < chunk_count; ++i) {
+		chunk_clear(&chunks[i]);
+	}
+	g_free(chunks);
+	g_mapped_file_unref(mapped);
+
+	if (obj != NULL) {
+		obj->seconds = g_timer_elapsed(timer, NULL);
+	}
+	g_timer_destroy(timer);
+
+	return obj;
+}
+
+void objfile_free(objfile_t *obj)
+{
+	if (obj == NULL) {
+		return;
+	}
+	for (guint m = 0; m < obj->mesh_count; ++m) {
+		mesh_free(obj->meshes[m].mesh);
+	}
+	for (guint m = 0; m < obj->material_count; ++m) {
+		g_free(obj->materials[m].name);
+		g_free(obj->materials[m].diffuse_map);
+		g_free(obj->materials[m].specular_map);
+	}
+	g_free(obj->meshes);
+	g_free(obj->materials);
+	g_free(obj);
+}
+
+/* all meshes as one, for consumers that draw without materials */
+mesh_t *objfile_merge(const objfile_t *obj)
+{
+	GLuint vertex_count = 0;
+	GLuint index_count = 0;
+
+	for (guint m = 0; m < obj->mesh_count; ++m) {
+		vertex_count += obj->meshes[m].mesh->vertex_count;
+		index_count += obj->meshes[m].mesh->index_count;
+	}
+
+	mesh_t *mesh = mesh_new(vertex_count, index_count);
+	GLuint vertex = 0;
+	GLuint index = 0;
+
+	for (guint m = 0; m < obj->mesh_count; ++m) {
+		const mesh_t *part = obj->meshes[m].mesh;
+
+		memcpy(mesh->vertices + vertex, part->vertices, part->vertex_count * sizeof (vertex_t));
+		for (GLuint i = 0; i < part->index_count; ++i) {
+			mesh->indices[index++] = part->indices[i] + vertex;
+		}
+		vertex += part->vertex_count;
+	}
+
+	return mesh;
+}
@@ -0,0 +1,72 @@
+#include <pbo_pool.h>
+
+pbo_pool_t *pbo_pool_new(guint count, GLsizeiptr size)
+{
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	pbo_pool_t *pool = g_new(pbo_pool_t, 1);
+
+	pool->pbos = g_new0(pbo_t, count);
+	pool->count = count;
+	pool->size = size;
+
+	for (guint i = 0; i < count; ++i) {
+		pbo_t *pbo = &pool->pbos[i];
+
+		glGenBuffers(1, &pbo->buffer);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo->buffer);
+		glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size, NULL, flags);
+		pbo->data = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, flags);
+	}
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	return pool;
+}
+
+/* with no worker still writing to any of them */
+void pbo_pool_free(pbo_pool_t *pool)
+{
+	if (pool == NULL) {
+		return;
+	}
+	for (guint i = 0; i < pool->count; ++i) {
+		pbo_t *pbo = &pool->pbos[i];
+
+		glDeleteSync(pbo->fence);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo->buffer);
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		glDeleteBuffers(1, &pbo->buffer);
+	}
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	g_free(pool->pbos);
+	g_free(pool);
+}
+
+/* a buffer the GPU is done with, NULL when all are in use or still being read, never blocks */
+pbo_t *pbo_pool_acquire(pbo_pool_t *pool)
+{
+	for (guint i = 0; i < pool->count; ++i) {
+		pbo_t *pbo = &pool->pbos[i];
+
+		if (pbo->used) {
+			continue;
+		}
+		if (pbo->fence != NULL) {
+			if (glClientWaitSync(pbo->fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+				continue;
+			}
+			glDeleteSync(pbo->fence);
+			pbo->fence = NULL;
+		}
+		pbo->used = TRUE;
+		return pbo;
+	}
+
+	return NULL;
+}
+
+/* after the last command reading from it, or right away when it was never read */
+void pbo_pool_release(pbo_pool_t *pool, pbo_t *pbo)
+{
+	pbo->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	pbo->used = FALSE;
+}
@@ -0,0 +1,101 @@
+#include <ring_buffer.h>
+
+/* how long one glClientWaitSync() blocks before it is asked again, in nanoseconds */
+#define RING_BUFFER_WAIT 1000000
+
+/*
+ * region_size is the most a frame allocates, in at most allocations calls,
+ * each of which may add up to alignment bytes of padding. Needs GL 4.4 or
+ * ARB_buffer_storage.
+ */
+ring_buffer_t *ring_buffer_new(GLsizeiptr region_size, guint allocations)
+{
+	ring_buffer_t *ring = g_new0(ring_buffer_t, 1);
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	GLint uniform, storage = 1;
+
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniform);
+	if (epoxy_gl_version() >= 43 || epoxy_has_gl_extension("GL_ARB_shader_storage_buffer_object")) {
+		glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storage);
+	}
+	/* both are powers of two, and 16 covers any std140 or std430 member */
+	ring->alignment = MAX(16, MAX(uniform, storage));
+	ring->region_size = (region_size + allocations * ring->alignment + ring->alignment - 1) & ~(ring->alignment - 1);
+
+	glGenBuffers(1, &ring->buffer);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+	glBufferStorage(GL_COPY_WRITE_BUFFER, RING_BUFFER_FRAMES * ring->region_size, NULL, flags);
+	ring->data = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, RING_BUFFER_FRAMES * ring->region_size, flags);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	ring->frame = RING_BUFFER_FRAMES - 1;
+
+	return ring;
+}
+
+void ring_buffer_free(ring_buffer_t *ring)
+{
+	if (ring == NULL) {
+		return;
+	}
+	for (guint i = 0; i < RING_BUFFER_FRAMES; ++i) {
+		glDeleteSync(ring->fences[i]);
+	}
+	glBindBuffer(GL_COPY_WRITE_BUFFER, ring->buffer);
+	glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	glDeleteBuffers(1, &ring->buffer);
+	g_free(ring);
+}
+
+/* moves on to the next region, first waiting for the GPU to finish the frame that used it last */
+void ring_buffer_begin(ring_buffer_t *ring)
+{
+	ring->frame = (ring->frame + 1) % RING_BUFFER_FRAMES;
+	ring->offset = 0;
+
+	GLsync fence = ring->fences[ring->frame];
+
+	if (fence == NULL) {
+		return;
+	}
+	if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+		const gint64 start = g_get_monotonic_time();
+		GLenum status;
+
+		do {
+			status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, RING_BUFFER_WAIT);
+		} while (status == GL_TIMEOUT_EXPIRED);
+		ring->wait_time += g_get_monotonic_time() - start;
+		ring->waits++;
+	}
+	glDeleteSync(fence);
+	ring->fences[ring->frame] = NULL;
+}
+
+/*
+ * Returns where to write size bytes this frame, offset receives their
+ * position in buffer for glBindBufferRange() or as an attribute offset.
+ * NULL once the region is full.
+ */
+gpointer ring_buffer_alloc(ring_buffer_t *ring, GLsizeiptr size, GLintptr *offset)
+{
+	g_return_val_if_fail(ring->offset + size <= ring->region_size, NULL);
+
+	*offset = ring->frame * ring->region_size + ring->offset;
+	ring->offset += (size + ring->alignment - 1) & ~(ring->alignment - 1);
+
+	return ring->data + *offset;
+}
+
+/* call after the last command reading this frame's allocations */
+void ring_buffer_end(ring_buffer_t *ring)
+{
+	ring->fences[ring->frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void ring_buffer_reset_stats(ring_buffer_t *ring)
+{
+	ring->wait_time = 0;
+	ring->waits = 0;
+}
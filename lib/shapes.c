@@ -0,0 +1,358 @@
+#include <math.h>
+#include <string.h>
+#include <shapes.h>
+
+/*
+                     2
+                  1     3
+ o ------------  0,N     4
+                  7     5
+		     6
+
+    2 - N+3
+    | \ |
+    1 - N+2
+    | \ |
+    0 - N+1
+
+ As strips, one per ring: 0, N+1, 1, N+2, 2, N+3 ... restart
+*/
+mesh_t *shape_torus(GLuint rings, GLuint sides, GLfloat radius, GLfloat width, GLenum mode)
+{
+	const GLuint index_count = mode == GL_TRIANGLE_STRIP ? rings * (2 * (sides + 1) + 1) - 1 : rings * sides * 6;
+	mesh_t *mesh = mesh_new((rings + 1) * (sides + 1), index_count);
+	vertex_t *vertex = mesh->vertices;
+	GLuint *index = mesh->indices;
+
+	for (GLuint i = 0; i <= rings; ++i) {
+		const double phi = i * (GLMATH_2_PI / rings);
+
+		for (GLuint j = 0; j <= sides; ++j) {
+			const double theta = j * (GLMATH_2_PI / sides);
+			const double x = radius - width * cos(theta);
+
+			*vertex++ = (vertex_t) {
+				.position = { x * cos(phi), width * sin(theta), -x * sin(phi) },
+				.normal = { -cos(theta) * cos(phi), sin(theta), cos(theta) * sin(phi) },
+				.texture = { (double) i / rings, (double) j / sides }
+			};
+		}
+	}
+
+	mesh->mode = mode;
+	if (mode == GL_TRIANGLE_STRIP) {
+		for (GLuint i = 0; i < rings; ++i) {
+			if (i > 0) {
+				*index++ = MESH_RESTART_INDEX;
+			}
+			for (GLuint j = 0; j <= sides; ++j) {
+				*index++ = j + i * (sides + 1);
+				*index++ = j + (i + 1) * (sides + 1);
+			}
+		}
+		return mesh;
+	}
+
+	for (GLuint i = 0; i < rings; ++i) {
+		for (GLuint j = 0; j < sides; ++j) {
+			const GLuint base = j + i * (sides + 1);
+
+			*index++ = base;
+			*index++ = base + sides + 1;
+			*index++ = base + 1;
+
+			*index++ = base + 1;
+			*index++ = base + sides + 1;
+			*index++ = base + sides + 2;
+		}
+	}
+
+	return mesh;
+}
+
+/*
+	0-2-4... 2N
+	|/|/|/
+	1-3-5... 2N+1
+
+ As a single strip: 0, 1, 2, 3 ... 2N+1
+*/
+mesh_t *shape_cylinder(GLuint segments, GLenum mode)
+{
+	const GLuint index_count = mode == GL_TRIANGLE_STRIP ? (segments + 1) * 2 : segments * 6;
+	mesh_t *mesh = mesh_new((segments + 1) * 2, index_count);
+	vertex_t *vertex = mesh->vertices;
+	GLuint *index = mesh->indices;
+
+	for (GLuint i = 0; i <= segments; ++i) {
+		const double phi = i * (GLMATH_2_PI / segments);
+		const vec3 normal = { cos(phi), 0.0, -sin(phi) };
+
+		*vertex++ = (vertex_t) {
+			.position = { normal.x, -1.0, normal.z },
+			.normal = normal,
+			.texture = { (double) i / segments, 1.0 }
+		};
+		*vertex++ = (vertex_t) {
+			.position = { normal.x, +1.0, normal.z },
+			.normal = normal,
+			.texture = { (double) i / segments, 0.0 }
+		};
+	}
+
+	mesh->mode = mode;
+	if (mode == GL_TRIANGLE_STRIP) {
+		for (GLuint i = 0; i < index_count; ++i) {
+			*index++ = i;
+		}
+		return mesh;
+	}
+
+	for (GLuint i = 0; i < segments; ++i) {
+		*index++ = i * 2 + 1;
+		*index++ = i * 2 + 2;
+		*index++ = i * 2 + 0;
+
+		*index++ = i * 2 + 1;
+		*index++ = i * 2 + 3;
+		*index++ = i * 2 + 2;
+	}
+
+	return mesh;
+}
+
+mesh_t *shape_icosahedron(void)
+{
+	const GLfloat phi = (1.0 + sqrt(5.0)) / 2.0;
+	const GLfloat a = 0.5;
+	const GLfloat b = 1.0 / (2.0 * phi);
+
+	static const GLuint indices[] = {
+		0, 1, 2,
+		3, 2, 1,
+		3, 4, 5,
+		3, 8, 4,
+		0, 6, 7,
+		0, 9, 6,
+		4, 10, 11,
+		6, 11, 10,
+		2, 5, 9,
+		11, 9, 5,
+		1, 7, 8,
+		10, 8, 7,
+		3, 5, 2,
+		3, 1, 8,
+		0, 2, 9,
+		0, 7, 1,
+		6, 9, 11,
+		6, 10, 7,
+		4, 11, 5,
+		4, 8, 10
+	};
+	const vec3 positions[] = {
+		{ 0,  b, -a},
+		{ b,  a,  0},
+		{-b,  a,  0},
+		{ 0,  b,  a},
+		{ 0, -b,  a},
+		{-a,  0,  b},
+		{ 0, -b, -a},
+		{ a,  0, -b},
+		{ a,  0,  b},
+		{-a,  0, -b},
+		{ b, -a,  0},
+		{-b, -a,  0}
+	};
+	mesh_t *mesh = mesh_new(G_N_ELEMENTS(positions), G_N_ELEMENTS(indices));
+
+	for (GLuint i = 0; i < G_N_ELEMENTS(positions); ++i) {
+		mesh->vertices[i] = (vertex_t) {
+			.position = positions[i],
+			.normal = vec3_normalize(positions[i]),
+			.texture = { 0, 0 }
+		};
+	}
+	memcpy(mesh->indices, indices, sizeof indices);
+
+	return mesh;
+}
+
+/* unit cube around the origin, four vertices per face so the normals stay flat */
+mesh_t *shape_cube(void)
+{
+	static const vec3 normals[] = {
+		{ 1, 0, 0}, {-1, 0, 0}, {0,  1, 0}, {0, -1, 0}, {0, 0,  1}, { 0, 0, -1}
+	};
+	static const vec3 tangents[] = {
+		{ 0, 0, -1}, { 0, 0, 1}, {1,  0, 0}, {1,  0, 0}, {1, 0,  0}, {-1, 0,  0}
+	};
+	static const vec2 corners[] = {
+		{-1, -1}, {1, -1}, {1, 1}, {-1, 1}
+	};
+	mesh_t *mesh = mesh_new(4 * G_N_ELEMENTS(normals), 6 * G_N_ELEMENTS(normals));
+
+	for (GLuint face = 0; face < G_N_ELEMENTS(normals); ++face) {
+		const vec3 n = normals[face];
+		const vec3 u = tangents[face];
+		const vec3 v = vec3_cross(n, u);
+
+		for (GLuint c = 0; c < G_N_ELEMENTS(corners); ++c) {
+			const vec2 st = corners[c];
+
+			mesh->vertices[4 * face + c] = (vertex_t) {
+				.position = vec3_mulf(vec3_add(n, vec3_add(vec3_mulf(u, st.x), vec3_mulf(v, st.y))), 0.5f),
+				.normal = n,
+				.texture = { 0.5f * (st.x + 1.0f), 0.5f * (st.y + 1.0f) }
+			};
+		}
+
+		GLuint *indices = mesh->indices + 6 * face;
+
+		indices[0] = 4 * face + 0;
+		indices[1] = 4 * face + 1;
+		indices[2] = 4 * face + 2;
+		indices[3] = 4 * face + 0;
+		indices[4] = 4 * face + 2;
+		indices[5] = 4 * face + 3;
+	}
+
+	return mesh;
+}
+
+typedef struct {
+	guint64 edge;
+	GLuint vertex;
+} midpoint_t;
+
+/*
+ * Returns the vertex halfway along the edge a-b, pushed out onto the unit
+ * sphere. Both triangles sharing the edge get the same vertex through the
+ * table, so a level has no duplicated positions.
+ */
+static GLuint icosphere_midpoint(midpoint_t *table, GLuint capacity, vertex_t *vertices, GLuint *count, GLuint a, GLuint b)
+{
+	const guint64 edge = a < b ? (guint64) a << 32 | b : (guint64) b << 32 | a;
+	GLuint slot = (edge * 11400714819323198485ull) >> 32 & (capacity - 1);
+
+	while (table[slot].edge != G_MAXUINT64) {
+		if (table[slot].edge == edge) {
+			return table[slot].vertex;
+		}
+		slot = (slot + 1) & (capacity - 1);
+	}
+
+	const vec3 position = vec3_normalize(vec3_add(vertices[a].position, vertices[b].position));
+
+	vertices[*count] = (vertex_t) {
+		.position = position,
+		.normal = position,
+		.texture = { 0, 0 }
+	};
+	table[slot] = (midpoint_t) { edge, *count };
+
+	return (*count)++;
+}
+
+/* deepest point of a flat triangle below the unit sphere, at its plane */
+static GLfloat icosphere_error(const vertex_t *vertices, const GLuint *indices, GLuint count)
+{
+	GLfloat error = 0.0f;
+
+	for (GLuint i = 0; i < count; i += 3) {
+		const vec3 a = vertices[indices[i + 0]].position;
+		const vec3 b = vertices[indices[i + 1]].position;
+		const vec3 c = vertices[indices[i + 2]].position;
+		const vec3 normal = vec3_normalize(vec3_cross(vec3_sub(b, a), vec3_sub(c, a)));
+
+		error = MAX(error, 1.0f - vec3_dot(normal, a));
+	}
+
+	return error;
+}
+
+/*
+ * Unit sphere made by splitting every triangle of the icosahedron in four,
+ * levels - 1 times. Each level only appends vertices, so the vertex buffer
+ * of the finest level serves all of them and the levels are ranges of one
+ * index buffer, stored finest first:
+
+	a
+	|\         a, ab, ca
+	ca-ab      ab, b, bc
+	|\ |\      ca, bc, c
+	c-bc-b     ab, bc, ca
+*/
+mesh_t *shape_icosphere(GLuint levels, mesh_lod_t *lods)
+{
+	g_return_val_if_fail(levels >= 1 && levels <= MESH_LOD_MAX, NULL);
+
+	mesh_t *base = shape_icosahedron();
+	GLuint index_count = 0;
+
+	for (GLuint level = 0; level < levels; ++level) {
+		index_count += base->index_count << 2 * level;
+	}
+
+	mesh_t *mesh = mesh_new(10 * (1u << 2 * (levels - 1)) + 2, index_count);
+	GLuint offset = index_count - base->index_count;
+	GLuint count = base->vertex_count;
+
+	for (GLuint i = 0; i < count; ++i) {
+		const vec3 position = vec3_normalize(base->vertices[i].position);
+
+		mesh->vertices[i] = (vertex_t) {
+			.position = position,
+			.normal = position,
+			.texture = { 0, 0 }
+		};
+	}
+	/* the icosahedron winds clockwise seen from outside, turn it for back face culling */
+	for (GLuint i = 0; i < base->index_count; i += 3) {
+		mesh->indices[offset + i + 0] = base->indices[i + 0];
+		mesh->indices[offset + i + 1] = base->indices[i + 2];
+		mesh->indices[offset + i + 2] = base->indices[i + 1];
+	}
+	lods[levels - 1] = (mesh_lod_t) { offset, base->index_count, icosphere_error(mesh->vertices, mesh->indices + offset, base->index_count) };
+	mesh_free(base);
+
+	/* a closed mesh has three edges for every two triangles, the last split inserts the most */
+	GLuint capacity = 16;
+
+	while (capacity < (lods[levels - 1].index_count << 2 * (levels - 1)) / 4) {
+		capacity *= 2;
+	}
+
+	midpoint_t *table = g_new(midpoint_t, capacity);
+
+	for (GLuint lod = levels - 1; lod > 0; --lod) {
+		const GLuint *source = mesh->indices + lods[lod].index_offset;
+		const GLuint source_count = lods[lod].index_count;
+		GLuint *index;
+
+		offset -= source_count * 4;
+		index = mesh->indices + offset;
+		memset(table, 0xff, capacity * sizeof (midpoint_t));
+
+		for (GLuint i = 0; i < source_count; i += 3) {
+			const GLuint a = source[i + 0];
+			const GLuint b = source[i + 1];
+			const GLuint c = source[i + 2];
+			const GLuint ab = icosphere_midpoint(table, capacity, mesh->vertices, &count, a, b);
+			const GLuint bc = icosphere_midpoint(table, capacity, mesh->vertices, &count, b, c);
+			const GLuint ca = icosphere_midpoint(table, capacity, mesh->vertices, &count, c, a);
+			const GLuint split[] = {
+				a, ab, ca,
+				ab, b, bc,
+				ca, bc, c,
+				ab, bc, ca
+			};
+
+			memcpy(index, split, sizeof split);
+			index += G_N_ELEMENTS(split);
+		}
+		lods[lod - 1] = (mesh_lod_t) { offset, source_count * 4, icosphere_error(mesh->vertices, mesh->indices + offset, source_count * 4) };
+	}
+	g_free(table);
+
+	return mesh;
+}
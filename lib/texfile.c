@@ -0,0 +1,477 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <texfile.h>
+#include <texture_compress.h>
+
+#define TEXFILE_ALIGN(x) (((x) + TEXFILE_ALIGNMENT - 1) & ~((guint64) TEXFILE_ALIGNMENT - 1))
+
+G_STATIC_ASSERT(sizeof (texfile_header_t) == 544);
+G_STATIC_ASSERT(G_BYTE_ORDER == G_LITTLE_ENDIAN);
+
+struct texfile {
+	GMappedFile *mapped;
+	const guint8 *data;
+	const texfile_header_t *header;
+};
+
+/* a level while baking, premultiplied RGBA in linear light unless TEXFILE_FLAG_LINEAR */
+typedef struct {
+	guint width;
+	guint height;
+	gfloat *texels;
+} texfile_image_t;
+
+G_DEFINE_QUARK(texfile-error-quark, texfile_error)
+
+static guint32 texfile_pitch(const texfile_header_t *header, guint32 width)
+{
+	const gsize block_bytes = texture_compress_block_bytes(header->internal_format);
+
+	if (block_bytes > 0) {
+		return (width + 3) / 4 * block_bytes;
+	}
+	return (width * (header->format == GL_RGBA ? 4 : 3) + 3) & ~3;
+}
+
+static guint64 texfile_size(const texfile_header_t *header, guint32 row_pitch, guint32 height)
+{
+	return (guint64) row_pitch * (texture_compress_block_bytes(header->internal_format) > 0 ? (height + 3) / 4 : height);
+}
+
+static gboolean texfile_validate(const guint8 *data, gsize length, GError **error)
+{
+	const texfile_header_t *header = (const texfile_header_t *) data;
+
+	if (length < sizeof (texfile_header_t) || header->magic != TEXFILE_MAGIC) {
+		g_set_error_literal(error, TEXFILE_ERROR, TEXFILE_ERROR_INVALID, "not a texture file");
+		return FALSE;
+	}
+	if (header->version != TEXFILE_VERSION || header->header_size != sizeof (texfile_header_t)) {
+		g_set_error(error, TEXFILE_ERROR, TEXFILE_ERROR_VERSION, "unsupported texture file version %u", header->version);
+		return FALSE;
+	}
+	if (!((header->internal_format == GL_RGB8 && header->format == GL_RGB) ||
+	      (header->internal_format == GL_RGBA8 && header->format == GL_RGBA) ||
+	      (texture_compress_block_bytes(header->internal_format) > 0 && header->format == 0))) {
+		g_set_error(error, TEXFILE_ERROR, TEXFILE_ERROR_INVALID, "unsupported format 0x%04x", header->internal_format);
+		return FALSE;
+	}
+	if (header->width == 0 || header->height == 0) {
+		g_set_error_literal(error, TEXFILE_ERROR, TEXFILE_ERROR_INVALID, "empty image");
+		return FALSE;
+	}
+	if (header->level_count == 0 || header->level_count > TEXFILE_LEVEL_MAX) {
+		g_set_error_literal(error, TEXFILE_ERROR, TEXFILE_ERROR_INVALID, "invalid level count");
+		return FALSE;
+	}
+	for (guint32 i = 0; i < header->level_count; ++i) {
+		const texfile_level_t *level = &header->levels[i];
+
+		if (level->width != MAX(1, header->width >> i) || level->height != MAX(1, header->height >> i) ||
+		    level->row_pitch != texfile_pitch(header, level->width) ||
+		    level->size != texfile_size(header, level->row_pitch, level->height) ||
+		    level->offset % TEXFILE_ALIGNMENT != 0 || level->offset < sizeof (texfile_header_t) ||
+		    level->offset > length || level->size > length - level->offset) {
+			g_set_error(error, TEXFILE_ERROR, TEXFILE_ERROR_INVALID, "invalid level #%u", i);
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+texfile_t *texfile_open(const gchar *filename, GError **error)
+{
+	GMappedFile *mapped = g_mapped_file_new(filename, FALSE, error);
+
+	if (mapped == NULL) {
+		return NULL;
+	}
+
+	const gsize length = g_mapped_file_get_length(mapped);
+	const guint8 *data = (const guint8 *) g_mapped_file_get_contents(mapped);
+
+	if (texfile_validate(data, length, error) == FALSE) {
+		g_prefix_error(error, "%s: ", filename);
+		g_mapped_file_unref(mapped);
+		return NULL;
+	}
+
+	/* start paging the levels in while the caller sets up the GL objects */
+	madvise((void *) data, length, MADV_WILLNEED);
+
+	texfile_t *file = g_new(texfile_t, 1);
+
+	file->mapped = mapped;
+	file->data = data;
+	file->header = (const texfile_header_t *) data;
+
+	return file;
+}
+
+void texfile_close(texfile_t *file)
+{
+	if (file == NULL) {
+		return;
+	}
+	g_mapped_file_unref(file->mapped);
+	g_free(file);
+}
+
+const texfile_header_t *texfile_get_header(const texfile_t *file)
+{
+	return file->header;
+}
+
+gconstpointer texfile_get_level(const texfile_t *file, guint level)
+{
+	return file->data + file->header->levels[level].offset;
+}
+
+/*
+ * Where texconv baked filename at build time: its path below
+ * TEXTURE_SOURCE_DIR, links resolved, under TEXTURE_BAKED_DIR with .tex
+ * appended. NULL for images outside the source directory.
+ */
+static gchar *texfile_baked_path(const gchar *filename)
+{
+	gchar *path = NULL;
+#if defined(TEXTURE_SOURCE_DIR) && defined(TEXTURE_BAKED_DIR)
+	gchar *source = realpath(filename, NULL);
+	gchar *root = realpath(TEXTURE_SOURCE_DIR, NULL);
+
+	if (source != NULL && root != NULL && g_str_has_prefix(source, root) && source[strlen(root)] == G_DIR_SEPARATOR) {
+		gchar *name = g_strconcat(source + strlen(root) + 1, ".tex", NULL);
+
+		path = g_build_filename(TEXTURE_BAKED_DIR, name, NULL);
+		g_free(name);
+	}
+	free(root);
+	free(source);
+#endif
+	return path;
+}
+
+/*
+ * The file texconv baked from the image filename at build time. NULL when
+ * there is none, or when its format is compressed in a way the current
+ * context cannot take and filename has to be decoded after all.
+ */
+texfile_t *texfile_open_baked(const gchar *filename)
+{
+	texfile_t *file = NULL;
+	gchar *path = texfile_baked_path(filename);
+
+	if (path != NULL && g_file_test(path, G_FILE_TEST_IS_REGULAR)) {
+		GError *error = NULL;
+
+		file = texfile_open(path, &error);
+		if (file == NULL) {
+			g_warning("%s", error->message);
+			g_error_free(error);
+		}
+		else if (!texfile_supported(file)) {
+			texfile_close(file);
+			file = NULL;
+		}
+	}
+	g_free(path);
+
+	return file;
+}
+
+/* with a context current, FALSE when the levels are in a compressed format it cannot take */
+gboolean texfile_supported(const texfile_t *file)
+{
+	return file->header->format != 0 || texture_compress_supported(file->header->internal_format);
+}
+
+/* faults every page in, for a worker to take the disk reads off the GL thread */
+void texfile_prefetch(const texfile_t *file)
+{
+	const gsize length = g_mapped_file_get_length(file->mapped);
+	volatile guint8 sum = 0;
+
+	for (gsize offset = 0; offset < length; offset += 4096) {
+		sum += file->data[offset];
+	}
+}
+
+static void texfile_prefetch_worker(GTask *task, gpointer source_object, gpointer task_data, GCancellable *cancellable)
+{
+	texfile_prefetch(task_data);
+	g_task_return_pointer(task, task_data, NULL);
+}
+
+/* texfile_prefetch() on a worker, task returns file, which stays the caller's */
+void texfile_prefetch_in_thread(GTask *task, texfile_t *file)
+{
+	g_task_set_task_data(task, file, NULL);
+	g_task_run_in_thread(task, texfile_prefetch_worker);
+}
+
+/*
+ * Into the texture bound to GL_TEXTURE_2D, straight from the mapped pages.
+ * Storage for every level is allocated at once where the context has
+ * texture storage, otherwise level by level. Compressed levels go as they
+ * are, check texfile_supported() first. With max_size > 0 the levels
+ * larger than max_size x max_size are left out, though never the last.
+ */
+void texfile_upload(const texfile_t *file, gint max_size)
+{
+	const texfile_header_t *header = file->header;
+	const gboolean storage = epoxy_gl_version() >= 42 || epoxy_has_gl_extension("GL_ARB_texture_storage");
+	const gboolean compressed = header->format == 0;
+	guint32 base = 0;
+
+	while (max_size > 0 && base + 1 < header->level_count && MAX(header->levels[base].width, header->levels[base].height) > (guint32) max_size) {
+		base++;
+	}
+	if (storage) {
+		glTexStorage2D(GL_TEXTURE_2D, header->level_count - base, header->internal_format, header->levels[base].width, header->levels[base].height);
+	}
+	for (guint32 i = base; i < header->level_count; ++i) {
+		const texfile_level_t *level = &header->levels[i];
+		gconstpointer data = texfile_get_level(file, i);
+
+		if (compressed && storage) {
+			glCompressedTexSubImage2D(GL_TEXTURE_2D, i - base, 0, 0, level->width, level->height, header->internal_format, level->size, data);
+		}
+		else if (compressed) {
+			glCompressedTexImage2D(GL_TEXTURE_2D, i - base, header->internal_format, level->width, level->height, 0, level->size, data);
+		}
+		else if (storage) {
+			glTexSubImage2D(GL_TEXTURE_2D, i - base, 0, 0, level->width, level->height, header->format, GL_UNSIGNED_BYTE, data);
+		}
+		else {
+			glTexImage2D(GL_TEXTURE_2D, i - base, header->internal_format, level->width, level->height, 0, header->format, GL_UNSIGNED_BYTE, data);
+		}
+	}
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, header->level_count - base - 1);
+}
+
+static gfloat texfile_decode(guint8 value, gboolean linear)
+{
+	const gfloat c = value / 255.0f;
+
+	if (linear) {
+		return c;
+	}
+	return c <= 0.04045f ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+}
+
+static guint8 texfile_encode(gfloat c, gboolean linear)
+{
+	c = CLAMP(c, 0.0f, 1.0f);
+	if (!linear) {
+		c = c <= 0.0031308f ? c * 12.92f : 1.055f * powf(c, 1.0f / 2.4f) - 0.055f;
+	}
+	return (guint8) (c * 255.0f + 0.5f);
+}
+
+static texfile_image_t texfile_image(GdkPixbuf *pixbuf, gboolean linear)
+{
+	const guint channels = gdk_pixbuf_get_n_channels(pixbuf);
+	const gboolean alpha = gdk_pixbuf_get_has_alpha(pixbuf);
+	const gsize stride = gdk_pixbuf_get_rowstride(pixbuf);
+	const guint8 *pixels = gdk_pixbuf_read_pixels(pixbuf);
+	texfile_image_t image = { gdk_pixbuf_get_width(pixbuf), gdk_pixbuf_get_height(pixbuf) };
+
+	image.texels = g_new(gfloat, 4 * image.width * image.height);
+	for (guint y = 0; y < image.height; ++y) {
+		for (guint x = 0; x < image.width; ++x) {
+			const guint8 *p = pixels + y * stride + x * channels;
+			gfloat *t = image.texels + 4 * (y * image.width + x);
+			const gfloat a = alpha ? p[3] / 255.0f : 1.0f;
+
+			t[0] = texfile_decode(p[0], linear) * a;
+			t[1] = texfile_decode(p[1], linear) * a;
+			t[2] = texfile_decode(p[2], linear) * a;
+			t[3] = a;
+		}
+	}
+
+	return image;
+}
+
+/*
+ * Resamples count texels a distance apart into size, with a tent filter as
+ * wide as the reduction. Halving weighs the four nearest texels 1 3 3 1, odd
+ * sizes get the same footprint around their true centres.
+ */
+static void texfile_filter(const gfloat *source, guint count, gsize distance, gfloat *target, guint size)
+{
+	const gfloat ratio = (gfloat) count / size;
+
+	for (guint i = 0; i < size; ++i) {
+		const gfloat centre = (i + 0.5f) * ratio - 0.5f;
+		const gint first = (gint) floorf(centre - ratio) + 1;
+		const gint last = (gint) ceilf(centre + ratio) - 1;
+		gfloat sum[4] = { 0.0f };
+		gfloat total = 0.0f;
+
+		for (gint s = first; s <= last; ++s) {
+			const gfloat weight = 1.0f - fabsf(s - centre) / ratio;
+			const gfloat *t = source + CLAMP(s, 0, (gint) count - 1) * distance;
+
+			if (weight <= 0.0f) {
+				continue;
+			}
+			for (guint c = 0; c < 4; ++c) {
+				sum[c] += weight * t[c];
+			}
+			total += weight;
+		}
+		for (guint c = 0; c < 4; ++c) {
+			target[4 * i + c] = sum[c] / total;
+		}
+	}
+}
+
+static texfile_image_t texfile_reduce(const texfile_image_t *source)
+{
+	texfile_image_t target = { MAX(1, source->width >> 1), MAX(1, source->height >> 1) };
+	gfloat *rows = g_new(gfloat, 4 * target.width * source->height);
+	gfloat *column = g_new(gfloat, 4 * target.height);
+
+	for (guint y = 0; y < source->height; ++y) {
+		texfile_filter(source->texels + 4 * y * source->width, source->width, 4, rows + 4 * y * target.width, target.width);
+	}
+	target.texels = g_new(gfloat, 4 * target.width * target.height);
+	for (guint x = 0; x < target.width; ++x) {
+		texfile_filter(rows + 4 * x, source->height, 4 * target.width, column, target.height);
+		for (guint y = 0; y < target.height; ++y) {
+			memcpy(target.texels + 4 * (y * target.width + x), column + 4 * y, 4 * sizeof (gfloat));
+		}
+	}
+	g_free(column);
+	g_free(rows);
+
+	return target;
+}
+
+/* back to 8 bit RGBA, straight alpha */
+static guint8 *texfile_rgba(const texfile_image_t *image, gboolean linear)
+{
+	guint8 *rgba = g_new(guint8, 4 * image->width * image->height);
+
+	for (guint i = 0; i < image->width * image->height; ++i) {
+		const gfloat *t = image->texels + 4 * i;
+		const gfloat a = t[3] > 0.0f ? t[3] : 1.0f;
+
+		rgba[4 * i + 0] = texfile_encode(t[0] / a, linear);
+		rgba[4 * i + 1] = texfile_encode(t[1] / a, linear);
+		rgba[4 * i + 2] = texfile_encode(t[2] / a, linear);
+		rgba[4 * i + 3] = texfile_encode(t[3], TRUE);
+	}
+
+	return rgba;
+}
+
+/* the finest level is the image as it is, nothing to round twice */
+static guint8 *texfile_pixbuf_rgba(GdkPixbuf *pixbuf)
+{
+	const guint width = gdk_pixbuf_get_width(pixbuf);
+	const guint height = gdk_pixbuf_get_height(pixbuf);
+	const guint channels = gdk_pixbuf_get_n_channels(pixbuf);
+	const gsize stride = gdk_pixbuf_get_rowstride(pixbuf);
+	const guint8 *pixels = gdk_pixbuf_read_pixels(pixbuf);
+	guint8 *rgba = g_new(guint8, 4 * width * height);
+
+	for (guint y = 0; y < height; ++y) {
+		for (guint x = 0; x < width; ++x) {
+			const guint8 *p = pixels + y * stride + x * channels;
+			guint8 *t = rgba + 4 * (y * width + x);
+
+			t[0] = p[0];
+			t[1] = p[1];
+			t[2] = p[2];
+			t[3] = channels == 4 ? p[3] : 0xff;
+		}
+	}
+
+	return rgba;
+}
+
+static void texfile_store(const guint8 *rgba, const texfile_header_t *header, const texfile_level_t *level, guint8 *data)
+{
+	if (header->format == 0) {
+		texture_compress(header->internal_format, rgba, level->width, level->height, data + level->offset);
+		return;
+	}
+
+	const guint channels = header->format == GL_RGBA ? 4 : 3;
+
+	for (guint y = 0; y < level->height; ++y) {
+		for (guint x = 0; x < level->width; ++x) {
+			memcpy(data + level->offset + y * level->row_pitch + x * channels, rgba + 4 * (y * level->width + x), channels);
+		}
+	}
+}
+
+/*
+ * Bakes pixbuf with its complete mipmap chain. Levels are reduced one from
+ * the next with premultiplied alpha, so transparent texels do not bleed
+ * their colour, and in linear light unless flags has TEXFILE_FLAG_LINEAR,
+ * which is for data such as specular maps. internal_format is either 0,
+ * for GL_RGB8 or GL_RGBA8 as the pixbuf has alpha, or a format
+ * texture_compress() encodes.
+ */
+gboolean texfile_write(const gchar *filename, GdkPixbuf *pixbuf, GLenum internal_format, guint32 flags, GError **error)
+{
+	g_return_val_if_fail(internal_format == 0 || texture_compress_encodable(internal_format), FALSE);
+
+	const gboolean alpha = gdk_pixbuf_get_has_alpha(pixbuf);
+	texfile_header_t header = {
+		.magic = TEXFILE_MAGIC,
+		.version = TEXFILE_VERSION,
+		.header_size = sizeof (texfile_header_t),
+		.internal_format = internal_format != 0 ? internal_format : alpha ? GL_RGBA8 : GL_RGB8,
+		.format = internal_format != 0 ? 0 : alpha ? GL_RGBA : GL_RGB,
+		.width = gdk_pixbuf_get_width(pixbuf),
+		.height = gdk_pixbuf_get_height(pixbuf),
+		.flags = flags
+	};
+	guint64 offset = TEXFILE_ALIGN(sizeof header);
+
+	while (header.level_count < TEXFILE_LEVEL_MAX) {
+		texfile_level_t *level = &header.levels[header.level_count++];
+
+		level->width = MAX(1, header.width >> (header.level_count - 1));
+		level->height = MAX(1, header.height >> (header.level_count - 1));
+		level->row_pitch = texfile_pitch(&header, level->width);
+		level->size = texfile_size(&header, level->row_pitch, level->height);
+		level->offset = offset;
+		offset = TEXFILE_ALIGN(offset + level->size);
+		if (level->width == 1 && level->height == 1) {
+			break;
+		}
+	}
+
+	guint8 *data = g_malloc0(offset);
+	texfile_image_t image = texfile_image(pixbuf, flags & TEXFILE_FLAG_LINEAR);
+
+	guint8 *rgba = texfile_pixbuf_rgba(pixbuf);
+
+	memcpy(data, &header, sizeof header);
+	texfile_store(rgba, &header, &header.levels[0], data);
+	g_free(rgba);
+	for (guint32 i = 1; i < header.level_count; ++i) {
+		texfile_image_t next = texfile_reduce(&image);
+
+		g_free(image.texels);
+		image = next;
+		rgba = texfile_rgba(&image, flags & TEXFILE_FLAG_LINEAR);
+		texfile_store(rgba, &header, &header.levels[i], data);
+		g_free(rgba);
+	}
+	g_free(image.texels);
+
+	const gboolean result = g_file_set_contents(filename, (const gchar *) data, offset, error);
+
+	g_free(data);
+
+	return result;
+}
@@ -0,0 +1,173 @@
+#include <gdk-pixbuf/gdk-pixbuf.h>
+#include <texfile.h>
+#include <texture_array.h>
+#include <texture_storage.h>
+
+static void texture_array_parameters(const texture_sampler_t *sampler)
+{
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, sampler->wrap_s);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, sampler->wrap_t);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, sampler->min_filter);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, sampler->mag_filter);
+}
+
+/* NULL unless every image has a baked file and all of them agree on size and format */
+static texfile_t **texture_array_baked(const gchar *const *filenames, guint count)
+{
+	texfile_t **files = g_new0(texfile_t *, count);
+
+	for (guint i = 0; i < count; ++i) {
+		files[i] = texfile_open_baked(filenames[i]);
+		if (files[i] == NULL) {
+			break;
+		}
+
+		const texfile_header_t *first = texfile_get_header(files[0]);
+		const texfile_header_t *header = texfile_get_header(files[i]);
+
+		if (header->width != first->width || header->height != first->height ||
+		    header->internal_format != first->internal_format || header->level_count != first->level_count) {
+			break;
+		}
+		if (i == count - 1) {
+			return files;
+		}
+	}
+	for (guint i = 0; i < count; ++i) {
+		texfile_close(files[i]);
+	}
+	g_free(files);
+
+	return NULL;
+}
+
+/* every level of every layer as baked, into the array bound to GL_TEXTURE_2D_ARRAY */
+static void texture_array_copy(texture_array_t *array, texfile_t **files)
+{
+	const texfile_header_t *first = texfile_get_header(files[0]);
+
+	array->width = first->width;
+	array->height = first->height;
+	array->internal_format = first->internal_format;
+	glTexStorage3D(GL_TEXTURE_2D_ARRAY, first->level_count, first->internal_format, first->width, first->height, array->layers);
+
+	for (GLsizei layer = 0; layer < array->layers; ++layer) {
+		for (guint32 i = 0; i < first->level_count; ++i) {
+			const texfile_level_t *level = &first->levels[i];
+			gconstpointer data = texfile_get_level(files[layer], i);
+
+			if (first->format == 0) {
+				glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, i, 0, 0, layer, level->width, level->height, 1, first->internal_format, level->size, data);
+			}
+			else {
+				glTexSubImage3D(GL_TEXTURE_2D_ARRAY, i, 0, 0, layer, level->width, level->height, 1, first->format, GL_UNSIGNED_BYTE, data);
+			}
+		}
+	}
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, first->level_count - 1);
+}
+
+/* decoded, each image scaled to the largest when they differ, into the array bound to GL_TEXTURE_2D_ARRAY */
+static gboolean texture_array_decode(texture_array_t *array, const gchar *const *filenames, GError **error)
+{
+	GdkPixbuf **pixbufs = g_new0(GdkPixbuf *, array->layers);
+	gboolean alpha = FALSE;
+	gboolean result = TRUE;
+
+	for (GLsizei layer = 0; layer < array->layers; ++layer) {
+		pixbufs[layer] = gdk_pixbuf_new_from_file(filenames[layer], error);
+		if (pixbufs[layer] == NULL) {
+			result = FALSE;
+			break;
+		}
+		array->width = MAX(array->width, gdk_pixbuf_get_width(pixbufs[layer]));
+		array->height = MAX(array->height, gdk_pixbuf_get_height(pixbufs[layer]));
+		alpha |= gdk_pixbuf_get_has_alpha(pixbufs[layer]);
+	}
+
+	/* RGBA8 when any layer has alpha, the driver only converts those that do not */
+	if (result) {
+		const GLsizei levels = texture_storage_levels(array->width, array->height);
+		GLenum format;
+
+		array->internal_format = texture_storage_format(alpha, &format);
+		if (epoxy_gl_version() >= 42 || epoxy_has_gl_extension("GL_ARB_texture_storage")) {
+			glTexStorage3D(GL_TEXTURE_2D_ARRAY, levels, array->internal_format, array->width, array->height, array->layers);
+		}
+		else {
+			glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, array->internal_format, array->width, array->height, array->layers, 0, format, GL_UNSIGNED_BYTE, NULL);
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, levels - 1);
+		}
+	}
+	for (GLsizei layer = 0; result && layer < array->layers; ++layer) {
+		GdkPixbuf *pixbuf = pixbufs[layer];
+
+		if (gdk_pixbuf_get_width(pixbuf) != array->width || gdk_pixbuf_get_height(pixbuf) != array->height) {
+			pixbuf = gdk_pixbuf_scale_simple(pixbufs[layer], array->width, array->height, GDK_INTERP_BILINEAR);
+			g_object_unref(G_OBJECT(pixbufs[layer]));
+			pixbufs[layer] = pixbuf;
+		}
+
+		GLenum format;
+
+		texture_storage_format(gdk_pixbuf_get_has_alpha(pixbuf), &format);
+		texture_storage_unpack(array->width, format, gdk_pixbuf_get_rowstride(pixbuf));
+		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, array->width, array->height, 1, format, GL_UNSIGNED_BYTE, gdk_pixbuf_read_pixels(pixbuf));
+		texture_storage_unpack_reset();
+	}
+	if (result) {
+		glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+	}
+
+	for (GLsizei layer = 0; layer < array->layers; ++layer) {
+		if (pixbufs[layer] != NULL) {
+			g_object_unref(G_OBJECT(pixbufs[layer]));
+		}
+	}
+	g_free(pixbufs);
+
+	return result;
+}
+
+/* returns NULL and sets error when one of the images cannot be decoded */
+texture_array_t *texture_array_new(const gchar *const *filenames, guint count, const texture_sampler_t *sampler, GError **error)
+{
+	g_return_val_if_fail(count > 0, NULL);
+
+	texture_array_t *array = g_new0(texture_array_t, 1);
+	const gboolean storage = epoxy_gl_version() >= 42 || epoxy_has_gl_extension("GL_ARB_texture_storage");
+	texfile_t **files = storage ? texture_array_baked(filenames, count) : NULL;
+	gboolean result = TRUE;
+
+	array->layers = count;
+	glGenTextures(1, &array->texture);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, array->texture);
+	texture_array_parameters(sampler);
+	if (files != NULL) {
+		texture_array_copy(array, files);
+		for (guint i = 0; i < count; ++i) {
+			texfile_close(files[i]);
+		}
+		g_free(files);
+	}
+	else {
+		result = texture_array_decode(array, filenames, error);
+	}
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+	if (!result) {
+		texture_array_free(array);
+		return NULL;
+	}
+
+	return array;
+}
+
+void texture_array_free(texture_array_t *array)
+{
+	if (array == NULL) {
+		return;
+	}
+	glDeleteTextures(1, &array->texture);
+	g_free(array);
+}
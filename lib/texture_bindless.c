@@ -0,0 +1,54 @@
+#include <texture_bindless.h>
+
+gboolean texture_bindless_supported(void)
+{
+	return epoxy_has_gl_extension("GL_ARB_bindless_texture");
+}
+
+/* returns NULL and sets error when one of the images cannot be loaded */
+texture_bindless_t *texture_bindless_new(const gchar *const *filenames, guint count, const texture_sampler_t *sampler, GError **error)
+{
+	g_return_val_if_fail(count > 0, NULL);
+	g_return_val_if_fail(texture_bindless_supported(), NULL);
+
+	texture_bindless_t *bindless = g_new0(texture_bindless_t, 1);
+
+	bindless->textures = g_new0(GLuint, count);
+	bindless->handles = g_new0(GLuint64, count);
+
+	for (guint i = 0; i < count; ++i) {
+		bindless->textures[i] = texture_cache_acquire(filenames[i], sampler, error);
+		if (bindless->textures[i] == 0) {
+			texture_bindless_free(bindless);
+			return NULL;
+		}
+		bindless->count++;
+
+		/* the handle carries the texture's own sampler state */
+		bindless->handles[i] = glGetTextureHandleARB(bindless->textures[i]);
+		glMakeTextureHandleResidentARB(bindless->handles[i]);
+	}
+
+	glGenBuffers(1, &bindless->buffer);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, bindless->buffer);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, count * sizeof (GLuint64), bindless->handles, GL_STATIC_DRAW);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+	return bindless;
+}
+
+void texture_bindless_free(texture_bindless_t *bindless)
+{
+	if (bindless == NULL) {
+		return;
+	}
+	/* out of residency before the cache may delete the texture under it */
+	for (guint i = 0; i < bindless->count; ++i) {
+		glMakeTextureHandleNonResidentARB(bindless->handles[i]);
+		texture_cache_release(bindless->textures[i]);
+	}
+	glDeleteBuffers(1, &bindless->buffer);
+	g_free(bindless->handles);
+	g_free(bindless->textures);
+	g_free(bindless);
+}
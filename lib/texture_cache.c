@@ -0,0 +1,490 @@
+#include <string.h>
+#include <gio/gio.h>
+#include <gtk/gtk.h>
+#include <gdk-pixbuf/gdk-pixbuf.h>
+#include <image_decode.h>
+#include <pbo_pool.h>
+#include <texfile.h>
+#include <texture_storage.h>
+#include <texture_cache.h>
+
+typedef struct {
+	gchar *key;
+	GLuint texture;
+	guint references;
+	gboolean busy;		/* a worker still has it, the entry outlives a release until it is back */
+	gboolean released;
+	GdkPixbuf *pixbuf;	/* decoded, waiting in decoded or being copied */
+	texfile_t *file;	/* mapped from a texconv file, prefetched then waiting in decoded */
+	pbo_t *pbo;		/* staging the pixels, waiting in copied */
+	GLsizei width;
+	GLsizei height;
+	GLenum format;
+	gint rowstride;		/* of the pixbuf, kept by the copy into the staging buffer */
+	gint max_size;		/* at the acquire, for the levels of a baked file */
+	GArray *ready;		/* texture_ready_t of the async acquires while a worker has it */
+} texture_entry_t;
+
+typedef struct {
+	texture_ready_func func;
+	gpointer user_data;
+} texture_ready_t;
+
+static GHashTable *by_key;	/* "wrap_s wrap_t min_filter mag_filter max_size use_baked filename" to texture_entry_t */
+static GHashTable *by_texture;	/* GL name to the same entries */
+static GQueue decoded = G_QUEUE_INIT;	/* waiting for a staging buffer */
+static GQueue copied = G_QUEUE_INIT;	/* waiting for their transfer */
+static guint workers;		/* decodes and copies in flight */
+static guint decodes;
+
+static pbo_pool_t *pool;
+static gboolean use_pbo = TRUE;
+static gboolean use_baked = TRUE;
+static gint max_size;
+
+static void texture_parameters(const texture_sampler_t *sampler)
+{
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, sampler->wrap_s);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, sampler->wrap_t);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, sampler->min_filter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, sampler->mag_filter);
+}
+
+/* every level as baked, nothing to decode or generate */
+static GLuint texture_map(texfile_t *file, const texture_sampler_t *sampler)
+{
+	GLuint texture;
+
+	decodes++;
+
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	texture_parameters(sampler);
+	texfile_upload(file, max_size);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	texfile_close(file);
+
+	return texture;
+}
+
+static GLuint texture_load(const gchar *filename, const texture_sampler_t *sampler, GError **error)
+{
+	texfile_t *file = use_baked ? texfile_open_baked(filename) : NULL;
+
+	if (file != NULL) {
+		return texture_map(file, sampler);
+	}
+
+	GdkPixbuf *pixbuf = image_decode(filename, max_size, error);
+	GLuint texture;
+
+	if (pixbuf == NULL) {
+		return 0;
+	}
+	decodes++;
+
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	texture_parameters(sampler);
+	texture_storage_pixbuf(pixbuf);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	g_object_unref(G_OBJECT(pixbuf));
+
+	return texture;
+}
+
+/* a single mid grey texel, complete for any filter, until the image is in, mutable for the storage that replaces it */
+static GLuint texture_placeholder(const texture_sampler_t *sampler)
+{
+	static const guint8 grey[4] = { 0x80, 0x80, 0x80, 0xff };
+	GLuint texture;
+
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	texture_parameters(sampler);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, grey);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	return texture;
+}
+
+static texture_entry_t *texture_lookup(const gchar *key)
+{
+	if (by_key == NULL) {
+		by_key = g_hash_table_new(g_str_hash, g_str_equal);
+		by_texture = g_hash_table_new(g_direct_hash, g_direct_equal);
+	}
+
+	return g_hash_table_lookup(by_key, key);
+}
+
+static gchar *texture_key(const gchar *filename, const texture_sampler_t *sampler)
+{
+	return g_strdup_printf("%x %x %x %x %d %d %s", sampler->wrap_s, sampler->wrap_t, sampler->min_filter, sampler->mag_filter, max_size, use_baked, filename);
+}
+
+static texture_entry_t *texture_insert(gchar *key, GLuint texture)
+{
+	texture_entry_t *entry = g_new0(texture_entry_t, 1);
+
+	entry->key = key;
+	entry->texture = texture;
+	entry->references = 1;
+	g_hash_table_insert(by_key, entry->key, entry);
+	g_hash_table_insert(by_texture, GUINT_TO_POINTER(texture), entry);
+
+	return entry;
+}
+
+static void texture_entry_free(texture_entry_t *entry)
+{
+	if (entry->pixbuf != NULL) {
+		g_object_unref(G_OBJECT(entry->pixbuf));
+	}
+	texfile_close(entry->file);
+	if (entry->ready != NULL) {
+		g_array_free(entry->ready, TRUE);
+	}
+	g_free(entry->key);
+	g_free(entry);
+}
+
+static void texture_ready_add(texture_entry_t *entry, texture_ready_func func, gpointer user_data)
+{
+	const texture_ready_t ready = { func, user_data };
+
+	if (func == NULL || !entry->busy) {
+		return;
+	}
+	if (entry->ready == NULL) {
+		entry->ready = g_array_new(FALSE, FALSE, sizeof (texture_ready_t));
+	}
+	g_array_append_val(entry->ready, ready);
+}
+
+static void texture_ready_call(const texture_entry_t *entry)
+{
+	for (guint i = 0; entry->ready != NULL && i < entry->ready->len; ++i) {
+		const texture_ready_t *ready = &g_array_index(entry->ready, texture_ready_t, i);
+
+		ready->func(ready->user_data);
+	}
+}
+
+/* returns 0 and sets error when filename cannot be decoded */
+GLuint texture_cache_acquire(const gchar *filename, const texture_sampler_t *sampler, GError **error)
+{
+	gchar *key = texture_key(filename, sampler);
+	texture_entry_t *entry = texture_lookup(key);
+
+	if (entry != NULL) {
+		entry->references++;
+		g_free(key);
+		return entry->texture;
+	}
+
+	const GLuint texture = texture_load(filename, sampler, error);
+
+	if (texture == 0) {
+		g_free(key);
+		return 0;
+	}
+	texture_insert(key, texture);
+
+	return texture;
+}
+
+/* the pool belongs to the context of the textures, it goes with the last of them; only where that context is current */
+static void texture_pool_check(void)
+{
+	if (pool != NULL && workers == 0 && (by_key == NULL || g_hash_table_size(by_key) == 0)) {
+		pbo_pool_free(pool);
+		pool = NULL;
+	}
+}
+
+/* back on the thread that acquired, queues the pixels for texture_cache_upload() */
+static void texture_decoded(GObject *source_object, GAsyncResult *result, gpointer user_data)
+{
+	texture_entry_t *entry = user_data;
+	GError *error = NULL;
+	gpointer image = g_task_propagate_pointer(G_TASK(result), &error);
+
+	workers--;
+	entry->busy = FALSE;
+	if (image == NULL) {
+		if (!entry->released) {
+			g_warning("%s keeps its placeholder: %s", entry->key, error->message);
+		}
+		g_error_free(error);
+	}
+	else if (entry->file == NULL) {
+		entry->pixbuf = image;
+		entry->width = gdk_pixbuf_get_width(entry->pixbuf);
+		entry->height = gdk_pixbuf_get_height(entry->pixbuf);
+		entry->format = gdk_pixbuf_get_has_alpha(entry->pixbuf) ? GL_RGBA : GL_RGB;
+		entry->rowstride = gdk_pixbuf_get_rowstride(entry->pixbuf);
+	}
+	if (entry->released) {
+		/* no context here, the next upload or release frees the pool */
+		texture_entry_free(entry);
+		return;
+	}
+	if (image == NULL) {
+		return;
+	}
+	decodes++;
+	g_queue_push_tail(&decoded, entry);
+	texture_ready_call(entry);
+}
+
+/*
+ * Returns at once with a 1x1 placeholder texture and decodes filename on
+ * a worker thread. Once the pixels are back on this thread they wait for
+ * texture_cache_upload() and ready, when not NULL, is called with
+ * user_data so the caller can schedule a frame for it. Every caller that
+ * acquires the texture while a worker has it is told. A release in that
+ * time drops them all, the cache cannot tell whose reference went, so a
+ * user_data is never used after its owner let go. Decode errors leave the
+ * placeholder and are logged.
+ */
+GLuint texture_cache_acquire_async(const gchar *filename, const texture_sampler_t *sampler, texture_ready_func ready, gpointer user_data)
+{
+	gchar *key = texture_key(filename, sampler);
+	texture_entry_t *entry = texture_lookup(key);
+
+	if (entry != NULL) {
+		entry->references++;
+		texture_ready_add(entry, ready, user_data);
+		g_free(key);
+		return entry->texture;
+	}
+
+	entry = texture_insert(key, texture_placeholder(sampler));
+	entry->busy = TRUE;
+	entry->file = use_baked ? texfile_open_baked(filename) : NULL;
+	entry->max_size = max_size;
+	texture_ready_add(entry, ready, user_data);
+
+	GTask *task = g_task_new(NULL, NULL, texture_decoded, entry);
+
+	if (entry->file != NULL) {
+		texfile_prefetch_in_thread(task, entry->file);
+	}
+	else {
+		image_decode_in_thread(task, filename, max_size);
+	}
+	g_object_unref(task);
+	workers++;
+
+	return entry->texture;
+}
+
+/* on a worker, the pixbuf into the mapped staging buffer in one go, rowstride and all */
+static void texture_copy(GTask *task, gpointer source_object, gpointer task_data, GCancellable *cancellable)
+{
+	const texture_entry_t *entry = task_data;
+
+	memcpy(entry->pbo->data, gdk_pixbuf_read_pixels(entry->pixbuf), gdk_pixbuf_get_byte_length(entry->pixbuf));
+	g_task_return_boolean(task, TRUE);
+}
+
+static void texture_copied(GObject *source_object, GAsyncResult *result, gpointer user_data)
+{
+	texture_entry_t *entry = user_data;
+
+	g_task_propagate_boolean(G_TASK(result), NULL);
+	workers--;
+	entry->busy = FALSE;
+	g_object_unref(G_OBJECT(entry->pixbuf));
+	entry->pixbuf = NULL;
+
+	if (entry->released) {
+		/* never read by GL, no fence needed and none can be made without the context */
+		entry->pbo->used = FALSE;
+		texture_entry_free(entry);
+		return;
+	}
+	g_queue_push_tail(&copied, entry);
+	/* texture_cache_upload() did not count it while the worker had it */
+	texture_ready_call(entry);
+}
+
+static void texture_copy_start(texture_entry_t *entry, pbo_t *pbo)
+{
+	GTask *task = g_task_new(NULL, NULL, texture_copied, entry);
+
+	entry->pbo = pbo;
+	entry->busy = TRUE;
+	g_task_set_task_data(task, entry, NULL);
+	g_task_run_in_thread(task, texture_copy);
+	g_object_unref(task);
+	workers++;
+}
+
+/* allocates the full size level and fills it from the staging buffer, the copy happens on the GPU's time */
+static void texture_transfer(texture_entry_t *entry)
+{
+	glBindTexture(GL_TEXTURE_2D, entry->texture);
+	texture_storage_2d(texture_storage_format(entry->format == GL_RGBA, NULL), texture_storage_levels(entry->width, entry->height), entry->width, entry->height);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, entry->pbo->buffer);
+	texture_storage_unpack(entry->width, entry->format, entry->rowstride);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, entry->width, entry->height, entry->format, GL_UNSIGNED_BYTE, NULL);
+	texture_storage_unpack_reset();
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	glGenerateMipmap(GL_TEXTURE_2D);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	pbo_pool_release(pool, entry->pbo);
+	entry->pbo = NULL;
+}
+
+/* the old path, from client memory inside the driver, and the one for baked files */
+static void texture_direct(texture_entry_t *entry)
+{
+	glBindTexture(GL_TEXTURE_2D, entry->texture);
+	if (entry->file != NULL) {
+		texfile_upload(entry->file, entry->max_size);
+		texfile_close(entry->file);
+		entry->file = NULL;
+	}
+	else {
+		texture_storage_pixbuf(entry->pixbuf);
+		g_object_unref(G_OBJECT(entry->pixbuf));
+		entry->pixbuf = NULL;
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+/*
+ * Moves decoded images on towards their textures for up to budget
+ * milliseconds. Images whose pixels a worker has copied into a staging
+ * buffer are transferred from it, then decoded images are handed to
+ * workers for as many buffers as are free. Images too large for a buffer,
+ * or all of them without GL 4.4, go straight from client memory instead.
+ * At least one transfer is made per call however large, so every image
+ * arrives eventually. Returns how many images wait for a later call, call
+ * again next frame while that is not 0. Images a worker still has are not
+ * counted, their ready callback says when they are back.
+ */
+guint texture_cache_upload(gdouble budget)
+{
+	const gint64 start = g_get_monotonic_time();
+	guint uploaded = 0;
+
+	if (pool == NULL && use_pbo && !g_queue_is_empty(&decoded) && (epoxy_gl_version() >= 44 || epoxy_has_gl_extension("GL_ARB_buffer_storage"))) {
+		pool = pbo_pool_new(TEXTURE_PBO_COUNT, TEXTURE_PBO_SIZE);
+	}
+
+	while (!g_queue_is_empty(&copied)) {
+		if (uploaded > 0 && g_get_monotonic_time() - start >= budget * 1e3) {
+			break;
+		}
+		texture_transfer(g_queue_pop_head(&copied));
+		uploaded++;
+	}
+
+	while (!g_queue_is_empty(&decoded)) {
+		texture_entry_t *entry = g_queue_peek_head(&decoded);
+
+		if (pool != NULL && entry->pixbuf != NULL && gdk_pixbuf_get_byte_length(entry->pixbuf) <= (gsize) pool->size) {
+			pbo_t *pbo = pbo_pool_acquire(pool);
+
+			if (pbo == NULL) {
+				break;
+			}
+			texture_copy_start(g_queue_pop_head(&decoded), pbo);
+			continue;
+		}
+		if (uploaded > 0 && g_get_monotonic_time() - start >= budget * 1e3) {
+			break;
+		}
+		texture_direct(g_queue_pop_head(&decoded));
+		uploaded++;
+	}
+	texture_pool_check();
+
+	return g_queue_get_length(&decoded) + g_queue_get_length(&copied);
+}
+
+/* images on their way in any form, those on workers too */
+guint texture_cache_pending(void)
+{
+	return g_queue_get_length(&decoded) + g_queue_get_length(&copied) + workers;
+}
+
+/* with the context of the acquire current, texture 0 is ignored */
+void texture_cache_release(GLuint texture)
+{
+	texture_entry_t *entry = by_texture != NULL ? g_hash_table_lookup(by_texture, GUINT_TO_POINTER(texture)) : NULL;
+
+	if (entry == NULL) {
+		return;
+	}
+	if (entry->ready != NULL) {
+		g_array_set_size(entry->ready, 0);
+	}
+	if (--entry->references > 0) {
+		return;
+	}
+	g_hash_table_remove(by_texture, GUINT_TO_POINTER(texture));
+	g_hash_table_remove(by_key, entry->key);
+	glDeleteTextures(1, &entry->texture);
+	if (entry->busy) {
+		entry->released = TRUE;
+		return;
+	}
+	g_queue_remove(&decoded, entry);
+	g_queue_remove(&copied, entry);
+	if (entry->pbo != NULL) {
+		pbo_pool_release(pool, entry->pbo);
+	}
+	texture_entry_free(entry);
+	texture_pool_check();
+}
+
+/* TRUE stages uploads through the pixel buffer pool when the context allows, FALSE always goes direct */
+void texture_cache_use_pbo(gboolean enable)
+{
+	use_pbo = enable;
+}
+
+/*
+ * TRUE maps the files texconv baked where there are any, FALSE decodes
+ * every image, for measuring that path. Part of the cache key as well.
+ */
+void texture_cache_use_baked(gboolean enable)
+{
+	use_baked = enable;
+}
+
+/*
+ * The largest side of textures acquired from now on, 0 for their full
+ * size. Images are decoded reduced by image_decode() and baked files skip
+ * their larger levels. Already cached textures keep the size they have,
+ * the limit is part of the cache key.
+ */
+void texture_cache_max_size(gint size)
+{
+	max_size = MAX(size, 0);
+}
+
+/* images decoded or mapped from baked files so far, each shared texture counts once however many hold it */
+guint texture_cache_decodes(void)
+{
+	return decodes;
+}
+
+/* a texture_ready_func for chapters, draws the frame that uploads the image */
+void texture_cache_ready_queue_render(gpointer user_data)
+{
+	gtk_gl_area_queue_render(GTK_GL_AREA(user_data));
+}
+
+/* at the start of render, uploads for the frame's budget and asks for another while images wait */
+void texture_cache_upload_queue_render(gpointer area)
+{
+	if (texture_cache_upload(TEXTURE_UPLOAD_BUDGET) > 0) {
+		gtk_gl_area_queue_render(GTK_GL_AREA(area));
+	}
+}
@@ -0,0 +1,365 @@
+#include <math.h>
+#include <string.h>
+#include <texture_compress.h>
+
+/* block rows per encode task */
+#define TEXTURE_COMPRESS_TASK_ROWS 4
+
+typedef struct {
+	GLenum internal_format;
+	const guint8 *rgba;
+	guint width;
+	guint height;
+	guint8 *blocks;
+	gsize block_bytes;
+} texture_compress_job_t;
+
+typedef struct {
+	const texture_compress_job_t *job;
+	guint first;
+	guint last;
+} texture_compress_task_t;
+
+gsize texture_compress_block_bytes(GLenum internal_format)
+{
+	switch (internal_format) {
+	case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+	case GL_COMPRESSED_RGB8_ETC2:
+		return 8;
+	case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+	case GL_COMPRESSED_RG_RGTC2:
+	case GL_COMPRESSED_RGBA_BPTC_UNORM:
+	case GL_COMPRESSED_RGBA8_ETC2_EAC:
+		return 16;
+	}
+	return 0;
+}
+
+gsize texture_compress_level_bytes(GLenum internal_format, guint width, guint height)
+{
+	return texture_compress_block_bytes(internal_format) * ((width + 3) / 4) * ((height + 3) / 4);
+}
+
+gboolean texture_compress_encodable(GLenum internal_format)
+{
+	return internal_format == GL_COMPRESSED_RGB_S3TC_DXT1_EXT ||
+		internal_format == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT ||
+		internal_format == GL_COMPRESSED_RG_RGTC2;
+}
+
+/* with a context current, ETC2 is core since 4.3 but desktop drivers often decompress it on upload */
+gboolean texture_compress_supported(GLenum internal_format)
+{
+	switch (internal_format) {
+	case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+	case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+		return epoxy_has_gl_extension("GL_EXT_texture_compression_s3tc");
+	case GL_COMPRESSED_RG_RGTC2:
+		return epoxy_gl_version() >= 30 || epoxy_has_gl_extension("GL_ARB_texture_compression_rgtc");
+	case GL_COMPRESSED_RGBA_BPTC_UNORM:
+		return epoxy_gl_version() >= 42 || epoxy_has_gl_extension("GL_ARB_texture_compression_bptc");
+	case GL_COMPRESSED_RGB8_ETC2:
+	case GL_COMPRESSED_RGBA8_ETC2_EAC:
+		return epoxy_gl_version() >= 43 || epoxy_has_gl_extension("GL_ARB_ES3_compatibility");
+	}
+	return FALSE;
+}
+
+static guint16 texture_compress_pack565(const gfloat c[3])
+{
+	const guint r = (guint) (CLAMP(c[0], 0.0f, 255.0f) * 31.0f / 255.0f + 0.5f);
+	const guint g = (guint) (CLAMP(c[1], 0.0f, 255.0f) * 63.0f / 255.0f + 0.5f);
+	const guint b = (guint) (CLAMP(c[2], 0.0f, 255.0f) * 31.0f / 255.0f + 0.5f);
+
+	return r << 11 | g << 5 | b;
+}
+
+static void texture_compress_unpack565(guint16 v, gfloat c[3])
+{
+	const guint r = v >> 11 & 31;
+	const guint g = v >> 5 & 63;
+	const guint b = v & 31;
+
+	c[0] = r << 3 | r >> 2;
+	c[1] = g << 2 | g >> 4;
+	c[2] = b << 3 | b >> 2;
+}
+
+/* nearest of the four colours for every texel, returns the squared error */
+static gfloat texture_compress_indices(const gfloat texels[16][3], guint16 c0, guint16 c1, guint8 indices[16])
+{
+	gfloat palette[4][3];
+	gfloat error = 0.0f;
+
+	texture_compress_unpack565(c0, palette[0]);
+	texture_compress_unpack565(c1, palette[1]);
+	for (guint c = 0; c < 3; ++c) {
+		palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f;
+		palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+	}
+	for (guint i = 0; i < 16; ++i) {
+		gfloat best = G_MAXFLOAT;
+
+		for (guint p = 0; p < 4; ++p) {
+			const gfloat dr = texels[i][0] - palette[p][0];
+			const gfloat dg = texels[i][1] - palette[p][1];
+			const gfloat db = texels[i][2] - palette[p][2];
+			const gfloat d = dr * dr + dg * dg + db * db;
+
+			if (d < best) {
+				best = d;
+				indices[i] = p;
+			}
+		}
+		error += best;
+	}
+
+	return error;
+}
+
+/* endpoints that best reproduce the texels with the given indices, by least squares */
+static gboolean texture_compress_refit(const gfloat texels[16][3], const guint8 indices[16], gfloat e0[3], gfloat e1[3])
+{
+	static const gfloat weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+	gfloat aa = 0.0f, ab = 0.0f, bb = 0.0f;
+	gfloat ax[3] = { 0.0f }, bx[3] = { 0.0f };
+
+	for (guint i = 0; i < 16; ++i) {
+		const gfloat a = weights[indices[i]];
+		const gfloat b = 1.0f - a;
+
+		aa += a * a;
+		ab += a * b;
+		bb += b * b;
+		for (guint c = 0; c < 3; ++c) {
+			ax[c] += a * texels[i][c];
+			bx[c] += b * texels[i][c];
+		}
+	}
+
+	const gfloat determinant = aa * bb - ab * ab;
+
+	if (fabsf(determinant) < 1e-6f) {
+		return FALSE;
+	}
+	for (guint c = 0; c < 3; ++c) {
+		e0[c] = (bb * ax[c] - ab * bx[c]) / determinant;
+		e1[c] = (aa * bx[c] - ab * ax[c]) / determinant;
+	}
+
+	return TRUE;
+}
+
+/*
+ * Endpoints from the extremes along the principal axis of the block's
+ * colours, inset by a sixteenth, then refitted once by least squares to the
+ * indices they produce. Always four colour mode, so also valid in BC3.
+ */
+static void texture_compress_bc1(const guint8 block[16][4], guint8 *output)
+{
+	gfloat texels[16][3];
+	gfloat mean[3] = { 0.0f };
+	gfloat covariance[6] = { 0.0f };
+
+	for (guint i = 0; i < 16; ++i) {
+		for (guint c = 0; c < 3; ++c) {
+			texels[i][c] = block[i][c];
+			mean[c] += block[i][c] / 16.0f;
+		}
+	}
+	for (guint i = 0; i < 16; ++i) {
+		const gfloat r = texels[i][0] - mean[0];
+		const gfloat g = texels[i][1] - mean[1];
+		const gfloat b = texels[i][2] - mean[2];
+
+		covariance[0] += r * r;
+		covariance[1] += r * g;
+		covariance[2] += r * b;
+		covariance[3] += g * g;
+		covariance[4] += g * b;
+		covariance[5] += b * b;
+	}
+
+	gfloat axis[3] = { 1.0f, 1.0f, 1.0f };
+
+	for (guint iteration = 0; iteration < 8; ++iteration) {
+		const gfloat x = covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2];
+		const gfloat y = covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2];
+		const gfloat z = covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2];
+		const gfloat length = sqrtf(x * x + y * y + z * z);
+
+		if (length < 1e-6f) {
+			break;
+		}
+		axis[0] = x / length;
+		axis[1] = y / length;
+		axis[2] = z / length;
+	}
+
+	gfloat low = G_MAXFLOAT, high = -G_MAXFLOAT;
+
+	for (guint i = 0; i < 16; ++i) {
+		const gfloat t = (texels[i][0] - mean[0]) * axis[0] + (texels[i][1] - mean[1]) * axis[1] + (texels[i][2] - mean[2]) * axis[2];
+
+		low = MIN(low, t);
+		high = MAX(high, t);
+	}
+
+	const gfloat inset = (high - low) / 16.0f;
+	gfloat e0[3], e1[3];
+
+	for (guint c = 0; c < 3; ++c) {
+		e0[c] = mean[c] + axis[c] * (high - inset);
+		e1[c] = mean[c] + axis[c] * (low + inset);
+	}
+
+	guint16 c0 = texture_compress_pack565(e0);
+	guint16 c1 = texture_compress_pack565(e1);
+	guint8 indices[16];
+	gfloat error = texture_compress_indices(texels, c0, c1, indices);
+
+	if (texture_compress_refit(texels, indices, e0, e1)) {
+		const guint16 r0 = texture_compress_pack565(e0);
+		const guint16 r1 = texture_compress_pack565(e1);
+		guint8 refitted[16];
+		const gfloat refitted_error = texture_compress_indices(texels, r0, r1, refitted);
+
+		if (refitted_error < error) {
+			c0 = r0;
+			c1 = r1;
+			error = refitted_error;
+			memcpy(indices, refitted, sizeof indices);
+		}
+	}
+
+	/* four colour mode needs c0 > c1, equal endpoints only work with index 0 */
+	if (c0 < c1) {
+		const guint16 swap = c0;
+
+		c0 = c1;
+		c1 = swap;
+		for (guint i = 0; i < 16; ++i) {
+			indices[i] ^= 1;
+		}
+	}
+	else if (c0 == c1) {
+		memset(indices, 0, sizeof indices);
+	}
+
+	guint32 bits = 0;
+
+	for (guint i = 0; i < 16; ++i) {
+		bits |= (guint32) indices[i] << (2 * i);
+	}
+	output[0] = c0 & 0xff;
+	output[1] = c0 >> 8;
+	output[2] = c1 & 0xff;
+	output[3] = c1 >> 8;
+	output[4] = bits & 0xff;
+	output[5] = bits >> 8 & 0xff;
+	output[6] = bits >> 16 & 0xff;
+	output[7] = bits >> 24;
+}
+
+/* one channel of the block, the BC3 alpha and BC4/BC5 channel block, in eight value mode */
+static void texture_compress_bc4(const guint8 block[16][4], guint channel, guint8 *output)
+{
+	guint8 a0 = 0, a1 = 255;
+
+	for (guint i = 0; i < 16; ++i) {
+		a0 = MAX(a0, block[i][channel]);
+		a1 = MIN(a1, block[i][channel]);
+	}
+
+	guint palette[8] = { a0, a1 };
+	guint64 bits = 0;
+
+	for (guint p = 2; p < 8; ++p) {
+		palette[p] = ((8 - p) * a0 + (p - 1) * a1) / 7;
+	}
+	for (guint i = 0; i < 16 && a0 != a1; ++i) {
+		guint best = G_MAXUINT;
+		guint index = 0;
+
+		for (guint p = 0; p < 8; ++p) {
+			const guint d = ABS((gint) block[i][channel] - (gint) palette[p]);
+
+			if (d < best) {
+				best = d;
+				index = p;
+			}
+		}
+		bits |= (guint64) index << (3 * i);
+	}
+	output[0] = a0;
+	output[1] = a1;
+	for (guint b = 0; b < 6; ++b) {
+		output[2 + b] = bits >> (8 * b) & 0xff;
+	}
+}
+
+static void texture_compress_rows(gpointer data, gpointer user_data)
+{
+	const texture_compress_task_t *task = data;
+	const texture_compress_job_t *job = task->job;
+	const guint columns = (job->width + 3) / 4;
+
+	for (guint by = task->first; by < task->last; ++by) {
+		for (guint bx = 0; bx < columns; ++bx) {
+			guint8 *output = job->blocks + (by * columns + bx) * job->block_bytes;
+			guint8 block[16][4];
+
+			/* blocks over the edge of a small level repeat its last texels */
+			for (guint i = 0; i < 16; ++i) {
+				const guint x = MIN(bx * 4 + i % 4, job->width - 1);
+				const guint y = MIN(by * 4 + i / 4, job->height - 1);
+
+				memcpy(block[i], job->rgba + 4 * (y * job->width + x), 4);
+			}
+
+			switch (job->internal_format) {
+			case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+				texture_compress_bc1(block, output);
+				break;
+			case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+				texture_compress_bc4(block, 3, output);
+				texture_compress_bc1(block, output + 8);
+				break;
+			case GL_COMPRESSED_RG_RGTC2:
+				texture_compress_bc4(block, 0, output);
+				texture_compress_bc4(block, 1, output + 8);
+				break;
+			}
+		}
+	}
+}
+
+/*
+ * Encodes a width x height level of tightly packed RGBA texels into blocks,
+ * row after row of blocks as glCompressedTexSubImage2D() takes them. The
+ * block rows are spread over a thread pool of every processor.
+ */
+void texture_compress(GLenum internal_format, const guint8 *rgba, guint width, guint height, guint8 *blocks)
+{
+	g_return_if_fail(texture_compress_encodable(internal_format));
+
+	const texture_compress_job_t job = {
+		.internal_format = internal_format,
+		.rgba = rgba,
+		.width = width,
+		.height = height,
+		.blocks = blocks,
+		.block_bytes = texture_compress_block_bytes(internal_format)
+	};
+	const guint rows = (height + 3) / 4;
+	const guint task_count = (rows + TEXTURE_COMPRESS_TASK_ROWS - 1) / TEXTURE_COMPRESS_TASK_ROWS;
+	texture_compress_task_t *tasks = g_new(texture_compress_task_t, task_count);
+	GThreadPool *pool = g_thread_pool_new(texture_compress_rows, NULL, g_get_num_processors(), FALSE, NULL);
+
+	for (guint t = 0; t < task_count; ++t) {
+		tasks[t] = (texture_compress_task_t) { &job, t * TEXTURE_COMPRESS_TASK_ROWS, MIN(rows, (t + 1) * TEXTURE_COMPRESS_TASK_ROWS) };
+		g_thread_pool_push(pool, &tasks[t], NULL);
+	}
+	g_thread_pool_free(pool, FALSE, TRUE);
+	g_free(tasks);
+}
@@ -0,0 +1,88 @@
+#include <texture_storage.h>
+
+/* a complete chain down to 1 x 1 */
+GLsizei texture_storage_levels(GLsizei width, GLsizei height)
+{
+	GLsizei levels = 1;
+
+	while ((width | height) >> levels) {
+		levels++;
+	}
+	return levels;
+}
+
+/* of one uncompressed level, drivers keep GL_RGB8 in four bytes too */
+gsize texture_storage_bytes(GLsizei width, GLsizei height)
+{
+	return (gsize) MAX(width, 1) * MAX(height, 1) * 4;
+}
+
+/* the sized internal format for 8 bit pixels, and the pixel format they come in */
+GLenum texture_storage_format(gboolean alpha, GLenum *format)
+{
+	if (format != NULL) {
+		*format = alpha ? GL_RGBA : GL_RGB;
+	}
+	return alpha ? GL_RGBA8 : GL_RGB8;
+}
+
+/*
+ * Every level for the texture bound to GL_TEXTURE_2D. Without texture
+ * storage, level 0 is specified empty and glGenerateMipmap() makes the rest.
+ */
+void texture_storage_2d(GLenum internal_format, GLsizei levels, GLsizei width, GLsizei height)
+{
+	if (epoxy_gl_version() >= 42 || epoxy_has_gl_extension("GL_ARB_texture_storage")) {
+		glTexStorage2D(GL_TEXTURE_2D, levels, internal_format, width, height);
+		return;
+	}
+
+	GLenum format;
+
+	texture_storage_format(internal_format == GL_RGBA8, &format);
+	glTexImage2D(GL_TEXTURE_2D, 0, internal_format, width, height, 0, format, GL_UNSIGNED_BYTE, NULL);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+}
+
+/*
+ * Rows rowstride bytes apart. The largest alignment that pads a row to
+ * exactly rowstride covers what gdk-pixbuf allocates, any other stride of
+ * whole texels is given as the row length.
+ */
+void texture_storage_unpack(GLsizei width, GLenum format, gint rowstride)
+{
+	const gint channels = format == GL_RGBA ? 4 : 3;
+	const gint row = width * channels;
+
+	for (gint alignment = 8; alignment >= 1; alignment /= 2) {
+		if (((row + alignment - 1) & ~(alignment - 1)) == rowstride) {
+			glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+			glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+			return;
+		}
+	}
+	g_warn_if_fail(rowstride % channels == 0);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, rowstride / channels);
+}
+
+void texture_storage_unpack_reset(void)
+{
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+}
+
+/* allocates the texture bound to GL_TEXTURE_2D for pixbuf, uploads it and generates its mipmaps */
+void texture_storage_pixbuf(GdkPixbuf *pixbuf)
+{
+	const GLsizei width = gdk_pixbuf_get_width(pixbuf);
+	const GLsizei height = gdk_pixbuf_get_height(pixbuf);
+	GLenum format;
+	const GLenum internal_format = texture_storage_format(gdk_pixbuf_get_has_alpha(pixbuf), &format);
+
+	texture_storage_2d(internal_format, texture_storage_levels(width, height), width, height);
+	texture_storage_unpack(width, format, gdk_pixbuf_get_rowstride(pixbuf));
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, format, GL_UNSIGNED_BYTE, gdk_pixbuf_read_pixels(pixbuf));
+	texture_storage_unpack_reset();
+	glGenerateMipmap(GL_TEXTURE_2D);
+}
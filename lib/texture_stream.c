@@ -0,0 +1,379 @@
+#include <gio/gio.h>
+#include <gdk-pixbuf/gdk-pixbuf.h>
+#include <image_decode.h>
+#include <texture_storage.h>
+#include <texture_stream.h>
+
+/* of the levels in texture now, nothing for the placeholder */
+static gsize texture_stream_bytes(const texture_stream_item_t *item)
+{
+	return item->base < item->levels ? item->chain[item->base] : 0;
+}
+
+/* bound to GL_TEXTURE_2D, with the sampler of item */
+static GLuint texture_stream_create(const texture_stream_item_t *item)
+{
+	GLuint texture;
+
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, item->sampler.wrap_s);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, item->sampler.wrap_t);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, item->sampler.min_filter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, item->sampler.mag_filter);
+
+	return texture;
+}
+
+static void texture_stream_item_free(texture_stream_item_t *item)
+{
+	if (item->pixbuf != NULL) {
+		g_object_unref(G_OBJECT(item->pixbuf));
+	}
+	texfile_close(item->file);
+	g_free(item->filename);
+	g_free(item);
+}
+
+texture_stream_t *texture_stream_new(gsize budget)
+{
+	texture_stream_t *stream = g_new0(texture_stream_t, 1);
+
+	stream->budget = budget;
+	stream->items = g_ptr_array_new();
+	g_queue_init(&stream->loaded);
+
+	return stream;
+}
+
+/* with the context of the textures current, loads still on a worker are dropped when they finish */
+void texture_stream_free(texture_stream_t *stream)
+{
+	if (stream == NULL) {
+		return;
+	}
+	for (guint i = 0; i < stream->items->len; ++i) {
+		texture_stream_item_t *item = g_ptr_array_index(stream->items, i);
+
+		glDeleteTextures(1, &item->texture);
+		if (item->busy) {
+			item->released = TRUE;
+			continue;
+		}
+		texture_stream_item_free(item);
+	}
+	g_queue_clear(&stream->loaded);
+	g_ptr_array_free(stream->items, TRUE);
+	g_free(stream);
+}
+
+/*
+ * Returns NULL and sets error when the size of filename cannot be read.
+ * Only the header is, from the baked file when there is one, the item
+ * starts out as a grey texel.
+ */
+texture_stream_item_t *texture_stream_add(texture_stream_t *stream, const gchar *filename, const texture_sampler_t *sampler, GError **error)
+{
+	texture_stream_item_t *item = g_new0(texture_stream_item_t, 1);
+	texfile_t *file = texfile_open_baked(filename);
+	gint width;
+	gint height;
+
+	if (file != NULL) {
+		const texfile_header_t *header = texfile_get_header(file);
+
+		width = header->width;
+		height = header->height;
+		item->levels = header->level_count;
+		item->internal_format = header->internal_format;
+		for (GLsizei i = item->levels; i-- > 0;) {
+			item->chain[i] = header->levels[i].size + (i + 1 < item->levels ? item->chain[i + 1] : 0);
+		}
+		texfile_close(file);
+	}
+	else if (gdk_pixbuf_get_file_info(filename, &width, &height) != NULL) {
+		item->levels = MIN(texture_storage_levels(width, height), TEXFILE_LEVEL_MAX);
+		item->internal_format = GL_RGBA8;
+		for (GLsizei i = item->levels; i-- > 0;) {
+			item->chain[i] = texture_storage_bytes(width >> i, height >> i) + (i + 1 < item->levels ? item->chain[i + 1] : 0);
+		}
+	}
+	else {
+		g_set_error(error, GDK_PIXBUF_ERROR, GDK_PIXBUF_ERROR_UNKNOWN_TYPE, "%s is not an image that can be read", filename);
+		g_free(item);
+		return NULL;
+	}
+
+	static const guint8 grey[4] = { 0x80, 0x80, 0x80, 0xff };
+
+	item->filename = g_strdup(filename);
+	item->sampler = *sampler;
+	item->size = MAX(width, height);
+	item->base = item->wanted = item->levels;
+	item->width = item->height = 1;
+	item->stream = stream;
+	item->texture = texture_stream_create(item);
+	glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 1, 1);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, grey);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	g_ptr_array_add(stream->items, item);
+
+	return item;
+}
+
+/*
+ * Asks for item to be sharp over pixels on screen this frame, the larger
+ * side of the area it covers. The level kept is the coarsest still at
+ * least that large. Call for every object before texture_stream_update().
+ */
+void texture_stream_request(texture_stream_t *stream, texture_stream_item_t *item, GLfloat pixels)
+{
+	GLsizei level = 0;
+
+	if (pixels <= 0.0f) {
+		return;
+	}
+	while (level + 1 < item->levels && (item->size >> (level + 1)) >= pixels) {
+		level++;
+	}
+	item->wanted = MIN(item->wanted, level);
+	item->used = stream->frame;
+}
+
+GLuint texture_stream_texture(const texture_stream_item_t *item)
+{
+	return item->texture;
+}
+
+/* back on the thread of the update, queues the level for the next one */
+static void texture_stream_loaded(GObject *source_object, GAsyncResult *result, gpointer user_data)
+{
+	texture_stream_item_t *item = user_data;
+	GError *error = NULL;
+	gpointer image = g_task_propagate_pointer(G_TASK(result), &error);
+
+	item->busy = FALSE;
+	if (image != NULL && item->file == NULL) {
+		item->pixbuf = image;
+	}
+	if (item->released) {
+		g_clear_error(&error);
+		texture_stream_item_free(item);
+		return;
+	}
+	if (image == NULL) {
+		g_warning("%s stays at level %d: %s", item->filename, item->base, error->message);
+		g_error_free(error);
+		item->stream->loading -= item->chain[item->load] - texture_stream_bytes(item);
+		item->loading = FALSE;
+		item->failed = TRUE;
+		return;
+	}
+	g_queue_push_tail(&item->stream->loaded, item);
+}
+
+static void texture_stream_load(texture_stream_t *stream, texture_stream_item_t *item, GLsizei level)
+{
+	GTask *task = g_task_new(NULL, NULL, texture_stream_loaded, item);
+
+	stream->loading += item->chain[level] - texture_stream_bytes(item);
+	stream->loads++;
+	item->load = level;
+	item->loading = TRUE;
+	item->busy = TRUE;
+	item->file = texfile_open_baked(item->filename);
+	if (item->file != NULL) {
+		texfile_prefetch_in_thread(task, item->file);
+	}
+	else {
+		image_decode_in_thread(task, item->filename, item->size >> item->load);
+	}
+	g_object_unref(task);
+}
+
+/* the loaded levels replace the texture of item */
+static void texture_stream_upload(texture_stream_t *stream, texture_stream_item_t *item)
+{
+	const gsize before = texture_stream_bytes(item);
+	const GLuint texture = texture_stream_create(item);
+
+	if (item->file != NULL) {
+		const texfile_header_t *header = texfile_get_header(item->file);
+
+		texfile_upload(item->file, item->size >> item->load);
+		item->width = header->levels[item->load].width;
+		item->height = header->levels[item->load].height;
+		texfile_close(item->file);
+		item->file = NULL;
+	}
+	else {
+		item->internal_format = texture_storage_format(gdk_pixbuf_get_has_alpha(item->pixbuf), NULL);
+		item->width = gdk_pixbuf_get_width(item->pixbuf);
+		item->height = gdk_pixbuf_get_height(item->pixbuf);
+		texture_storage_pixbuf(item->pixbuf);
+		g_object_unref(G_OBJECT(item->pixbuf));
+		item->pixbuf = NULL;
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glDeleteTextures(1, &item->texture);
+
+	item->texture = texture;
+	item->base = item->load;
+	item->loading = FALSE;
+	stream->loading -= texture_stream_bytes(item) - before;
+	stream->resident += texture_stream_bytes(item) - before;
+}
+
+/* the finest level of item goes, the others are copied on the GPU into a texture without it */
+static void texture_stream_shrink(texture_stream_t *stream, texture_stream_item_t *item)
+{
+	const gsize before = texture_stream_bytes(item);
+	const GLsizei width = MAX(item->width / 2, 1);
+	const GLsizei height = MAX(item->height / 2, 1);
+	const GLsizei levels = texture_storage_levels(width, height);
+	const GLuint texture = texture_stream_create(item);
+
+	glTexStorage2D(GL_TEXTURE_2D, levels, item->internal_format, width, height);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	for (GLsizei i = 0; i < levels; ++i) {
+		glCopyImageSubData(item->texture, GL_TEXTURE_2D, i + 1, 0, 0, 0, texture, GL_TEXTURE_2D, i, 0, 0, 0, MAX(width >> i, 1), MAX(height >> i, 1), 1);
+	}
+	glDeleteTextures(1, &item->texture);
+
+	item->texture = texture;
+	item->width = width;
+	item->height = height;
+	item->base++;
+	stream->resident -= before - texture_stream_bytes(item);
+	stream->evictions++;
+}
+
+/* the coarsest level eviction may take item to, its own base when it cannot lose any */
+static GLsizei texture_stream_floor(const texture_stream_t *stream, const texture_stream_item_t *item)
+{
+	const GLsizei floor = item->used == stream->frame ? item->wanted : item->levels - 1;
+
+	if (item->loading || item->base >= floor || MAX(item->width, item->height) == 1) {
+		return item->base;
+	}
+	return floor;
+}
+
+/* the item to lose a level first: not requested for the longest, or holding more than its requests need */
+static texture_stream_item_t *texture_stream_victim(texture_stream_t *stream)
+{
+	texture_stream_item_t *victim = NULL;
+
+	for (guint i = 0; i < stream->items->len; ++i) {
+		texture_stream_item_t *item = g_ptr_array_index(stream->items, i);
+
+		if (texture_stream_floor(stream, item) == item->base) {
+			continue;
+		}
+		if (victim == NULL || item->used < victim->used) {
+			victim = item;
+		}
+	}
+	return victim;
+}
+
+/* bytes under the budget once every victim has lost all it can */
+static gsize texture_stream_available(const texture_stream_t *stream)
+{
+	gsize available = stream->budget;
+	gsize taken = stream->resident + stream->loading;
+
+	for (guint i = 0; i < stream->items->len; ++i) {
+		const texture_stream_item_t *item = g_ptr_array_index(stream->items, i);
+
+		/* a placeholder holds no budget and has nothing to give back */
+		if (item->base >= item->levels) {
+			continue;
+		}
+		taken -= texture_stream_bytes(item) - item->chain[texture_stream_floor(stream, item)];
+	}
+	return available > taken ? available - taken : 0;
+}
+
+/* most levels missing first */
+static gint texture_stream_compare(gconstpointer a, gconstpointer b)
+{
+	const texture_stream_item_t *first = *(texture_stream_item_t *const *) a;
+	const texture_stream_item_t *second = *(texture_stream_item_t *const *) b;
+
+	return (second->base - second->wanted) - (first->base - first->wanted);
+}
+
+/*
+ * Once a frame, after the requests. Uploads the levels loaded since the
+ * last update for up to budget milliseconds, at least one however long it
+ * takes. Then loads what the requests need and is not resident, evicting
+ * least recently requested levels while the loads would go over the byte
+ * budget.
+ */
+void texture_stream_update(texture_stream_t *stream, gdouble budget)
+{
+	const gint64 start = g_get_monotonic_time();
+	guint uploaded = 0;
+
+	while (!g_queue_is_empty(&stream->loaded)) {
+		if (uploaded > 0 && g_get_monotonic_time() - start >= budget * 1e3) {
+			break;
+		}
+		texture_stream_upload(stream, g_queue_pop_head(&stream->loaded));
+		uploaded++;
+	}
+
+	GPtrArray *missing = g_ptr_array_new();
+
+	for (guint i = 0; i < stream->items->len; ++i) {
+		texture_stream_item_t *item = g_ptr_array_index(stream->items, i);
+
+		if (item->wanted < item->base && !item->loading && !item->failed) {
+			g_ptr_array_add(missing, item);
+		}
+	}
+	g_ptr_array_sort(missing, texture_stream_compare);
+
+	/* the finest level that fits, evicting only when that makes it fit */
+	for (guint i = 0; i < missing->len; ++i) {
+		texture_stream_item_t *item = g_ptr_array_index(missing, i);
+		const gsize available = texture_stream_available(stream);
+		GLsizei level = item->wanted;
+		texture_stream_item_t *victim;
+
+		while (level < item->base && item->chain[level] - texture_stream_bytes(item) > available) {
+			level++;
+		}
+		if (level > item->wanted) {
+			stream->deferred++;
+		}
+		if (level >= item->base) {
+			continue;
+		}
+
+		const gsize more = item->chain[level] - texture_stream_bytes(item);
+
+		while (stream->resident + stream->loading + more > stream->budget && (victim = texture_stream_victim(stream)) != NULL) {
+			texture_stream_shrink(stream, victim);
+		}
+		texture_stream_load(stream, item, level);
+	}
+	g_ptr_array_free(missing, TRUE);
+
+	stream->complete = 0;
+	for (guint i = 0; i < stream->items->len; ++i) {
+		texture_stream_item_t *item = g_ptr_array_index(stream->items, i);
+
+		stream->complete += item->base <= item->wanted;
+		item->wanted = item->levels;
+	}
+	stream->frame++;
+}
+
+void texture_stream_reset_stats(texture_stream_t *stream)
+{
+	stream->loads = 0;
+	stream->evictions = 0;
+	stream->deferred = 0;
+}
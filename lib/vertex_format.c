@@ -0,0 +1,224 @@
+#include <math.h>
+#include <string.h>
+#include <vertex_format.h>
+
+const vertex_format_t vertex_format_float = {
+	.position = VERTEX_FLOAT,
+	.normal = VERTEX_FLOAT,
+	.texture = VERTEX_FLOAT
+};
+
+/* 16 bytes per vertex instead of 32 */
+const vertex_format_t vertex_format_compact = {
+	.position = VERTEX_UNORM16,
+	.normal = VERTEX_INT_2_10_10_10,
+	.texture = VERTEX_UNORM16
+};
+
+static vertex_attrib_t vertex_attrib(mesh_attrib_t semantic, vertex_encoding_t encoding, guint8 components)
+{
+	vertex_attrib_t attrib = {
+		.semantic = semantic,
+		.size = components,
+		.encoding = encoding
+	};
+
+	switch (encoding) {
+	case VERTEX_FLOAT:
+		attrib.type = GL_FLOAT;
+		break;
+	case VERTEX_HALF:
+		attrib.type = GL_HALF_FLOAT;
+		break;
+	case VERTEX_UNORM16:
+		attrib.type = GL_UNSIGNED_SHORT;
+		attrib.normalized = GL_TRUE;
+		break;
+	case VERTEX_INT_2_10_10_10:
+		attrib.type = GL_INT_2_10_10_10_REV;
+		attrib.size = 4;
+		attrib.normalized = GL_TRUE;
+		break;
+	case VERTEX_OCTAHEDRAL:
+		attrib.type = GL_SHORT;
+		attrib.size = 2;
+		attrib.normalized = GL_TRUE;
+		break;
+	default:
+		g_warn_if_reached();
+		break;
+	}
+
+	return attrib;
+}
+
+/* attributes start 4 byte aligned, returns the attribute count */
+guint vertex_format_layout(const vertex_format_t *format, vertex_attrib_t attribs[MESH_ATTRIB_COUNT], guint32 *stride)
+{
+	guint32 offset = 0;
+
+	attribs[MESH_ATTRIB_POSITION] = vertex_attrib(MESH_ATTRIB_POSITION, format->position, 3);
+	attribs[MESH_ATTRIB_NORMAL] = vertex_attrib(MESH_ATTRIB_NORMAL, format->normal, 3);
+	attribs[MESH_ATTRIB_TEXTURE] = vertex_attrib(MESH_ATTRIB_TEXTURE, format->texture, 2);
+
+	for (guint i = 0; i < MESH_ATTRIB_COUNT; ++i) {
+		attribs[i].offset = offset;
+		offset += (vertex_attrib_bytes(&attribs[i]) + 3) & ~3u;
+	}
+	*stride = offset;
+
+	return MESH_ATTRIB_COUNT;
+}
+
+static void vertex_pack(const vertex_attrib_t *attrib, const GLfloat *value, const GLfloat *min, const GLfloat *extent, guint8 *output)
+{
+	switch (attrib->encoding) {
+	case VERTEX_FLOAT:
+		memcpy(output, value, attrib->size * sizeof (GLfloat));
+		break;
+	case VERTEX_HALF:
+		for (guint i = 0; i < attrib->size; ++i) {
+			((guint16 *) output)[i] = vertex_half(value[i]);
+		}
+		break;
+	case VERTEX_UNORM16:
+		for (guint i = 0; i < attrib->size; ++i) {
+			const GLfloat v = min != NULL ? (extent[i] > 0.0f ? (value[i] - min[i]) / extent[i] : 0.0f) : value[i];
+
+			((guint16 *) output)[i] = vertex_unorm16(v);
+		}
+		break;
+	case VERTEX_INT_2_10_10_10:
+		*(guint32 *) output = vertex_int_2_10_10_10((vec3) { value[0], value[1], value[2] });
+		break;
+	case VERTEX_OCTAHEDRAL:
+		vertex_octahedral((vec3) { value[0], value[1], value[2] }, (gint16 *) output);
+		break;
+	}
+}
+
+/* positions are stored relative to [min, max], texture coordinates as they are */
+void vertex_format_pack(const vertex_format_t *format, const mesh_t *mesh, vec3 min, vec3 max, gpointer output)
+{
+	vertex_attrib_t attribs[MESH_ATTRIB_COUNT];
+	guint32 stride;
+	const vec3 extent = vec3_sub(max, min);
+	guint8 *target = output;
+
+	vertex_format_layout(format, attribs, &stride);
+	memset(output, 0, (gsize) mesh->vertex_count * stride);
+
+	for (GLuint v = 0; v < mesh->vertex_count; ++v, target += stride) {
+		const vertex_t *vertex = &mesh->vertices[v];
+
+		vertex_pack(&attribs[MESH_ATTRIB_POSITION], &vertex->position.x, &min.x, &extent.x, target + attribs[MESH_ATTRIB_POSITION].offset);
+		vertex_pack(&attribs[MESH_ATTRIB_NORMAL], &vertex->normal.x, NULL, NULL, target + attribs[MESH_ATTRIB_NORMAL].offset);
+		vertex_pack(&attribs[MESH_ATTRIB_TEXTURE], &vertex->texture.x, NULL, NULL, target + attribs[MESH_ATTRIB_TEXTURE].offset);
+	}
+}
+
+/* maps stored positions back to object space, fold it into the model matrix */
+mat4 vertex_format_decode(const vertex_attrib_t *position, vec3 min, vec3 max)
+{
+	if (position == NULL || position->encoding != VERTEX_UNORM16) {
+		return mat4_identity();
+	}
+	return mat4_transformation(vec3_sub(max, min), min);
+}
+
+gsize vertex_attrib_bytes(const vertex_attrib_t *attrib)
+{
+	switch (attrib->type) {
+	case GL_BYTE:
+	case GL_UNSIGNED_BYTE:
+		return attrib->size;
+	case GL_SHORT:
+	case GL_UNSIGNED_SHORT:
+	case GL_HALF_FLOAT:
+		return attrib->size * 2;
+	case GL_INT:
+	case GL_UNSIGNED_INT:
+	case GL_FLOAT:
+		return attrib->size * 4;
+	case GL_INT_2_10_10_10_REV:
+	case GL_UNSIGNED_INT_2_10_10_10_REV:
+		return attrib->size == 4 ? 4 : 0;
+	}
+	return 0;
+}
+
+void vertex_attrib_pointer(const vertex_attrib_t *attrib, GLsizei stride, GLint index)
+{
+	if (index < 0) {
+		return;
+	}
+	glVertexAttribPointer(index, attrib->size, attrib->type, attrib->normalized, stride, (const GLvoid *) (gsize) attrib->offset);
+	glEnableVertexAttribArray(index);
+}
+
+/* separate attribute format, GL 4.3 or GL_ARB_vertex_attrib_binding */
+void vertex_attrib_format(const vertex_attrib_t *attrib, GLuint binding, GLint index)
+{
+	if (index < 0) {
+		return;
+	}
+	glVertexAttribFormat(index, attrib->size, attrib->type, attrib->normalized, attrib->offset);
+	glVertexAttribBinding(index, binding);
+	glEnableVertexAttribArray(index);
+}
+
+/* round to nearest, subnormals flush to zero */
+guint16 vertex_half(GLfloat value)
+{
+	guint32 bits;
+
+	memcpy(&bits, &value, sizeof bits);
+
+	const guint32 sign = (bits >> 16) & 0x8000;
+	const guint32 magnitude = bits & 0x7fffffff;
+	guint32 half = (magnitude - (112u << 23) + (1u << 12)) >> 13;
+
+	if (magnitude < (113u << 23)) {
+		half = 0;
+	}
+	if (magnitude >= (143u << 23)) {
+		half = 0x7c00;
+	}
+	if (magnitude > (255u << 23)) {
+		half = 0x7e00;
+	}
+
+	return sign | half;
+}
+
+guint16 vertex_unorm16(GLfloat value)
+{
+	return (guint16) (CLAMP(value, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+static guint32 vertex_snorm10(GLfloat value)
+{
+	return (guint32) (gint32) lrintf(CLAMP(value, -1.0f, 1.0f) * 511.0f) & 0x3ff;
+}
+
+guint32 vertex_int_2_10_10_10(vec3 normal)
+{
+	return vertex_snorm10(normal.x) | vertex_snorm10(normal.y) << 10 | vertex_snorm10(normal.z) << 20;
+}
+
+void vertex_octahedral(vec3 normal, gint16 encoded[2])
+{
+	const GLfloat norm = fabsf(normal.x) + fabsf(normal.y) + fabsf(normal.z);
+	GLfloat x = norm > 0.0f ? normal.x / norm : 0.0f;
+	GLfloat y = norm > 0.0f ? normal.y / norm : 0.0f;
+
+	if (normal.z < 0.0f) {
+		const GLfloat folded_x = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+		const GLfloat folded_y = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+
+		x = folded_x;
+		y = folded_y;
+	}
+	encoded[0] = (gint16) lrintf(CLAMP(x, -1.0f, 1.0f) * 32767.0f);
+	encoded[1] = (gint16) lrintf(CLAMP(y, -1.0f, 1.0f) * 32767.0f);
+}
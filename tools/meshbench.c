@@ -0,0 +1,272 @@
+#include <stddef.h>
+#include <glib.h>
+#include <gtk/gtk.h>
+#include <epoxy/gl.h>
+#include <glmath.h>
+#include <mesh.h>
+#include <mesh_optimize.h>
+#include <shapes.h>
+
+enum {
+	VARIANT_LIST,
+	VARIANT_STRIP,
+	VARIANT_COUNT
+};
+
+typedef struct {
+	const gchar *name;
+	GLuint vao;
+	GLuint vbo;
+	GLuint ebo;
+	GLenum mode;
+	GLsizei count;
+	GLuint triangles;
+	GLfloat acmr;
+	GLuint *queries;
+} variant_t;
+
+static gint rings = 64;
+static gint sides = 32;
+static gint grid = 16;
+static gint frames = 200;
+
+static const GOptionEntry entries[] = {
+	{ "rings", 0, 0, G_OPTION_ARG_INT, &rings, "Torus rings", "N" },
+	{ "sides", 0, 0, G_OPTION_ARG_INT, &sides, "Torus sides", "N" },
+	{ "grid", 'g', 0, G_OPTION_ARG_INT, &grid, "Draw a N x N grid of tori", "N" },
+	{ "frames", 'f', 0, G_OPTION_ARG_INT, &frames, "Timed frames per variant", "N" },
+	G_OPTION_ENTRY_NULL
+};
+
+static const gchar vertex_source[] =
+	"#version 330 core\n"
+	"layout (location = 0) in vec3 vec_position;\n"
+	"layout (location = 1) in vec3 vec_normal;\n"
+	"uniform mat4 projection;\n"
+	"uniform vec3 offset;\n"
+	"out vec3 normal;\n"
+	"void main()\n"
+	"{\n"
+	"	gl_Position = projection * vec4(vec_position + offset, 1.0);\n"
+	"	normal = vec_normal;\n"
+	"}\n";
+
+static const gchar fragment_source[] =
+	"#version 330 core\n"
+	"in vec3 normal;\n"
+	"out vec4 color;\n"
+	"void main()\n"
+	"{\n"
+	"	color = vec4(normalize(normal) * 0.5 + 0.5, 1.0);\n"
+	"}\n";
+
+static variant_t variants[VARIANT_COUNT] = {
+	{ .name = "list" },
+	{ .name = "strip" }
+};
+static GLuint program;
+static gint frame;
+
+static GLuint compile(GLenum type, const gchar *source)
+{
+	GLuint shader = glCreateShader(type);
+	GLint status;
+
+	glShaderSource(shader, 1, &source, NULL);
+	glCompileShader(shader);
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+	if (status == GL_FALSE) {
+		gchar log[1024];
+
+		glGetShaderInfoLog(shader, sizeof (log), NULL, log);
+		g_error("meshbench: shader: %s", log);
+	}
+	return shader;
+}
+
+static void variant_init(variant_t *variant, mesh_t *mesh)
+{
+	variant->mode = mesh->mode;
+	variant->count = mesh->index_count;
+	variant->triangles = mesh_triangle_count(mesh);
+	variant->acmr = mesh_cache_stats(mesh, MESH_CACHE_SIZE).acmr;
+	variant->queries = g_new(GLuint, frames);
+
+	glGenVertexArrays(1, &variant->vao);
+	glBindVertexArray(variant->vao);
+
+	glGenBuffers(1, &variant->vbo);
+	glBindBuffer(GL_ARRAY_BUFFER, variant->vbo);
+	glBufferData(GL_ARRAY_BUFFER, mesh->vertex_count * sizeof (vertex_t), mesh->vertices, GL_STATIC_DRAW);
+
+	glGenBuffers(1, &variant->ebo);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, variant->ebo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh->index_count * sizeof (GLuint), mesh->indices, GL_STATIC_DRAW);
+
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (GLvoid *) offsetof(vertex_t, position));
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof (vertex_t), (GLvoid *) offsetof(vertex_t, normal));
+	glEnableVertexAttribArray(1);
+
+	glBindVertexArray(0);
+	glGenQueries(frames, variant->queries);
+	mesh_free(mesh);
+}
+
+static void realize(GtkGLArea *area, gpointer user_data)
+{
+	mesh_t *mesh;
+	GLuint vertex;
+	GLuint fragment;
+
+	gtk_gl_area_make_current(area);
+	if (gtk_gl_area_get_error(area) != NULL) {
+		return;
+	}
+
+	vertex = compile(GL_VERTEX_SHADER, vertex_source);
+	fragment = compile(GL_FRAGMENT_SHADER, fragment_source);
+	program = glCreateProgram();
+	glAttachShader(program, vertex);
+	glAttachShader(program, fragment);
+	glLinkProgram(program);
+	glDeleteShader(vertex);
+	glDeleteShader(fragment);
+
+	mesh = shape_torus(rings, sides, 0.6f, 0.4f, GL_TRIANGLES);
+	mesh_optimize(mesh);
+	variant_init(&variants[VARIANT_LIST], mesh);
+
+	mesh = shape_torus(rings, sides, 0.6f, 0.4f, GL_TRIANGLE_STRIP);
+	variant_init(&variants[VARIANT_STRIP], mesh);
+
+	/* both variants use 32-bit indices so only the topology differs */
+	mesh_restart_enable(GL_UNSIGNED_INT);
+	glEnable(GL_DEPTH_TEST);
+}
+
+static void unrealize(GtkGLArea *area, gpointer user_data)
+{
+	gtk_gl_area_make_current(area);
+	if (gtk_gl_area_get_error(area) != NULL) {
+		return;
+	}
+
+	for (gint i = 0; i < VARIANT_COUNT; i++) {
+		glDeleteQueries(frames, variants[i].queries);
+		glDeleteBuffers(1, &variants[i].ebo);
+		glDeleteBuffers(1, &variants[i].vbo);
+		glDeleteVertexArrays(1, &variants[i].vao);
+		g_free(variants[i].queries);
+	}
+	glDeleteProgram(program);
+}
+
+static void report(void)
+{
+	const gdouble tori = (gdouble) grid * grid;
+
+	g_print("%d x %d tori, %d x %d triangles each, %d frames\n", grid, grid, rings, sides * 2, frames);
+	for (gint i = 0; i < VARIANT_COUNT; i++) {
+		const variant_t *variant = &variants[i];
+		GLuint64 total = 0;
+
+		for (gint f = 0; f < frames; f++) {
+			GLuint64 elapsed;
+
+			glGetQueryObjectui64v(variant->queries[f], GL_QUERY_RESULT, &elapsed);
+			total += elapsed;
+		}
+
+		const gdouble ms = total / 1.0e6 / frames;
+
+		g_print("%-6s %7d indices  ACMR %.3f  %8.3f ms/frame  %8.1f Mtris/s\n",
+			variant->name, variant->count, variant->acmr, ms,
+			tori * variant->triangles / (ms * 1.0e3));
+	}
+}
+
+static gboolean render(GtkGLArea *area, GdkGLContext *context, gpointer user_data)
+{
+	const GLint width = gtk_widget_get_allocated_width(GTK_WIDGET(area));
+	const GLint height = gtk_widget_get_allocated_height(GTK_WIDGET(area));
+	const gint index = frame / frames;
+	const variant_t *variant;
+	mat4 projection;
+
+	glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	if (index >= VARIANT_COUNT) {
+		return TRUE;
+	}
+	variant = &variants[index];
+
+	projection = mat4_mul(
+		mat4_perspective(radians(45.0f), (GLfloat) width / (GLfloat) height, 0.1f, 100.0f),
+		mat4_translation((vec3) { 0.0f, 0.0f, -1.2f * grid })
+	);
+
+	glUseProgram(program);
+	glUniformMatrix4fv(glGetUniformLocation(program, "projection"), 1, GL_FALSE, (const GLfloat *) &projection);
+	glBindVertexArray(variant->vao);
+
+	glBeginQuery(GL_TIME_ELAPSED, variant->queries[frame % frames]);
+	for (gint y = 0; y < grid; y++) {
+		for (gint x = 0; x < grid; x++) {
+			glUniform3f(glGetUniformLocation(program, "offset"), 2.0f * x - grid + 1.0f, 2.0f * y - grid + 1.0f, 0.0f);
+			glDrawElements(variant->mode, variant->count, GL_UNSIGNED_INT, NULL);
+		}
+	}
+	glEndQuery(GL_TIME_ELAPSED);
+
+	glBindVertexArray(0);
+	glUseProgram(0);
+
+	if (++frame == frames * VARIANT_COUNT) {
+		report();
+		g_application_quit(g_application_get_default());
+	}
+
+	return TRUE;
+}
+
+static gboolean ontick(GtkWidget *widget, GdkFrameClock *frame_clock, gpointer user_data)
+{
+	gtk_gl_area_queue_render(GTK_GL_AREA(widget));
+
+	return G_SOURCE_CONTINUE;
+}
+
+static void activate(GtkApplication *application, gpointer user_data)
+{
+	GtkWidget *window;
+	GtkWidget *drawing;
+
+	drawing = gtk_gl_area_new();
+	gtk_gl_area_set_has_depth_buffer(GTK_GL_AREA(drawing), TRUE);
+	g_signal_connect(G_OBJECT(drawing), "realize", G_CALLBACK(realize), NULL);
+	g_signal_connect(G_OBJECT(drawing), "unrealize", G_CALLBACK(unrealize), NULL);
+	g_signal_connect(G_OBJECT(drawing), "render", G_CALLBACK(render), NULL);
+	gtk_widget_add_tick_callback(drawing, ontick, NULL, NULL);
+
+	window = gtk_application_window_new(application);
+	gtk_window_set_default_size(GTK_WINDOW(window), 800, 600);
+	gtk_window_set_child(GTK_WINDOW(window), drawing);
+
+	gtk_widget_show(window);
+}
+
+int main(int argc, char *argv[])
+{
+	int result;
+	GtkApplication *application;
+
+	application = gtk_application_new(NULL, G_APPLICATION_FLAGS_NONE);
+	g_application_add_main_option_entries(G_APPLICATION(application), entries);
+	g_signal_connect(G_OBJECT(application), "activate", G_CALLBACK(activate), NULL);
+	result = g_application_run(G_APPLICATION(application), argc, argv);
+	g_object_unref(G_OBJECT(application));
+
+	return result;
+}
@@ -0,0 +1,234 @@
+#include <stdlib.h>
+#include <glib.h>
+#include <mesh.h>
+#include <meshfile.h>
+#include <mesh_optimize.h>
+#include <mesh_simplify.h>
+#include <objfile.h>
+#include <shapes.h>
+
+static gchar *shape = "torus";
+static gchar *obj = NULL;
+static gint rings = 64;
+static gint sides = 32;
+static gint segments = 32;
+static gint levels = 1;
+static gboolean info = FALSE;
+static gboolean no_optimize = FALSE;
+static gboolean compact = FALSE;
+static gboolean strip = FALSE;
+static gchar *position = NULL;
+static gchar *normal = NULL;
+static gchar *texture = NULL;
+
+static const GOptionEntry entries[] = {
+	{ "shape", 's', 0, G_OPTION_ARG_STRING, &shape, "Generated shape: torus, cylinder, icosahedron or icosphere", "SHAPE" },
+	{ "obj", 0, 0, G_OPTION_ARG_FILENAME, &obj, "Convert a Wavefront OBJ file instead of generating a shape", "FILE" },
+	{ "rings", 0, 0, G_OPTION_ARG_INT, &rings, "Torus rings", "N" },
+	{ "sides", 0, 0, G_OPTION_ARG_INT, &sides, "Torus sides", "N" },
+	{ "segments", 0, 0, G_OPTION_ARG_INT, &segments, "Cylinder segments", "N" },
+	{ "lods", 'l', 0, G_OPTION_ARG_INT, &levels, "Levels of detail, subdivisions for the icosphere, simplified by half for the others", "N" },
+	{ "strip", 0, 0, G_OPTION_ARG_NONE, &strip, "Triangle strips with primitive restart for the torus and cylinder", NULL },
+	{ "compact", 'c', 0, G_OPTION_ARG_NONE, &compact, "Quantised 16 byte vertices", NULL },
+	{ "position", 0, 0, G_OPTION_ARG_STRING, &position, "Position encoding: float, half or unorm16", "ENCODING" },
+	{ "normal", 0, 0, G_OPTION_ARG_STRING, &normal, "Normal encoding: float, int2101010 or octahedral", "ENCODING" },
+	{ "texture", 0, 0, G_OPTION_ARG_STRING, &texture, "Texture coordinate encoding: float, half or unorm16", "ENCODING" },
+	{ "no-optimize", 0, 0, G_OPTION_ARG_NONE, &no_optimize, "Keep the generated triangle and vertex order", NULL },
+	{ "info", 'i', 0, G_OPTION_ARG_NONE, &info, "Print the header of an existing mesh file", NULL },
+	G_OPTION_ENTRY_NULL
+};
+
+static const gchar *const semantic[MESH_ATTRIB_COUNT] = {
+	"position",
+	"normal",
+	"texture"
+};
+
+static const gchar *const encoding[VERTEX_ENCODING_COUNT] = {
+	[VERTEX_FLOAT] = "float",
+	[VERTEX_HALF] = "half",
+	[VERTEX_UNORM16] = "unorm16",
+	[VERTEX_INT_2_10_10_10] = "int2101010",
+	[VERTEX_OCTAHEDRAL] = "octahedral"
+};
+
+/* the packed 10 bit and octahedral encodings hold unit vectors, normals only */
+static gboolean parse_encoding(const gchar *name, mesh_attrib_t attrib, vertex_encoding_t *result, GError **error)
+{
+	if (name == NULL) {
+		return TRUE;
+	}
+	for (guint i = 0; i < G_N_ELEMENTS(encoding); ++i) {
+		if (g_strcmp0(name, encoding[i]) != 0) {
+			continue;
+		}
+		if ((i == VERTEX_INT_2_10_10_10 || i == VERTEX_OCTAHEDRAL) && attrib != MESH_ATTRIB_NORMAL) {
+			g_set_error(error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE, "encoding '%s' is for normals, not %s", name, semantic[attrib]);
+			return FALSE;
+		}
+		*result = i;
+		return TRUE;
+	}
+	g_set_error(error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE, "unknown encoding '%s'", name);
+
+	return FALSE;
+}
+
+static gboolean parse_format(const mesh_t *mesh, vertex_format_t *format, GError **error)
+{
+	*format = compact ? vertex_format_compact : vertex_format_float;
+
+	/* 16 bit normalised texture coordinates cannot repeat, fall back to half floats */
+	for (GLuint v = 0; compact && v < mesh->vertex_count; ++v) {
+		const vec2 t = mesh->vertices[v].texture;
+
+		if (t.x < 0.0f || t.x > 1.0f || t.y < 0.0f || t.y > 1.0f) {
+			format->texture = VERTEX_HALF;
+			break;
+		}
+	}
+
+	return parse_encoding(position, MESH_ATTRIB_POSITION, &format->position, error) &&
+		parse_encoding(normal, MESH_ATTRIB_NORMAL, &format->normal, error) &&
+		parse_encoding(texture, MESH_ATTRIB_TEXTURE, &format->texture, error);
+}
+
+static void print_header(const gchar *filename, const meshfile_header_t *header)
+{
+	g_print("%s: version %u, mode 0x%04x\n", filename, header->version, header->mode);
+	for (guint32 i = 0; i < header->attrib_count; ++i) {
+		const vertex_attrib_t *attrib = &header->attribs[i];
+
+		g_print("  %-10s %-10s %u x 0x%04x%s at %u\n", semantic[attrib->semantic], encoding[attrib->encoding], attrib->size, attrib->type, attrib->normalized ? " normalized" : "", attrib->offset);
+	}
+	g_print("  vertices   %u x %u bytes at %" G_GUINT64_FORMAT "\n", header->vertex_count, header->vertex_stride, header->vertex_offset);
+	g_print("  indices    %u x 0x%04x at %" G_GUINT64_FORMAT "\n", header->index_count, header->index_type, header->index_offset);
+	g_print("  bounds     (%.3f, %.3f, %.3f) - (%.3f, %.3f, %.3f)\n",
+		header->bounds_min[0], header->bounds_min[1], header->bounds_min[2],
+		header->bounds_max[0], header->bounds_max[1], header->bounds_max[2]);
+	for (guint32 i = 0; i < header->lod_count; ++i) {
+		const mesh_lod_t *lod = &header->lods[i];
+
+		g_print("  lod %u      %u indices at %u, error %g\n", i, lod->index_count, lod->index_offset, lod->error);
+	}
+}
+
+static void optimize(mesh_t *mesh, const mesh_lod_t *lods, GLuint lod_count)
+{
+	const mesh_cache_stats_t before = mesh_cache_stats(mesh, MESH_CACHE_SIZE);
+
+	if (lod_count > 1) {
+		mesh_optimize_lods(mesh, lods, lod_count);
+	}
+	else {
+		mesh_optimize(mesh);
+	}
+
+	const mesh_cache_stats_t after = mesh_cache_stats(mesh, MESH_CACHE_SIZE);
+
+	g_print("ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n", before.acmr, after.acmr, before.atvr, after.atvr);
+}
+
+/* every material of the OBJ ends up in one mesh, mesh files carry no materials */
+static mesh_t *load_obj(GError **error)
+{
+	objfile_t *file = objfile_load(obj, error);
+
+	if (file == NULL) {
+		return NULL;
+	}
+	g_print("%s: %.1f MB in %.3f s, %.1f MB/s\n", obj, file->bytes / 1e6, file->seconds, file->bytes / 1e6 / MAX(file->seconds, 1e-6));
+
+	mesh_t *mesh = objfile_merge(file);
+
+	objfile_free(file);
+
+	return mesh;
+}
+
+static mesh_t *generate_shape(GError **error)
+{
+	if (obj != NULL) {
+		return load_obj(error);
+	}
+	if (g_strcmp0(shape, "torus") == 0) {
+		return shape_torus(rings, sides, 0.6f, 0.4f, strip ? GL_TRIANGLE_STRIP : GL_TRIANGLES);
+	}
+	if (g_strcmp0(shape, "cylinder") == 0) {
+		return shape_cylinder(segments, strip ? GL_TRIANGLE_STRIP : GL_TRIANGLES);
+	}
+	if (g_strcmp0(shape, "icosahedron") == 0) {
+		return shape_icosahedron();
+	}
+	g_set_error(error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE, "unknown shape '%s'", shape);
+
+	return NULL;
+}
+
+static mesh_t *generate(mesh_lod_t *lods, GLuint *lod_count, GError **error)
+{
+	if (levels < 1 || levels > MESH_LOD_MAX) {
+		g_set_error(error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE, "between 1 and %d levels of detail expected", MESH_LOD_MAX);
+		return NULL;
+	}
+	if (g_strcmp0(shape, "icosphere") == 0) {
+		*lod_count = levels;
+		return shape_icosphere(levels, lods);
+	}
+
+	mesh_t *mesh = generate_shape(error);
+
+	if (mesh == NULL || levels == 1) {
+		*lod_count = 1;
+		lods[0] = (mesh_lod_t) { 0, mesh != NULL ? mesh->index_count : 0, 0.0f };
+		return mesh;
+	}
+	if (mesh->mode != GL_TRIANGLES) {
+		g_set_error_literal(error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE, "levels of detail need triangle lists");
+		mesh_free(mesh);
+		return NULL;
+	}
+	*lod_count = mesh_simplify_lods(mesh, levels, MESH_SIMPLIFY_RATIO, lods);
+
+	return mesh;
+}
+
+int main(int argc, char *argv[])
+{
+	GError *error = NULL;
+	GOptionContext *context = g_option_context_new("FILE - write or inspect binary mesh files");
+
+	g_option_context_add_main_entries(context, entries, NULL);
+	if (g_option_context_parse(context, &argc, &argv, &error) == FALSE || argc != 2) {
+		g_printerr("%s\n", error != NULL ? error->message : "exactly one FILE expected");
+		return EXIT_FAILURE;
+	}
+	g_option_context_free(context);
+
+	if (info == FALSE) {
+		mesh_lod_t lods[MESH_LOD_MAX];
+		GLuint lod_count;
+		mesh_t *mesh = generate(lods, &lod_count, &error);
+		vertex_format_t format;
+
+		if (mesh != NULL && no_optimize == FALSE) {
+			optimize(mesh, lods, lod_count);
+		}
+		if (mesh == NULL || parse_format(mesh, &format, &error) == FALSE || meshfile_write(argv[1], mesh, lods, lod_count, &format, &error) == FALSE) {
+			g_printerr("%s\n", error->message);
+			return EXIT_FAILURE;
+		}
+		mesh_free(mesh);
+	}
+
+	meshfile_t *file = meshfile_open(argv[1], &error);
+
+	if (file == NULL) {
+		g_printerr("%s\n", error->message);
+		return EXIT_FAILURE;
+	}
+	print_header(argv[1], meshfile_get_header(file));
+	meshfile_close(file);
+
+	return EXIT_SUCCESS;
+}
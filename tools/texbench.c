@@ -0,0 +1,252 @@
+#include <math.h>
+#include <glib.h>
+#include <gtk/gtk.h>
+#include <epoxy/gl.h>
+#include <texture_cache.h>
+
+/* every sampler a file can be cached with here, so one file makes up to this many textures */
+#define TEXBENCH_SAMPLERS 16
+
+static gint count = 48;
+static gboolean direct = FALSE;
+static gboolean baked = FALSE;
+static gdouble budget = TEXTURE_UPLOAD_BUDGET;
+static gint max_size = 0;
+
+static const GOptionEntry entries[] = {
+	{ "count", 'c', 0, G_OPTION_ARG_INT, &count, "Textures to stream, up to 96", "N" },
+	{ "direct", 'd', 0, G_OPTION_ARG_NONE, &direct, "Upload from client memory, without the pixel buffer pool", NULL },
+	{ "baked", 'k', 0, G_OPTION_ARG_NONE, &baked, "Map the files texconv baked instead of decoding every image", NULL },
+	{ "budget", 'b', 0, G_OPTION_ARG_DOUBLE, &budget, "Upload milliseconds per frame", "MS" },
+	{ "max-size", 'm', 0, G_OPTION_ARG_INT, &max_size, "Decode every image reduced to fit SIZE x SIZE, 0 for full size", "SIZE" },
+	G_OPTION_ENTRY_NULL
+};
+
+static const gchar *filenames[] = {
+	"container.jpg",
+	"awesomeface.png",
+	"container.png",
+	"container2.png",
+	"container_specular.png",
+	"container2_specular.png"
+};
+
+static const GLint wraps[] = { GL_REPEAT, GL_MIRRORED_REPEAT, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_BORDER };
+
+static const gchar vertex_source[] =
+	"#version 330 core\n"
+	"layout (location = 0) in vec2 vec_position;\n"
+	"uniform vec4 rectangle;\n"
+	"out vec2 coordinate;\n"
+	"void main()\n"
+	"{\n"
+	"	gl_Position = vec4(rectangle.xy + vec_position * rectangle.zw, 0.0, 1.0);\n"
+	"	coordinate = vec_position;\n"
+	"}\n";
+
+static const gchar fragment_source[] =
+	"#version 330 core\n"
+	"in vec2 coordinate;\n"
+	"uniform sampler2D image;\n"
+	"out vec4 color;\n"
+	"void main()\n"
+	"{\n"
+	"	color = texture(image, coordinate);\n"
+	"}\n";
+
+static const GLfloat quad[] = {
+	0.0f, 0.0f,
+	1.0f, 0.0f,
+	0.0f, 1.0f,
+	1.0f, 1.0f
+};
+
+static GLuint program;
+static GLuint vao;
+static GLuint vbo;
+static GLuint *textures;
+static GArray *times;		/* milliseconds of CPU time of each render while streaming */
+static gint64 start;
+
+static GLuint compile(GLenum type, const gchar *source)
+{
+	GLuint shader = glCreateShader(type);
+	GLint status;
+
+	glShaderSource(shader, 1, &source, NULL);
+	glCompileShader(shader);
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+	if (status == GL_FALSE) {
+		gchar log[1024];
+
+		glGetShaderInfoLog(shader, sizeof (log), NULL, log);
+		g_error("texbench: shader: %s", log);
+	}
+	return shader;
+}
+
+static void realize(GtkGLArea *area, gpointer user_data)
+{
+	GLuint vertex;
+	GLuint fragment;
+
+	gtk_gl_area_make_current(area);
+	if (gtk_gl_area_get_error(area) != NULL) {
+		return;
+	}
+
+	vertex = compile(GL_VERTEX_SHADER, vertex_source);
+	fragment = compile(GL_FRAGMENT_SHADER, fragment_source);
+	program = glCreateProgram();
+	glAttachShader(program, vertex);
+	glAttachShader(program, fragment);
+	glLinkProgram(program);
+	glDeleteShader(vertex);
+	glDeleteShader(fragment);
+
+	glGenVertexArrays(1, &vao);
+	glBindVertexArray(vao);
+	glGenBuffers(1, &vbo);
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferData(GL_ARRAY_BUFFER, sizeof (quad), quad, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof (GLfloat), NULL);
+	glEnableVertexAttribArray(0);
+	glBindVertexArray(0);
+
+	/* the sampler is part of the key, so each variation decodes and uploads the file again */
+	texture_cache_use_pbo(!direct);
+	texture_cache_use_baked(baked);
+	texture_cache_max_size(max_size);
+	textures = g_new(GLuint, count);
+	for (gint i = 0; i < count; i++) {
+		const gint variation = i / G_N_ELEMENTS(filenames);
+		const texture_sampler_t sampler = {
+			wraps[variation % G_N_ELEMENTS(wraps)],
+			wraps[variation / G_N_ELEMENTS(wraps)],
+			GL_LINEAR_MIPMAP_LINEAR,
+			GL_LINEAR
+		};
+
+		textures[i] = texture_cache_acquire_async(filenames[i % G_N_ELEMENTS(filenames)], &sampler, texture_cache_ready_queue_render, area);
+	}
+	times = g_array_new(FALSE, FALSE, sizeof (gdouble));
+	start = g_get_monotonic_time();
+}
+
+static void unrealize(GtkGLArea *area, gpointer user_data)
+{
+	gtk_gl_area_make_current(area);
+	if (gtk_gl_area_get_error(area) != NULL) {
+		return;
+	}
+
+	for (gint i = 0; i < count; i++) {
+		texture_cache_release(textures[i]);
+	}
+	g_free(textures);
+	g_array_free(times, TRUE);
+	glDeleteBuffers(1, &vbo);
+	glDeleteVertexArrays(1, &vao);
+	glDeleteProgram(program);
+}
+
+static gint compare(gconstpointer a, gconstpointer b)
+{
+	const gdouble x = *(const gdouble *) a;
+	const gdouble y = *(const gdouble *) b;
+
+	return x < y ? -1 : x > y;
+}
+
+static gdouble percentile(gdouble p)
+{
+	const guint index = MIN(times->len - 1, (guint) (p * times->len));
+
+	return g_array_index(times, gdouble, index);
+}
+
+static void report(gint64 elapsed)
+{
+	g_array_sort(times, compare);
+
+	g_print("%d textures, %s uploads, %.1f ms budget, %s, %s\n", count, direct ? "direct" : "pixel buffer", budget, max_size > 0 ? "reduced" : "full size", baked ? "baked" : "decoded");
+	g_print("%u frames in %.1f ms\n", times->len, elapsed / 1.0e3);
+	g_print("render p50 %.3f ms  p90 %.3f ms  p99 %.3f ms  max %.3f ms\n",
+		percentile(0.5), percentile(0.9), percentile(0.99), percentile(1.0));
+}
+
+static gboolean render(GtkGLArea *area, GdkGLContext *context, gpointer user_data)
+{
+	const gint64 begin = g_get_monotonic_time();
+	texture_cache_upload(budget);
+	const gint columns = (gint) ceil(sqrt(count));
+	const GLfloat size = 2.0f / columns;
+
+	glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT);
+
+	glUseProgram(program);
+	glBindVertexArray(vao);
+	glActiveTexture(GL_TEXTURE0);
+	for (gint i = 0; i < count; i++) {
+		glUniform4f(glGetUniformLocation(program, "rectangle"), -1.0f + size * (i % columns), 1.0f - size * (i / columns + 1), size, size);
+		glBindTexture(GL_TEXTURE_2D, textures[i]);
+		glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glBindVertexArray(0);
+	glUseProgram(0);
+
+	/* what a frame costs the render loop is the time until the driver has taken every command */
+	glFlush();
+	const gdouble ms = (g_get_monotonic_time() - begin) / 1.0e3;
+
+	g_array_append_val(times, ms);
+	if (texture_cache_pending() == 0) {
+		report(g_get_monotonic_time() - start);
+		g_application_quit(g_application_get_default());
+	}
+
+	return TRUE;
+}
+
+static gboolean ontick(GtkWidget *widget, GdkFrameClock *frame_clock, gpointer user_data)
+{
+	gtk_gl_area_queue_render(GTK_GL_AREA(widget));
+
+	return G_SOURCE_CONTINUE;
+}
+
+static void activate(GtkApplication *application, gpointer user_data)
+{
+	GtkWidget *window;
+	GtkWidget *drawing;
+
+	count = CLAMP(count, 1, (gint) G_N_ELEMENTS(filenames) * TEXBENCH_SAMPLERS);
+
+	drawing = gtk_gl_area_new();
+	g_signal_connect(G_OBJECT(drawing), "realize", G_CALLBACK(realize), NULL);
+	g_signal_connect(G_OBJECT(drawing), "unrealize", G_CALLBACK(unrealize), NULL);
+	g_signal_connect(G_OBJECT(drawing), "render", G_CALLBACK(render), NULL);
+	gtk_widget_add_tick_callback(drawing, ontick, NULL, NULL);
+
+	window = gtk_application_window_new(application);
+	gtk_window_set_default_size(GTK_WINDOW(window), 800, 600);
+	gtk_window_set_child(GTK_WINDOW(window), drawing);
+
+	gtk_widget_show(window);
+}
+
+int main(int argc, char *argv[])
+{
+	int result;
+	GtkApplication *application;
+
+	application = gtk_application_new(NULL, G_APPLICATION_FLAGS_NONE);
+	g_application_add_main_option_entries(G_APPLICATION(application), entries);
+	g_signal_connect(G_OBJECT(application), "activate", G_CALLBACK(activate), NULL);
+	result = g_application_run(G_APPLICATION(application), argc, argv);
+	g_object_unref(G_OBJECT(application));
+
+	return result;
+}
@@ -0,0 +1,98 @@
+#include <stdlib.h>
+#include <glib.h>
+#include <gdk-pixbuf/gdk-pixbuf.h>
+#include <texfile.h>
+#include <texture_compress.h>
+#include <texture_storage.h>
+
+static gchar *format = "auto";
+static gboolean linear = FALSE;
+static gboolean info = FALSE;
+
+static const GOptionEntry entries[] = {
+	{ "format", 'f', 0, G_OPTION_ARG_STRING, &format, "Texel format: auto (bc1, or bc3 with alpha), bc1, bc3, bc5 or rgb (uncompressed)", "FORMAT" },
+	{ "linear", 'l', 0, G_OPTION_ARG_NONE, &linear, "Filter the texels as they are, for data such as specular maps", NULL },
+	{ "info", 'i', 0, G_OPTION_ARG_NONE, &info, "Print the header of an existing texture file", NULL },
+	G_OPTION_ENTRY_NULL
+};
+
+static const struct {
+	const gchar *name;
+	GLenum internal_format;
+} formats[] = {
+	{ "rgb", 0 },
+	{ "bc1", GL_COMPRESSED_RGB_S3TC_DXT1_EXT },
+	{ "bc3", GL_COMPRESSED_RGBA_S3TC_DXT5_EXT },
+	{ "bc5", GL_COMPRESSED_RG_RGTC2 }
+};
+
+static gboolean parse_format(GdkPixbuf *pixbuf, GLenum *internal_format, GError **error)
+{
+	if (g_strcmp0(format, "auto") == 0) {
+		*internal_format = gdk_pixbuf_get_has_alpha(pixbuf) ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+		return TRUE;
+	}
+	for (guint i = 0; i < G_N_ELEMENTS(formats); ++i) {
+		if (g_strcmp0(format, formats[i].name) == 0) {
+			*internal_format = formats[i].internal_format;
+			return TRUE;
+		}
+	}
+	g_set_error(error, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE, "unknown format '%s'", format);
+
+	return FALSE;
+}
+
+static void print_header(const gchar *filename, const texfile_header_t *header)
+{
+	g_print("%s: version %u, %u x %u, format 0x%04x%s\n", filename, header->version, header->width, header->height, header->internal_format, header->flags & TEXFILE_FLAG_LINEAR ? ", linear" : "");
+	guint64 total = 0;
+	guint64 uncompressed = 0;
+
+	for (guint32 i = 0; i < header->level_count; ++i) {
+		const texfile_level_t *level = &header->levels[i];
+
+		g_print("  level %-2u %4u x %-4u %8" G_GUINT64_FORMAT " bytes at %" G_GUINT64_FORMAT "\n", i, level->width, level->height, level->size, level->offset);
+		total += level->size;
+		uncompressed += texture_storage_bytes(level->width, level->height);
+	}
+	g_print("  %" G_GUINT64_FORMAT " bytes, %.1fx smaller than RGBA8\n", total, (gdouble) uncompressed / total);
+}
+
+int main(int argc, char *argv[])
+{
+	GError *error = NULL;
+	GOptionContext *context = g_option_context_new("[IMAGE] FILE - bake or inspect mipmapped texture files");
+
+	g_option_context_add_main_entries(context, entries, NULL);
+	if (g_option_context_parse(context, &argc, &argv, &error) == FALSE || argc != (info ? 2 : 3)) {
+		g_printerr("%s\n", error != NULL ? error->message : info ? "exactly one FILE expected" : "an IMAGE and a FILE expected");
+		return EXIT_FAILURE;
+	}
+	g_option_context_free(context);
+
+	const gchar *filename = argv[argc - 1];
+
+	if (info == FALSE) {
+		GdkPixbuf *pixbuf = gdk_pixbuf_new_from_file(argv[1], &error);
+		GLenum internal_format;
+
+		if (pixbuf == NULL || parse_format(pixbuf, &internal_format, &error) == FALSE ||
+		    texfile_write(filename, pixbuf, internal_format, linear ? TEXFILE_FLAG_LINEAR : 0, &error) == FALSE) {
+			g_printerr("%s\n", error->message);
+			return EXIT_FAILURE;
+		}
+		g_object_unref(G_OBJECT(pixbuf));
+	}
+
+	texfile_t *file = texfile_open(filename, &error);
+
+	if (file == NULL) {
+		g_printerr("%s\n", error->message);
+		return EXIT_FAILURE;
+	}
+	print_header(filename, texfile_get_header(file));
+	texfile_close(file);
+
+	return EXIT_SUCCESS;
+}